@@ -27,7 +27,10 @@
 
 // Phase 2: Application core layer
 #include "rainmgrapp.h"
+#include "startup_profiler.h"
+#include "benchmark_mode.h"
 using RainmeterManager::App::RAINMGRApp;
+using RainmeterManager::App::StartupProfiler;
 
 // Global application constants
 constexpr int EMERGENCY_EXIT_CODE = -1;
@@ -54,6 +57,13 @@ struct CLIOptions {
     std::vector<std::wstring> allowedOrigins;
     bool dashboardOnly = false;
     bool showHelp = false;
+
+    // Headless synthetic-workload benchmark (see benchmark_mode.h)
+    bool benchmark = false;
+    int benchmarkWidgets = 50;
+    int benchmarkDurationSec = 30;
+    int benchmarkIntervalMs = 100;
+    std::vector<std::wstring> benchmarkTypes;
 };
 
 static LogLevel ParseLogLevel(const std::wstring& level) {
@@ -94,6 +104,18 @@ static CLIOptions ParseCLI() {
             if (start < val.size()) opts.allowedOrigins.push_back(val.substr(start));
         }
         else if (key == L"--dashboard-only") opts.dashboardOnly = true;
+        else if (key == L"--benchmark") opts.benchmark = true;
+        else if (key == L"--benchmark-widgets" && !val.empty()) opts.benchmarkWidgets = _wtoi(val.c_str());
+        else if (key == L"--benchmark-duration" && !val.empty()) opts.benchmarkDurationSec = _wtoi(val.c_str());
+        else if (key == L"--benchmark-interval" && !val.empty()) opts.benchmarkIntervalMs = _wtoi(val.c_str());
+        else if (key == L"--benchmark-types" && !val.empty()) {
+            size_t start = 0, pos = 0;
+            while ((pos = val.find(L',', start)) != std::wstring::npos) {
+                opts.benchmarkTypes.push_back(val.substr(start, pos - start));
+                start = pos + 1;
+            }
+            if (start < val.size()) opts.benchmarkTypes.push_back(val.substr(start));
+        }
         else if (key == L"--help" || key == L"-h" || key == L"/h" || key == L"/?") opts.showHelp = true;
     }
     LocalFree(argv);
@@ -144,19 +166,29 @@ int WINAPI wWinMain(
     _In_ int nShowCmd
 ) {
     UNREFERENCED_PARAMETER(hPrevInstance);
-    
+
+    // Crash watchdog helper invocation: run the dump loop and exit
+    // before any application initialization
+    if (lpCmdLine && wcsstr(lpCmdLine, L"--crash-watchdog")) {
+        return RainmeterManager::Crash::CrashHandler::WatchdogMain(lpCmdLine);
+    }
+
     // Store global references for crash handling
     g_hInstance = hInstance;
     g_commandLine = lpCmdLine ? lpCmdLine : L"";
     
     // Start application bootstrap timer
     auto startupTimer = std::chrono::high_resolution_clock::now();
-    
+
+    // QPC-based phase trace; persisted at ready-state (Phase 9)
+    auto& profiler = StartupProfiler::GetInstance();
+
     try {
         //=====================================================================
         // Phase 1: Critical System Initialization
         //=====================================================================
-        
+        profiler.BeginPhase("system-init");
+
         // Install crash handler with vectored exceptions (Phase 1)
         RainmeterManager::Crash::CrashHandler::Install();
         
@@ -193,10 +225,13 @@ int WINAPI wWinMain(
             return INITIALIZATION_FAILURE_CODE;
         }
         
+        profiler.EndPhase("system-init");
+
         //=====================================================================
-        // Phase 2: Logging Infrastructure 
+        // Phase 2: Logging Infrastructure
         //=====================================================================
-        
+        profiler.BeginPhase("logging");
+
         // Initialize enterprise logging system first
         LogRotationConfig logConfig;
         logConfig.maxFileSize = 10 * 1024 * 1024;  // 10MB
@@ -238,10 +273,13 @@ int WINAPI wWinMain(
         LOG_INFO("Command Line: " + std::string(lpCmdLine ? 
                  std::string(lpCmdLine, lpCmdLine + wcslen(lpCmdLine)) : ""));
         
+        profiler.EndPhase("logging");
+
         //=====================================================================
         // Phase 3: Security Framework Initialization
         //=====================================================================
-        
+        profiler.BeginPhase("security");
+
         LOG_INFO("Initializing security framework...");
         
 // Initialize crypto providers first
@@ -274,18 +312,21 @@ int WINAPI wWinMain(
         }
         
         LOG_INFO("Security framework initialization completed");
-        
+        profiler.EndPhase("security");
+
         //=====================================================================
         // Phase 4: Application Instance Creation (Phase 2 Implementation)
         //=====================================================================
-        
+        profiler.BeginPhase("app-init");
+
         LOG_INFO("Creating RAINMGRApp singleton instance...");
         
         // Phase 2: Get the application singleton instance
         auto& app = RAINMGRApp::GetInstance(hInstance);
         
-        // Initialize the application core layer
-        if (!app.Initialize()) {
+        // Initialize the application core layer (no main window when
+        // running the headless benchmark)
+        if (!app.Initialize(cli.benchmark)) {
             LOG_ERROR("Failed to initialize RAINMGRApp singleton");
             ShowCriticalErrorDialog(
                 L"Application Initialization Failed",
@@ -295,7 +336,8 @@ int WINAPI wWinMain(
         }
         
         LOG_INFO("RAINMGRApp singleton created and initialized successfully");
-        
+        profiler.EndPhase("app-init");
+
         //=====================================================================
         // Phase 5: Service Registration (Future Implementation)
         //=====================================================================
@@ -324,11 +366,31 @@ int WINAPI wWinMain(
         // }
         
         LOG_INFO("Dependency validation: PLACEHOLDER");
-        
+
+        //=====================================================================
+        // Benchmark Mode: headless synthetic-workload run
+        //=====================================================================
+        if (cli.benchmark) {
+            // No UI phases and no message loop: drive the widget
+            // pipeline for a fixed duration and report
+            RainmeterManager::App::BenchmarkConfig benchConfig;
+            benchConfig.widgetCount = static_cast<size_t>(cli.benchmarkWidgets);
+            benchConfig.durationSeconds = static_cast<DWORD>(cli.benchmarkDurationSec);
+            benchConfig.updateIntervalMs = static_cast<UINT>(cli.benchmarkIntervalMs);
+            benchConfig.types = cli.benchmarkTypes;
+
+            int benchExitCode = RainmeterManager::App::BenchmarkMode::Run(benchConfig);
+
+            Security::Cleanup();
+            CleanupAndExit(benchExitCode);
+            return benchExitCode;
+        }
+
         //=====================================================================
         // Phase 7: UI Initialization & Splash Screen
         //=====================================================================
-        
+        profiler.BeginPhase("ui-init");
+
         LOG_INFO("Initializing UI framework...");
         
         // Show cinematic splash (disabled for now)
@@ -362,10 +424,13 @@ int WINAPI wWinMain(
             }
         }
         
+        profiler.EndPhase("ui-init");
+
         //=====================================================================
-        // Phase 8: Widget System Initialization  
+        // Phase 8: Widget System Initialization
         //=====================================================================
-        
+        profiler.BeginPhase("widget-system");
+
         LOG_INFO("Initializing widget system...");
         
         // TODO: Implement widget manager
@@ -374,14 +439,18 @@ int WINAPI wWinMain(
         // - Register widget templates
         
         LOG_INFO("Widget system initialization: PLACEHOLDER");
-        
+        profiler.EndPhase("widget-system");
+
         //=====================================================================
         // Phase 9: Application Ready - Start Message Loop
         //=====================================================================
-        
+
         auto endTime = std::chrono::high_resolution_clock::now();
         auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startupTimer);
-        
+
+        // Persist the phase trace and rolling per-machine history
+        profiler.MarkReady();
+
         LOG_INFO("=== Bootstrap Complete in " + std::to_string(duration.count()) + "ms ===");
         LOG_INFO("Phase 2: Starting RAINMGRApp main loop...");
         
@@ -456,6 +525,11 @@ static void ShowCLIHelp() {
         L"  --dashboard-only          Show dashboard only (no widget suite)\n"
         L"  --no-web                  Disable web content\n"
         L"  --allow-origin=<host>     Allow web origin (repeatable)\n"
+        L"  --benchmark               Headless synthetic-workload benchmark\n"
+        L"  --benchmark-widgets=<n>   Benchmark population size (default 50)\n"
+        L"  --benchmark-duration=<s>  Benchmark run length in seconds (default 30)\n"
+        L"  --benchmark-interval=<ms> Benchmark widget update interval (default 100)\n"
+        L"  --benchmark-types=<a,b>   Widget types to cycle (default: all registered)\n"
         L"  --help, -h                Show this help\n\n"
         L"Examples:\n"
         L"  RainmeterManager.exe --log-level=info --dashboard-only\n"
@@ -473,6 +547,16 @@ static bool ValidateCLIOptions(const CLIOptions& opts, std::wstring& error) {
         error = L"--allow-origin can only be used when web is enabled (omit --no-web).";
         return false;
     }
+    if (opts.benchmark && opts.dashboardOnly) {
+        error = L"--benchmark runs headless and cannot be combined with --dashboard-only.";
+        return false;
+    }
+    if (opts.benchmark &&
+        (opts.benchmarkWidgets <= 0 || opts.benchmarkDurationSec <= 0 ||
+         opts.benchmarkIntervalMs <= 0)) {
+        error = L"--benchmark-widgets, --benchmark-duration and --benchmark-interval must be positive.";
+        return false;
+    }
     return true;
 }
 
@@ -1,4 +1,5 @@
 #include "rainmgrapp.h"
+#include "startup_graph.h"
 #include "../core/error_handling.h"
 #include "../core/security_adapter.h"
 #include "../core/logger_adapter.h"
@@ -74,7 +75,7 @@ void RAINMGRApp::DestroyInstance() {
     instance_.reset();
 }
 
-bool RAINMGRApp::Initialize() {
+bool RAINMGRApp::Initialize(bool headless) {
     try {
         LOG_INFO("RAINMGRApp::Initialize - entry");
         LOG_INFO("RAINMGRApp::Initialize - starting...");
@@ -95,36 +96,53 @@ bool RAINMGRApp::Initialize() {
         }
         LOG_INFO("RAINMGRApp::Initialize - after InitializeLogging");
         
-        // Initialize security framework
-        RawTrace("Init: before InitializeSecurity");
-        LOG_INFO("RAINMGRApp::Initialize - before InitializeSecurity");
-        if (!InitializeSecurity()) {
-            HandleFatalError(L"Failed to initialize security framework");
+        // Paths and logging are up; remaining subsystems initialize as
+        // a dependency graph so independent branches (security/DLL
+        // validation vs. service locator setup) overlap instead of
+        // serializing on each other's I/O. Window creation stays on
+        // this thread after the graph completes.
+        RawTrace("Init: before startup graph");
+        LOG_INFO("RAINMGRApp::Initialize - before startup graph");
+
+        StartupGraph startupGraph;
+        startupGraph.AddTask(L"security", {}, [this] {
+            return InitializeSecurity();
+        });
+        startupGraph.AddTask(L"service-locator", {}, [this] {
+            serviceLocator_ = std::make_unique<Core::ServiceLocator>();
+            return serviceLocator_ != nullptr;
+        });
+        startupGraph.AddTask(L"services", {L"service-locator", L"security"}, [this] {
+            return InitializeServices();
+        });
+        startupGraph.SetProgressCallback([this](size_t completed, size_t total,
+                                                const std::wstring& taskName) {
+            // Drives splash progress when the cinematic splash is
+            // re-enabled; for now the completion order goes to the log
+            LogApplicationEvent(L"Startup task completed (" +
+                                std::to_wstring(completed) + L"/" +
+                                std::to_wstring(total) + L"): " + taskName);
+        });
+
+        if (!startupGraph.Run()) {
+            HandleFatalError(L"Failed to initialize application subsystems");
             return false;
         }
-        LOG_INFO("RAINMGRApp::Initialize - after InitializeSecurity");
-        RawTrace("Init: after InitializeSecurity");
+        LOG_INFO("RAINMGRApp::Initialize - after startup graph");
+        RawTrace("Init: after startup graph");
         
-        // Create service locator
-        LOG_INFO("RAINMGRApp::Initialize - before ServiceLocator creation");
-        serviceLocator_ = std::make_unique<Core::ServiceLocator>();
-        LOG_INFO("RAINMGRApp::Initialize - after ServiceLocator creation");
-        
-        // Initialize core services
-        LOG_INFO("RAINMGRApp::Initialize - before InitializeServices");
-        if (!InitializeServices()) {
-            HandleFatalError(L"Failed to initialize core services");
-            return false;
-        }
-        LOG_INFO("RAINMGRApp::Initialize - after InitializeServices");
-        
-        // Create main window (hidden); we'll show it after splash completes
-        LOG_INFO("RAINMGRApp::Initialize - before CreateMainWindow");
-        if (!CreateMainWindow()) {
-            HandleFatalError(L"Failed to create main application window");
-            return false;
+        // Create main window (hidden); we'll show it after splash completes.
+        // Headless runs (--benchmark) skip window creation entirely.
+        if (headless) {
+            LOG_INFO("RAINMGRApp::Initialize - headless, skipping CreateMainWindow");
+        } else {
+            LOG_INFO("RAINMGRApp::Initialize - before CreateMainWindow");
+            if (!CreateMainWindow()) {
+                HandleFatalError(L"Failed to create main application window");
+                return false;
+            }
+            LOG_INFO("RAINMGRApp::Initialize - after CreateMainWindow");
         }
-        LOG_INFO("RAINMGRApp::Initialize - after CreateMainWindow");
 
         // Display cinematic splash while completing background initialization (temporarily disabled for stability)
         bool useCinematicSplash = false;
@@ -61,8 +61,10 @@ public:
     
     ~RAINMGRApp();
 
-    // Application lifecycle management
-    bool Initialize();
+    // Application lifecycle management. Headless initialization boots
+    // every subsystem except the main window — used by --benchmark and
+    // other windowless runs.
+    bool Initialize(bool headless = false);
     int Run();
     void RequestShutdown();
     void Shutdown();
@@ -0,0 +1,154 @@
+#include "startup_graph.h"
+#include "../core/logger.h"
+
+namespace RainmeterManager {
+namespace App {
+
+void StartupGraph::AddTask(const std::wstring& name, std::vector<std::wstring> dependencies,
+                           TaskFunc work) {
+    std::lock_guard<std::mutex> lock(graphMutex_);
+    Task task;
+    task.name = name;
+    task.dependencies = std::move(dependencies);
+    task.work = std::move(work);
+    task.pendingDeps = task.dependencies.size();
+    tasks_.push_back(std::move(task));
+}
+
+void StartupGraph::SetProgressCallback(ProgressCallback callback) {
+    std::lock_guard<std::mutex> lock(graphMutex_);
+    progressCallback_ = std::move(callback);
+}
+
+bool StartupGraph::Run(size_t workerCount) {
+    {
+        std::lock_guard<std::mutex> lock(graphMutex_);
+        if (tasks_.empty()) {
+            return true;
+        }
+        finishedCount_ = 0;
+        anyFailed_ = false;
+        stopWorkers_ = false;
+        ScheduleReadyTasks();
+    }
+
+    if (workerCount == 0) {
+        workerCount = 1;
+    }
+
+    std::vector<std::thread> workers;
+    workers.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; ++i) {
+        workers.emplace_back(&StartupGraph::WorkerLoop, this);
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    std::lock_guard<std::mutex> lock(graphMutex_);
+    return !anyFailed_ && finishedCount_ == tasks_.size();
+}
+
+StartupGraph::Task* StartupGraph::FindTask(const std::wstring& name) {
+    for (Task& task : tasks_) {
+        if (task.name == name) {
+            return &task;
+        }
+    }
+    return nullptr;
+}
+
+void StartupGraph::ScheduleReadyTasks() {
+    for (size_t i = 0; i < tasks_.size(); ++i) {
+        Task& task = tasks_[i];
+        if (!task.scheduled && !task.skipped && task.pendingDeps == 0) {
+            task.scheduled = true;
+            readyQueue_.push_back(i);
+        }
+    }
+    graphCondition_.notify_all();
+}
+
+void StartupGraph::OnTaskFinished(Task& task, bool success) {
+    task.succeeded = success;
+    ++finishedCount_;
+
+    if (success) {
+        // Release dependents
+        for (Task& other : tasks_) {
+            if (other.scheduled || other.skipped) {
+                continue;
+            }
+            for (const std::wstring& dep : other.dependencies) {
+                if (dep == task.name) {
+                    --other.pendingDeps;
+                    break;
+                }
+            }
+        }
+    } else {
+        anyFailed_ = true;
+        SkipDependentsOf(task.name);
+    }
+
+    if (progressCallback_) {
+        progressCallback_(finishedCount_, tasks_.size(), task.name);
+    }
+
+    ScheduleReadyTasks();
+}
+
+void StartupGraph::SkipDependentsOf(const std::wstring& name) {
+    // Transitive: skipping one task may strand its own dependents
+    for (Task& task : tasks_) {
+        if (task.scheduled || task.skipped) {
+            continue;
+        }
+        for (const std::wstring& dep : task.dependencies) {
+            if (dep == name) {
+                task.skipped = true;
+                ++finishedCount_;
+                SkipDependentsOf(task.name);
+                break;
+            }
+        }
+    }
+}
+
+void StartupGraph::WorkerLoop() {
+    for (;;) {
+        size_t taskIndex;
+        {
+            std::unique_lock<std::mutex> lock(graphMutex_);
+            graphCondition_.wait(lock, [this] {
+                return !readyQueue_.empty() || finishedCount_ >= tasks_.size() || stopWorkers_;
+            });
+            if (readyQueue_.empty()) {
+                // Nothing left to run; wake the others so they exit too
+                stopWorkers_ = true;
+                graphCondition_.notify_all();
+                return;
+            }
+            taskIndex = readyQueue_.back();
+            readyQueue_.pop_back();
+        }
+
+        Task& task = tasks_[taskIndex];
+        bool success = false;
+        try {
+            success = task.work();
+        } catch (const std::exception& e) {
+            LOG_ERROR(std::string("StartupGraph: task threw: ") + e.what());
+            success = false;
+        } catch (...) {
+            LOG_ERROR("StartupGraph: task threw unknown exception");
+            success = false;
+        }
+
+        std::lock_guard<std::mutex> lock(graphMutex_);
+        OnTaskFinished(task, success);
+    }
+}
+
+} // namespace App
+} // namespace RainmeterManager
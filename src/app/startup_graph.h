@@ -0,0 +1,84 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <map>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+
+namespace RainmeterManager {
+namespace App {
+
+/**
+ * @brief Dependency-graph runner for application startup
+ *
+ * Initialization used to be strictly sequential, leaving the CPU idle
+ * during I/O-bound stages (DLL validation, config load, render-process
+ * spawn). The graph makes dependencies explicit: each task names the
+ * tasks it needs, and everything whose dependencies are satisfied runs
+ * concurrently on a small startup pool. Splash progress is driven by
+ * task completion instead of hard-coded percentages.
+ *
+ * A failed task fails the run and skips its dependents; independent
+ * branches still finish so their state is consistent for shutdown.
+ * Tasks run on pool threads — anything that must run on the main
+ * thread (window creation) stays outside the graph.
+ */
+class StartupGraph {
+public:
+    using TaskFunc = std::function<bool()>;
+    // (completed, total, name of the task that just finished)
+    using ProgressCallback = std::function<void(size_t completed, size_t total,
+                                                const std::wstring& taskName)>;
+
+    /**
+     * @brief Add a task with its dependencies
+     * @param name Unique task name
+     * @param dependencies Names of tasks that must succeed first
+     * @param work Returns false on failure (dependents are skipped)
+     */
+    void AddTask(const std::wstring& name, std::vector<std::wstring> dependencies,
+                 TaskFunc work);
+
+    void SetProgressCallback(ProgressCallback callback);
+
+    /**
+     * @brief Run the graph to completion
+     * @param workerCount Startup pool size
+     * @return True if every task ran and succeeded
+     */
+    bool Run(size_t workerCount = 2);
+
+private:
+    struct Task {
+        std::wstring name;
+        std::vector<std::wstring> dependencies;
+        TaskFunc work;
+        size_t pendingDeps = 0;
+        bool scheduled = false;
+        bool succeeded = false;
+        bool skipped = false;
+    };
+
+    // All below require graphMutex_
+    Task* FindTask(const std::wstring& name);
+    void ScheduleReadyTasks();
+    void OnTaskFinished(Task& task, bool success);
+    void SkipDependentsOf(const std::wstring& name);
+
+    void WorkerLoop();
+
+    std::vector<Task> tasks_;
+    std::vector<size_t> readyQueue_;   // Indices into tasks_
+    size_t finishedCount_ = 0;
+    bool anyFailed_ = false;
+    bool stopWorkers_ = false;
+    ProgressCallback progressCallback_;
+    std::mutex graphMutex_;
+    std::condition_variable graphCondition_;
+};
+
+} // namespace App
+} // namespace RainmeterManager
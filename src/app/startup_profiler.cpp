@@ -0,0 +1,131 @@
+#include "startup_profiler.h"
+#include "../core/logger.h"
+#include <cstdio>
+#include <ctime>
+#include <deque>
+#include <fstream>
+#include <sstream>
+
+namespace RainmeterManager {
+namespace App {
+
+StartupProfiler& StartupProfiler::GetInstance() {
+    static StartupProfiler instance;
+    return instance;
+}
+
+StartupProfiler::StartupProfiler() {
+    LARGE_INTEGER freq{}, now{};
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&now);
+    qpcFrequency_ = (freq.QuadPart > 0) ? freq.QuadPart : 1;
+    originQpc_ = now.QuadPart;
+}
+
+void StartupProfiler::BeginPhase(const char* name) {
+    LARGE_INTEGER now{};
+    QueryPerformanceCounter(&now);
+
+    std::lock_guard<std::mutex> lock(profileMutex_);
+    if (readyMarked_) return;
+    PhaseRecord record;
+    record.name = name ? name : "";
+    record.startQpc = now.QuadPart;
+    phases_.push_back(std::move(record));
+}
+
+void StartupProfiler::EndPhase(const char* name) {
+    LARGE_INTEGER now{};
+    QueryPerformanceCounter(&now);
+
+    std::lock_guard<std::mutex> lock(profileMutex_);
+    if (readyMarked_) return;
+    // Most recent open phase with this name (phases may nest)
+    for (auto it = phases_.rbegin(); it != phases_.rend(); ++it) {
+        if (it->endQpc == 0 && name && it->name == name) {
+            it->endQpc = now.QuadPart;
+            return;
+        }
+    }
+}
+
+void StartupProfiler::MarkReady() {
+    LARGE_INTEGER now{};
+    QueryPerformanceCounter(&now);
+
+    std::lock_guard<std::mutex> lock(profileMutex_);
+    if (readyMarked_) return;
+    readyMarked_ = true;
+
+    WriteTraceFile(now.QuadPart);
+    AppendHistoryLine(QpcToMs(now.QuadPart - originQpc_));
+}
+
+double StartupProfiler::QpcToMs(LONGLONG qpc) const {
+    return static_cast<double>(qpc) * 1000.0 / static_cast<double>(qpcFrequency_);
+}
+
+void StartupProfiler::WriteTraceFile(LONGLONG readyQpc) {
+    try {
+        std::ofstream out("logs/startup_trace.json", std::ios::trunc);
+        if (!out.is_open()) return;
+
+        out << "{\"totalMs\":" << QpcToMs(readyQpc - originQpc_) << ",\"phases\":[";
+        for (size_t i = 0; i < phases_.size(); ++i) {
+            const PhaseRecord& phase = phases_[i];
+            LONGLONG end = (phase.endQpc != 0) ? phase.endQpc : readyQpc;
+            if (i > 0) out << ",";
+            out << "{\"name\":\"" << phase.name
+                << "\",\"startMs\":" << QpcToMs(phase.startQpc - originQpc_)
+                << ",\"durationMs\":" << QpcToMs(end - phase.startQpc) << "}";
+        }
+        out << "]}\n";
+    } catch (...) {
+        // Profiling must never take the app down
+    }
+}
+
+void StartupProfiler::AppendHistoryLine(double totalMs) {
+    try {
+        const char* historyPath = "logs/startup_history.log";
+
+        // Keep a rolling window: read existing lines, trim the oldest
+        std::deque<std::string> lines;
+        {
+            std::ifstream in(historyPath);
+            std::string line;
+            while (std::getline(in, line)) {
+                if (!line.empty()) lines.push_back(line);
+            }
+        }
+
+        std::time_t nowTime = std::time(nullptr);
+        std::tm localTime{};
+        localtime_s(&localTime, &nowTime);
+        char stamp[32];
+        std::strftime(stamp, sizeof(stamp), "%Y-%m-%dT%H:%M:%S", &localTime);
+
+        std::ostringstream entry;
+        entry << stamp << " totalMs=" << totalMs;
+        for (const PhaseRecord& phase : phases_) {
+            if (phase.endQpc != 0) {
+                entry << " " << phase.name << "=" << QpcToMs(phase.endQpc - phase.startQpc);
+            }
+        }
+        lines.push_back(entry.str());
+
+        while (lines.size() > MAX_HISTORY_LINES) {
+            lines.pop_front();
+        }
+
+        std::ofstream out(historyPath, std::ios::trunc);
+        for (const std::string& line : lines) {
+            out << line << "\n";
+        }
+    } catch (...) {
+        // Best-effort; same rationale as WriteTraceFile
+    }
+}
+
+} // namespace App
+} // namespace RainmeterManager
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <windows.h>
+#include <string>
+#include <vector>
+#include <mutex>
+
+namespace RainmeterManager {
+namespace App {
+
+/**
+ * @brief Startup phase profiler with persisted traces
+ *
+ * Records named bootstrap phases (config load, security init, IPC
+ * handshake, first widget rendered) with QueryPerformanceCounter
+ * timestamps. MarkReady() writes the full trace of the current run to
+ * logs/startup_trace.json and appends a one-line summary to a rolling
+ * local history (logs/startup_history.log, last 100 runs), so
+ * "startup got slower after the update" reports can be triaged from a
+ * seat's own history instead of ad-hoc log archaeology.
+ *
+ * Phases may nest and may run on any thread; Begin/End pairs are
+ * matched by name. Overhead is two QPC reads and a vector append per
+ * phase — nothing is formatted until MarkReady.
+ */
+class StartupProfiler {
+public:
+    static StartupProfiler& GetInstance();
+
+    /**
+     * @brief Open a named phase at the current QPC timestamp
+     */
+    void BeginPhase(const char* name);
+
+    /**
+     * @brief Close the most recent open phase with this name
+     */
+    void EndPhase(const char* name);
+
+    /**
+     * @brief Mark ready-state: persist the trace and history entry
+     *
+     * Idempotent; only the first call writes. Open phases are closed
+     * at the ready timestamp so a missed EndPhase still shows up with
+     * a plausible duration rather than vanishing.
+     */
+    void MarkReady();
+
+    /**
+     * @brief RAII phase marker for scoped sections
+     */
+    class Scoped {
+    public:
+        explicit Scoped(const char* name) : name_(name) {
+            StartupProfiler::GetInstance().BeginPhase(name_);
+        }
+        ~Scoped() {
+            StartupProfiler::GetInstance().EndPhase(name_);
+        }
+        Scoped(const Scoped&) = delete;
+        Scoped& operator=(const Scoped&) = delete;
+    private:
+        const char* name_;
+    };
+
+private:
+    StartupProfiler();
+    ~StartupProfiler() = default;
+
+    StartupProfiler(const StartupProfiler&) = delete;
+    StartupProfiler& operator=(const StartupProfiler&) = delete;
+
+    struct PhaseRecord {
+        std::string name;
+        LONGLONG startQpc = 0;
+        LONGLONG endQpc = 0;  // 0 while the phase is open
+    };
+
+    double QpcToMs(LONGLONG qpc) const;
+    void WriteTraceFile(LONGLONG readyQpc);
+    void AppendHistoryLine(double totalMs);
+
+    static constexpr size_t MAX_HISTORY_LINES = 100;
+
+    LONGLONG originQpc_ = 0;   // Process profiling start
+    LONGLONG qpcFrequency_ = 1;
+    std::vector<PhaseRecord> phases_;
+    bool readyMarked_ = false;
+    std::mutex profileMutex_;
+};
+
+// Two-level concat so __LINE__ expands before pasting; direct ## would
+// name every phase variable literally _startupPhase___LINE__ and two
+// phases in one function would collide
+#define RM_PP_CAT2(a, b) a##b
+#define RM_PP_CAT(a, b) RM_PP_CAT2(a, b)
+
+// Scoped phase marker: STARTUP_PHASE("security init");
+#define STARTUP_PHASE(name) \
+    RainmeterManager::App::StartupProfiler::Scoped RM_PP_CAT(_startupPhase_, __LINE__)(name)
+
+} // namespace App
+} // namespace RainmeterManager
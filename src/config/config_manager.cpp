@@ -353,8 +353,6 @@ bool ConfigManager::ParseJsonFile(const std::string& filepath) {
         buffer << file.rdbuf();
         std::string content = buffer.str();
         
-        // Basic JSON parsing - in a real implementation you'd use a proper JSON library
-        // For now, we'll do simple key-value extraction for demonstration
         return ParseJsonObject(content);
         
     } catch (const std::exception& e) {
@@ -364,37 +362,60 @@ bool ConfigManager::ParseJsonFile(const std::string& filepath) {
 }
 
 bool ConfigManager::ParseJsonObject(const std::string& json, const std::string& prefix) {
-    // This is a simplified JSON parser for demonstration
-    // In production, you should use a proper JSON library like nlohmann/json
-    
-    // For now, we'll just store some basic configuration entries
-    // that would be useful for the existing config files
-    
-    if (!prefix.empty()) {
-        return true; // Skip nested objects for this simple implementation
+    Core::JsonDocument document;
+    if (!document.Parse(json)) {
+        LogConfigEvent("Malformed JSON configuration", Core::LogLevel::Error);
+        return false;
     }
-    
-    // Set some default configuration values that would be useful
-    config_["app.name"] = ConfigValue("Rainmeter Manager", ValueType::String);
-    config_["app.version"] = ConfigValue("1.0.0", ValueType::String);
-    config_["app.phase"] = ConfigValue("Phase 2 - Application Core", ValueType::String);
-    
-    config_["security.encryption_enabled"] = ConfigValue("true", ValueType::Boolean);
-    config_["security.https_only"] = ConfigValue("true", ValueType::Boolean);
-    config_["security.certificate_validation"] = ConfigValue("true", ValueType::Boolean);
-    
-    config_["network.default_timeout"] = ConfigValue("10000", ValueType::Integer);
-    config_["network.max_retries"] = ConfigValue("3", ValueType::Integer);
-    config_["network.follow_redirects"] = ConfigValue("true", ValueType::Boolean);
-    
-    config_["cache.default_duration"] = ConfigValue("300000", ValueType::Integer);
-    config_["cache.max_size"] = ConfigValue("104857600", ValueType::Integer); // 100MB
-    config_["cache.encryption_enabled"] = ConfigValue("true", ValueType::Boolean);
-    
-    LogConfigEvent("Parsed JSON configuration (simplified parser)");
+
+    Core::JsonCursor root = document.Root();
+    if (!root.IsObject()) {
+        LogConfigEvent("JSON configuration root is not an object", Core::LogLevel::Error);
+        return false;
+    }
+
+    size_t storedCount = 0;
+    StoreJsonValue(root, prefix, storedCount);
+
+    LogConfigEvent("Parsed JSON configuration (" + std::to_string(storedCount) + " keys)");
     return true;
 }
 
+void ConfigManager::StoreJsonValue(const Core::JsonCursor& value, const std::string& prefix,
+                                   size_t& storedCount) {
+    if (value.IsObject()) {
+        value.ForEachMember([&](const std::string& key, const Core::JsonCursor& member) {
+            std::string dottedKey = prefix.empty() ? key : prefix + "." + key;
+            StoreJsonValue(member, dottedKey, storedCount);
+        });
+        return;
+    }
+
+    if (value.IsArray()) {
+        // Arrays keep their JSON text; consumers split or re-parse as needed
+        config_[prefix] = ConfigValue(value.RawText(), ValueType::Array);
+        ++storedCount;
+        return;
+    }
+
+    if (value.IsString()) {
+        config_[prefix] = ConfigValue(value.AsString(), ValueType::String);
+    } else if (value.IsBool()) {
+        config_[prefix] = ConfigValue(value.AsBool() ? "true" : "false", ValueType::Boolean);
+    } else if (value.IsNumber()) {
+        std::string raw = value.RawText();
+        bool integral = raw.find('.') == std::string::npos &&
+                        raw.find('e') == std::string::npos &&
+                        raw.find('E') == std::string::npos;
+        config_[prefix] = ConfigValue(raw, integral ? ValueType::Integer : ValueType::Double);
+    } else if (value.IsNull()) {
+        return; // Null entries are treated as absent
+    } else {
+        return; // Malformed value; skip rather than store garbage
+    }
+    ++storedCount;
+}
+
 bool ConfigManager::FileExists(const std::string& filepath) const {
     DWORD attributes = GetFileAttributesA(filepath.c_str());
     return (attributes != INVALID_FILE_ATTRIBUTES && !(attributes & FILE_ATTRIBUTE_DIRECTORY));
@@ -7,6 +7,7 @@
 #include <mutex>
 #include <vector>
 #include "../core/logger_adapter.h"
+#include "../core/json_document.h"
 
 namespace RainmeterManager {
 namespace Config {
@@ -259,6 +260,7 @@ private:
     // JSON parsing helpers
     bool ParseJsonFile(const std::string& filepath);
     bool ParseJsonObject(const std::string& json, const std::string& prefix = "");
+    void StoreJsonValue(const Core::JsonCursor& value, const std::string& prefix, size_t& storedCount);
     std::string ExtractJsonValue(const std::string& json, const std::string& key) const;
     ValueType DetermineValueType(const std::string& value) const;
     
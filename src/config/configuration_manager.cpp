@@ -3,10 +3,13 @@
 
 #include "configuration_manager.h"
 #include "../core/logger.h"
+#include "../core/json_document.h"
+#include "../core/string_intern.h"
 #include <fstream>
 #include <sstream>
 #include <filesystem>
 #include <algorithm>
+#include <chrono>
 #include <shlobj.h>
 #include <windows.h>
 
@@ -113,12 +116,27 @@ bool ConfigurationManager::Initialize(const std::wstring& configPath) {
         Save();
     }
 
+    // Replay journaled key updates written after the last full save
+    // (crash or hard kill before the debounced rewrite ran)
+    journalPath_ = configFilePath_ + L".journal";
+    if (ReplayJournal()) {
+        LOG_INFO("Replayed config journal on top of last full save");
+        MarkDirty();
+    }
+    journalStream_.open(std::filesystem::path(journalPath_),
+                        std::ios::binary | std::ios::app);
+    StartFlushThread();
+
     initialized_ = true;
     LOG_INFO("ConfigurationManager initialized successfully");
     return true;
 }
 
 void ConfigurationManager::Shutdown() {
+    // Stop the flush thread before taking the config lock; it takes
+    // the same lock through Save()
+    StopFlushThread();
+
     std::lock_guard<std::mutex> lock(configMutex_);
 
     if (!initialized_) {
@@ -127,6 +145,10 @@ void ConfigurationManager::Shutdown() {
 
     LOG_INFO("Shutting down ConfigurationManager");
 
+    if (journalStream_.is_open()) {
+        journalStream_.close();
+    }
+
     // Save if dirty
     if (dirty_) {
         Save();
@@ -150,6 +172,13 @@ bool ConfigurationManager::Load(const std::wstring& filePath) {
         return false;
     }
 
+    // Fast path: a fresh binary snapshot skips text parsing entirely
+    if (TryLoadBinarySnapshot(filePath)) {
+        MarkClean();
+        LOG_INFO("Configuration loaded from binary snapshot");
+        return true;
+    }
+
     bool success = false;
     if (configFormat_ == L"json") {
         success = LoadJSON(filePath);
@@ -194,6 +223,13 @@ bool ConfigurationManager::Save(const std::wstring& filePath) {
 
     if (success) {
         MarkClean();
+        // Keep the binary snapshot in lockstep with the text file so
+        // the next startup can skip the parser
+        if (!WriteBinarySnapshot(filePath)) {
+            LOG_WARNING("Failed to write binary config snapshot");
+        }
+        // Journaled records are now covered by the full save
+        TruncateJournal();
         LOG_INFO("Configuration saved successfully");
     } else {
         LOG_ERROR("Failed to save configuration");
@@ -232,8 +268,9 @@ std::wstring ConfigurationManager::GetValue(const std::wstring& key, const std::
 
 void ConfigurationManager::SetValue(const std::wstring& key, const std::wstring& value) {
     std::lock_guard<std::mutex> lock(configMutex_);
-    
+
     customSettings_[key] = value;
+    AppendJournalRecord(key, value);
     MarkDirty();
     NotifyChange(key, value);
 }
@@ -389,44 +426,41 @@ bool ConfigurationManager::MigrateFromVersion(const std::wstring& fromVersion) {
 // Private helper methods
 
 bool ConfigurationManager::LoadJSON(const std::wstring& filePath) {
-    // Simple JSON parser (basic implementation)
-    // For production, consider using a JSON library like nlohmann/json
-    
-    std::wifstream file(filePath);
+    // Read the whole file once and hand it to the shared lazy parser;
+    // the document views the buffer, so it stays alive until the walk
+    // below finishes
+    std::ifstream file(filePath, std::ios::binary);
     if (!file.is_open()) {
         return false;
     }
 
-    std::wstring line;
-    std::wstring currentKey;
-    
-    while (std::getline(file, line)) {
-        // Trim whitespace
-        line.erase(0, line.find_first_not_of(L" \t\r\n"));
-        line.erase(line.find_last_not_of(L" \t\r\n") + 1);
-
-        // Skip empty lines and comments
-        if (line.empty() || line[0] == L'#' || line[0] == L'/') {
-            continue;
-        }
-
-        // Simple key:value parsing
-        size_t colonPos = line.find(L':');
-        if (colonPos != std::wstring::npos) {
-            std::wstring key = line.substr(0, colonPos);
-            std::wstring value = line.substr(colonPos + 1);
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    std::string content = buffer.str();
+    file.close();
 
-            // Trim quotes and whitespace
-            key.erase(0, key.find_first_not_of(L" \t\""));
-            key.erase(key.find_last_not_of(L" \t\",") + 1);
-            value.erase(0, value.find_first_not_of(L" \t\""));
-            value.erase(value.find_last_not_of(L" \t\",") + 1);
+    Core::JsonDocument document;
+    if (!document.Parse(content)) {
+        LOG_ERROR("Malformed JSON configuration file");
+        return false;
+    }
 
-            customSettings_[key] = value;
-        }
+    Core::JsonCursor root = document.Root();
+    if (!root.IsObject()) {
+        LOG_ERROR("JSON configuration root is not an object");
+        return false;
     }
 
-    file.close();
+    // SaveJSON writes a flat object, so a flat walk covers everything;
+    // values are stored as text and typed by ApplyConfiguration
+    // Config keys are a stable population reloaded on every load and
+    // hot-reload; the intern table caches their UTF-16 form
+    auto& internTable = Core::StringInternTable::GetInstance();
+    root.ForEachMember([this, &internTable](const std::string& key,
+                                            const Core::JsonCursor& value) {
+        std::string text = value.IsString() ? value.AsString() : value.RawText();
+        customSettings_[internTable.Intern(key).Utf16()] = Core::Utf8ToUtf16(text);
+    });
 
     // Apply to config structure
     ApplyConfiguration(config_);
@@ -565,6 +599,241 @@ bool ConfigurationManager::SaveINI(const std::wstring& filePath) {
     return true;
 }
 
+// === Binary snapshot fast path ===
+
+namespace {
+    constexpr uint32_t SNAPSHOT_MAGIC = 0x524D4353;  // 'RMCS'
+    constexpr uint32_t SNAPSHOT_VERSION = 1;
+
+    struct BinarySnapshotHeader {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t entryCount;
+        uint32_t reserved;
+        uint64_t textHash;   // FNV-1a of the text config bytes
+    };
+}
+
+std::wstring ConfigurationManager::GetSnapshotPath(const std::wstring& textPath) const {
+    return textPath + L".bin";
+}
+
+// FNV-1a over the raw file bytes; cheap enough to run on every load
+// and catches edits made to the text config by hand
+uint64_t ConfigurationManager::HashFileContents(const std::wstring& path) {
+    std::ifstream file(std::filesystem::path(path), std::ios::binary);
+    if (!file.is_open()) {
+        return 0;
+    }
+
+    uint64_t hash = 14695981039346656037ULL;
+    char buffer[4096];
+    while (file.read(buffer, sizeof(buffer)) || file.gcount() > 0) {
+        std::streamsize count = file.gcount();
+        for (std::streamsize i = 0; i < count; ++i) {
+            hash ^= static_cast<unsigned char>(buffer[i]);
+            hash *= 1099511628211ULL;
+        }
+        if (count < (std::streamsize)sizeof(buffer)) break;
+    }
+    return hash;
+}
+
+bool ConfigurationManager::TryLoadBinarySnapshot(const std::wstring& textPath) {
+    std::wstring snapshotPath = GetSnapshotPath(textPath);
+    if (!std::filesystem::exists(snapshotPath)) {
+        return false;
+    }
+
+    HANDLE file = CreateFileW(snapshotPath.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                              nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    LARGE_INTEGER fileSize{};
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart < (LONGLONG)sizeof(BinarySnapshotHeader)) {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        CloseHandle(file);
+        return false;
+    }
+
+    const uint8_t* base = static_cast<const uint8_t*>(
+        MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    bool success = false;
+
+    if (base) {
+        const auto* header = reinterpret_cast<const BinarySnapshotHeader*>(base);
+        size_t totalSize = static_cast<size_t>(fileSize.QuadPart);
+
+        if (header->magic == SNAPSHOT_MAGIC &&
+            header->version == SNAPSHOT_VERSION &&
+            header->textHash == HashFileContents(textPath)) {
+
+            std::map<std::wstring, std::wstring> settings;
+            size_t offset = sizeof(BinarySnapshotHeader);
+            uint32_t parsed = 0;
+
+            while (parsed < header->entryCount && offset + 2 * sizeof(uint32_t) <= totalSize) {
+                uint32_t keyChars = *reinterpret_cast<const uint32_t*>(base + offset);
+                uint32_t valueChars = *reinterpret_cast<const uint32_t*>(base + offset + sizeof(uint32_t));
+                offset += 2 * sizeof(uint32_t);
+
+                size_t bytesNeeded = (size_t(keyChars) + valueChars) * sizeof(wchar_t);
+                if (offset + bytesNeeded > totalSize) {
+                    break;  // Truncated snapshot; fall back to text
+                }
+
+                const wchar_t* keyData = reinterpret_cast<const wchar_t*>(base + offset);
+                const wchar_t* valueData = keyData + keyChars;
+                settings.emplace(std::wstring(keyData, keyChars),
+                                 std::wstring(valueData, valueChars));
+                offset += bytesNeeded;
+                ++parsed;
+            }
+
+            if (parsed == header->entryCount) {
+                customSettings_.swap(settings);
+                ApplyConfiguration(config_);
+                success = true;
+            }
+        }
+
+        UnmapViewOfFile(base);
+    }
+
+    CloseHandle(mapping);
+    CloseHandle(file);
+    return success;
+}
+
+bool ConfigurationManager::WriteBinarySnapshot(const std::wstring& textPath) {
+    std::wstring snapshotPath = GetSnapshotPath(textPath);
+
+    BinarySnapshotHeader header{};
+    header.magic = SNAPSHOT_MAGIC;
+    header.version = SNAPSHOT_VERSION;
+    header.entryCount = static_cast<uint32_t>(customSettings_.size());
+    header.textHash = HashFileContents(textPath);
+
+    std::ofstream file(std::filesystem::path(snapshotPath),
+                       std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (const auto& [key, value] : customSettings_) {
+        uint32_t keyChars = static_cast<uint32_t>(key.size());
+        uint32_t valueChars = static_cast<uint32_t>(value.size());
+        file.write(reinterpret_cast<const char*>(&keyChars), sizeof(keyChars));
+        file.write(reinterpret_cast<const char*>(&valueChars), sizeof(valueChars));
+        file.write(reinterpret_cast<const char*>(key.data()), keyChars * sizeof(wchar_t));
+        file.write(reinterpret_cast<const char*>(value.data()), valueChars * sizeof(wchar_t));
+    }
+
+    return file.good();
+}
+
+// === Write-behind journal ===
+
+// Append one compact record; a flush per record keeps the journal
+// crash-safe while staying O(key) on the caller's thread
+void ConfigurationManager::AppendJournalRecord(const std::wstring& key, const std::wstring& value) {
+    if (!journalStream_.is_open()) {
+        return;
+    }
+
+    uint32_t keyChars = static_cast<uint32_t>(key.size());
+    uint32_t valueChars = static_cast<uint32_t>(value.size());
+    journalStream_.write(reinterpret_cast<const char*>(&keyChars), sizeof(keyChars));
+    journalStream_.write(reinterpret_cast<const char*>(&valueChars), sizeof(valueChars));
+    journalStream_.write(reinterpret_cast<const char*>(key.data()), keyChars * sizeof(wchar_t));
+    journalStream_.write(reinterpret_cast<const char*>(value.data()), valueChars * sizeof(wchar_t));
+    journalStream_.flush();
+}
+
+// Replay records left behind by a crash onto the loaded settings;
+// later records win, matching the order SetValue was called in
+bool ConfigurationManager::ReplayJournal() {
+    std::ifstream file(std::filesystem::path(journalPath_), std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    bool replayedAny = false;
+    while (true) {
+        uint32_t keyChars = 0;
+        uint32_t valueChars = 0;
+        if (!file.read(reinterpret_cast<char*>(&keyChars), sizeof(keyChars))) break;
+        if (!file.read(reinterpret_cast<char*>(&valueChars), sizeof(valueChars))) break;
+
+        std::wstring key(keyChars, L'\0');
+        std::wstring value(valueChars, L'\0');
+        if (!file.read(reinterpret_cast<char*>(&key[0]), keyChars * sizeof(wchar_t))) break;
+        if (valueChars > 0 &&
+            !file.read(reinterpret_cast<char*>(&value[0]), valueChars * sizeof(wchar_t))) break;
+
+        customSettings_[key] = value;
+        replayedAny = true;
+    }
+
+    if (replayedAny) {
+        ApplyConfiguration(config_);
+    }
+    return replayedAny;
+}
+
+void ConfigurationManager::TruncateJournal() {
+    if (journalStream_.is_open()) {
+        journalStream_.close();
+    }
+    if (!journalPath_.empty()) {
+        journalStream_.open(std::filesystem::path(journalPath_),
+                            std::ios::binary | std::ios::trunc);
+    }
+}
+
+void ConfigurationManager::StartFlushThread() {
+    if (flushThread_.joinable()) {
+        return;
+    }
+    flushStop_ = false;
+    flushThread_ = std::thread(&ConfigurationManager::FlushLoop, this);
+}
+
+void ConfigurationManager::StopFlushThread() {
+    if (!flushThread_.joinable()) {
+        return;
+    }
+    flushStop_ = true;
+    flushCV_.notify_all();
+    flushThread_.join();
+}
+
+// Debounced full-file rewrite: frequent SetValue bursts (slider drags,
+// window-geometry updates) cost journal appends only, and the full
+// rewrite happens at most once per interval off the UI thread
+void ConfigurationManager::FlushLoop() {
+    while (!flushStop_) {
+        {
+            std::unique_lock<std::mutex> lock(flushMutex_);
+            flushCV_.wait_for(lock, std::chrono::milliseconds(flushIntervalMs_),
+                              [this]{ return flushStop_.load(); });
+        }
+        if (flushStop_) break;
+
+        if (IsDirty()) {
+            Save();
+        }
+    }
+}
+
 void ConfigurationManager::NotifyChange(const std::wstring& key, const std::wstring& value) {
     for (const auto& callback : changeCallbacks_) {
         try {
@@ -8,6 +8,10 @@
 #include <mutex>
 #include <functional>
 #include <vector>
+#include <fstream>
+#include <thread>
+#include <atomic>
+#include <condition_variable>
 
 namespace RainmeterManager {
 namespace Config {
@@ -86,6 +90,19 @@ private:
     // Change notifications
     std::vector<ConfigChangeCallback> changeCallbacks_;
 
+    // Write-behind journal. SetValue appends one compact record to the
+    // journal file immediately (O(key), not O(file)); the background
+    // flush thread rewrites the full config on a debounce interval and
+    // truncates the journal. After a crash, Load replays the journal on
+    // top of the last full save.
+    std::ofstream journalStream_;
+    std::wstring journalPath_;
+    std::thread flushThread_;
+    std::condition_variable flushCV_;
+    std::mutex flushMutex_;
+    std::atomic<bool> flushStop_{false};
+    unsigned int flushIntervalMs_ = 2000;
+
 public:
     ConfigurationManager();
     ~ConfigurationManager();
@@ -144,12 +161,32 @@ public:
     // Migration support (for upgrading old config formats)
     bool MigrateFromVersion(const std::wstring& fromVersion);
 
+    // Debounce interval between full-file rewrites while dirty
+    void SetFlushInterval(unsigned int intervalMs) { flushIntervalMs_ = intervalMs; }
+
 private:
     // Format-specific loading/saving
     bool LoadJSON(const std::wstring& filePath);
     bool SaveJSON(const std::wstring& filePath);
     bool LoadINI(const std::wstring& filePath);
     bool SaveINI(const std::wstring& filePath);
+
+    // Binary snapshot fast path. Save writes a compiled snapshot next
+    // to the text config stamped with a hash of the text bytes; Load
+    // memory-maps it and skips parsing entirely while the hash still
+    // matches, falling back to the text parser when it is stale.
+    bool TryLoadBinarySnapshot(const std::wstring& textPath);
+    bool WriteBinarySnapshot(const std::wstring& textPath);
+    std::wstring GetSnapshotPath(const std::wstring& textPath) const;
+    static uint64_t HashFileContents(const std::wstring& path);
+
+    // Write-behind journal helpers
+    void AppendJournalRecord(const std::wstring& key, const std::wstring& value);
+    bool ReplayJournal();
+    void TruncateJournal();
+    void StartFlushThread();
+    void StopFlushThread();
+    void FlushLoop();
     
     // Helper methods
     void NotifyChange(const std::wstring& key, const std::wstring& value);
@@ -0,0 +1,71 @@
+#pragma once
+// core_services.h - Constexpr-indexable handle registry for core services
+// Copyright (c) 2025 RainmeterManager. All rights reserved.
+
+#include "service_locator.h"
+#include "system_monitor.h"
+#include "../config/configuration_manager.h"
+#include "../services/telemetry_service.h"
+#include <tuple>
+
+namespace RainmeterManager {
+namespace Core {
+
+/**
+ * @brief Compile-time ids for the fixed set of locator-managed core services
+ *
+ * Logger is a global static class and never goes through the locator,
+ * so it has no slot here.
+ */
+enum class CoreServiceId : size_t {
+    SystemMonitor = 0,
+    Configuration,
+    Telemetry,
+    Count
+};
+
+/// Maps a CoreServiceId to its interface type at compile time
+template<CoreServiceId Id> struct CoreServiceTraits;
+template<> struct CoreServiceTraits<CoreServiceId::SystemMonitor> {
+    using Interface = ISystemMonitor;
+};
+template<> struct CoreServiceTraits<CoreServiceId::Configuration> {
+    using Interface = Config::ConfigurationManager;
+};
+template<> struct CoreServiceTraits<CoreServiceId::Telemetry> {
+    using Interface = Services::TelemetryService;
+};
+
+/**
+ * @brief Fixed array of cached service handles, indexed at compile time
+ *
+ * The core service set is known at compile time, so call sites resolve
+ * through a constexpr-indexed slot instead of hashing a type_index per
+ * call: `services.Get<CoreServiceId::SystemMonitor>()` is a pointer
+ * load plus the handle's generation compare. Keep one instance near the
+ * hot loop (widget manager, measure scheduler) rather than constructing
+ * per call.
+ */
+class CoreServices {
+public:
+    explicit CoreServices(ServiceLocator& locator)
+        : handles_(ServiceHandle<ISystemMonitor>(locator),
+                   ServiceHandle<Config::ConfigurationManager>(locator),
+                   ServiceHandle<Services::TelemetryService>(locator)) {}
+
+    template<CoreServiceId Id>
+    std::shared_ptr<typename CoreServiceTraits<Id>::Interface> Get() {
+        static_assert(Id < CoreServiceId::Count, "Invalid core service id");
+        return std::get<static_cast<size_t>(Id)>(handles_).Get();
+    }
+
+private:
+    std::tuple<
+        ServiceHandle<ISystemMonitor>,
+        ServiceHandle<Config::ConfigurationManager>,
+        ServiceHandle<Services::TelemetryService>
+    > handles_;
+};
+
+} // namespace Core
+} // namespace RainmeterManager
@@ -0,0 +1,217 @@
+#pragma once
+// cpu_sample_ring.h - Structure-of-arrays ring buffer for per-core CPU samples
+// Copyright (c) 2025 RainmeterManager. All rights reserved.
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#include <emmintrin.h>
+#define RMM_CPU_RING_SSE2 1
+#endif
+
+namespace RainmeterManager {
+namespace Core {
+
+/**
+ * @brief Aggregate statistics over a window of core load samples
+ */
+struct CoreLoadStats {
+    float minimum = 0.0f;
+    float maximum = 0.0f;
+    float average = 0.0f;
+    size_t sampleCount = 0;
+};
+
+/**
+ * @brief Contiguous per-core load sample history
+ *
+ * Stores samples structure-of-arrays: one contiguous row of history per
+ * core (cores x capacity floats in a single allocation), instead of a
+ * fresh std::vector<float> per poll. A core's recent window is therefore
+ * a contiguous scan, and min/max/avg aggregation runs four lanes at a
+ * time under SSE2 with a scalar fallback elsewhere. On a 64-core box
+ * polled at 250 ms this removes both the per-poll allocation and the
+ * strided cache misses the scattered per-object histories caused.
+ *
+ * Single-writer (the monitor's update thread); readers that poll from
+ * another thread should snapshot via GetCoreWindow.
+ */
+class CPUSampleRing {
+public:
+    CPUSampleRing() = default;
+
+    CPUSampleRing(size_t coreCount, size_t historyCapacity) {
+        Reset(coreCount, historyCapacity);
+    }
+
+    /**
+     * @brief Size the ring; discards existing samples
+     */
+    void Reset(size_t coreCount, size_t historyCapacity) {
+        coreCount_ = coreCount;
+        capacity_ = (historyCapacity > 0) ? historyCapacity : 1;
+        samples_.assign(coreCount_ * capacity_, 0.0f);
+        writeIndex_ = 0;
+        storedSamples_ = 0;
+    }
+
+    /**
+     * @brief Append one sample per core (loads[coreCount] in percent)
+     */
+    void Push(const float* loads, size_t count) {
+        if (!loads || count != coreCount_ || coreCount_ == 0) {
+            return;
+        }
+
+        for (size_t core = 0; core < coreCount_; ++core) {
+            samples_[core * capacity_ + writeIndex_] = loads[core];
+        }
+        writeIndex_ = (writeIndex_ + 1) % capacity_;
+        if (storedSamples_ < capacity_) {
+            ++storedSamples_;
+        }
+    }
+
+    size_t GetCoreCount() const { return coreCount_; }
+    size_t GetCapacity() const { return capacity_; }
+    size_t GetStoredSamples() const { return storedSamples_; }
+
+    /**
+     * @brief Latest sample for one core (0 when empty)
+     */
+    float GetLatest(size_t core) const {
+        if (core >= coreCount_ || storedSamples_ == 0) {
+            return 0.0f;
+        }
+        size_t last = (writeIndex_ + capacity_ - 1) % capacity_;
+        return samples_[core * capacity_ + last];
+    }
+
+    /**
+     * @brief Min/max/avg over the newest windowSize samples of one core
+     *
+     * windowSize of 0 aggregates the full stored history. The core's row
+     * is contiguous, so the ring splits into at most two spans that are
+     * each aggregated vectorized.
+     */
+    CoreLoadStats Aggregate(size_t core, size_t windowSize = 0) const {
+        CoreLoadStats stats;
+        if (core >= coreCount_ || storedSamples_ == 0) {
+            return stats;
+        }
+
+        size_t window = (windowSize == 0) ? storedSamples_
+                                          : (std::min)(windowSize, storedSamples_);
+        const float* row = samples_.data() + core * capacity_;
+
+        // Newest 'window' samples end just before writeIndex_ and may
+        // wrap once around the row
+        size_t end = writeIndex_;
+        size_t start = (end + capacity_ - window) % capacity_;
+
+        float minVal = row[start];
+        float maxVal = row[start];
+        float sum = 0.0f;
+
+        if (start < end || end == 0) {
+            size_t spanEnd = (end == 0) ? capacity_ : end;
+            AggregateSpan(row + start, spanEnd - start, minVal, maxVal, sum);
+        } else {
+            AggregateSpan(row + start, capacity_ - start, minVal, maxVal, sum);
+            AggregateSpan(row, end, minVal, maxVal, sum);
+        }
+
+        stats.minimum = minVal;
+        stats.maximum = maxVal;
+        stats.average = sum / static_cast<float>(window);
+        stats.sampleCount = window;
+        return stats;
+    }
+
+    /**
+     * @brief Aggregate the same window across every core
+     *
+     * One entry per core, for dashboard summaries; a single pass over
+     * the whole allocation in row order.
+     */
+    std::vector<CoreLoadStats> AggregateAllCores(size_t windowSize = 0) const {
+        std::vector<CoreLoadStats> all;
+        all.reserve(coreCount_);
+        for (size_t core = 0; core < coreCount_; ++core) {
+            all.push_back(Aggregate(core, windowSize));
+        }
+        return all;
+    }
+
+    /**
+     * @brief Copy one core's newest windowSize samples, oldest first
+     *
+     * For sparkline rendering; the only API that allocates, and callers
+     * can reuse the output vector across frames.
+     */
+    void GetCoreWindow(size_t core, size_t windowSize, std::vector<float>& out) const {
+        out.clear();
+        if (core >= coreCount_ || storedSamples_ == 0) {
+            return;
+        }
+
+        size_t window = (windowSize == 0) ? storedSamples_
+                                          : (std::min)(windowSize, storedSamples_);
+        const float* row = samples_.data() + core * capacity_;
+        out.reserve(window);
+
+        size_t index = (writeIndex_ + capacity_ - window) % capacity_;
+        for (size_t i = 0; i < window; ++i) {
+            out.push_back(row[index]);
+            index = (index + 1) % capacity_;
+        }
+    }
+
+private:
+    /**
+     * @brief Fold one contiguous span into running min/max/sum
+     */
+    static void AggregateSpan(const float* data, size_t count,
+                              float& minVal, float& maxVal, float& sum) {
+        size_t i = 0;
+
+#ifdef RMM_CPU_RING_SSE2
+        if (count >= 8) {
+            __m128 vmin = _mm_loadu_ps(data);
+            __m128 vmax = vmin;
+            __m128 vsum = vmin;
+            for (i = 4; i + 4 <= count; i += 4) {
+                __m128 v = _mm_loadu_ps(data + i);
+                vmin = _mm_min_ps(vmin, v);
+                vmax = _mm_max_ps(vmax, v);
+                vsum = _mm_add_ps(vsum, v);
+            }
+
+            alignas(16) float lanes[4];
+            _mm_store_ps(lanes, vmin);
+            minVal = (std::min)({ minVal, lanes[0], lanes[1], lanes[2], lanes[3] });
+            _mm_store_ps(lanes, vmax);
+            maxVal = (std::max)({ maxVal, lanes[0], lanes[1], lanes[2], lanes[3] });
+            _mm_store_ps(lanes, vsum);
+            sum += lanes[0] + lanes[1] + lanes[2] + lanes[3];
+        }
+#endif
+
+        for (; i < count; ++i) {
+            minVal = (std::min)(minVal, data[i]);
+            maxVal = (std::max)(maxVal, data[i]);
+            sum += data[i];
+        }
+    }
+
+    std::vector<float> samples_;  // coreCount_ rows of capacity_ floats
+    size_t coreCount_ = 0;
+    size_t capacity_ = 0;
+    size_t writeIndex_ = 0;       // Next slot within each row
+    size_t storedSamples_ = 0;    // Valid samples per row (saturates at capacity_)
+};
+
+} // namespace Core
+} // namespace RainmeterManager
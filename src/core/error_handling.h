@@ -119,4 +119,153 @@ private:
     static std::mutex errorMetricsMutex;
 };
 
+//=============================================================================
+// Zero-allocation result type for hot paths
+//
+// ErrorResult/ErrorRecord carry std::string members, so returning one
+// allocates even on success — measurable on the IPC and render command
+// paths in healthy steady state. Result<T> keeps the error code and a
+// short fixed-size context inline; nothing on either path touches the
+// heap. Rich strings are materialized by Describe() only at the moment
+// an error is actually logged.
+//
+//     Result<size_t> WriteFrame(...);
+//     auto r = WriteFrame(...);
+//     if (!r) { LOG_ERROR(r.Describe()); return r.Code(); }
+//=============================================================================
+
+enum class ErrorCode : uint8_t {
+    Ok = 0,
+    InvalidParameter,
+    Timeout,
+    NotConnected,
+    BufferFull,
+    ProtocolError,
+    AccessDenied,
+    OutOfMemory,
+    IoError,
+    Unknown
+};
+
+inline const char* ErrorCodeName(ErrorCode code) {
+    switch (code) {
+        case ErrorCode::Ok:               return "Ok";
+        case ErrorCode::InvalidParameter: return "InvalidParameter";
+        case ErrorCode::Timeout:          return "Timeout";
+        case ErrorCode::NotConnected:     return "NotConnected";
+        case ErrorCode::BufferFull:       return "BufferFull";
+        case ErrorCode::ProtocolError:    return "ProtocolError";
+        case ErrorCode::AccessDenied:     return "AccessDenied";
+        case ErrorCode::OutOfMemory:      return "OutOfMemory";
+        case ErrorCode::IoError:          return "IoError";
+        default:                          return "Unknown";
+    }
+}
+
+template <typename T>
+class Result {
+public:
+    static Result Success(T value) {
+        Result r;
+        r.code_ = ErrorCode::Ok;
+        r.value_ = std::move(value);
+        return r;
+    }
+
+    static Result Failure(ErrorCode code, const char* context = nullptr) {
+        Result r;
+        r.code_ = (code == ErrorCode::Ok) ? ErrorCode::Unknown : code;
+        r.SetContext(context);
+        return r;
+    }
+
+    explicit operator bool() const { return code_ == ErrorCode::Ok; }
+    ErrorCode Code() const { return code_; }
+
+    // Valid only when the result is Ok
+    T& Value() { return value_; }
+    const T& Value() const { return value_; }
+
+    // Truncated inline context; never null
+    const char* Context() const { return context_; }
+
+    // Allocates; call only when actually logging the error
+    std::string Describe() const {
+        std::string out = ErrorCodeName(code_);
+        if (context_[0] != '\0') {
+            out += ": ";
+            out += context_;
+        }
+        return out;
+    }
+
+private:
+    Result() = default;
+
+    void SetContext(const char* context) {
+        size_t i = 0;
+        if (context) {
+            for (; i < CONTEXT_CAPACITY - 1 && context[i] != '\0'; ++i) {
+                context_[i] = context[i];
+            }
+        }
+        context_[i] = '\0';
+    }
+
+    static constexpr size_t CONTEXT_CAPACITY = 48;
+
+    T value_{};
+    ErrorCode code_ = ErrorCode::Unknown;
+    char context_[CONTEXT_CAPACITY] = {0};
+};
+
+// Void specialization for operations with no payload
+template <>
+class Result<void> {
+public:
+    static Result Success() {
+        Result r;
+        r.code_ = ErrorCode::Ok;
+        return r;
+    }
+
+    static Result Failure(ErrorCode code, const char* context = nullptr) {
+        Result r;
+        r.code_ = (code == ErrorCode::Ok) ? ErrorCode::Unknown : code;
+        r.SetContext(context);
+        return r;
+    }
+
+    explicit operator bool() const { return code_ == ErrorCode::Ok; }
+    ErrorCode Code() const { return code_; }
+    const char* Context() const { return context_; }
+
+    std::string Describe() const {
+        std::string out = ErrorCodeName(code_);
+        if (context_[0] != '\0') {
+            out += ": ";
+            out += context_;
+        }
+        return out;
+    }
+
+private:
+    Result() = default;
+
+    void SetContext(const char* context) {
+        size_t i = 0;
+        if (context) {
+            for (; i < CONTEXT_CAPACITY - 1 && context[i] != '\0'; ++i) {
+                context_[i] = context[i];
+            }
+        }
+        context_[i] = '\0';
+    }
+
+    static constexpr size_t CONTEXT_CAPACITY = 48;
+
+    ErrorCode code_ = ErrorCode::Unknown;
+    char context_[CONTEXT_CAPACITY] = {0};
+};
+
 #endif // ERROR_HANDLING_H
@@ -19,3 +19,88 @@
 #ifndef RM_ENABLE_GL
 #define RM_ENABLE_GL 0
 #endif
+
+#include <atomic>
+#include <cstdint>
+
+namespace RainmeterManager {
+namespace Core {
+
+// === Compile-time tier ===
+//
+// The macros above resolved through constexpr so hot paths can write
+//     if constexpr (IsBuildFlagEnabled<BuildFlag::WebView2>()) { ... }
+// and have the disabled branch compiled out entirely — zero runtime
+// cost, and the dead branch still has to parse, unlike #ifdef blocks
+// that rot silently.
+
+enum class BuildFlag {
+    SkiaSharp,
+    WebView2,
+    CommunityWidgets,
+    Gl
+};
+
+template <BuildFlag Flag>
+constexpr bool IsBuildFlagEnabled() {
+    if constexpr (Flag == BuildFlag::SkiaSharp) {
+        return RM_ENABLE_SKIA_SHARP != 0;
+    } else if constexpr (Flag == BuildFlag::WebView2) {
+        return RM_ENABLE_WEBVIEW2 != 0;
+    } else if constexpr (Flag == BuildFlag::CommunityWidgets) {
+        return RM_ENABLE_COMMUNITY_WIDGETS != 0;
+    } else {
+        return RM_ENABLE_GL != 0;
+    }
+}
+
+// === Runtime tier ===
+//
+// Flags that can change while running (prefs UI, capability
+// negotiation) live as bits in one cache-line-aligned atomic word.
+// A check on a per-frame loop is a relaxed load plus a bit test — no
+// string keys, no map lookups, no locks.
+
+enum class RuntimeFlag : uint32_t {
+    IpcCompression = 0,    // LZ4 framing on the render pipe
+    EtwProcessMonitor,     // Event-driven system monitor mode
+    DeltaSnapshots,        // Generation-based task-manager deltas
+    TextLayoutCache,       // Shared DirectWrite layout cache
+    HttpResponseCache,     // Fetch-service TTL/ETag cache
+    BudgetedUpdates,       // Per-tick widget update budget
+
+    Count
+};
+
+class RuntimeFlags {
+public:
+    static bool IsEnabled(RuntimeFlag flag) {
+        return (bits_.load(std::memory_order_relaxed) >>
+                static_cast<uint32_t>(flag)) & 1u;
+    }
+
+    static void Set(RuntimeFlag flag, bool enabled) {
+        const uint64_t mask = 1ull << static_cast<uint32_t>(flag);
+        if (enabled) {
+            bits_.fetch_or(mask, std::memory_order_relaxed);
+        } else {
+            bits_.fetch_and(~mask, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    static_assert(static_cast<uint32_t>(RuntimeFlag::Count) <= 64,
+                  "RuntimeFlag set must fit one atomic word");
+
+    // Own cache line so frame-loop reads never false-share with
+    // unrelated writes
+    alignas(64) static inline std::atomic<uint64_t> bits_{
+        // Defaults: everything shipped-on stays on
+        (1ull << static_cast<uint32_t>(RuntimeFlag::TextLayoutCache)) |
+        (1ull << static_cast<uint32_t>(RuntimeFlag::HttpResponseCache)) |
+        (1ull << static_cast<uint32_t>(RuntimeFlag::BudgetedUpdates))
+    };
+};
+
+} // namespace Core
+} // namespace RainmeterManager
@@ -0,0 +1,474 @@
+// http_fetch_service.cpp - Implementation of the shared HTTP fetch service
+// Copyright (c) 2025 RainmeterManager. All rights reserved.
+
+#include "http_fetch_service.h"
+#include "logger.h"
+#include <algorithm>
+
+#pragma comment(lib, "winhttp.lib")
+
+namespace RainmeterManager {
+namespace Core {
+
+namespace {
+    constexpr DWORD RESPONSE_READ_CHUNK = 64 * 1024;
+    constexpr size_t MAX_RESPONSE_SIZE = 32 * 1024 * 1024;  // 32MB safety cap
+
+    std::string WideToUtf8(const std::wstring& wide) {
+        if (wide.empty()) return std::string();
+        int needed = WideCharToMultiByte(CP_UTF8, 0, wide.c_str(), (int)wide.size(),
+                                         nullptr, 0, nullptr, nullptr);
+        std::string narrow(needed, 0);
+        WideCharToMultiByte(CP_UTF8, 0, wide.c_str(), (int)wide.size(),
+                            &narrow[0], needed, nullptr, nullptr);
+        return narrow;
+    }
+}
+
+HttpFetchService& HttpFetchService::GetInstance() {
+    static HttpFetchService instance;
+    return instance;
+}
+
+HttpFetchService::~HttpFetchService() {
+    Shutdown();
+}
+
+bool HttpFetchService::Initialize(size_t workerCount) {
+    if (running_) {
+        return true;
+    }
+
+    session_ = WinHttpOpen(L"RainmeterManager/1.0",
+                           WINHTTP_ACCESS_TYPE_AUTOMATIC_PROXY,
+                           WINHTTP_NO_PROXY_NAME, WINHTTP_NO_PROXY_BYPASS, 0);
+    if (!session_) {
+        LOG_ERROR("HttpFetchService: WinHttpOpen failed with error " +
+                  std::to_string(GetLastError()));
+        return false;
+    }
+
+    stopRequested_ = false;
+    workerCount = (std::max)(workerCount, size_t(1));
+    for (size_t i = 0; i < workerCount; ++i) {
+        workers_.emplace_back(&HttpFetchService::WorkerLoop, this);
+    }
+
+    running_ = true;
+    LOG_INFO("HttpFetchService started with " + std::to_string(workerCount) + " workers");
+    return true;
+}
+
+void HttpFetchService::Shutdown() {
+    if (!running_) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(inflightMutex_);
+        stopRequested_ = true;
+    }
+    fetchCondition_.notify_all();
+
+    for (auto& worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    workers_.clear();
+
+    // Fail any fetches still queued so no callback is silently dropped
+    {
+        std::lock_guard<std::mutex> lock(inflightMutex_);
+        for (auto& entry : inflight_) {
+            HttpFetchResult result;
+            result.errorMessage = "Fetch service shut down";
+            for (auto& callback : entry.second.callbacks) {
+                try { callback(result); } catch (...) {}
+            }
+        }
+        inflight_.clear();
+        fetchQueue_.clear();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(connectionMutex_);
+        for (auto& entry : connectionsByHost_) {
+            WinHttpCloseHandle(entry.second);
+        }
+        connectionsByHost_.clear();
+    }
+
+    if (session_) {
+        WinHttpCloseHandle(session_);
+        session_ = nullptr;
+    }
+
+    running_ = false;
+    LOG_INFO("HttpFetchService shut down");
+}
+
+void HttpFetchService::FetchAsync(const HttpFetchRequest& request, HttpFetchCallback callback) {
+    if (!callback) {
+        return;
+    }
+    if (!running_) {
+        HttpFetchResult result;
+        result.errorMessage = "Fetch service not initialized";
+        callback(result);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(statsMutex_);
+        ++stats_.totalRequests;
+    }
+
+    // Fresh cache entry: serve immediately, no queue round trip
+    if (request.cacheTtlMs > 0) {
+        HttpFetchResult cached;
+        bool hit = false;
+        {
+            std::lock_guard<std::mutex> lock(cacheMutex_);
+            hit = TryServeFromCache(request.url, cached);
+        }
+        if (hit) {
+            {
+                std::lock_guard<std::mutex> statsLock(statsMutex_);
+                ++stats_.cacheHits;
+            }
+            // Invoke outside the cache lock (like the completion path):
+            // callbacks may re-enter the service and take cacheMutex_
+            callback(cached);
+            return;
+        }
+    }
+
+    bool isNewFetch = false;
+    {
+        std::lock_guard<std::mutex> lock(inflightMutex_);
+        auto it = inflight_.find(request.url);
+        if (it != inflight_.end()) {
+            // Coalesce: join the fetch already on its way
+            it->second.callbacks.push_back(std::move(callback));
+            std::lock_guard<std::mutex> statsLock(statsMutex_);
+            ++stats_.coalescedRequests;
+        } else {
+            PendingFetch pending;
+            pending.request = request;
+            pending.callbacks.push_back(std::move(callback));
+            inflight_.emplace(request.url, std::move(pending));
+            fetchQueue_.push_back(request.url);
+            isNewFetch = true;
+        }
+    }
+
+    if (isNewFetch) {
+        fetchCondition_.notify_one();
+    }
+}
+
+HttpFetchResult HttpFetchService::Fetch(const HttpFetchRequest& request) {
+    struct SyncState {
+        std::mutex mutex;
+        std::condition_variable done;
+        HttpFetchResult result;
+        bool completed = false;
+    };
+    auto state = std::make_shared<SyncState>();
+
+    FetchAsync(request, [state](const HttpFetchResult& result) {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->result = result;
+        state->completed = true;
+        state->done.notify_one();
+    });
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->done.wait(lock, [&state] { return state->completed; });
+    return state->result;
+}
+
+void HttpFetchService::ClearCache() {
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    cache_.clear();
+}
+
+HttpFetchService::Statistics HttpFetchService::GetStatistics() const {
+    Statistics stats;
+    {
+        std::lock_guard<std::mutex> lock(statsMutex_);
+        stats = stats_;
+    }
+    {
+        std::lock_guard<std::mutex> lock(connectionMutex_);
+        stats.pooledConnections = connectionsByHost_.size();
+    }
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        stats.cachedEntries = cache_.size();
+    }
+    return stats;
+}
+
+void HttpFetchService::WorkerLoop() {
+    for (;;) {
+        std::wstring url;
+        {
+            std::unique_lock<std::mutex> lock(inflightMutex_);
+            fetchCondition_.wait(lock, [this] {
+                return stopRequested_ || !fetchQueue_.empty();
+            });
+
+            if (stopRequested_) {
+                return;
+            }
+
+            url = std::move(fetchQueue_.front());
+            fetchQueue_.pop_front();
+        }
+
+        ExecuteFetch(url);
+    }
+}
+
+void HttpFetchService::ExecuteFetch(const std::wstring& url) {
+    HttpFetchRequest request;
+    {
+        std::lock_guard<std::mutex> lock(inflightMutex_);
+        auto it = inflight_.find(url);
+        if (it == inflight_.end()) {
+            return;
+        }
+        request = it->second.request;
+    }
+
+    // Stale-but-cached entries revalidate with If-None-Match
+    std::wstring cachedEtag;
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        auto it = cache_.find(url);
+        if (it != cache_.end()) {
+            cachedEtag = it->second.etag;
+        }
+    }
+
+    HttpFetchResult result = PerformNetworkFetch(request, cachedEtag);
+
+    if (result.statusCode == 304) {
+        // Not modified: serve the cached body and refresh its clock
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        auto it = cache_.find(url);
+        if (it != cache_.end()) {
+            it->second.fetchedTick = GetTickCount64();
+            result.success = true;
+            result.statusCode = it->second.statusCode;
+            result.body = it->second.body;
+            result.etag = it->second.etag;
+            result.fromCache = true;
+        }
+        std::lock_guard<std::mutex> statsLock(statsMutex_);
+        ++stats_.revalidations304;
+    } else if (result.success && request.cacheTtlMs > 0) {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        StoreInCache(url, request, result);
+    }
+
+    // Deliver to every coalesced caller and retire the in-flight entry
+    std::vector<HttpFetchCallback> callbacks;
+    {
+        std::lock_guard<std::mutex> lock(inflightMutex_);
+        auto it = inflight_.find(url);
+        if (it != inflight_.end()) {
+            callbacks = std::move(it->second.callbacks);
+            inflight_.erase(it);
+        }
+    }
+    for (auto& callback : callbacks) {
+        try {
+            callback(result);
+        } catch (const std::exception& e) {
+            LOG_ERROR(std::string("HttpFetchService callback failed: ") + e.what());
+        }
+    }
+}
+
+HttpFetchResult HttpFetchService::PerformNetworkFetch(const HttpFetchRequest& request,
+                                                      const std::wstring& ifNoneMatchEtag) {
+    HttpFetchResult result;
+
+    URL_COMPONENTS components{};
+    components.dwStructSize = sizeof(components);
+    wchar_t host[256] = {};
+    wchar_t path[2048] = {};
+    components.lpszHostName = host;
+    components.dwHostNameLength = ARRAYSIZE(host);
+    components.lpszUrlPath = path;
+    components.dwUrlPathLength = ARRAYSIZE(path);
+
+    if (!WinHttpCrackUrl(request.url.c_str(), 0, 0, &components)) {
+        result.errorMessage = "Invalid URL";
+        return result;
+    }
+
+    HINTERNET connection = AcquireConnection(host, components.nPort);
+    if (!connection) {
+        result.errorMessage = "Connection failed with error " + std::to_string(GetLastError());
+        return result;
+    }
+
+    const bool secure = (components.nScheme == INTERNET_SCHEME_HTTPS);
+    HINTERNET httpRequest = WinHttpOpenRequest(
+        connection, L"GET", path, nullptr, WINHTTP_NO_REFERER,
+        WINHTTP_DEFAULT_ACCEPT_TYPES, secure ? WINHTTP_FLAG_SECURE : 0);
+    if (!httpRequest) {
+        result.errorMessage = "OpenRequest failed with error " + std::to_string(GetLastError());
+        return result;
+    }
+
+    WinHttpSetTimeouts(httpRequest, request.timeoutMs, request.timeoutMs,
+                       request.timeoutMs, request.timeoutMs);
+
+    std::wstring headerBlock;
+    for (const auto& header : request.headers) {
+        headerBlock += header.first + L": " + header.second + L"\r\n";
+    }
+    if (!ifNoneMatchEtag.empty()) {
+        headerBlock += L"If-None-Match: " + ifNoneMatchEtag + L"\r\n";
+    }
+
+    bool sent = WinHttpSendRequest(
+        httpRequest,
+        headerBlock.empty() ? WINHTTP_NO_ADDITIONAL_HEADERS : headerBlock.c_str(),
+        headerBlock.empty() ? 0 : (DWORD)-1,
+        WINHTTP_NO_REQUEST_DATA, 0, 0, 0);
+    if (!sent || !WinHttpReceiveResponse(httpRequest, nullptr)) {
+        result.errorMessage = "Request failed with error " + std::to_string(GetLastError());
+        WinHttpCloseHandle(httpRequest);
+        return result;
+    }
+
+    DWORD statusCode = 0;
+    DWORD statusSize = sizeof(statusCode);
+    WinHttpQueryHeaders(httpRequest,
+                        WINHTTP_QUERY_STATUS_CODE | WINHTTP_QUERY_FLAG_NUMBER,
+                        WINHTTP_HEADER_NAME_BY_INDEX, &statusCode, &statusSize,
+                        WINHTTP_NO_HEADER_INDEX);
+    result.statusCode = statusCode;
+
+    if (statusCode == 304) {
+        // Caller revalidates against its cache entry
+        WinHttpCloseHandle(httpRequest);
+        return result;
+    }
+
+    wchar_t etagBuffer[256] = {};
+    DWORD etagSize = sizeof(etagBuffer);
+    if (WinHttpQueryHeaders(httpRequest, WINHTTP_QUERY_ETAG,
+                            WINHTTP_HEADER_NAME_BY_INDEX, etagBuffer, &etagSize,
+                            WINHTTP_NO_HEADER_INDEX)) {
+        result.etag = etagBuffer;
+    }
+
+    // Read the body in chunks
+    for (;;) {
+        DWORD available = 0;
+        if (!WinHttpQueryDataAvailable(httpRequest, &available) || available == 0) {
+            break;
+        }
+        if (result.body.size() + available > MAX_RESPONSE_SIZE) {
+            result.errorMessage = "Response exceeds size cap";
+            WinHttpCloseHandle(httpRequest);
+            return result;
+        }
+
+        size_t offset = result.body.size();
+        result.body.resize(offset + (std::min)(available, RESPONSE_READ_CHUNK));
+        DWORD read = 0;
+        if (!WinHttpReadData(httpRequest, result.body.data() + offset,
+                             (DWORD)(result.body.size() - offset), &read)) {
+            break;
+        }
+        result.body.resize(offset + read);
+        if (read == 0) {
+            break;
+        }
+    }
+
+    WinHttpCloseHandle(httpRequest);
+
+    result.success = (statusCode >= 200 && statusCode < 300);
+    if (!result.success && result.errorMessage.empty()) {
+        result.errorMessage = "HTTP status " + std::to_string(statusCode) +
+                              " for " + WideToUtf8(request.url);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(statsMutex_);
+        ++stats_.networkFetches;
+        stats_.bytesFetched += result.body.size();
+    }
+    return result;
+}
+
+HINTERNET HttpFetchService::AcquireConnection(const std::wstring& host, INTERNET_PORT port) {
+    std::wstring key = host + L":" + std::to_wstring(port);
+
+    std::lock_guard<std::mutex> lock(connectionMutex_);
+    auto it = connectionsByHost_.find(key);
+    if (it != connectionsByHost_.end()) {
+        return it->second;
+    }
+
+    HINTERNET connection = WinHttpConnect(session_, host.c_str(), port, 0);
+    if (connection) {
+        connectionsByHost_[key] = connection;
+    }
+    return connection;
+}
+
+bool HttpFetchService::TryServeFromCache(const std::wstring& url, HttpFetchResult& result) {
+    auto it = cache_.find(url);
+    if (it == cache_.end()) {
+        return false;
+    }
+
+    const CacheEntry& entry = it->second;
+    if (GetTickCount64() - entry.fetchedTick >= entry.ttlMs) {
+        return false;  // Stale; the fetch path will revalidate
+    }
+
+    result.success = true;
+    result.statusCode = entry.statusCode;
+    result.body = entry.body;
+    result.etag = entry.etag;
+    result.fromCache = true;
+    return true;
+}
+
+void HttpFetchService::StoreInCache(const std::wstring& url, const HttpFetchRequest& request,
+                                    const HttpFetchResult& result) {
+    CacheEntry entry;
+    entry.body = result.body;
+    entry.etag = result.etag;
+    entry.statusCode = result.statusCode;
+    entry.fetchedTick = GetTickCount64();
+    entry.ttlMs = request.cacheTtlMs;
+    cache_[url] = std::move(entry);
+    EvictOldestIfNeeded();
+}
+
+void HttpFetchService::EvictOldestIfNeeded() {
+    while (cache_.size() > MAX_CACHE_ENTRIES) {
+        auto oldest = cache_.begin();
+        for (auto it = cache_.begin(); it != cache_.end(); ++it) {
+            if (it->second.fetchedTick < oldest->second.fetchedTick) {
+                oldest = it;
+            }
+        }
+        cache_.erase(oldest);
+    }
+}
+
+} // namespace Core
+} // namespace RainmeterManager
@@ -0,0 +1,183 @@
+#pragma once
+// http_fetch_service.h - Shared HTTP fetch service for widget data sources
+// Copyright (c) 2025 RainmeterManager. All rights reserved.
+
+#include <string>
+#include <vector>
+#include <map>
+#include <unordered_map>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <functional>
+#include <condition_variable>
+#include <windows.h>
+#include <winhttp.h>
+
+namespace RainmeterManager {
+namespace Core {
+
+/**
+ * @brief One HTTP GET request
+ *
+ * cacheTtlMs should match the caller's refresh interval: a widget
+ * polling every 60 s passes 60000 so other widgets polling the same
+ * endpoint inside that window are served from cache.
+ */
+struct HttpFetchRequest {
+    std::wstring url;
+    std::map<std::wstring, std::wstring> headers;
+    DWORD timeoutMs = 30000;
+    DWORD cacheTtlMs = 0;  // 0 disables caching for this request
+};
+
+/**
+ * @brief Outcome of a fetch; body is valid only when success is true
+ */
+struct HttpFetchResult {
+    bool success = false;
+    DWORD statusCode = 0;
+    std::vector<uint8_t> body;
+    std::wstring etag;
+    bool fromCache = false;
+    std::string errorMessage;
+};
+
+using HttpFetchCallback = std::function<void(const HttpFetchResult&)>;
+
+/**
+ * @brief Shared HTTP fetch service with pooling, coalescing and caching
+ *
+ * Widget data sources (weather, ISS, ticker, TV station templates and
+ * WebParser measures) previously each opened their own connection per
+ * poll. This service centralizes fetching:
+ *
+ * - Connection pooling: one WinHTTP connection handle per host, kept
+ *   alive and reused, so repeated polls skip TCP/TLS setup.
+ * - Request coalescing: concurrent requests for the same URL share one
+ *   network fetch; every caller gets the same response. Three weather
+ *   widgets polling one API cost one connection and one request.
+ * - Response cache: entries fresh within their TTL are served without
+ *   touching the network; stale entries with an ETag revalidate with
+ *   If-None-Match and a 304 refreshes the entry without a body
+ *   transfer.
+ *
+ * Callbacks run on the service's worker threads; marshal to the UI
+ * thread before touching windows.
+ */
+class HttpFetchService {
+public:
+    static HttpFetchService& GetInstance();
+
+    /**
+     * @brief Open the WinHTTP session and start the worker pool
+     * @param workerCount Number of fetch worker threads
+     * @return True if the session opened
+     */
+    bool Initialize(size_t workerCount = 2);
+
+    /**
+     * @brief Drain workers, close pooled connections and the session
+     */
+    void Shutdown();
+
+    /**
+     * @brief Fetch asynchronously; the callback fires exactly once
+     *
+     * Served from cache immediately when fresh; otherwise coalesced
+     * with any in-flight fetch of the same URL or queued to a worker.
+     */
+    void FetchAsync(const HttpFetchRequest& request, HttpFetchCallback callback);
+
+    /**
+     * @brief Fetch synchronously (blocks the calling thread)
+     * @return Fetch result; inspect success and statusCode
+     */
+    HttpFetchResult Fetch(const HttpFetchRequest& request);
+
+    /**
+     * @brief Drop all cached responses
+     */
+    void ClearCache();
+
+    // === Statistics ===
+
+    struct Statistics {
+        uint64_t totalRequests = 0;
+        uint64_t cacheHits = 0;          // Served fresh from cache
+        uint64_t coalescedRequests = 0;  // Joined an in-flight fetch
+        uint64_t revalidations304 = 0;   // Conditional GET answered 304
+        uint64_t networkFetches = 0;
+        uint64_t bytesFetched = 0;
+        size_t pooledConnections = 0;
+        size_t cachedEntries = 0;
+    };
+
+    Statistics GetStatistics() const;
+
+private:
+    HttpFetchService() = default;
+    ~HttpFetchService();
+
+    HttpFetchService(const HttpFetchService&) = delete;
+    HttpFetchService& operator=(const HttpFetchService&) = delete;
+
+    struct CacheEntry {
+        std::vector<uint8_t> body;
+        std::wstring etag;
+        DWORD statusCode = 0;
+        ULONGLONG fetchedTick = 0;  // GetTickCount64 at fetch/revalidate
+        DWORD ttlMs = 0;
+    };
+
+    struct PendingFetch {
+        HttpFetchRequest request;
+        std::vector<HttpFetchCallback> callbacks;
+    };
+
+    // Worker pipeline
+    void WorkerLoop();
+    void ExecuteFetch(const std::wstring& url);
+    HttpFetchResult PerformNetworkFetch(const HttpFetchRequest& request,
+                                        const std::wstring& ifNoneMatchEtag);
+
+    // Connection pool (host:port -> open WinHTTP connection)
+    HINTERNET AcquireConnection(const std::wstring& host, INTERNET_PORT port);
+
+    // Cache helpers; cacheMutex_ must be held
+    bool TryServeFromCache(const std::wstring& url, HttpFetchResult& result);
+    void StoreInCache(const std::wstring& url, const HttpFetchRequest& request,
+                      const HttpFetchResult& result);
+    void EvictOldestIfNeeded();
+
+    static constexpr size_t MAX_CACHE_ENTRIES = 64;
+
+    // Session and connection pool
+    HINTERNET session_ = nullptr;
+    std::map<std::wstring, HINTERNET> connectionsByHost_;
+    mutable std::mutex connectionMutex_;
+
+    // In-flight coalescing and work queue (keyed by URL)
+    std::unordered_map<std::wstring, PendingFetch> inflight_;
+    std::deque<std::wstring> fetchQueue_;
+    std::mutex inflightMutex_;
+    std::condition_variable fetchCondition_;
+
+    // Response cache
+    std::unordered_map<std::wstring, CacheEntry> cache_;
+    mutable std::mutex cacheMutex_;
+
+    // Workers
+    std::vector<std::thread> workers_;
+    std::atomic<bool> running_{false};
+    std::atomic<bool> stopRequested_{false};
+
+    // Statistics
+    mutable std::mutex statsMutex_;
+    Statistics stats_;
+};
+
+} // namespace Core
+} // namespace RainmeterManager
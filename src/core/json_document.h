@@ -0,0 +1,670 @@
+#pragma once
+// json_document.h - Shared lazy JSON parsing layer
+// Copyright (c) 2025 RainmeterManager. All rights reserved.
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define RM_JSON_SSE2 1
+#else
+#define RM_JSON_SSE2 0
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace RainmeterManager {
+namespace Core {
+
+/**
+ * @brief Two-stage lazy JSON parser shared by config load and widget
+ * content refresh
+ *
+ * Stage one scans the raw text for structural characters ({ } [ ] : ,
+ * and string quotes) sixteen bytes at a time with SSE2 compares and
+ * records their offsets in a structural index; no tree is built and no
+ * value is copied or converted. Stage two is on demand: a JsonCursor
+ * navigates the structural index when a consumer asks for a member or
+ * element, and only the fields actually read pay for string unescaping
+ * or number conversion. Widgets that poll chunky API responses every
+ * few seconds touch a handful of fields out of kilobytes of payload,
+ * so skipping the unread remainder is where the win comes from.
+ *
+ * The document views the caller's buffer (it does not copy), so the
+ * buffer must outlive any cursor into it. The structural index vector
+ * is reused across Parse calls; long-lived consumers keep a document
+ * as a member (or borrow one from JsonDocumentPool) so refresh loops
+ * allocate nothing in steady state.
+ *
+ * Member lookup compares key bytes raw, without unescaping - keys
+ * containing escape sequences will not match, which no config or API
+ * schema in this codebase uses.
+ */
+class JsonDocument {
+public:
+    JsonDocument() = default;
+
+    JsonDocument(const JsonDocument&) = delete;
+    JsonDocument& operator=(const JsonDocument&) = delete;
+    JsonDocument(JsonDocument&&) = default;
+    JsonDocument& operator=(JsonDocument&&) = default;
+
+    /**
+     * @brief Build the structural index over the caller's buffer
+     * @return false on empty input, input over 4 GB, or an unterminated
+     *         string; structural soundness beyond that is checked lazily
+     *         during navigation
+     */
+    bool Parse(const char* data, size_t size);
+    bool Parse(const std::string& text) { return Parse(text.data(), text.size()); }
+    bool Parse(const std::vector<uint8_t>& data) {
+        return Parse(reinterpret_cast<const char*>(data.data()), data.size());
+    }
+
+    /**
+     * @brief Cursor at the top-level value (invalid before Parse)
+     */
+    class JsonCursor Root() const;
+
+    void Reset() {
+        text_ = nullptr;
+        size_ = 0;
+        structural_.clear();
+    }
+
+private:
+    friend class JsonCursor;
+
+    const char* text_ = nullptr;
+    size_t size_ = 0;
+    std::vector<uint32_t> structural_;  // offsets of structural chars and string quotes
+
+    size_t SkipWhitespace(size_t offset) const {
+        while (offset < size_ &&
+               (text_[offset] == ' ' || text_[offset] == '\t' ||
+                text_[offset] == '\n' || text_[offset] == '\r')) {
+            ++offset;
+        }
+        return offset;
+    }
+
+    // A quote preceded by an odd number of backslashes is escaped.
+    // Escapes are rare in config and API payloads, so the backward walk
+    // here is cheaper than tracking backslashes in the SIMD stage.
+    bool IsEscapedQuote(size_t offset) const {
+        size_t backslashes = 0;
+        while (offset > 0 && text_[offset - 1] == '\\') {
+            ++backslashes;
+            --offset;
+        }
+        return (backslashes & 1) != 0;
+    }
+};
+
+/**
+ * @brief Lazy handle to one JSON value inside a JsonDocument
+ *
+ * Navigation (Member, Element, ForEach*) walks the structural index;
+ * accessors (AsString, AsDouble, AsInt, AsBool) convert only the value
+ * they are called on. Malformed structure surfaces as invalid cursors
+ * rather than exceptions, matching the bool-returning style of the
+ * config loaders that consume this.
+ */
+class JsonCursor {
+public:
+    JsonCursor() = default;
+
+    bool IsValid() const { return doc_ != nullptr; }
+
+    bool IsObject() const { return FirstChar() == '{'; }
+    bool IsArray() const { return FirstChar() == '['; }
+    bool IsString() const { return FirstChar() == '"'; }
+    bool IsBool() const { char c = FirstChar(); return c == 't' || c == 'f'; }
+    bool IsNull() const { return FirstChar() == 'n'; }
+    bool IsNumber() const {
+        char c = FirstChar();
+        return c == '-' || (c >= '0' && c <= '9');
+    }
+
+    /**
+     * @brief Look up an object member by key; invalid cursor if absent
+     */
+    JsonCursor Member(const char* name) const;
+    JsonCursor Member(const std::string& name) const { return Member(name.c_str()); }
+
+    /**
+     * @brief Index into an array; invalid cursor when out of range
+     */
+    JsonCursor Element(size_t index) const;
+
+    /**
+     * @brief Visit object members in order; fn(const std::string& key,
+     *        const JsonCursor& value). Stops on malformed structure.
+     */
+    template <typename Fn>
+    void ForEachMember(Fn fn) const;
+
+    /**
+     * @brief Visit array elements in order; fn(const JsonCursor& value)
+     */
+    template <typename Fn>
+    void ForEachElement(Fn fn) const;
+
+    /**
+     * @brief String value with escapes resolved (\uXXXX encodes UTF-8);
+     *        fallback when the cursor is not a string
+     */
+    std::string AsString(const std::string& fallback = std::string()) const;
+
+    double AsDouble(double fallback = 0.0) const;
+    int64_t AsInt(int64_t fallback = 0) const;
+    bool AsBool(bool fallback = false) const;
+
+    /**
+     * @brief Raw trimmed text of the value as it appears in the buffer
+     *        (quotes included for strings) - handy when a consumer
+     *        stores settings as strings regardless of JSON type
+     */
+    std::string RawText() const;
+
+private:
+    friend class JsonDocument;
+
+    JsonCursor(const JsonDocument* doc, size_t valueOffset, size_t tokenIndex)
+        : doc_(doc), valueOffset_(valueOffset), tokenIndex_(tokenIndex) {}
+
+    const JsonDocument* doc_ = nullptr;
+    size_t valueOffset_ = 0;  // byte offset of the value's first character
+    size_t tokenIndex_ = 0;   // structural index entry at or after valueOffset_
+
+    char FirstChar() const {
+        return (doc_ && valueOffset_ < doc_->size_) ? doc_->text_[valueOffset_] : '\0';
+    }
+
+    char TokenChar(size_t index) const { return doc_->text_[doc_->structural_[index]]; }
+    size_t TokenOffset(size_t index) const { return doc_->structural_[index]; }
+    size_t TokenCount() const { return doc_->structural_.size(); }
+
+    // Returns the structural index entry immediately after this value
+    // (the , } or ] that follows it), or TokenCount() on malformed
+    // structure / end of input.
+    size_t SkipValue() const;
+
+    // End offset of a scalar value: the next structural token, or end
+    // of the buffer for a bare top-level scalar.
+    size_t ScalarEnd() const {
+        return tokenIndex_ < TokenCount() ? TokenOffset(tokenIndex_) : doc_->size_;
+    }
+};
+
+// ---------------------------------------------------------------------------
+// JsonDocument implementation
+// ---------------------------------------------------------------------------
+
+inline bool JsonDocument::Parse(const char* data, size_t size) {
+    text_ = data;
+    size_ = size;
+    structural_.clear();
+
+    if (!data || size == 0 || size > UINT32_MAX) {
+        text_ = nullptr;
+        size_ = 0;
+        return false;
+    }
+
+    bool inString = false;
+    size_t pos = 0;
+
+#if RM_JSON_SSE2
+    // SIMD stage: classify sixteen bytes per compare into a candidate
+    // bitmask, then visit only the set bits. Typical payloads are well
+    // under one structural character per sixteen bytes, so the scalar
+    // state machine below runs on a small fraction of the input.
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i braceO = _mm_set1_epi8('{');
+    const __m128i braceC = _mm_set1_epi8('}');
+    const __m128i brackO = _mm_set1_epi8('[');
+    const __m128i brackC = _mm_set1_epi8(']');
+    const __m128i colon = _mm_set1_epi8(':');
+    const __m128i comma = _mm_set1_epi8(',');
+
+    while (pos + 16 <= size) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+        __m128i hits = _mm_cmpeq_epi8(chunk, quote);
+        hits = _mm_or_si128(hits, _mm_cmpeq_epi8(chunk, braceO));
+        hits = _mm_or_si128(hits, _mm_cmpeq_epi8(chunk, braceC));
+        hits = _mm_or_si128(hits, _mm_cmpeq_epi8(chunk, brackO));
+        hits = _mm_or_si128(hits, _mm_cmpeq_epi8(chunk, brackC));
+        hits = _mm_or_si128(hits, _mm_cmpeq_epi8(chunk, colon));
+        hits = _mm_or_si128(hits, _mm_cmpeq_epi8(chunk, comma));
+
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(hits));
+        while (mask != 0) {
+#ifdef _MSC_VER
+            unsigned long bit;
+            _BitScanForward(&bit, mask);
+#else
+            unsigned bit = static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+            mask &= mask - 1;
+
+            size_t at = pos + bit;
+            char c = data[at];
+            if (c == '"') {
+                if (!inString) {
+                    inString = true;
+                    structural_.push_back(static_cast<uint32_t>(at));
+                } else if (!IsEscapedQuote(at)) {
+                    inString = false;
+                    structural_.push_back(static_cast<uint32_t>(at));
+                }
+            } else if (!inString) {
+                structural_.push_back(static_cast<uint32_t>(at));
+            }
+        }
+        pos += 16;
+    }
+#endif
+
+    // Scalar stage: the whole input without SSE2, the tail with it
+    for (; pos < size; ++pos) {
+        char c = data[pos];
+        if (c == '"') {
+            if (!inString) {
+                inString = true;
+                structural_.push_back(static_cast<uint32_t>(pos));
+            } else if (!IsEscapedQuote(pos)) {
+                inString = false;
+                structural_.push_back(static_cast<uint32_t>(pos));
+            }
+        } else if (!inString &&
+                   (c == '{' || c == '}' || c == '[' || c == ']' || c == ':' || c == ',')) {
+            structural_.push_back(static_cast<uint32_t>(pos));
+        }
+    }
+
+    if (inString) {
+        text_ = nullptr;
+        size_ = 0;
+        structural_.clear();
+        return false;
+    }
+    return true;
+}
+
+inline JsonCursor JsonDocument::Root() const {
+    if (!text_) {
+        return JsonCursor();
+    }
+    size_t start = SkipWhitespace(0);
+    if (start >= size_) {
+        return JsonCursor();
+    }
+    // First structural entry at or after the value start; for a bare
+    // scalar root there is none and the cursor's token index is the
+    // end sentinel.
+    size_t tokenIndex = 0;
+    while (tokenIndex < structural_.size() && structural_[tokenIndex] < start) {
+        ++tokenIndex;
+    }
+    return JsonCursor(this, start, tokenIndex);
+}
+
+// ---------------------------------------------------------------------------
+// JsonCursor implementation
+// ---------------------------------------------------------------------------
+
+inline size_t JsonCursor::SkipValue() const {
+    size_t end = TokenCount();
+    char first = FirstChar();
+
+    if (first == '{' || first == '[') {
+        if (tokenIndex_ >= end || TokenOffset(tokenIndex_) != valueOffset_) {
+            return end;
+        }
+        size_t depth = 0;
+        for (size_t i = tokenIndex_; i < end; ++i) {
+            char c = TokenChar(i);
+            if (c == '{' || c == '[') {
+                ++depth;
+            } else if (c == '}' || c == ']') {
+                if (--depth == 0) {
+                    return i + 1;
+                }
+            }
+        }
+        return end;  // unbalanced
+    }
+
+    if (first == '"') {
+        // Strings contribute exactly two structural entries (escaped
+        // quotes are filtered during the scan)
+        return tokenIndex_ + 2 <= end ? tokenIndex_ + 2 : end;
+    }
+
+    // Scalar: already positioned on the token that follows it
+    return tokenIndex_;
+}
+
+inline JsonCursor JsonCursor::Member(const char* name) const {
+    if (!IsValid() || !IsObject() || !name) {
+        return JsonCursor();
+    }
+    const size_t nameLen = std::strlen(name);
+    JsonCursor result;
+    ForEachMember([&](const std::string& key, const JsonCursor& value) {
+        if (!result.IsValid() && key.size() == nameLen &&
+            std::memcmp(key.data(), name, nameLen) == 0) {
+            result = value;
+        }
+    });
+    return result;
+}
+
+inline JsonCursor JsonCursor::Element(size_t index) const {
+    if (!IsValid() || !IsArray()) {
+        return JsonCursor();
+    }
+    JsonCursor result;
+    size_t current = 0;
+    ForEachElement([&](const JsonCursor& value) {
+        if (current++ == index) {
+            result = value;
+        }
+    });
+    return result;
+}
+
+template <typename Fn>
+inline void JsonCursor::ForEachMember(Fn fn) const {
+    if (!IsValid() || !IsObject()) {
+        return;
+    }
+    const size_t end = TokenCount();
+    size_t i = tokenIndex_;
+    if (i >= end || TokenOffset(i) != valueOffset_) {
+        return;
+    }
+    ++i;  // past '{'
+
+    while (i < end && TokenChar(i) != '}') {
+        // Key string: open and close quotes are consecutive entries
+        if (TokenChar(i) != '"' || i + 2 >= end || TokenChar(i + 2) != ':') {
+            return;  // malformed
+        }
+        size_t keyStart = TokenOffset(i) + 1;
+        size_t keyEnd = TokenOffset(i + 1);
+        std::string key(doc_->text_ + keyStart, keyEnd - keyStart);
+
+        size_t valueStart = doc_->SkipWhitespace(TokenOffset(i + 2) + 1);
+        JsonCursor value(doc_, valueStart, i + 3);
+        fn(key, value);
+
+        size_t after = value.SkipValue();
+        if (after >= end) {
+            return;
+        }
+        if (TokenChar(after) == ',') {
+            i = after + 1;
+        } else if (TokenChar(after) == '}') {
+            return;
+        } else {
+            return;  // malformed
+        }
+    }
+}
+
+template <typename Fn>
+inline void JsonCursor::ForEachElement(Fn fn) const {
+    if (!IsValid() || !IsArray()) {
+        return;
+    }
+    const size_t end = TokenCount();
+    size_t i = tokenIndex_;
+    if (i >= end || TokenOffset(i) != valueOffset_) {
+        return;
+    }
+
+    // Empty array: '[' directly followed by ']'
+    size_t firstStart = doc_->SkipWhitespace(valueOffset_ + 1);
+    if (firstStart < doc_->size_ && doc_->text_[firstStart] == ']') {
+        return;
+    }
+
+    ++i;  // past '['
+    size_t valueStart = firstStart;
+    while (i <= end) {
+        JsonCursor value(doc_, valueStart, i);
+        fn(value);
+
+        size_t after = value.SkipValue();
+        if (after >= end) {
+            return;
+        }
+        if (TokenChar(after) == ',') {
+            valueStart = doc_->SkipWhitespace(TokenOffset(after) + 1);
+            i = after + 1;
+        } else {
+            return;  // ']' or malformed
+        }
+    }
+}
+
+inline std::string JsonCursor::AsString(const std::string& fallback) const {
+    if (!IsValid() || !IsString()) {
+        return fallback;
+    }
+    if (tokenIndex_ + 1 >= TokenCount()) {
+        return fallback;
+    }
+    size_t start = TokenOffset(tokenIndex_) + 1;
+    size_t stop = TokenOffset(tokenIndex_ + 1);
+
+    std::string out;
+    out.reserve(stop - start);
+    for (size_t i = start; i < stop; ++i) {
+        char c = doc_->text_[i];
+        if (c != '\\' || i + 1 >= stop) {
+            out.push_back(c);
+            continue;
+        }
+        char escape = doc_->text_[++i];
+        switch (escape) {
+            case '"': out.push_back('"'); break;
+            case '\\': out.push_back('\\'); break;
+            case '/': out.push_back('/'); break;
+            case 'b': out.push_back('\b'); break;
+            case 'f': out.push_back('\f'); break;
+            case 'n': out.push_back('\n'); break;
+            case 'r': out.push_back('\r'); break;
+            case 't': out.push_back('\t'); break;
+            case 'u': {
+                if (i + 4 >= stop) {
+                    break;
+                }
+                auto hex4 = [this](size_t at) {
+                    unsigned value = 0;
+                    for (int nibble = 0; nibble < 4; ++nibble) {
+                        char h = doc_->text_[at + nibble];
+                        value <<= 4;
+                        if (h >= '0' && h <= '9') value |= static_cast<unsigned>(h - '0');
+                        else if (h >= 'a' && h <= 'f') value |= static_cast<unsigned>(h - 'a' + 10);
+                        else if (h >= 'A' && h <= 'F') value |= static_cast<unsigned>(h - 'A' + 10);
+                    }
+                    return value;
+                };
+                unsigned codepoint = hex4(i + 1);
+                i += 4;
+
+                // Non-BMP characters arrive as UTF-16 surrogate pairs;
+                // combine them into the supplementary code point. A lone
+                // surrogate has no valid UTF-8 form, so it degrades to
+                // U+FFFD instead of emitting the raw surrogate bytes.
+                if (codepoint >= 0xD800 && codepoint <= 0xDBFF) {
+                    if (i + 6 < stop && doc_->text_[i + 1] == '\\' &&
+                        doc_->text_[i + 2] == 'u') {
+                        unsigned low = hex4(i + 3);
+                        if (low >= 0xDC00 && low <= 0xDFFF) {
+                            codepoint = 0x10000 +
+                                        ((codepoint - 0xD800) << 10) + (low - 0xDC00);
+                            i += 6;
+                        } else {
+                            codepoint = 0xFFFD;
+                        }
+                    } else {
+                        codepoint = 0xFFFD;
+                    }
+                } else if (codepoint >= 0xDC00 && codepoint <= 0xDFFF) {
+                    codepoint = 0xFFFD;
+                }
+
+                if (codepoint < 0x80) {
+                    out.push_back(static_cast<char>(codepoint));
+                } else if (codepoint < 0x800) {
+                    out.push_back(static_cast<char>(0xC0 | (codepoint >> 6)));
+                    out.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+                } else if (codepoint < 0x10000) {
+                    out.push_back(static_cast<char>(0xE0 | (codepoint >> 12)));
+                    out.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+                    out.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+                } else {
+                    out.push_back(static_cast<char>(0xF0 | (codepoint >> 18)));
+                    out.push_back(static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F)));
+                    out.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+                    out.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+                }
+                break;
+            }
+            default: out.push_back(escape); break;
+        }
+    }
+    return out;
+}
+
+inline double JsonCursor::AsDouble(double fallback) const {
+    if (!IsValid() || !IsNumber()) {
+        return fallback;
+    }
+    // Numbers are short; a stack copy gives strtod its terminator
+    char buffer[64];
+    size_t len = ScalarEnd() - valueOffset_;
+    if (len >= sizeof(buffer)) {
+        len = sizeof(buffer) - 1;
+    }
+    std::memcpy(buffer, doc_->text_ + valueOffset_, len);
+    buffer[len] = '\0';
+
+    char* parseEnd = nullptr;
+    double value = std::strtod(buffer, &parseEnd);
+    return parseEnd != buffer ? value : fallback;
+}
+
+inline int64_t JsonCursor::AsInt(int64_t fallback) const {
+    if (!IsValid() || !IsNumber()) {
+        return fallback;
+    }
+    char buffer[64];
+    size_t len = ScalarEnd() - valueOffset_;
+    if (len >= sizeof(buffer)) {
+        len = sizeof(buffer) - 1;
+    }
+    std::memcpy(buffer, doc_->text_ + valueOffset_, len);
+    buffer[len] = '\0';
+
+    char* parseEnd = nullptr;
+    long long value = std::strtoll(buffer, &parseEnd, 10);
+    if (parseEnd == buffer) {
+        return fallback;
+    }
+    // Fractional / exponent forms round through the double path
+    if (*parseEnd == '.' || *parseEnd == 'e' || *parseEnd == 'E') {
+        return static_cast<int64_t>(AsDouble(static_cast<double>(fallback)));
+    }
+    return static_cast<int64_t>(value);
+}
+
+inline bool JsonCursor::AsBool(bool fallback) const {
+    if (!IsValid()) {
+        return fallback;
+    }
+    size_t remaining = doc_->size_ - valueOffset_;
+    if (remaining >= 4 && std::memcmp(doc_->text_ + valueOffset_, "true", 4) == 0) {
+        return true;
+    }
+    if (remaining >= 5 && std::memcmp(doc_->text_ + valueOffset_, "false", 5) == 0) {
+        return false;
+    }
+    return fallback;
+}
+
+inline std::string JsonCursor::RawText() const {
+    if (!IsValid()) {
+        return std::string();
+    }
+    size_t stop;
+    if (IsString()) {
+        stop = tokenIndex_ + 1 < TokenCount() ? TokenOffset(tokenIndex_ + 1) + 1
+                                              : doc_->size_;
+    } else if (IsObject() || IsArray()) {
+        size_t after = SkipValue();
+        stop = after > 0 && after <= TokenCount() ? TokenOffset(after - 1) + 1
+                                                  : doc_->size_;
+    } else {
+        stop = ScalarEnd();
+    }
+    // Trim trailing whitespace left between the value and its delimiter
+    while (stop > valueOffset_ &&
+           (doc_->text_[stop - 1] == ' ' || doc_->text_[stop - 1] == '\t' ||
+            doc_->text_[stop - 1] == '\n' || doc_->text_[stop - 1] == '\r')) {
+        --stop;
+    }
+    return std::string(doc_->text_ + valueOffset_, stop - valueOffset_);
+}
+
+/**
+ * @brief Small pool of parse documents for transient consumers
+ *
+ * Mirrors the scratch-buffer pool on the render pipe: Acquire hands
+ * back a document whose structural index keeps its previous capacity,
+ * Release returns it. Callers with a natural home for a document (a
+ * widget instance, a loader) should just hold one as a member instead.
+ */
+class JsonDocumentPool {
+public:
+    explicit JsonDocumentPool(size_t capacity = 8) : capacity_(capacity) {}
+
+    JsonDocument Acquire() {
+        std::lock_guard<std::mutex> lock(poolMutex_);
+        if (!pool_.empty()) {
+            JsonDocument doc = std::move(pool_.back());
+            pool_.pop_back();
+            doc.Reset();
+            return doc;
+        }
+        return JsonDocument();
+    }
+
+    void Release(JsonDocument&& doc) {
+        doc.Reset();
+        std::lock_guard<std::mutex> lock(poolMutex_);
+        if (pool_.size() < capacity_) {
+            pool_.push_back(std::move(doc));
+        }
+    }
+
+private:
+    size_t capacity_;
+    std::mutex poolMutex_;
+    std::vector<JsonDocument> pool_;
+};
+
+} // namespace Core
+} // namespace RainmeterManager
@@ -12,8 +12,16 @@ LogLevel Logger::minLogLevel = LogLevel::INFO;
 LogRotationConfig Logger::rotationConfig;
 bool Logger::asyncLoggingEnabled = false;
 bool Logger::consoleOutputEnabled = true;
-std::queue<LogEntry> Logger::logQueue;
+std::unique_ptr<Logger::LogSlot[]> Logger::slotRing = nullptr;
+std::atomic<uint64_t> Logger::slotEnqueuePos{0};
+uint64_t Logger::slotDequeuePos = 0;
+std::atomic<uint64_t> Logger::droppedLogCount{0};
 std::thread Logger::loggingThread;
+std::unique_ptr<std::ofstream> Logger::binaryLogFile = nullptr;
+std::mutex Logger::binaryLogMutex;
+std::atomic<bool> Logger::binaryLoggingEnabled{false};
+std::vector<std::string> Logger::templateRegistry;
+std::string Logger::binaryLogPath;
 std::condition_variable Logger::logCondition;
 std::mutex Logger::queueMutex;
 bool Logger::shutdownRequested = false;
@@ -28,6 +36,7 @@ bool Logger::initialize(const std::string& logFilePath, LogRotationConfig config
             return false;
         }
         if (asyncLoggingEnabled) {
+            initializeSlotRing();
             loggingThread = std::thread(processLogQueue);
         }
     }
@@ -38,10 +47,20 @@ bool Logger::initialize(const std::string& logFilePath, LogRotationConfig config
 
 void Logger::log(LogLevel level, const std::string& message, const char* file, int line, const char* function) {
     if (!shouldLog(level)) return;
-    
+
     const char* fileCStr = file ? file : "";
     const char* funcCStr = function ? function : "";
 
+    if (asyncLoggingEnabled) {
+        // Hot path: one slot claim plus inline copies, no heap, no mutex.
+        // A full ring drops the message and bumps the counter instead of
+        // blocking the caller.
+        if (enqueueSlot(level, message, fileCStr, line, funcCStr)) {
+            logCondition.notify_one();
+        }
+        return;
+    }
+
     LogEntry entry = {
         level,
         message,
@@ -51,16 +70,10 @@ void Logger::log(LogLevel level, const std::string& message, const char* file, i
         line,
         std::string(funcCStr)
     };
-    
-    if (asyncLoggingEnabled) {
-        std::lock_guard<std::mutex> lock(queueMutex);
-        logQueue.push(entry);
-        logCondition.notify_one();
-    } else {
-        writeToFile(entry);
-        if (consoleOutputEnabled) {
-            writeToConsole(entry);
-        }
+
+    writeToFile(entry);
+    if (consoleOutputEnabled) {
+        writeToConsole(entry);
     }
 }
 
@@ -241,22 +254,131 @@ void Logger::writeToConsole(const LogEntry& entry) {
 
 void Logger::processLogQueue() {
     while (!shutdownRequested) {
-        std::unique_lock<std::mutex> lock(queueMutex);
-        logCondition.wait(lock, [] { return !logQueue.empty() || shutdownRequested; });
-        
-        while (!logQueue.empty()) {
-            LogEntry entry = logQueue.front();
-            logQueue.pop();
-            lock.unlock();
-            
-            writeToFile(entry);
-            if (consoleOutputEnabled) {
-                writeToConsole(entry);
+        // Timed wait instead of a predicate: producers notify without the
+        // mutex, so a missed wakeup only delays the drain by one interval
+        {
+            std::unique_lock<std::mutex> lock(queueMutex);
+            logCondition.wait_for(lock, std::chrono::milliseconds(10));
+        }
+
+        drainSlotRing();
+    }
+
+    // Final drain so shutdown never loses buffered messages
+    drainSlotRing();
+}
+
+void Logger::initializeSlotRing() {
+    if (slotRing) {
+        return;
+    }
+
+    slotRing.reset(new LogSlot[ASYNC_RING_SIZE]);
+    for (uint64_t i = 0; i < ASYNC_RING_SIZE; ++i) {
+        slotRing[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    slotEnqueuePos.store(0);
+    slotDequeuePos = 0;
+}
+
+bool Logger::enqueueSlot(LogLevel level, const std::string& message,
+                         const char* file, int line, const char* function) {
+    if (!slotRing) {
+        return false;
+    }
+
+    uint64_t pos = slotEnqueuePos.load(std::memory_order_relaxed);
+    LogSlot* slot = nullptr;
+
+    for (;;) {
+        slot = &slotRing[pos & (ASYNC_RING_SIZE - 1)];
+        uint64_t seq = slot->sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+        if (diff == 0) {
+            if (slotEnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
             }
-            
-            lock.lock();
+        } else if (diff < 0) {
+            // Ring full: drop rather than block the caller
+            droppedLogCount.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        } else {
+            pos = slotEnqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->level = level;
+    slot->line = line;
+    slot->timestamp = std::chrono::system_clock::now();
+    slot->threadId = GetCurrentThreadId();
+
+    // Inline truncating copies; strip the path from __FILE__ without
+    // touching std::filesystem on the hot path
+    const char* fileName = file;
+    for (const char* p = file; *p; ++p) {
+        if (*p == '\\' || *p == '/') {
+            fileName = p + 1;
         }
     }
+
+    strncpy_s(slot->message, message.c_str(), _TRUNCATE);
+    strncpy_s(slot->file, fileName, _TRUNCATE);
+    strncpy_s(slot->function, function, _TRUNCATE);
+
+    // Publish the slot to the consumer
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+bool Logger::dequeueSlot(LogEntry& entry) {
+    if (!slotRing) {
+        return false;
+    }
+
+    LogSlot& slot = slotRing[slotDequeuePos & (ASYNC_RING_SIZE - 1)];
+    uint64_t seq = slot.sequence.load(std::memory_order_acquire);
+
+    if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(slotDequeuePos + 1) < 0) {
+        return false; // Ring empty
+    }
+
+    entry.level = slot.level;
+    entry.message = slot.message;
+    entry.timestamp = slot.timestamp;
+    entry.threadId = std::to_string(slot.threadId);
+    entry.file = slot.file;
+    entry.line = slot.line;
+    entry.function = slot.function;
+
+    // Hand the slot back to the producers
+    slot.sequence.store(slotDequeuePos + ASYNC_RING_SIZE, std::memory_order_release);
+    slotDequeuePos++;
+    return true;
+}
+
+void Logger::drainSlotRing() {
+    LogEntry entry;
+    while (dequeueSlot(entry)) {
+        writeToFile(entry);
+        if (consoleOutputEnabled) {
+            writeToConsole(entry);
+        }
+    }
+
+    uint64_t dropped = droppedLogCount.exchange(0, std::memory_order_relaxed);
+    if (dropped > 0) {
+        LogEntry dropEntry = {
+            LogLevel::WARNING,
+            "Async log ring overflow: dropped " + std::to_string(dropped) + " message(s)",
+            std::chrono::system_clock::now(),
+            getThreadId(),
+            "logger.cpp",
+            0,
+            "drainSlotRing"
+        };
+        writeToFile(dropEntry);
+    }
 }
 
 void Logger::rotateLogFile() {
@@ -272,7 +394,161 @@ void Logger::rotateLogFile() {
     }
 }
 
+// ===== Binary structured logging =====
+
+bool Logger::enableBinaryLogging(const std::string& path) {
+    std::lock_guard<std::mutex> lock(binaryLogMutex);
+
+    binaryLogFile = std::make_unique<std::ofstream>(path, std::ios::binary | std::ios::app);
+    if (!binaryLogFile->is_open()) {
+        binaryLogFile.reset();
+        return false;
+    }
+
+    binaryLogPath = path;
+
+    // Stamp a file header on a fresh file
+    if (binaryLogFile->tellp() == std::streampos(0)) {
+        BinaryLogFileHeader header;
+        header.magic = BINARY_LOG_MAGIC;
+        header.version = BINARY_LOG_VERSION;
+        header.createdTimestamp = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count());
+        binaryLogFile->write(reinterpret_cast<const char*>(&header), sizeof(header));
+    }
+
+    // Re-emit known templates so each file is self-describing
+    for (size_t i = 0; i < templateRegistry.size(); ++i) {
+        writeTemplateDefinition(static_cast<uint32_t>(i), templateRegistry[i]);
+    }
+
+    binaryLoggingEnabled = true;
+    return true;
+}
+
+void Logger::disableBinaryLogging() {
+    std::lock_guard<std::mutex> lock(binaryLogMutex);
+    binaryLoggingEnabled = false;
+    if (binaryLogFile) {
+        binaryLogFile->flush();
+        binaryLogFile->close();
+        binaryLogFile.reset();
+    }
+}
+
+bool Logger::isBinaryLoggingEnabled() {
+    return binaryLoggingEnabled.load(std::memory_order_relaxed);
+}
+
+uint32_t Logger::registerLogTemplate(const std::string& formatTemplate) {
+    std::lock_guard<std::mutex> lock(binaryLogMutex);
+
+    // Re-registering the same template returns the existing ID
+    for (size_t i = 0; i < templateRegistry.size(); ++i) {
+        if (templateRegistry[i] == formatTemplate) {
+            return static_cast<uint32_t>(i);
+        }
+    }
+
+    uint32_t templateId = static_cast<uint32_t>(templateRegistry.size());
+    templateRegistry.push_back(formatTemplate);
+
+    if (binaryLogFile && binaryLogFile->is_open()) {
+        writeTemplateDefinition(templateId, formatTemplate);
+    }
+
+    return templateId;
+}
+
+void Logger::logBinaryRaw(uint32_t templateId, LogLevel level,
+                          const void* args, size_t argBytes, uint8_t argCount,
+                          int line) {
+    if (!isBinaryLoggingEnabled() || argBytes > BINARY_ARG_CAPACITY) {
+        return;
+    }
+
+    BinaryLogRecord record;
+    record.templateId = templateId;
+    record.level = static_cast<uint8_t>(level);
+    record.argCount = argCount;
+    record.argBytes = static_cast<uint16_t>(argBytes);
+    record.threadId = GetCurrentThreadId();
+    record.line = static_cast<uint32_t>(line);
+    record.timestamp = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
+
+    std::lock_guard<std::mutex> lock(binaryLogMutex);
+    if (!binaryLogFile || !binaryLogFile->is_open()) {
+        return;
+    }
+
+    binaryLogFile->write(reinterpret_cast<const char*>(&record), sizeof(record));
+    if (argBytes > 0) {
+        binaryLogFile->write(reinterpret_cast<const char*>(args),
+                             static_cast<std::streamsize>(argBytes));
+    }
+
+    if (rotationConfig.enableRotation) {
+        rotateBinaryLogFile();
+    }
+}
+
+void Logger::writeTemplateDefinition(uint32_t templateId, const std::string& formatTemplate) {
+    // A template definition is a record with TEMPLATE_DEF_ID whose payload
+    // is the defined ID followed by the template text
+    BinaryLogRecord record;
+    record.templateId = TEMPLATE_DEF_ID;
+    record.level = static_cast<uint8_t>(LogLevel::INFO);
+    record.argCount = 1;
+    record.argBytes = static_cast<uint16_t>(sizeof(templateId) + formatTemplate.size());
+    record.threadId = GetCurrentThreadId();
+    record.line = 0;
+    record.timestamp = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
+
+    binaryLogFile->write(reinterpret_cast<const char*>(&record), sizeof(record));
+    binaryLogFile->write(reinterpret_cast<const char*>(&templateId), sizeof(templateId));
+    binaryLogFile->write(formatTemplate.data(),
+                         static_cast<std::streamsize>(formatTemplate.size()));
+}
+
+void Logger::rotateBinaryLogFile() {
+    // Size-capped via the shared LogRotationConfig; the current file is
+    // renamed to .1 (replacing the previous archive) and writing resumes
+    // at the original path
+    if (binaryLogFile) {
+        auto pos = binaryLogFile->tellp();
+        if (pos > static_cast<std::streampos>(rotationConfig.maxFileSize)) {
+            binaryLogFile->close();
+
+            std::error_code ec;
+            std::filesystem::remove(binaryLogPath + ".1", ec);
+            std::filesystem::rename(binaryLogPath, binaryLogPath + ".1", ec);
+
+            binaryLogFile = std::make_unique<std::ofstream>(
+                binaryLogPath, std::ios::binary | std::ios::trunc);
+
+            // New segment: header plus template definitions again
+            BinaryLogFileHeader header;
+            header.magic = BINARY_LOG_MAGIC;
+            header.version = BINARY_LOG_VERSION;
+            header.createdTimestamp = static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::system_clock::now().time_since_epoch()).count());
+            binaryLogFile->write(reinterpret_cast<const char*>(&header), sizeof(header));
+            for (size_t i = 0; i < templateRegistry.size(); ++i) {
+                writeTemplateDefinition(static_cast<uint32_t>(i), templateRegistry[i]);
+            }
+        }
+    }
+}
+
 void Logger::shutdown() {
+    disableBinaryLogging();
+
     if (asyncLoggingEnabled) {
         shutdownRequested = true;
         logCondition.notify_all();
@@ -310,6 +586,7 @@ void Logger::enableAsyncLogging(bool enable) {
         if (asyncLoggingEnabled != enable) {
             asyncLoggingEnabled = enable;
             if (enable && !loggingThread.joinable()) {
+                initializeSlotRing();
                 loggingThread = std::thread(processLogQueue);
                 justEnabled = true;
             } else if (!enable && loggingThread.joinable()) {
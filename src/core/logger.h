@@ -11,6 +11,9 @@
 #include <queue>
 #include <thread>
 #include <condition_variable>
+#include <atomic>
+#include <type_traits>
+#include <cstring>
 #include <windows.h>
 #include <dbghelp.h>  // For stack traces
 
@@ -70,6 +73,25 @@ struct ErrorResult {
     std::string threadId;
 };
 
+// On-disk framing for the structured binary log. Records carry a template
+// ID plus raw argument bytes; the text is reconstructed offline by a reader
+// tool, never on the hot path.
+struct BinaryLogFileHeader {
+    uint32_t magic;          // 'RMBL'
+    uint32_t version;
+    uint64_t createdTimestamp;
+};
+
+struct BinaryLogRecord {
+    uint32_t templateId;     // Registered format template (TEMPLATE_DEF_ID defines one)
+    uint8_t level;           // LogLevel
+    uint8_t argCount;
+    uint16_t argBytes;       // Size of the raw argument payload that follows
+    uint32_t threadId;
+    uint32_t line;
+    uint64_t timestamp;      // system_clock ticks (ms since epoch)
+};
+
 // Log entry structure for async logging
 struct LogEntry {
     LogLevel level;
@@ -83,12 +105,65 @@ struct LogEntry {
 
 class Logger {
 public:
+    // Async ring sizing; capacities include the null terminator
+    static constexpr size_t ASYNC_RING_SIZE = 8192;  // Must be a power of two
+    static constexpr size_t MESSAGE_INLINE_CAPACITY = 256;
+    static constexpr size_t FILE_INLINE_CAPACITY = 48;
+    static constexpr size_t FUNCTION_INLINE_CAPACITY = 64;
+
+    // Binary log format
+    static constexpr uint32_t BINARY_LOG_MAGIC = 0x524D424C;   // 'RMBL'
+    static constexpr uint32_t BINARY_LOG_VERSION = 1;
+    static constexpr uint32_t TEMPLATE_DEF_ID = 0xFFFFFFFF;    // Record defines a template
+    static constexpr size_t BINARY_ARG_CAPACITY = 192;
+
     // Initialization and configuration
     static bool initialize(const std::string& logFilePath, LogRotationConfig config = {});
     static void setLogLevel(LogLevel minLevel);
     static void enableAsyncLogging(bool enable = true);
     static void enableConsoleOutput(bool enable = true);
-    
+
+    // Structured binary logging. The hot path writes a small fixed record
+    // (template ID + raw argument bytes) and defers all text formatting to
+    // an offline reader or rotation-time conversion. Template definitions
+    // are embedded in the file as TEMPLATE_DEF_ID records, so a binary log
+    // is self-describing. Rotation follows the active LogRotationConfig.
+    static bool enableBinaryLogging(const std::string& binaryLogPath);
+    static void disableBinaryLogging();
+    static bool isBinaryLoggingEnabled();
+
+    /**
+     * Register a format template (printf-style or {}-style; the reader
+     * decides). Returns the template ID to pass to logBinary. Safe to call
+     * once at startup per call site and cache in a static.
+     */
+    static uint32_t registerLogTemplate(const std::string& formatTemplate);
+
+    // Record a binary log entry with pre-packed argument bytes
+    static void logBinaryRaw(uint32_t templateId, LogLevel level,
+                             const void* args, size_t argBytes, uint8_t argCount,
+                             int line = 0);
+
+    // Pack trivially copyable arguments inline and record them
+    template<typename... Args>
+    static void logBinary(uint32_t templateId, LogLevel level, const Args&... args) {
+        static_assert((std::is_trivially_copyable<Args>::value && ...),
+                      "logBinary arguments must be trivially copyable");
+        if (!shouldLog(level) || !isBinaryLoggingEnabled()) return;
+
+        unsigned char packed[BINARY_ARG_CAPACITY];
+        size_t offset = 0;
+        auto packOne = [&](const auto& arg) {
+            if (offset + sizeof(arg) <= sizeof(packed)) {
+                memcpy(packed + offset, &arg, sizeof(arg));
+                offset += sizeof(arg);
+            }
+        };
+        (packOne(args), ...);
+        logBinaryRaw(templateId, level, packed, offset,
+                     static_cast<uint8_t>(sizeof...(Args)));
+    }
+
     // Core logging methods
     static void log(LogLevel level, const std::string& message, const char* file = "", int line = 0, const char* function = "");
     static void trace(const std::string& message);
@@ -137,13 +212,40 @@ private:
     static bool asyncLoggingEnabled;
     static bool consoleOutputEnabled;
     
-    // Async logging infrastructure
-    static std::queue<LogEntry> logQueue;
+    // Fixed-size slot for the async ring. Strings are stored inline and
+    // truncated if needed, so enqueueing never touches the heap.
+    struct LogSlot {
+        std::atomic<uint64_t> sequence;
+        LogLevel level;
+        int line;
+        std::chrono::system_clock::time_point timestamp;
+        unsigned long threadId;
+        char message[MESSAGE_INLINE_CAPACITY];
+        char file[FILE_INLINE_CAPACITY];
+        char function[FUNCTION_INLINE_CAPACITY];
+    };
+
+    // Async logging infrastructure: a bounded lock-free MPSC ring of
+    // preallocated slots (Vyukov-style sequence numbers). Producers claim a
+    // slot with one CAS and memcpy into it; the consumer thread drains in
+    // order. When the ring is full messages are dropped and counted rather
+    // than blocking the caller.
+    static std::unique_ptr<LogSlot[]> slotRing;
+    static std::atomic<uint64_t> slotEnqueuePos;
+    static uint64_t slotDequeuePos;           // Consumer thread only
+    static std::atomic<uint64_t> droppedLogCount;
     static std::thread loggingThread;
     static std::condition_variable logCondition;
-    static std::mutex queueMutex;
+    static std::mutex queueMutex;             // Guards only the consumer's sleep
     static bool shutdownRequested;
-    
+
+    // Binary structured logging
+    static std::unique_ptr<std::ofstream> binaryLogFile;
+    static std::mutex binaryLogMutex;
+    static std::atomic<bool> binaryLoggingEnabled;
+    static std::vector<std::string> templateRegistry;  // Guarded by binaryLogMutex
+    static std::string binaryLogPath;
+
     // Helper methods
     static std::string getCurrentTimestamp();
     static std::string logLevelToString(LogLevel level);
@@ -153,6 +255,13 @@ private:
     static void writeToFile(const LogEntry& entry);
     static void writeToConsole(const LogEntry& entry);
     static std::string formatLogEntry(const LogEntry& entry);
+    static void rotateBinaryLogFile();
+    static void writeTemplateDefinition(uint32_t templateId, const std::string& formatTemplate);
+    static void initializeSlotRing();
+    static bool enqueueSlot(LogLevel level, const std::string& message,
+                            const char* file, int line, const char* function);
+    static bool dequeueSlot(LogEntry& entry);
+    static void drainSlotRing();
 };
 
 // Convenience macros for easier logging with file/line info
@@ -1,4 +1,5 @@
 #include "logger_adapter.h"
+#include "string_intern.h"
 #include <sstream>
 
 namespace RainmeterManager {
@@ -10,12 +11,7 @@ Logger& Logger::GetInstance() {
 }
 
 std::string Logger::ToUtf8(const std::wstring& w) const {
-    if (w.empty()) return std::string();
-    int sz = ::WideCharToMultiByte(CP_UTF8, 0, w.c_str(), static_cast<int>(w.size()), nullptr, 0, nullptr, nullptr);
-    if (sz <= 0) return std::string();
-    std::string out(static_cast<size_t>(sz), '\0');
-    ::WideCharToMultiByte(CP_UTF8, 0, w.c_str(), static_cast<int>(w.size()), out.data(), sz, nullptr, nullptr);
-    return out;
+    return Utf16ToUtf8(w);
 }
 
 ::LogLevel Logger::ToLegacyLevel(LogLevel lvl) const {
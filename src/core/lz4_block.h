@@ -0,0 +1,204 @@
+#pragma once
+// lz4_block.h - In-tree LZ4 block-format codec shared across subsystems
+// Copyright (c) 2025 RainmeterManager. All rights reserved.
+
+#include "error_handling.h"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace RainmeterManager {
+namespace Core {
+
+/**
+ * @brief LZ4 block-format encoder: greedy matching over a 13-bit hash
+ * table, 64 KB window, minimum match of 4
+ *
+ * Implemented in-tree because the project vendors no third-party
+ * dependencies; the output is standard LZ4 block format so any stock
+ * LZ4 binding (the C# render side, fleet telemetry endpoints) can
+ * decode it. Hoisted from NamedPipeChannel so the render pipe and the
+ * telemetry upload pipeline share one codec.
+ *
+ * @param maxInputSize Upper bound the caller enforces on payloads
+ *        (wire message cap, upload batch cap); inputs beyond it fail
+ * @return Failure(BufferFull) when the input is incompressible - the
+ *         caller should send it raw rather than pay to inflate it
+ */
+inline ::Result<void> Lz4BlockCompress(const uint8_t* data, size_t size,
+                                       size_t maxInputSize,
+                                       std::vector<uint8_t>& out) {
+    static constexpr size_t MIN_COMPRESS_INPUT = 16;
+    static constexpr unsigned HASH_BITS = 13;
+    static constexpr size_t MAX_OFFSET = 65535;
+
+    if (!data || size < MIN_COMPRESS_INPUT || size > maxInputSize) {
+        return ::Result<void>::Failure(ErrorCode::InvalidParameter,
+                                       "payload outside compressible size range");
+    }
+
+    out.clear();
+    out.reserve(size);
+
+    uint32_t table[1u << HASH_BITS] = {};
+    auto Read32 = [](const uint8_t* p) {
+        uint32_t v;
+        std::memcpy(&v, p, sizeof(v));
+        return v;
+    };
+    auto Hash = [](uint32_t v) { return (v * 2654435761u) >> (32 - HASH_BITS); };
+    auto EmitLength = [&out](size_t len) {
+        while (len >= 255) {
+            out.push_back(255);
+            len -= 255;
+        }
+        out.push_back(static_cast<uint8_t>(len));
+    };
+
+    // LZ4 block rules: the last five bytes are always literals and no
+    // match may start within the last twelve bytes of the input.
+    const size_t matchLimit = size - 5;
+    size_t anchor = 0;
+    size_t pos = 0;
+
+    while (pos + 12 <= size) {
+        uint32_t sequence = Read32(data + pos);
+        uint32_t hash = Hash(sequence);
+        size_t candidate = table[hash];
+        table[hash] = static_cast<uint32_t>(pos);
+
+        if (candidate >= pos || pos - candidate > MAX_OFFSET ||
+            Read32(data + candidate) != sequence) {
+            ++pos;
+            continue;
+        }
+
+        size_t matchLen = 4;
+        while (pos + matchLen < matchLimit &&
+               data[candidate + matchLen] == data[pos + matchLen]) {
+            ++matchLen;
+        }
+
+        size_t literalLen = pos - anchor;
+        size_t matchCode = matchLen - 4;
+        uint8_t token = static_cast<uint8_t>(
+            (literalLen < 15 ? literalLen : 15) << 4 |
+            (matchCode < 15 ? matchCode : 15));
+        out.push_back(token);
+        if (literalLen >= 15) {
+            EmitLength(literalLen - 15);
+        }
+        out.insert(out.end(), data + anchor, data + pos);
+
+        size_t offset = pos - candidate;
+        out.push_back(static_cast<uint8_t>(offset & 0xFF));
+        out.push_back(static_cast<uint8_t>(offset >> 8));
+        if (matchCode >= 15) {
+            EmitLength(matchCode - 15);
+        }
+
+        pos += matchLen;
+        anchor = pos;
+    }
+
+    // Final literal run (token has no match part)
+    size_t literalLen = size - anchor;
+    out.push_back(static_cast<uint8_t>((literalLen < 15 ? literalLen : 15) << 4));
+    if (literalLen >= 15) {
+        EmitLength(literalLen - 15);
+    }
+    out.insert(out.end(), data + anchor, data + size);
+
+    // Incompressible input: send it raw rather than paying to inflate it
+    if (out.size() >= size) {
+        return ::Result<void>::Failure(ErrorCode::BufferFull, "payload incompressible");
+    }
+    return ::Result<void>::Success();
+}
+
+/**
+ * @brief LZ4 block-format decoder with strict bounds validation
+ *
+ * Every length, offset and run is validated against the declared
+ * uncompressed size before it is applied, so corrupt or hostile frames
+ * fail with ProtocolError instead of overrunning the output.
+ */
+inline ::Result<void> Lz4BlockDecompress(const uint8_t* data, size_t size,
+                                         size_t uncompressedSize,
+                                         size_t maxOutputSize,
+                                         std::vector<uint8_t>& out) {
+    static constexpr size_t LENGTH_INVALID = static_cast<size_t>(-1);
+
+    if (!data || size == 0 || uncompressedSize > maxOutputSize) {
+        return ::Result<void>::Failure(ErrorCode::InvalidParameter,
+                                       "bad compressed frame dimensions");
+    }
+
+    out.clear();
+    out.reserve(uncompressedSize);
+
+    size_t pos = 0;
+    auto ReadLength = [&](size_t base) {
+        size_t len = base;
+        if (base == 15) {
+            uint8_t byte;
+            do {
+                if (pos >= size) {
+                    return LENGTH_INVALID;
+                }
+                byte = data[pos++];
+                len += byte;
+            } while (byte == 255);
+        }
+        return len;
+    };
+
+    while (pos < size) {
+        uint8_t token = data[pos++];
+
+        size_t literalLen = ReadLength(token >> 4);
+        if (literalLen == LENGTH_INVALID || pos + literalLen > size ||
+            out.size() + literalLen > uncompressedSize) {
+            return ::Result<void>::Failure(ErrorCode::ProtocolError, "truncated literal run");
+        }
+        out.insert(out.end(), data + pos, data + pos + literalLen);
+        pos += literalLen;
+
+        if (pos >= size) {
+            break;  // Final literal run
+        }
+
+        if (pos + 2 > size) {
+            return ::Result<void>::Failure(ErrorCode::ProtocolError, "truncated match offset");
+        }
+        size_t offset = data[pos] | (static_cast<size_t>(data[pos + 1]) << 8);
+        pos += 2;
+        if (offset == 0 || offset > out.size()) {
+            return ::Result<void>::Failure(ErrorCode::ProtocolError, "match offset out of window");
+        }
+
+        size_t matchLen = ReadLength(token & 0x0F);
+        if (matchLen == LENGTH_INVALID) {
+            return ::Result<void>::Failure(ErrorCode::ProtocolError, "truncated match length");
+        }
+        matchLen += 4;
+        if (out.size() + matchLen > uncompressedSize) {
+            return ::Result<void>::Failure(ErrorCode::ProtocolError, "match overruns declared size");
+        }
+
+        // Byte-wise copy: matches may overlap their own output
+        size_t matchPos = out.size() - offset;
+        for (size_t i = 0; i < matchLen; ++i) {
+            out.push_back(out[matchPos + i]);
+        }
+    }
+
+    if (out.size() != uncompressedSize) {
+        return ::Result<void>::Failure(ErrorCode::ProtocolError, "decoded size mismatch");
+    }
+    return ::Result<void>::Success();
+}
+
+} // namespace Core
+} // namespace RainmeterManager
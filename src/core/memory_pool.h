@@ -0,0 +1,364 @@
+#pragma once
+// memory_pool.h - Tagged arenas and pooled allocators with per-tag statistics
+// Copyright (c) 2025 RainmeterManager. All rights reserved.
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <chrono>
+#include <mutex>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace RainmeterManager {
+namespace Core {
+
+/**
+ * @brief Allocation tag identifying the owning subsystem
+ *
+ * Every allocation routed through this facility is attributed to one
+ * tag, so soak-test heap growth can be pinned to a subsystem instead of
+ * read off an undifferentiated process working set. Add a tag here (and
+ * a name in MemoryTagName) when a new subsystem adopts the facility.
+ */
+enum class MemoryTag : size_t {
+    General = 0,
+    IPC,            // IPCManager queues and framing buffers
+    Widgets,        // Widget framework update tasks and widget state
+    Telemetry,      // TelemetryService event/metric queues
+    RenderCommands, // Render-process command and message queues
+    Count
+};
+
+inline const char* MemoryTagName(MemoryTag tag) {
+    switch (tag) {
+        case MemoryTag::General:        return "General";
+        case MemoryTag::IPC:            return "IPC";
+        case MemoryTag::Widgets:        return "Widgets";
+        case MemoryTag::Telemetry:      return "Telemetry";
+        case MemoryTag::RenderCommands: return "RenderCommands";
+        default:                        return "Unknown";
+    }
+}
+
+/**
+ * @brief Point-in-time statistics for one allocation tag
+ */
+struct MemoryTagStatistics {
+    size_t liveBytes = 0;
+    size_t peakBytes = 0;
+    uint64_t totalAllocations = 0;
+    uint64_t totalFrees = 0;
+    uint64_t totalBytes = 0;
+    double allocationsPerSecond = 0.0;  // Averaged over process lifetime
+};
+
+/**
+ * @brief Process-wide tagged allocation registry and block pool
+ *
+ * Two jobs, both in service of the soak-test fragmentation problem:
+ *
+ * Attribution - every Allocate/Free updates per-tag live/peak/total
+ * counters (relaxed atomics, one cache-line-padded slot per tag, same
+ * discipline as ShardedCounters), so GetStatistics answers "which
+ * subsystem is growing" at runtime without a profiler attached.
+ *
+ * Recycling - small blocks are size-classed (powers of two up to 4KB)
+ * and freed blocks go to a bounded per-tag free list instead of back to
+ * the heap. Hot containers then churn the same few blocks forever
+ * rather than interleaving short-lived nodes with long-lived state,
+ * which is what fragments the heap over 24 hours. Oversized blocks and
+ * overflow beyond the retention cap fall through to operator new/delete.
+ *
+ * Singleton with the same lifetime discipline as Logger: constructed on
+ * first use, never destroyed order-sensitively (leaked at exit by
+ * design - the pool holds raw blocks only).
+ */
+class MemoryRegistry {
+public:
+    static MemoryRegistry& GetInstance() {
+        static MemoryRegistry* instance = new MemoryRegistry();
+        return *instance;
+    }
+
+    MemoryRegistry(const MemoryRegistry&) = delete;
+    MemoryRegistry& operator=(const MemoryRegistry&) = delete;
+
+    /**
+     * @brief Allocate a tagged block (pooled for small sizes)
+     */
+    void* Allocate(MemoryTag tag, size_t bytes) {
+        void* block = nullptr;
+        const size_t sizeClass = SizeClassFor(bytes);
+        if (sizeClass != NO_SIZE_CLASS) {
+            FreeList& list = freeLists_[static_cast<size_t>(tag)][sizeClass];
+            std::lock_guard<std::mutex> lock(list.mutex);
+            if (!list.blocks.empty()) {
+                block = list.blocks.back();
+                list.blocks.pop_back();
+            }
+        }
+        if (!block) {
+            block = ::operator new(sizeClass != NO_SIZE_CLASS ? SizeClassBytes(sizeClass)
+                                                              : bytes);
+        }
+        RecordAllocation(tag, bytes);
+        return block;
+    }
+
+    /**
+     * @brief Return a tagged block (retained on the free list up to a cap)
+     */
+    void Free(MemoryTag tag, void* block, size_t bytes) {
+        if (!block) return;
+        RecordFree(tag, bytes);
+
+        const size_t sizeClass = SizeClassFor(bytes);
+        if (sizeClass != NO_SIZE_CLASS) {
+            FreeList& list = freeLists_[static_cast<size_t>(tag)][sizeClass];
+            std::lock_guard<std::mutex> lock(list.mutex);
+            if (list.blocks.size() < MAX_RETAINED_BLOCKS) {
+                list.blocks.push_back(block);
+                return;
+            }
+        }
+        ::operator delete(block);
+    }
+
+    /**
+     * @brief Record an allocation made outside the pool (e.g. arena blocks)
+     */
+    void RecordAllocation(MemoryTag tag, size_t bytes) {
+        TagSlot& slot = slots_[static_cast<size_t>(tag)];
+        slot.totalAllocations.fetch_add(1, std::memory_order_relaxed);
+        slot.totalBytes.fetch_add(bytes, std::memory_order_relaxed);
+        const size_t live = slot.liveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+
+        // Lossy CAS max: racing updates may briefly under-report the
+        // peak, acceptable for monitoring counters
+        size_t peak = slot.peakBytes.load(std::memory_order_relaxed);
+        while (live > peak &&
+               !slot.peakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+        }
+    }
+
+    /**
+     * @brief Record a free made outside the pool
+     */
+    void RecordFree(MemoryTag tag, size_t bytes) {
+        TagSlot& slot = slots_[static_cast<size_t>(tag)];
+        slot.totalFrees.fetch_add(1, std::memory_order_relaxed);
+        slot.liveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Snapshot statistics for one tag
+     */
+    MemoryTagStatistics GetStatistics(MemoryTag tag) const {
+        const TagSlot& slot = slots_[static_cast<size_t>(tag)];
+        MemoryTagStatistics stats;
+        stats.liveBytes = slot.liveBytes.load(std::memory_order_relaxed);
+        stats.peakBytes = slot.peakBytes.load(std::memory_order_relaxed);
+        stats.totalAllocations = slot.totalAllocations.load(std::memory_order_relaxed);
+        stats.totalFrees = slot.totalFrees.load(std::memory_order_relaxed);
+        stats.totalBytes = slot.totalBytes.load(std::memory_order_relaxed);
+
+        const double elapsedSec = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - startTime_).count();
+        stats.allocationsPerSecond =
+            elapsedSec > 0.0 ? stats.totalAllocations / elapsedSec : 0.0;
+        return stats;
+    }
+
+    /**
+     * @brief One-line-per-tag report for logs and telemetry
+     */
+    std::string GetStatisticsReport() const {
+        std::ostringstream report;
+        for (size_t tag = 0; tag < static_cast<size_t>(MemoryTag::Count); ++tag) {
+            MemoryTagStatistics stats = GetStatistics(static_cast<MemoryTag>(tag));
+            if (stats.totalAllocations == 0) continue;
+            report << MemoryTagName(static_cast<MemoryTag>(tag))
+                   << ": live " << stats.liveBytes
+                   << "B, peak " << stats.peakBytes
+                   << "B, allocs " << stats.totalAllocations
+                   << " (" << stats.allocationsPerSecond << "/s)\n";
+        }
+        return report.str();
+    }
+
+private:
+    MemoryRegistry() : startTime_(std::chrono::steady_clock::now()) {}
+
+    // Size classes: 32B..4KB powers of two; larger blocks are not pooled
+    static constexpr size_t NUM_SIZE_CLASSES = 8;
+    static constexpr size_t MIN_CLASS_BYTES = 32;
+    static constexpr size_t NO_SIZE_CLASS = static_cast<size_t>(-1);
+
+    // Retention cap per (tag, class) bounds how much freed memory the
+    // pool holds back from the heap
+    static constexpr size_t MAX_RETAINED_BLOCKS = 256;
+
+    static size_t SizeClassBytes(size_t sizeClass) {
+        return MIN_CLASS_BYTES << sizeClass;
+    }
+
+    static size_t SizeClassFor(size_t bytes) {
+        size_t classBytes = MIN_CLASS_BYTES;
+        for (size_t sizeClass = 0; sizeClass < NUM_SIZE_CLASSES; ++sizeClass) {
+            if (bytes <= classBytes) return sizeClass;
+            classBytes <<= 1;
+        }
+        return NO_SIZE_CLASS;
+    }
+
+    // Padded so no two tags' counters share a cache line
+    struct alignas(64) TagSlot {
+        std::atomic<size_t> liveBytes{0};
+        std::atomic<size_t> peakBytes{0};
+        std::atomic<uint64_t> totalAllocations{0};
+        std::atomic<uint64_t> totalFrees{0};
+        std::atomic<uint64_t> totalBytes{0};
+    };
+
+    struct FreeList {
+        std::mutex mutex;
+        std::vector<void*> blocks;
+    };
+
+    TagSlot slots_[static_cast<size_t>(MemoryTag::Count)];
+    FreeList freeLists_[static_cast<size_t>(MemoryTag::Count)][NUM_SIZE_CLASSES];
+    std::chrono::steady_clock::time_point startTime_;
+};
+
+/**
+ * @brief Bump arena for burst allocations attributed to one tag
+ *
+ * Allocate is a pointer bump within the current block (new blocks come
+ * from the heap and are recorded against the tag); individual frees do
+ * not exist - Reset releases everything except the first block in one
+ * step. Suited to per-frame or per-message scratch data that all dies
+ * together: serialization buffers, parse temporaries. Not thread-safe;
+ * give each producer thread its own arena.
+ */
+class TaggedArena {
+public:
+    explicit TaggedArena(MemoryTag tag, size_t blockBytes = 64 * 1024)
+        : tag_(tag), blockBytes_(blockBytes) {}
+
+    ~TaggedArena() {
+        for (Block& block : blocks_) {
+            MemoryRegistry::GetInstance().RecordFree(tag_, block.size);
+            ::operator delete(block.base);
+        }
+    }
+
+    TaggedArena(const TaggedArena&) = delete;
+    TaggedArena& operator=(const TaggedArena&) = delete;
+
+    /**
+     * @brief Allocate from the current block, growing as needed
+     */
+    void* Allocate(size_t bytes, size_t alignment = alignof(std::max_align_t)) {
+        if (bytes == 0) bytes = 1;
+        if (!blocks_.empty()) {
+            Block& current = blocks_.back();
+            size_t aligned = (current.used + alignment - 1) & ~(alignment - 1);
+            if (aligned + bytes <= current.size) {
+                current.used = aligned + bytes;
+                return static_cast<char*>(current.base) + aligned;
+            }
+        }
+
+        // Oversized requests get a dedicated block so block size stays
+        // a soft hint, not a limit
+        size_t blockSize = bytes > blockBytes_ ? bytes : blockBytes_;
+        Block block;
+        block.base = ::operator new(blockSize);
+        block.size = blockSize;
+        block.used = bytes;
+        MemoryRegistry::GetInstance().RecordAllocation(tag_, blockSize);
+        blocks_.push_back(block);
+        return block.base;
+    }
+
+    /**
+     * @brief Drop everything; the first block is retained for reuse
+     */
+    void Reset() {
+        while (blocks_.size() > 1) {
+            MemoryRegistry::GetInstance().RecordFree(tag_, blocks_.back().size);
+            ::operator delete(blocks_.back().base);
+            blocks_.pop_back();
+        }
+        if (!blocks_.empty()) {
+            blocks_.front().used = 0;
+        }
+    }
+
+    MemoryTag GetTag() const { return tag_; }
+
+private:
+    struct Block {
+        void* base = nullptr;
+        size_t size = 0;
+        size_t used = 0;
+    };
+
+    MemoryTag tag_;
+    size_t blockBytes_;
+    std::vector<Block> blocks_;
+};
+
+/**
+ * @brief Drop-in std allocator routing through the tagged block pool
+ *
+ * The tag is a template parameter so the allocator stays stateless and
+ * default-constructible - containers keep their existing construction
+ * sites, only the declaration changes:
+ *
+ *     std::deque<Frame, TaggedAllocator<Frame, MemoryTag::IPC>> frames;
+ *
+ * deque/list/map node churn then recycles through the per-tag free
+ * lists and shows up in MemoryRegistry statistics under the owning
+ * subsystem.
+ */
+template <typename T, MemoryTag Tag>
+class TaggedAllocator {
+public:
+    using value_type = T;
+
+    TaggedAllocator() = default;
+
+    template <typename U>
+    TaggedAllocator(const TaggedAllocator<U, Tag>&) noexcept {}
+
+    template <typename U>
+    struct rebind {
+        using other = TaggedAllocator<U, Tag>;
+    };
+
+    T* allocate(size_t count) {
+        return static_cast<T*>(
+            MemoryRegistry::GetInstance().Allocate(Tag, count * sizeof(T)));
+    }
+
+    void deallocate(T* pointer, size_t count) noexcept {
+        MemoryRegistry::GetInstance().Free(Tag, pointer, count * sizeof(T));
+    }
+};
+
+template <typename T, typename U, MemoryTag Tag>
+bool operator==(const TaggedAllocator<T, Tag>&, const TaggedAllocator<U, Tag>&) noexcept {
+    return true;
+}
+
+template <typename T, typename U, MemoryTag Tag>
+bool operator!=(const TaggedAllocator<T, Tag>&, const TaggedAllocator<U, Tag>&) noexcept {
+    return false;
+}
+
+} // namespace Core
+} // namespace RainmeterManager
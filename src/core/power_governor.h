@@ -0,0 +1,198 @@
+#pragma once
+// power_governor.h - Adaptive power-aware update throttling
+// Copyright (c) 2025 RainmeterManager. All rights reserved.
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <windows.h>
+
+namespace RainmeterManager {
+namespace Core {
+
+/**
+ * @brief Tuning for the power governor; all stretch factors multiply
+ * update intervals (2.0 halves the update rate)
+ *
+ * Battery and power-saver are mutually exclusive inputs (the larger
+ * applies); user-idle compounds on top, and occlusion compounds per
+ * widget where the caller knows visibility. The cap bounds the worst
+ * case so a widget never freezes entirely.
+ */
+struct PowerGovernorPolicy {
+    bool enabled = true;
+    DWORD pollIntervalMs = 2000;       // How often Poll() re-samples the OS
+    DWORD userIdleAfterMs = 60000;     // No input for this long counts as idle
+    double batteryStretch = 2.0;       // Running on battery
+    double powerSaverStretch = 4.0;    // Windows battery saver engaged
+    double idleStretch = 2.0;          // User idle (compounds with the above)
+    double occludedStretch = 4.0;      // Fully occluded/minimized widgets
+    double maxStretch = 8.0;           // Cap on the compounded factor
+};
+
+/**
+ * @brief Process-wide governor that stretches update cadence under
+ * battery, idle and occlusion signals
+ *
+ * Widgets are a measurable battery drain on laptops, and most of their
+ * update work is invisible while the machine is unplugged and the user
+ * is away. The governor samples power state (GetSystemPowerStatus) and
+ * input recency (GetLastInputInfo) at a low cadence and folds them
+ * into one stretch factor that the measure scheduler, the widget
+ * update tick and the frame scheduler apply to their intervals.
+ *
+ * Reads are a single relaxed atomic load, so hot paths can consult the
+ * governor per tick. Snap-back is instant: NotifyInteraction drops the
+ * idle factor immediately rather than waiting for the next poll.
+ */
+class PowerGovernor {
+public:
+    static PowerGovernor& GetInstance() {
+        // Leaked singleton: consulted from update threads during shutdown
+        static PowerGovernor* instance = new PowerGovernor();
+        return *instance;
+    }
+
+    void SetPolicy(const PowerGovernorPolicy& policy) {
+        {
+            std::lock_guard<std::mutex> lock(policyMutex_);
+            policy_ = policy;
+        }
+        RecomputeStretch();
+    }
+
+    PowerGovernorPolicy GetPolicy() const {
+        std::lock_guard<std::mutex> lock(policyMutex_);
+        return policy_;
+    }
+
+    /**
+     * @brief Re-sample power and idle state; rate-limited internally,
+     * so callers just invoke it once per update tick
+     */
+    void Poll() {
+        DWORD now = GetTickCount();
+        DWORD last = lastPollTick_.load(std::memory_order_relaxed);
+        DWORD interval;
+        {
+            std::lock_guard<std::mutex> lock(policyMutex_);
+            interval = policy_.pollIntervalMs;
+        }
+        if (last != 0 && now - last < interval) {
+            return;
+        }
+        if (!lastPollTick_.compare_exchange_strong(last, now,
+                                                   std::memory_order_relaxed)) {
+            return;  // another thread is polling this granule
+        }
+
+        SYSTEM_POWER_STATUS power = {};
+        if (GetSystemPowerStatus(&power)) {
+            onBattery_.store(power.ACLineStatus == 0, std::memory_order_relaxed);
+            powerSaver_.store(power.SystemStatusFlag == 1, std::memory_order_relaxed);
+        }
+
+        LASTINPUTINFO input = {};
+        input.cbSize = sizeof(input);
+        DWORD idleMs = 0;
+        if (GetLastInputInfo(&input)) {
+            idleMs = now - input.dwTime;
+        }
+        // Programmatic interaction (widget drags report through
+        // NotifyInteraction) counts as input too
+        DWORD lastInteraction = lastInteractionTick_.load(std::memory_order_relaxed);
+        if (lastInteraction != 0 && now - lastInteraction < idleMs) {
+            idleMs = now - lastInteraction;
+        }
+        DWORD idleThreshold;
+        {
+            std::lock_guard<std::mutex> lock(policyMutex_);
+            idleThreshold = policy_.userIdleAfterMs;
+        }
+        userIdle_.store(idleMs >= idleThreshold, std::memory_order_relaxed);
+
+        RecomputeStretch();
+    }
+
+    /**
+     * @brief Snap back instantly on user interaction (drag, click)
+     */
+    void NotifyInteraction() {
+        lastInteractionTick_.store(GetTickCount(), std::memory_order_relaxed);
+        if (userIdle_.exchange(false, std::memory_order_relaxed)) {
+            RecomputeStretch();
+        }
+    }
+
+    /**
+     * @brief Current compounded stretch factor (1.0 = full rate)
+     */
+    double CurrentStretch(bool occluded = false) const {
+        double stretch = stretchMilli_.load(std::memory_order_relaxed) / 1000.0;
+        if (occluded) {
+            std::lock_guard<std::mutex> lock(policyMutex_);
+            if (policy_.enabled) {
+                stretch = (std::min)(stretch * policy_.occludedStretch,
+                                     policy_.maxStretch);
+            }
+        }
+        return stretch;
+    }
+
+    DWORD StretchInterval(DWORD baseMs, bool occluded = false) const {
+        return static_cast<DWORD>(baseMs * CurrentStretch(occluded));
+    }
+
+    uint32_t StretchFps(uint32_t targetFps, bool occluded = false) const {
+        double stretch = CurrentStretch(occluded);
+        uint32_t fps = static_cast<uint32_t>(targetFps / stretch);
+        return fps > 0 ? fps : 1;
+    }
+
+    bool IsOnBattery() const { return onBattery_.load(std::memory_order_relaxed); }
+    bool IsUserIdle() const { return userIdle_.load(std::memory_order_relaxed); }
+
+private:
+    PowerGovernor() = default;
+
+    PowerGovernor(const PowerGovernor&) = delete;
+    PowerGovernor& operator=(const PowerGovernor&) = delete;
+
+    void RecomputeStretch() {
+        PowerGovernorPolicy policy;
+        {
+            std::lock_guard<std::mutex> lock(policyMutex_);
+            policy = policy_;
+        }
+
+        double stretch = 1.0;
+        if (policy.enabled) {
+            if (powerSaver_.load(std::memory_order_relaxed)) {
+                stretch *= policy.powerSaverStretch;
+            } else if (onBattery_.load(std::memory_order_relaxed)) {
+                stretch *= policy.batteryStretch;
+            }
+            if (userIdle_.load(std::memory_order_relaxed)) {
+                stretch *= policy.idleStretch;
+            }
+            stretch = (std::min)(stretch, policy.maxStretch);
+        }
+        stretchMilli_.store(static_cast<uint64_t>(stretch * 1000.0),
+                            std::memory_order_relaxed);
+    }
+
+    mutable std::mutex policyMutex_;
+    PowerGovernorPolicy policy_;
+
+    // Hot-path state: one relaxed load per consultation
+    std::atomic<uint64_t> stretchMilli_{1000};
+    std::atomic<bool> onBattery_{false};
+    std::atomic<bool> powerSaver_{false};
+    std::atomic<bool> userIdle_{false};
+    std::atomic<DWORD> lastPollTick_{0};
+    std::atomic<DWORD> lastInteractionTick_{0};
+};
+
+} // namespace Core
+} // namespace RainmeterManager
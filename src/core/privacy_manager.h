@@ -233,6 +233,11 @@ public:
     
     /**
      * @brief Sanitize data by removing PII
+     *
+     * Synchronous; avoid on frequent paths. Telemetry events are
+     * scrubbed in batches on the telemetry worker thread instead
+     * (Services::PiiScrubber), so recording an event never pays for
+     * the scan inline.
      */
     std::string SanitizeData(const std::string& data) const;
     
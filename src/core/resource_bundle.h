@@ -0,0 +1,451 @@
+#pragma once
+// resource_bundle.h - Memory-mapped packed asset bundle with decoded-image cache
+// Copyright (c) 2025 RainmeterManager. All rights reserved.
+
+#include <windows.h>
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace RainmeterManager {
+namespace Core {
+
+// ============================================================================
+// Bundle wire format
+// ============================================================================
+//
+// Icons, splash imagery and sample skin assets ship as one packed archive
+// instead of dozens of small files: a single CreateFileMapping at startup
+// replaces per-asset opens, pages fault in on first touch, and assets
+// shared across widgets are stored (and decoded) once.
+//
+//   [BundleFileHeader][BundleFileEntry * entryCount][blob bytes...]
+//
+// Entries are sorted by assetId at pack time so lookup is a binary search
+// over the mapped table; blobs are the original encoded bytes (PNG/JPEG/
+// ICO), decoded lazily through DecodedImageCache.
+
+constexpr uint32_t RESOURCE_BUNDLE_MAGIC = 0x524D5242;  // 'RMRB'
+constexpr uint32_t RESOURCE_BUNDLE_VERSION = 1;
+
+#pragma pack(push, 1)
+struct BundleFileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t entryCount;
+    uint32_t reserved;
+};
+
+struct BundleFileEntry {
+    uint64_t assetId;    // FNV-1a of the normalized asset path
+    uint64_t offset;     // From start of file
+    uint64_t size;       // Encoded blob size in bytes
+};
+#pragma pack(pop)
+
+static_assert(sizeof(BundleFileHeader) == 16, "bundle header is part of the file format");
+static_assert(sizeof(BundleFileEntry) == 24, "bundle entry is part of the file format");
+
+/**
+ * @brief Asset identifier from a bundle-relative path
+ *
+ * FNV-1a over the lowercased path with forward slashes, so
+ * "Icons\\Tray.png" and "icons/tray.png" name the same asset. Stable
+ * across packer and runtime; collisions are rejected at pack time.
+ */
+inline uint64_t AssetIdFromPath(const std::wstring& path) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (wchar_t ch : path) {
+        if (ch >= L'A' && ch <= L'Z') ch = ch - L'A' + L'a';
+        if (ch == L'\\') ch = L'/';
+        // Hash UTF-16 code units byte-wise for a stable, cheap identity
+        hash ^= static_cast<uint8_t>(ch & 0xFF);
+        hash *= 1099511628211ULL;
+        hash ^= static_cast<uint8_t>((ch >> 8) & 0xFF);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+/**
+ * @brief Non-owning view of one encoded asset inside the mapped bundle
+ *
+ * Valid for the lifetime of the ResourceBundle that produced it.
+ */
+struct BundleAssetView {
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+
+    bool IsValid() const { return data != nullptr && size > 0; }
+};
+
+/**
+ * @brief Read-only memory-mapped asset bundle
+ *
+ * Open() maps the whole archive once; Find() is a binary search over
+ * the mapped entry table and returns a zero-copy view of the encoded
+ * bytes. Decoders (WIC) read straight from the view, so cold-start
+ * asset loading is one map plus page-in instead of per-file opens.
+ */
+class ResourceBundle {
+public:
+    ResourceBundle() = default;
+
+    ~ResourceBundle() {
+        Close();
+    }
+
+    /**
+     * @brief Map a bundle file read-only and validate its index
+     * @param path Bundle file path
+     * @return True if the bundle mapped and the index is well-formed
+     */
+    bool Open(const std::wstring& path) {
+        Close();
+
+        HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                                  nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize = {};
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0) {
+            CloseHandle(file);
+            return false;
+        }
+
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);  // Mapping holds its own reference
+        if (!mapping) {
+            return false;
+        }
+
+        const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!view) {
+            CloseHandle(mapping);
+            return false;
+        }
+
+        if (!AttachView(static_cast<const uint8_t*>(view),
+                        static_cast<size_t>(fileSize.QuadPart))) {
+            UnmapViewOfFile(view);
+            CloseHandle(mapping);
+            return false;
+        }
+
+        mapping_ = mapping;
+        mappedView_ = view;
+        return true;
+    }
+
+    /**
+     * @brief Validate and index an already-resident bundle image
+     *
+     * Used by Open() on the mapped view; also usable directly for
+     * bundles embedded as binary resources. The memory must outlive
+     * the bundle object.
+     * @return True if the header and entry table are well-formed
+     */
+    bool AttachView(const uint8_t* data, size_t size) {
+        if (!data || size < sizeof(BundleFileHeader)) {
+            return false;
+        }
+
+        BundleFileHeader header;
+        std::memcpy(&header, data, sizeof(header));
+        if (header.magic != RESOURCE_BUNDLE_MAGIC ||
+            header.version != RESOURCE_BUNDLE_VERSION) {
+            return false;
+        }
+
+        const uint64_t tableBytes =
+            static_cast<uint64_t>(header.entryCount) * sizeof(BundleFileEntry);
+        if (sizeof(BundleFileHeader) + tableBytes > size) {
+            return false;
+        }
+
+        // Every blob must land inside the file and the table must be
+        // sorted (binary-search invariant); reject corrupt bundles here
+        // rather than at asset-fetch time
+        const auto* entries = reinterpret_cast<const BundleFileEntry*>(
+            data + sizeof(BundleFileHeader));
+        uint64_t previousId = 0;
+        for (uint32_t i = 0; i < header.entryCount; ++i) {
+            BundleFileEntry entry;
+            std::memcpy(&entry, &entries[i], sizeof(entry));
+            if (entry.offset > size || entry.size > size - entry.offset) {
+                return false;
+            }
+            if (i > 0 && entry.assetId <= previousId) {
+                return false;
+            }
+            previousId = entry.assetId;
+        }
+
+        base_ = data;
+        totalSize_ = size;
+        entries_ = entries;
+        entryCount_ = header.entryCount;
+        return true;
+    }
+
+    /**
+     * @brief Look up an asset by identifier
+     * @param assetId Identifier from AssetIdFromPath
+     * @return Zero-copy view of the encoded bytes (invalid if absent)
+     */
+    BundleAssetView Find(uint64_t assetId) const {
+        size_t lo = 0;
+        size_t hi = entryCount_;
+        while (lo < hi) {
+            const size_t mid = lo + (hi - lo) / 2;
+            BundleFileEntry entry;
+            std::memcpy(&entry, &entries_[mid], sizeof(entry));
+            if (entry.assetId == assetId) {
+                BundleAssetView view;
+                view.data = base_ + entry.offset;
+                view.size = static_cast<size_t>(entry.size);
+                return view;
+            }
+            if (entry.assetId < assetId) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        return BundleAssetView{};
+    }
+
+    BundleAssetView Find(const std::wstring& path) const {
+        return Find(AssetIdFromPath(path));
+    }
+
+    bool IsOpen() const { return base_ != nullptr; }
+    size_t GetAssetCount() const { return entryCount_; }
+
+    void Close() {
+        if (mappedView_) {
+            UnmapViewOfFile(mappedView_);
+            mappedView_ = nullptr;
+        }
+        if (mapping_) {
+            CloseHandle(mapping_);
+            mapping_ = nullptr;
+        }
+        base_ = nullptr;
+        totalSize_ = 0;
+        entries_ = nullptr;
+        entryCount_ = 0;
+    }
+
+private:
+    HANDLE mapping_ = nullptr;
+    const void* mappedView_ = nullptr;
+    const uint8_t* base_ = nullptr;
+    size_t totalSize_ = 0;
+    const BundleFileEntry* entries_ = nullptr;
+    size_t entryCount_ = 0;
+
+    // Non-copyable (owns the mapping)
+    ResourceBundle(const ResourceBundle&) = delete;
+    ResourceBundle& operator=(const ResourceBundle&) = delete;
+};
+
+/**
+ * @brief The process-wide asset bundle
+ *
+ * Opened once at startup (resources/assets.rmrb next to the binary);
+ * consumers fall back to loose-file loading when it is absent, so a
+ * dev tree without the packed bundle still runs.
+ */
+inline ResourceBundle& SharedResourceBundle() {
+    // Leaked intentionally: views handed out from the mapping must stay
+    // valid through late consumers during shutdown
+    static ResourceBundle* bundle = new ResourceBundle();
+    return *bundle;
+}
+
+/**
+ * @brief Builds a packed bundle from in-memory blobs (packer side)
+ *
+ * Add() collects encoded assets; WriteTo() sorts the table by assetId
+ * and emits header, entry table and blobs. Duplicate ids are rejected
+ * so path-hash collisions surface at pack time, not at lookup time.
+ */
+class ResourceBundleWriter {
+public:
+    bool Add(const std::wstring& path, std::vector<uint8_t> data) {
+        const uint64_t assetId = AssetIdFromPath(path);
+        for (const auto& pending : pending_) {
+            if (pending.assetId == assetId) {
+                return false;
+            }
+        }
+        pending_.push_back({assetId, std::move(data)});
+        return true;
+    }
+
+    bool WriteTo(std::vector<uint8_t>& out) const {
+        std::vector<const PendingAsset*> sorted;
+        sorted.reserve(pending_.size());
+        for (const auto& pending : pending_) {
+            sorted.push_back(&pending);
+        }
+        for (size_t i = 1; i < sorted.size(); ++i) {
+            const PendingAsset* key = sorted[i];
+            size_t j = i;
+            while (j > 0 && sorted[j - 1]->assetId > key->assetId) {
+                sorted[j] = sorted[j - 1];
+                --j;
+            }
+            sorted[j] = key;
+        }
+
+        const size_t tableBytes = sorted.size() * sizeof(BundleFileEntry);
+        uint64_t blobOffset = sizeof(BundleFileHeader) + tableBytes;
+
+        out.clear();
+        out.reserve(blobOffset);
+
+        BundleFileHeader header = {};
+        header.magic = RESOURCE_BUNDLE_MAGIC;
+        header.version = RESOURCE_BUNDLE_VERSION;
+        header.entryCount = static_cast<uint32_t>(sorted.size());
+        AppendBytes(out, &header, sizeof(header));
+
+        for (const PendingAsset* asset : sorted) {
+            BundleFileEntry entry = {};
+            entry.assetId = asset->assetId;
+            entry.offset = blobOffset;
+            entry.size = asset->data.size();
+            AppendBytes(out, &entry, sizeof(entry));
+            blobOffset += asset->data.size();
+        }
+
+        for (const PendingAsset* asset : sorted) {
+            out.insert(out.end(), asset->data.begin(), asset->data.end());
+        }
+        return true;
+    }
+
+private:
+    struct PendingAsset {
+        uint64_t assetId;
+        std::vector<uint8_t> data;
+    };
+
+    static void AppendBytes(std::vector<uint8_t>& out, const void* data, size_t size) {
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        out.insert(out.end(), bytes, bytes + size);
+    }
+
+    std::vector<PendingAsset> pending_;
+};
+
+// ============================================================================
+// Decoded-image cache
+// ============================================================================
+
+/**
+ * @brief A decoded bitmap in 32bpp premultiplied BGRA
+ *
+ * Renderer-agnostic so the splash screen (D2D) and widget image meters
+ * share one decode; each consumer uploads to its own render target.
+ */
+struct DecodedImage {
+    uint32_t width = 0;
+    uint32_t height = 0;
+    uint32_t stride = 0;       // Bytes per row
+    std::vector<uint8_t> pixels;
+};
+
+/**
+ * @brief Shared decode-on-first-use cache keyed by asset ID
+ *
+ * The first consumer of an asset decodes it (supplying the WIC decode
+ * as a callback, keeping imaging dependencies out of this header) and
+ * every later consumer — including the same icon used by ten widgets —
+ * gets the shared decoded pixels. Entries are shared_ptr so eviction
+ * never invalidates an image a consumer still holds.
+ */
+class DecodedImageCache {
+public:
+    static DecodedImageCache& GetInstance() {
+        // Leaked intentionally: meters may resolve images during shutdown
+        static DecodedImageCache* instance = new DecodedImageCache();
+        return *instance;
+    }
+
+    using DecodeFn = std::function<std::shared_ptr<const DecodedImage>(const BundleAssetView&)>;
+
+    /**
+     * @brief Get the decoded image, decoding on first use
+     * @param assetId Asset identifier (cache key)
+     * @param encoded Encoded bytes from the bundle (or a loose file)
+     * @param decode Decoder invoked only on a cache miss
+     * @return Shared decoded image (nullptr if the decode failed)
+     */
+    std::shared_ptr<const DecodedImage> GetOrDecode(uint64_t assetId,
+                                                    const BundleAssetView& encoded,
+                                                    const DecodeFn& decode) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = images_.find(assetId);
+            if (it != images_.end()) {
+                return it->second;
+            }
+        }
+
+        // Decode outside the lock; two racing first-users may both
+        // decode, but the loser's copy is simply dropped
+        std::shared_ptr<const DecodedImage> image = decode ? decode(encoded) : nullptr;
+        if (!image) {
+            return nullptr;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto [it, inserted] = images_.emplace(assetId, image);
+        return it->second;
+    }
+
+    /**
+     * @brief Drop cached images nobody else references
+     *
+     * Called under memory pressure; images still held by consumers
+     * survive through their shared_ptr.
+     */
+    void TrimUnreferenced() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto it = images_.begin(); it != images_.end();) {
+            if (it->second.use_count() == 1) {
+                it = images_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    size_t GetCachedCount() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return images_.size();
+    }
+
+private:
+    DecodedImageCache() = default;
+
+    mutable std::mutex mutex_;
+    std::unordered_map<uint64_t, std::shared_ptr<const DecodedImage>> images_;
+
+    DecodedImageCache(const DecodedImageCache&) = delete;
+    DecodedImageCache& operator=(const DecodedImageCache&) = delete;
+};
+
+} // namespace Core
+} // namespace RainmeterManager
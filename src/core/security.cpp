@@ -10,6 +10,8 @@
 #include <regex>
 #include <vector>
 #include <iomanip>
+#include <thread>
+#include <atomic>
 #include <wintrust.h>
 #include <softpub.h>
 #include <wincrypt.h>
@@ -216,6 +218,428 @@ std::string Security::calculateSHA256FromBuffer(const char* data, size_t length)
     return ss.str();
 }
 
+//=============================================================================
+// Multi-Stream Parallel Hashing
+//=============================================================================
+
+// Hash one file through a caller-owned read buffer (reused across files)
+static bool hashFileWithBuffer(const std::string& filePath,
+                               std::vector<char>& buffer,
+                               std::string& hexDigest) {
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file.is_open()) {
+        LOG_ERROR("Failed to open file for SHA-256: " + filePath);
+        return false;
+    }
+
+    BCRYPT_HASH_HANDLE hHash = nullptr;
+    NTSTATUS status = BCryptCreateHash(g_hSha256Alg, &hHash, nullptr, 0, nullptr, 0, 0);
+    if (!BCRYPT_SUCCESS(status)) {
+        LOG_ERROR("Failed to create SHA-256 hash object: 0x" + std::to_string(status));
+        return false;
+    }
+
+    while (file.read(buffer.data(), buffer.size()) || file.gcount() > 0) {
+        status = BCryptHashData(hHash, (PUCHAR)buffer.data(),
+                                static_cast<ULONG>(file.gcount()), 0);
+        if (!BCRYPT_SUCCESS(status)) {
+            LOG_ERROR("Failed to hash data: 0x" + std::to_string(status));
+            BCryptDestroyHash(hHash);
+            return false;
+        }
+    }
+
+    DWORD hashSize = 32;
+    std::vector<BYTE> hashBytes(hashSize);
+    status = BCryptFinishHash(hHash, hashBytes.data(), hashSize, 0);
+    BCryptDestroyHash(hHash);
+
+    if (!BCRYPT_SUCCESS(status)) {
+        LOG_ERROR("Failed to finalize SHA-256 hash: 0x" + std::to_string(status));
+        return false;
+    }
+
+    std::stringstream ss;
+    for (BYTE b : hashBytes) {
+        ss << std::hex << std::setfill('0') << std::setw(2) << static_cast<int>(b);
+    }
+    hexDigest = ss.str();
+    return true;
+}
+
+std::vector<Security::FileHashResult> Security::hashFiles(
+    const std::vector<std::string>& paths, size_t workerCount) {
+    std::vector<FileHashResult> results(paths.size());
+    for (size_t i = 0; i < paths.size(); ++i) {
+        results[i].filePath = paths[i];
+        results[i].success = false;
+    }
+
+    if (!g_cryptoInitialized) {
+        LOG_ERROR("Crypto not initialized for parallel hashing");
+        return results;
+    }
+    if (paths.empty()) {
+        return results;
+    }
+
+    if (workerCount == 0) {
+        size_t hw = std::thread::hardware_concurrency();
+        workerCount = (hw >= 2) ? ((hw < 8) ? hw : 8) : 2;
+    }
+    if (workerCount > paths.size()) {
+        workerCount = paths.size();
+    }
+
+    const size_t READ_BUFFER_SIZE = 1024 * 1024;  // 1 MB per worker
+    std::atomic<size_t> nextIndex{0};
+
+    auto worker = [&]() {
+        std::vector<char> buffer(READ_BUFFER_SIZE);
+        for (;;) {
+            size_t index = nextIndex.fetch_add(1);
+            if (index >= paths.size()) {
+                return;
+            }
+            results[index].success =
+                hashFileWithBuffer(paths[index], buffer, results[index].hash);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; ++i) {
+        workers.emplace_back(worker);
+    }
+    for (auto& thread : workers) {
+        thread.join();
+    }
+
+    return results;
+}
+
+std::future<std::vector<Security::FileHashResult>> Security::hashFilesAsync(
+    const std::vector<std::string>& paths, size_t workerCount) {
+    return std::async(std::launch::async, [paths, workerCount]() {
+        return hashFiles(paths, workerCount);
+    });
+}
+
+//=============================================================================
+// Bulk and Streaming AES-256-GCM Encryption
+//=============================================================================
+
+static const ULONG GCM_NONCE_LENGTH = 12;
+static const ULONG GCM_TAG_LENGTH = 16;
+static const ULONG AES_BLOCK_SIZE = 16;
+
+// Build the AES key schedule once; callers reuse the handle across buffers
+static BCRYPT_KEY_HANDLE createAesKey(const unsigned char* key, size_t keyLength,
+                                      std::vector<unsigned char>& keyObject) {
+    DWORD objectLength = 0;
+    DWORD cbResult = 0;
+    NTSTATUS status = BCryptGetProperty(g_hAesAlg, BCRYPT_OBJECT_LENGTH,
+                                        (PUCHAR)&objectLength, sizeof(objectLength),
+                                        &cbResult, 0);
+    if (!BCRYPT_SUCCESS(status)) {
+        LOG_ERROR("Failed to query AES object length: 0x" + std::to_string(status));
+        return nullptr;
+    }
+
+    keyObject.resize(objectLength);
+
+    BCRYPT_KEY_HANDLE hKey = nullptr;
+    status = BCryptGenerateSymmetricKey(g_hAesAlg, &hKey,
+                                        keyObject.data(), objectLength,
+                                        (PUCHAR)key, static_cast<ULONG>(keyLength), 0);
+    if (!BCRYPT_SUCCESS(status)) {
+        LOG_ERROR("Failed to generate AES key: 0x" + std::to_string(status));
+        return nullptr;
+    }
+    return hKey;
+}
+
+// One-shot GCM encrypt with an existing key schedule
+static bool encryptWithKey(BCRYPT_KEY_HANDLE hKey,
+                           const unsigned char* plaintext, size_t length,
+                           std::vector<unsigned char>& output) {
+    output.resize(GCM_NONCE_LENGTH + length + GCM_TAG_LENGTH);
+
+    NTSTATUS status = BCryptGenRandom(nullptr, output.data(), GCM_NONCE_LENGTH,
+                                      BCRYPT_USE_SYSTEM_PREFERRED_RNG);
+    if (!BCRYPT_SUCCESS(status)) {
+        LOG_ERROR("Failed to generate GCM nonce: 0x" + std::to_string(status));
+        return false;
+    }
+
+    BCRYPT_AUTHENTICATED_CIPHER_MODE_INFO authInfo;
+    BCRYPT_INIT_AUTH_MODE_INFO(authInfo);
+    authInfo.pbNonce = output.data();
+    authInfo.cbNonce = GCM_NONCE_LENGTH;
+    authInfo.pbTag = output.data() + GCM_NONCE_LENGTH + length;
+    authInfo.cbTag = GCM_TAG_LENGTH;
+
+    ULONG written = 0;
+    status = BCryptEncrypt(hKey, (PUCHAR)plaintext, static_cast<ULONG>(length),
+                           &authInfo, nullptr, 0,
+                           output.data() + GCM_NONCE_LENGTH, static_cast<ULONG>(length),
+                           &written, 0);
+    if (!BCRYPT_SUCCESS(status)) {
+        LOG_ERROR("Failed to encrypt buffer: 0x" + std::to_string(status));
+        return false;
+    }
+    return true;
+}
+
+bool Security::encryptBuffer(const unsigned char* key, size_t keyLength,
+                             const unsigned char* plaintext, size_t plaintextLength,
+                             std::vector<unsigned char>& output) {
+    if (!g_cryptoInitialized || !key || !plaintext) {
+        LOG_ERROR("Invalid parameters for buffer encryption");
+        return false;
+    }
+
+    std::vector<unsigned char> keyObject;
+    BCRYPT_KEY_HANDLE hKey = createAesKey(key, keyLength, keyObject);
+    if (!hKey) {
+        return false;
+    }
+
+    bool ok = encryptWithKey(hKey, plaintext, plaintextLength, output);
+    BCryptDestroyKey(hKey);
+    return ok;
+}
+
+bool Security::decryptBuffer(const unsigned char* key, size_t keyLength,
+                             const unsigned char* input, size_t inputLength,
+                             std::vector<unsigned char>& plaintext) {
+    if (!g_cryptoInitialized || !key || !input ||
+        inputLength < GCM_NONCE_LENGTH + GCM_TAG_LENGTH) {
+        LOG_ERROR("Invalid parameters for buffer decryption");
+        return false;
+    }
+
+    std::vector<unsigned char> keyObject;
+    BCRYPT_KEY_HANDLE hKey = createAesKey(key, keyLength, keyObject);
+    if (!hKey) {
+        return false;
+    }
+
+    size_t cipherLength = inputLength - GCM_NONCE_LENGTH - GCM_TAG_LENGTH;
+    plaintext.resize(cipherLength);
+
+    BCRYPT_AUTHENTICATED_CIPHER_MODE_INFO authInfo;
+    BCRYPT_INIT_AUTH_MODE_INFO(authInfo);
+    authInfo.pbNonce = (PUCHAR)input;
+    authInfo.cbNonce = GCM_NONCE_LENGTH;
+    authInfo.pbTag = (PUCHAR)input + GCM_NONCE_LENGTH + cipherLength;
+    authInfo.cbTag = GCM_TAG_LENGTH;
+
+    ULONG written = 0;
+    NTSTATUS status = BCryptDecrypt(hKey,
+                                    (PUCHAR)input + GCM_NONCE_LENGTH,
+                                    static_cast<ULONG>(cipherLength),
+                                    &authInfo, nullptr, 0,
+                                    plaintext.data(), static_cast<ULONG>(cipherLength),
+                                    &written, 0);
+    BCryptDestroyKey(hKey);
+
+    if (!BCRYPT_SUCCESS(status)) {
+        LOG_ERROR("Failed to decrypt buffer (bad key or tampered data): 0x" +
+                  std::to_string(status));
+        plaintext.clear();
+        return false;
+    }
+    return true;
+}
+
+bool Security::encryptBuffersBulk(const unsigned char* key, size_t keyLength,
+                                  const std::vector<BulkBuffer>& inputs,
+                                  std::vector<std::vector<unsigned char>>& outputs) {
+    if (!g_cryptoInitialized || !key) {
+        LOG_ERROR("Invalid parameters for bulk encryption");
+        return false;
+    }
+
+    std::vector<unsigned char> keyObject;
+    BCRYPT_KEY_HANDLE hKey = createAesKey(key, keyLength, keyObject);
+    if (!hKey) {
+        return false;
+    }
+
+    outputs.clear();
+    outputs.reserve(inputs.size());
+
+    bool ok = true;
+    for (const auto& input : inputs) {
+        std::vector<unsigned char> output;
+        if (!encryptWithKey(hKey, input.data, input.length, output)) {
+            ok = false;
+            break;
+        }
+        outputs.push_back(std::move(output));
+    }
+
+    BCryptDestroyKey(hKey);
+    if (!ok) {
+        outputs.clear();
+    }
+    return ok;
+}
+
+//=============================================================================
+// Streaming Encryption (chained GCM)
+//=============================================================================
+
+Security::StreamEncryptor::StreamEncryptor()
+    : hKey_(nullptr)
+    , active_(false)
+{
+}
+
+Security::StreamEncryptor::~StreamEncryptor() {
+    Reset();
+}
+
+void Security::StreamEncryptor::Reset() {
+    if (hKey_) {
+        BCryptDestroyKey(hKey_);
+        hKey_ = nullptr;
+    }
+    pending_.clear();
+    active_ = false;
+}
+
+bool Security::StreamEncryptor::Begin(const unsigned char* key, size_t keyLength) {
+    Reset();
+
+    if (!g_cryptoInitialized || !key) {
+        LOG_ERROR("Invalid parameters for streaming encryption");
+        return false;
+    }
+
+    hKey_ = createAesKey(key, keyLength, keyObject_);
+    if (!hKey_) {
+        return false;
+    }
+
+    nonce_.resize(GCM_NONCE_LENGTH);
+    NTSTATUS status = BCryptGenRandom(nullptr, nonce_.data(), GCM_NONCE_LENGTH,
+                                      BCRYPT_USE_SYSTEM_PREFERRED_RNG);
+    if (!BCRYPT_SUCCESS(status)) {
+        LOG_ERROR("Failed to generate streaming nonce: 0x" + std::to_string(status));
+        Reset();
+        return false;
+    }
+
+    // Chained calls need the MAC context carried between BCryptEncrypt calls
+    BCRYPT_AUTH_TAG_LENGTHS_STRUCT tagLengths = {0};
+    DWORD cbResult = 0;
+    status = BCryptGetProperty(g_hAesAlg, BCRYPT_AUTH_TAG_LENGTH,
+                               (PUCHAR)&tagLengths, sizeof(tagLengths), &cbResult, 0);
+    if (!BCRYPT_SUCCESS(status)) {
+        LOG_ERROR("Failed to query GCM tag lengths: 0x" + std::to_string(status));
+        Reset();
+        return false;
+    }
+
+    macContext_.assign(tagLengths.dwMaxLength, 0);
+    tag_.assign(GCM_TAG_LENGTH, 0);
+    ivScratch_.assign(AES_BLOCK_SIZE, 0);
+
+    BCRYPT_INIT_AUTH_MODE_INFO(authInfo_);
+    authInfo_.pbNonce = nonce_.data();
+    authInfo_.cbNonce = GCM_NONCE_LENGTH;
+    authInfo_.pbMacContext = macContext_.data();
+    authInfo_.cbMacContext = static_cast<ULONG>(macContext_.size());
+    authInfo_.pbTag = tag_.data();
+    authInfo_.cbTag = GCM_TAG_LENGTH;
+    authInfo_.dwFlags = BCRYPT_AUTH_MODE_CHAIN_CALLS_FLAG;
+
+    active_ = true;
+    return true;
+}
+
+bool Security::StreamEncryptor::EncryptChunk(const unsigned char* input, size_t length,
+                                             unsigned char* output) {
+    ULONG written = 0;
+    NTSTATUS status = BCryptEncrypt(hKey_, (PUCHAR)input, static_cast<ULONG>(length),
+                                    &authInfo_, ivScratch_.data(), AES_BLOCK_SIZE,
+                                    output, static_cast<ULONG>(length), &written, 0);
+    if (!BCRYPT_SUCCESS(status)) {
+        LOG_ERROR("Failed to encrypt stream chunk: 0x" + std::to_string(status));
+        Reset();
+        return false;
+    }
+    return true;
+}
+
+bool Security::StreamEncryptor::Update(const unsigned char* input, size_t length,
+                                       std::vector<unsigned char>& output) {
+    if (!active_ || !input) {
+        LOG_ERROR("StreamEncryptor::Update called without active stream");
+        return false;
+    }
+
+    // Intermediate chained calls must be block multiples: top up the held
+    // partial block first, then encrypt the largest whole-block run, then
+    // stash the new remainder.
+    size_t consumed = 0;
+    size_t outStart = output.size();
+
+    if (!pending_.empty()) {
+        size_t need = AES_BLOCK_SIZE - pending_.size();
+        size_t take = (need < length) ? need : length;
+        pending_.insert(pending_.end(), input, input + take);
+        consumed = take;
+
+        if (pending_.size() < AES_BLOCK_SIZE) {
+            return true;
+        }
+
+        output.resize(outStart + AES_BLOCK_SIZE);
+        if (!EncryptChunk(pending_.data(), AES_BLOCK_SIZE, output.data() + outStart)) {
+            return false;
+        }
+        pending_.clear();
+        outStart = output.size();
+    }
+
+    size_t remaining = length - consumed;
+    size_t wholeBlocks = remaining - (remaining % AES_BLOCK_SIZE);
+    if (wholeBlocks > 0) {
+        output.resize(outStart + wholeBlocks);
+        if (!EncryptChunk(input + consumed, wholeBlocks, output.data() + outStart)) {
+            return false;
+        }
+        consumed += wholeBlocks;
+    }
+
+    pending_.assign(input + consumed, input + length);
+    return true;
+}
+
+bool Security::StreamEncryptor::Finish(std::vector<unsigned char>& output) {
+    if (!active_) {
+        LOG_ERROR("StreamEncryptor::Finish called without active stream");
+        return false;
+    }
+
+    // The final call may be any length; clearing the chain flag emits the tag
+    authInfo_.dwFlags &= ~BCRYPT_AUTH_MODE_CHAIN_CALLS_FLAG;
+
+    size_t outStart = output.size();
+    output.resize(outStart + pending_.size());
+    if (!EncryptChunk(pending_.empty() ? nullptr : pending_.data(), pending_.size(),
+                      pending_.empty() ? nullptr : output.data() + outStart)) {
+        return false;
+    }
+
+    output.insert(output.end(), tag_.begin(), tag_.end());
+    Reset();
+    return true;
+}
+
 //=============================================================================
 // Code Signature Validation
 //=============================================================================
@@ -6,6 +6,7 @@
 #include <typeindex>
 #include <functional>
 #include <mutex>
+#include <atomic>
 #include <unordered_set>
 #include "logger_adapter.h"
 
@@ -19,6 +20,7 @@ namespace Core {
  * - Type-safe service registration and resolution
  * - Singleton and factory service creation patterns
  * - Thread-safe service management
+ * - Lock-free resolution of materialized singletons via published snapshots
  * - Circular dependency detection
  * - Service lifecycle management
  * 
@@ -46,6 +48,23 @@ private:
     mutable std::mutex servicesMutex_;
     std::unordered_map<std::type_index, ServiceEntry> services_;
     std::unordered_map<std::string, std::type_index> namedServices_;
+
+    // Published resolution snapshot (RCU-style). Every mutation rebuilds
+    // an immutable copy of the table and swaps it in atomically, so the
+    // hot path — resolving an already-materialized singleton like the
+    // logger or system monitor — is a plain hash probe with no mutex.
+    // Registration is effectively frozen after startup, so republishing
+    // on mutation is rare and cheap.
+    struct SnapshotEntry {
+        std::shared_ptr<void> instance;
+        ServiceLifetime lifetime;
+    };
+    using ResolutionSnapshot = std::unordered_map<std::type_index, SnapshotEntry>;
+    std::shared_ptr<const ResolutionSnapshot> snapshot_;
+
+    // Bumped on every registration change; ServiceHandle caches check
+    // this to know when their resolved pointer is stale
+    std::atomic<uint64_t> registrationGeneration_{0};
     
     // Circular dependency detection
     mutable std::unordered_set<std::type_index> resolutionStack_;
@@ -116,12 +135,14 @@ public:
             return voidInstance;
         };
         
-        services_.emplace(typeIndex, ServiceEntry(factory, ServiceLifetime::Singleton, name));
-        
+        auto& entry = services_.emplace(typeIndex, ServiceEntry(factory, ServiceLifetime::Singleton, name)).first->second;
+        entry.instance = voidInstance;
+
         if (!name.empty()) {
             namedServices_[name] = typeIndex;
         }
-        
+        RepublishSnapshot();
+
         LogServiceRegistration<TInterface>("Instance", name);
     }
 
@@ -194,7 +215,8 @@ public:
                 namedServices_.erase(it->second.name);
             }
             services_.erase(it);
-            
+            RepublishSnapshot();
+
             LogServiceUnregistration<TInterface>();
         }
     }
@@ -211,6 +233,7 @@ public:
             auto typeIndex = namedIt->second;
             services_.erase(typeIndex);
             namedServices_.erase(namedIt);
+            RepublishSnapshot();
         }
     }
 
@@ -221,6 +244,7 @@ public:
         std::lock_guard<std::mutex> lock(servicesMutex_);
         services_.clear();
         namedServices_.clear();
+        RepublishSnapshot();
         Logger::GetInstance().LogInfo(L"ServiceLocator: All services cleared");
     }
 
@@ -233,6 +257,17 @@ public:
         return services_.size();
     }
 
+    /**
+     * @brief Current registration generation
+     *
+     * Incremented whenever the service table changes (including first
+     * singleton materialization). Cached handles compare against this
+     * to validate their resolved pointer without a table lookup.
+     */
+    uint64_t GetRegistrationGeneration() const {
+        return registrationGeneration_.load(std::memory_order_acquire);
+    }
+
 private:
     template<typename TInterface>
     void RegisterServiceInternal(std::function<std::shared_ptr<void>()> factory,
@@ -242,16 +277,46 @@ private:
         
         auto typeIndex = std::type_index(typeid(TInterface));
         services_.emplace(typeIndex, ServiceEntry(factory, lifetime, name));
-        
+
         if (!name.empty()) {
             namedServices_[name] = typeIndex;
         }
-        
+        RepublishSnapshot();
+
         LogServiceRegistration<TInterface>(lifetime == ServiceLifetime::Singleton ? "Singleton" : "Transient", name);
     }
 
+    // Rebuild and publish the immutable snapshot; callers hold
+    // servicesMutex_. Readers holding the old snapshot keep a valid
+    // shared_ptr until they drop it.
+    void RepublishSnapshot() {
+        auto fresh = std::make_shared<ResolutionSnapshot>();
+        fresh->reserve(services_.size());
+        for (const auto& pair : services_) {
+            (*fresh)[pair.first] = SnapshotEntry{pair.second.instance, pair.second.lifetime};
+        }
+        std::atomic_store_explicit(&snapshot_,
+            std::shared_ptr<const ResolutionSnapshot>(std::move(fresh)),
+            std::memory_order_release);
+        registrationGeneration_.fetch_add(1, std::memory_order_release);
+    }
+
     template<typename TInterface>
     std::shared_ptr<TInterface> ResolveInternal(const std::type_index& typeIndex) {
+        // Lock-free fast path: a singleton that has already been
+        // materialized resolves straight out of the published snapshot.
+        // First-touch materialization, transients (whose factories may
+        // resolve other services and need cycle detection), and
+        // unknown types fall through to the locked path.
+        if (auto snapshot = std::atomic_load_explicit(&snapshot_, std::memory_order_acquire)) {
+            auto snapIt = snapshot->find(typeIndex);
+            if (snapIt != snapshot->end() &&
+                snapIt->second.lifetime == ServiceLifetime::Singleton &&
+                snapIt->second.instance) {
+                return std::static_pointer_cast<TInterface>(snapIt->second.instance);
+            }
+        }
+
         // Check for circular dependency
         {
             std::lock_guard<std::mutex> resolutionLock(resolutionMutex_);
@@ -276,6 +341,9 @@ private:
             if (entry.lifetime == ServiceLifetime::Singleton) {
                 if (!entry.instance) {
                     entry.instance = entry.factory();
+                    // Publish the materialized instance so later
+                    // resolutions take the lock-free path
+                    RepublishSnapshot();
                 }
                 result = std::static_pointer_cast<TInterface>(entry.instance);
             } else {
@@ -320,5 +388,49 @@ private:
     }
 };
 
+/**
+ * @brief Cached typed handle to a located service
+ *
+ * Resolves once through the locator and afterwards returns the cached
+ * shared_ptr while the locator's registration generation is unchanged:
+ * a pointer load plus one atomic compare per call instead of a hash
+ * probe. Re-resolves transparently after a registration change.
+ * Intended for Singleton services on hot paths (measure update loops,
+ * widget rendering); caching a Transient service would pin a single
+ * instance. Resolution errors propagate from Resolve as usual.
+ */
+template<typename TInterface>
+class ServiceHandle {
+public:
+    ServiceHandle() = default;
+    explicit ServiceHandle(ServiceLocator& locator) : locator_(&locator) {}
+
+    std::shared_ptr<TInterface> Get() {
+        if (!locator_) {
+            return nullptr;
+        }
+        uint64_t current = locator_->GetRegistrationGeneration();
+        if (!cached_ || cachedGeneration_ != current) {
+            cached_ = locator_->Resolve<TInterface>();
+            cachedGeneration_ = current;
+        }
+        return cached_;
+    }
+
+    void Attach(ServiceLocator& locator) {
+        locator_ = &locator;
+        cached_.reset();
+    }
+
+    void Reset() {
+        cached_.reset();
+    }
+
+private:
+    ServiceLocator* locator_ = nullptr;
+    std::shared_ptr<TInterface> cached_;
+    uint64_t cachedGeneration_ = 0;
+};
+
 } // namespace Core
 } // namespace RainmeterManager
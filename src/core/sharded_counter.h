@@ -0,0 +1,86 @@
+#pragma once
+// sharded_counter.h - Per-thread sharded statistics counters
+// Copyright (c) 2025 RainmeterManager. All rights reserved.
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace RainmeterManager {
+namespace Core {
+
+/**
+ * @brief Cache-line sharded counter block for hot-path statistics
+ *
+ * Statistics guarded by a mutex (or a single shared atomic) make every
+ * message on the IPC paths pay for counter maintenance: the lock, and
+ * the cache line bouncing between producer and consumer threads.
+ * ShardedCounters gives each thread its own cache-line-padded slot
+ * block; an increment is one relaxed fetch_add on a line no other
+ * thread writes. Reads aggregate across shards lazily, so GetStatistics
+ * pays the cost instead of the hot path — cheap enough to leave
+ * enabled in production.
+ *
+ * Counts are eventually consistent: a Sum racing with increments may
+ * miss in-flight additions, which is fine for monitoring counters.
+ * CounterCount is the number of distinct counters (an enum per user);
+ * threads map onto ShardCount blocks round-robin.
+ */
+template <size_t CounterCount, size_t ShardCount = 8>
+class ShardedCounters {
+public:
+    ShardedCounters() = default;
+
+    ShardedCounters(const ShardedCounters&) = delete;
+    ShardedCounters& operator=(const ShardedCounters&) = delete;
+
+    /**
+     * @brief Add to a counter from any thread (relaxed, uncontended)
+     */
+    void Add(size_t counter, uint64_t delta = 1) {
+        shards_[ThisThreadShard()].values[counter]
+            .fetch_add(delta, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Aggregate one counter across all shards
+     */
+    uint64_t Sum(size_t counter) const {
+        uint64_t total = 0;
+        for (size_t shard = 0; shard < ShardCount; ++shard) {
+            total += shards_[shard].values[counter].load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    /**
+     * @brief Zero every counter (racing increments may survive)
+     */
+    void Reset() {
+        for (size_t shard = 0; shard < ShardCount; ++shard) {
+            for (size_t counter = 0; counter < CounterCount; ++counter) {
+                shards_[shard].values[counter].store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+private:
+    // Padded to a cache-line multiple so no two shards share a line
+    struct alignas(64) Shard {
+        std::atomic<uint64_t> values[CounterCount] = {};
+    };
+
+    size_t ThisThreadShard() const {
+        // Round-robin shard assignment on first use per thread; stable
+        // for the thread's lifetime
+        static std::atomic<size_t> nextShard{0};
+        thread_local size_t shard =
+            nextShard.fetch_add(1, std::memory_order_relaxed) % ShardCount;
+        return shard;
+    }
+
+    Shard shards_[ShardCount];
+};
+
+} // namespace Core
+} // namespace RainmeterManager
@@ -0,0 +1,261 @@
+#pragma once
+// string_intern.h - Interned strings with cached UTF-16/UTF-8 dual encodings
+// Copyright (c) 2025 RainmeterManager. All rights reserved.
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace RainmeterManager {
+namespace Core {
+
+/**
+ * @brief Convert UTF-16 to UTF-8 (portable, surrogate-aware)
+ *
+ * Replaces the ad-hoc WideCharToMultiByte wrappers and the lossy
+ * begin()/end() narrowing scattered across the tree. Unpaired
+ * surrogates and invalid sequences become U+FFFD rather than failing -
+ * these conversions feed logs and identifiers, where a replacement
+ * character beats a dropped message.
+ */
+inline std::string Utf16ToUtf8(const std::wstring& input) {
+    std::string out;
+    out.reserve(input.size());
+
+    for (size_t i = 0; i < input.size(); ++i) {
+        uint32_t codepoint = static_cast<uint32_t>(input[i]) & 0xFFFFFFFFu;
+
+        if (sizeof(wchar_t) == 2 && codepoint >= 0xD800 && codepoint <= 0xDBFF) {
+            // High surrogate: combine with the following low surrogate
+            if (i + 1 < input.size()) {
+                uint32_t low = static_cast<uint32_t>(input[i + 1]);
+                if (low >= 0xDC00 && low <= 0xDFFF) {
+                    codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (low - 0xDC00);
+                    ++i;
+                } else {
+                    codepoint = 0xFFFD;
+                }
+            } else {
+                codepoint = 0xFFFD;
+            }
+        } else if ((codepoint >= 0xDC00 && codepoint <= 0xDFFF) || codepoint > 0x10FFFF) {
+            codepoint = 0xFFFD;  // stray low surrogate / out of range
+        }
+
+        if (codepoint < 0x80) {
+            out.push_back(static_cast<char>(codepoint));
+        } else if (codepoint < 0x800) {
+            out.push_back(static_cast<char>(0xC0 | (codepoint >> 6)));
+            out.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+        } else if (codepoint < 0x10000) {
+            out.push_back(static_cast<char>(0xE0 | (codepoint >> 12)));
+            out.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+        } else {
+            out.push_back(static_cast<char>(0xF0 | (codepoint >> 18)));
+            out.push_back(static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+        }
+    }
+    return out;
+}
+
+/**
+ * @brief Convert UTF-8 to UTF-16; invalid sequences become U+FFFD
+ */
+inline std::wstring Utf8ToUtf16(const std::string& input) {
+    std::wstring out;
+    out.reserve(input.size());
+
+    size_t i = 0;
+    while (i < input.size()) {
+        uint8_t lead = static_cast<uint8_t>(input[i]);
+        uint32_t codepoint;
+        size_t length;
+
+        if (lead < 0x80) {
+            codepoint = lead;
+            length = 1;
+        } else if ((lead >> 5) == 0x6) {
+            codepoint = lead & 0x1F;
+            length = 2;
+        } else if ((lead >> 4) == 0xE) {
+            codepoint = lead & 0x0F;
+            length = 3;
+        } else if ((lead >> 3) == 0x1E) {
+            codepoint = lead & 0x07;
+            length = 4;
+        } else {
+            out.push_back(static_cast<wchar_t>(0xFFFD));
+            ++i;
+            continue;
+        }
+
+        if (i + length > input.size()) {
+            out.push_back(static_cast<wchar_t>(0xFFFD));
+            break;
+        }
+
+        bool valid = true;
+        for (size_t k = 1; k < length; ++k) {
+            uint8_t continuation = static_cast<uint8_t>(input[i + k]);
+            if ((continuation >> 6) != 0x2) {
+                valid = false;
+                break;
+            }
+            codepoint = (codepoint << 6) | (continuation & 0x3F);
+        }
+        if (!valid || codepoint > 0x10FFFF ||
+            (codepoint >= 0xD800 && codepoint <= 0xDFFF)) {
+            out.push_back(static_cast<wchar_t>(0xFFFD));
+            ++i;
+            continue;
+        }
+        i += length;
+
+        if (codepoint >= 0x10000 && sizeof(wchar_t) == 2) {
+            codepoint -= 0x10000;
+            out.push_back(static_cast<wchar_t>(0xD800 + (codepoint >> 10)));
+            out.push_back(static_cast<wchar_t>(0xDC00 + (codepoint & 0x3FF)));
+        } else {
+            out.push_back(static_cast<wchar_t>(codepoint));
+        }
+    }
+    return out;
+}
+
+/**
+ * @brief Handle to an interned string; both encodings are cached and
+ * live for the process lifetime, so returned references are stable
+ */
+class InternedString {
+public:
+    InternedString() = default;
+
+    const std::string& Utf8() const { return entry_ ? entry_->utf8 : EmptyUtf8(); }
+    const std::wstring& Utf16() const { return entry_ ? entry_->utf16 : EmptyUtf16(); }
+
+    // Interned strings are canonical: same text, same entry
+    bool operator==(const InternedString& other) const { return entry_ == other.entry_; }
+    bool operator!=(const InternedString& other) const { return entry_ != other.entry_; }
+
+private:
+    friend class StringInternTable;
+
+    struct Entry {
+        std::string utf8;
+        std::wstring utf16;
+    };
+
+    explicit InternedString(const Entry* entry) : entry_(entry) {}
+
+    static const std::string& EmptyUtf8() {
+        static const std::string empty;
+        return empty;
+    }
+    static const std::wstring& EmptyUtf16() {
+        static const std::wstring empty;
+        return empty;
+    }
+
+    const Entry* entry_ = nullptr;
+};
+
+/**
+ * @brief Process-wide intern table for the stable identifier population
+ *
+ * Widget names, channel names and config keys are a small, stable set,
+ * but they cross the UTF-16/UTF-8 boundary constantly - every Send,
+ * log line and command build used to re-convert and re-allocate the
+ * same few dozen strings. Interning converts each identifier once and
+ * caches both encodings; after warm-up a crossing is a shared-lock
+ * hash lookup with no allocation.
+ *
+ * Entries are never evicted, so intern only bounded populations
+ * (identifiers), never payloads or user-variable text. Lookups from
+ * either encoding hit their own index; a miss converts, inserts under
+ * the write lock, and both indexes point at the same entry.
+ */
+class StringInternTable {
+public:
+    static StringInternTable& GetInstance() {
+        // Leaked singleton: interned strings are referenced from logging
+        // during shutdown, so the table must outlive static teardown
+        static StringInternTable* instance = new StringInternTable();
+        return *instance;
+    }
+
+    InternedString Intern(const std::string& utf8) {
+        {
+            std::shared_lock<std::shared_mutex> lock(tableMutex_);
+            auto it = utf8Index_.find(utf8);
+            if (it != utf8Index_.end()) {
+                return InternedString(it->second);
+            }
+        }
+
+        std::wstring utf16 = Utf8ToUtf16(utf8);
+        std::unique_lock<std::shared_mutex> lock(tableMutex_);
+        auto it = utf8Index_.find(utf8);
+        if (it != utf8Index_.end()) {
+            return InternedString(it->second);  // lost the insert race
+        }
+        return InternedString(Insert(utf8, std::move(utf16)));
+    }
+
+    InternedString Intern(const std::wstring& utf16) {
+        {
+            std::shared_lock<std::shared_mutex> lock(tableMutex_);
+            auto it = utf16Index_.find(utf16);
+            if (it != utf16Index_.end()) {
+                return InternedString(it->second);
+            }
+        }
+
+        std::string utf8 = Utf16ToUtf8(utf16);
+        std::unique_lock<std::shared_mutex> lock(tableMutex_);
+        auto it = utf16Index_.find(utf16);
+        if (it != utf16Index_.end()) {
+            return InternedString(it->second);
+        }
+        return InternedString(Insert(std::move(utf8), utf16));
+    }
+
+    size_t Count() const {
+        std::shared_lock<std::shared_mutex> lock(tableMutex_);
+        return entries_.size();
+    }
+
+private:
+    StringInternTable() = default;
+
+    StringInternTable(const StringInternTable&) = delete;
+    StringInternTable& operator=(const StringInternTable&) = delete;
+
+    // Called with the write lock held
+    const InternedString::Entry* Insert(std::string utf8, std::wstring utf16) {
+        auto entry = std::make_unique<InternedString::Entry>();
+        entry->utf8 = std::move(utf8);
+        entry->utf16 = std::move(utf16);
+        const InternedString::Entry* raw = entry.get();
+        entries_.push_back(std::move(entry));
+        utf8Index_[raw->utf8] = raw;
+        utf16Index_[raw->utf16] = raw;
+        return raw;
+    }
+
+    mutable std::shared_mutex tableMutex_;
+    std::vector<std::unique_ptr<InternedString::Entry>> entries_;
+    // Index keys view the entry's own storage via map key copies;
+    // entries are never erased, so raw pointers stay valid
+    std::unordered_map<std::string, const InternedString::Entry*> utf8Index_;
+    std::unordered_map<std::wstring, const InternedString::Entry*> utf16Index_;
+};
+
+} // namespace Core
+} // namespace RainmeterManager
@@ -6,6 +6,12 @@
 #include <vector>
 #include <memory>
 #include <map>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <windows.h>
+#include <evntrace.h>
+#include "cpu_sample_ring.h"
 
 namespace RainmeterManager {
 namespace Core {
@@ -42,6 +48,21 @@ struct ProcessInfo {
     std::wstring status;  // "running", "sleeping", etc.
 };
 
+/**
+ * @brief Incremental changes to the process table since a prior generation
+ *
+ * Returned by ISystemMonitor::GetProcessChanges so pollers (task-manager
+ * tab) only touch processes that actually appeared, exited, or changed
+ * instead of copying the full 300+ entry table every second.
+ */
+struct ProcessDelta {
+    uint64_t generation = 0;            // Generation this delta brings the caller up to
+    std::vector<ProcessInfo> added;     // Processes not present at sinceGeneration
+    std::vector<uint32_t> removedPids;  // Processes gone since sinceGeneration
+    std::vector<ProcessInfo> updated;   // Present before but with changed cpu/memory/status
+    bool fullResync = false;            // sinceGeneration too old; 'added' holds the complete table
+};
+
 /**
  * @brief Network interface information
  */
@@ -58,6 +79,13 @@ struct NetworkInterfaceInfo {
 
 /**
  * @brief Disk information structure
+ *
+ * Disk metrics are collected on a dedicated background thread (volume
+ * queries can block for seconds on spun-down or disconnected media), so
+ * every entry carries the tick it was actually sampled at. Consumers
+ * decide how much staleness they tolerate; `stale` is set when the
+ * volume missed its last collection window (probe timed out or the
+ * volume vanished) and the values are the last good sample.
  */
 struct DiskInfo {
     std::wstring drive;
@@ -65,6 +93,8 @@ struct DiskInfo {
     uint64_t freeBytes;
     uint64_t usedBytes;
     float usagePercent;
+    DWORD sampledTick;   // GetTickCount at collection time
+    bool stale;          // Last probe missed; values are the previous sample
 };
 
 /**
@@ -98,34 +128,93 @@ public:
     virtual std::vector<ProcessInfo> GetAllProcesses() const = 0;
     virtual bool KillProcess(uint32_t pid) = 0;
 
+    // Incremental process monitoring. Each Update() that changes the
+    // process table bumps the generation; callers remember the last
+    // generation they saw and receive only the changes since. Passing a
+    // generation the monitor no longer remembers yields a fullResync
+    // delta carrying the complete table.
+    virtual uint64_t GetProcessGeneration() const = 0;
+    virtual ProcessDelta GetProcessChanges(uint64_t sinceGeneration) const = 0;
+
     // Network monitoring
     virtual std::vector<NetworkInterfaceInfo> GetNetworkInterfaces() const = 0;
     virtual NetworkInterfaceInfo GetNetworkInterface(const std::wstring& name) const = 0;
     virtual std::wstring GetPublicIP() const = 0;
 
-    // Disk monitoring
+    // Disk monitoring. Always immediate: implementations serve from the
+    // background collector's cache and never touch the volume on the
+    // caller's thread, so a sleeping disk can't stall the Update loop.
     virtual std::vector<DiskInfo> GetDiskInfo() const = 0;
     virtual DiskInfo GetDiskInfo(const std::wstring& drive) const = 0;
 };
 
 /**
  * @brief Native Windows implementation of ISystemMonitor
- * 
+ *
  * Uses Windows Performance Counters, WMI, and other native APIs.
+ *
+ * Two process-monitoring modes share the same interface. The default
+ * polling mode re-enumerates everything each updateIntervalMs_. The
+ * opt-in event-driven mode (EnableEventDrivenMode) consumes ETW kernel
+ * events instead — process start/stop keeps the table current at
+ * O(changes), and context-switch accounting yields per-process CPU
+ * without snapshot enumeration.
  */
 class WindowsSystemMonitor : public ISystemMonitor {
 private:
     // Cached data
     CPUInfo cpuInfo_;
     MemoryInfo memoryInfo_;
+
+    // Per-core load history in one contiguous SoA allocation;
+    // UpdateCPUInfo pushes one sample per core each refresh
+    CPUSampleRing coreSampleRing_;
     std::vector<ProcessInfo> processes_;
+
+    // Incremental process snapshot. processIndex_ keys the current table
+    // by pid; UpdateProcessInfo diffs the fresh enumeration against it,
+    // bumps processGeneration_ and stores the delta of the last step so
+    // a steady one-generation-behind poller never pays a full copy.
+    std::map<uint32_t, ProcessInfo> processIndex_;
+    uint64_t processGeneration_;
+    ProcessDelta lastProcessDelta_;
     std::vector<NetworkInterfaceInfo> networkInterfaces_;
     std::vector<DiskInfo> disks_;
 
+    // Asynchronous disk collection. GetVolumeInformation/GetDiskFreeSpaceEx
+    // can block for seconds on spun-down drives or dead network shares,
+    // so volumes are probed on diskCollectorThread_ — one volume at a
+    // time, each probe issued on a watchdog-abandonable worker so a hung
+    // volume costs its timeout, not the whole sweep. Results land in
+    // diskCache_ under diskMutex_ stamped with their collection tick; a
+    // probe that exceeds diskProbeTimeoutMs_ leaves the previous sample
+    // in place with `stale` set. GetDiskInfo only ever reads the cache.
+    std::thread diskCollectorThread_;
+    std::atomic<bool> diskCollectorStop_{false};
+    mutable std::mutex diskMutex_;
+    std::map<std::wstring, DiskInfo> diskCache_;
+    DWORD diskProbeTimeoutMs_{2000};
+    DWORD diskRefreshIntervalMs_{5000};
+
     // Update tracking
     DWORD lastUpdateTick_;
     DWORD updateIntervalMs_;
 
+    // Event-driven mode state. The consumer thread owns the real-time
+    // kernel session and applies process start/stop events straight into
+    // processIndex_ (under etwMutex_), so Update() in this mode only
+    // publishes the accumulated delta and refreshes the non-process
+    // subsystems on the normal interval. Context-switch events
+    // accumulate per-pid cycle time in etwCpuCyclesByPid_; each publish
+    // converts the window's cycles into cpuPercent and clears it.
+    std::atomic<bool> etwModeEnabled_{false};
+    std::atomic<bool> etwStopRequested_{false};
+    TRACEHANDLE etwSessionHandle_{0};
+    TRACEHANDLE etwConsumerHandle_{INVALID_PROCESSTRACE_HANDLE};
+    std::thread etwConsumerThread_;
+    mutable std::mutex etwMutex_;
+    std::map<uint32_t, uint64_t> etwCpuCyclesByPid_;
+
 public:
     WindowsSystemMonitor();
     ~WindowsSystemMonitor() override;
@@ -147,6 +236,9 @@ public:
     std::vector<ProcessInfo> GetAllProcesses() const override;
     bool KillProcess(uint32_t pid) override;
 
+    uint64_t GetProcessGeneration() const override { return processGeneration_; }
+    ProcessDelta GetProcessChanges(uint64_t sinceGeneration) const override;
+
     std::vector<NetworkInterfaceInfo> GetNetworkInterfaces() const override;
     NetworkInterfaceInfo GetNetworkInterface(const std::wstring& name) const override;
     std::wstring GetPublicIP() const override;
@@ -154,16 +246,99 @@ public:
     std::vector<DiskInfo> GetDiskInfo() const override;
     DiskInfo GetDiskInfo(const std::wstring& drive) const override;
 
+    // === Event-Driven Mode ===
+
+    /**
+     * @brief Switch process monitoring from polling to ETW kernel events
+     *
+     * Starts a real-time kernel trace session (process provider +
+     * context-switch provider) consumed on a dedicated thread. Process
+     * list maintenance becomes O(changes) — start/stop events mutate the
+     * table directly instead of a full snapshot diff — and per-process
+     * CPU arrives push-style from context-switch accounting. Kernel
+     * sessions require elevation; on StartTrace failure the monitor logs
+     * and stays in polling mode, so callers can enable unconditionally.
+     * @return True if the kernel session started and the mode is active
+     */
+    bool EnableEventDrivenMode();
+
+    /**
+     * @brief Stop the ETW session and fall back to snapshot polling
+     */
+    void DisableEventDrivenMode();
+
+    /**
+     * @brief Check whether ETW-driven process monitoring is active
+     * @return True if process data is event-fed
+     */
+    bool IsEventDrivenModeEnabled() const { return etwModeEnabled_; }
+
     // Configuration
     void SetUpdateInterval(DWORD intervalMs) { updateIntervalMs_ = intervalMs; }
 
+    /**
+     * @brief Cap how long one volume probe may block the disk sweep
+     *
+     * A probe still running at the deadline is abandoned: the volume
+     * keeps its previous cached sample with `stale` set, and the sweep
+     * moves on to the next volume.
+     */
+    void SetDiskProbeTimeout(DWORD timeoutMs) { diskProbeTimeoutMs_ = timeoutMs; }
+
+    /**
+     * @brief Set how often the background collector re-sweeps volumes
+     */
+    void SetDiskRefreshInterval(DWORD intervalMs) { diskRefreshIntervalMs_ = intervalMs; }
+    void SetCoreHistoryCapacity(size_t samples) {
+        coreSampleRing_.Reset(static_cast<size_t>(cpuInfo_.coreCount), samples);
+    }
+
+    // Sample history access. Sparklines and the dashboard aggregate
+    // through the ring (vectorized, no per-call allocation) instead of
+    // repeated GetCPUCoreLoads copies.
+    const CPUSampleRing& GetCoreSampleRing() const { return coreSampleRing_; }
+    CoreLoadStats GetCoreLoadStats(size_t core, size_t windowSize = 0) const {
+        return coreSampleRing_.Aggregate(core, windowSize);
+    }
+
 private:
     // Internal data collection methods
     void UpdateCPUInfo();
     void UpdateMemoryInfo();
     void UpdateProcessInfo();
+    void DiffProcessSnapshot(const std::vector<ProcessInfo>& fresh);
     void UpdateNetworkInfo();
+    // Publishes the collector's cache into disks_; never queries a
+    // volume on the Update thread (see diskCollectorThread_)
     void UpdateDiskInfo();
+
+    // Disk collector internals. The loop enumerates volumes each
+    // diskRefreshIntervalMs_ and probes them sequentially;
+    // ProbeVolumeWithTimeout runs the blocking query on a detached
+    // worker and waits at most diskProbeTimeoutMs_ for it — on timeout
+    // the worker is abandoned (it parks on the hung volume and exits
+    // whenever the kernel releases it) and the cache entry is re-marked
+    // stale instead of overwritten.
+    void StartDiskCollector();
+    void StopDiskCollector();
+    void DiskCollectorLoop();
+    bool ProbeVolumeWithTimeout(const std::wstring& drive, DiskInfo& out);
+
+    // Event-driven mode internals. StartEtwSession configures the
+    // kernel logger with EVENT_TRACE_FLAG_PROCESS and
+    // EVENT_TRACE_FLAG_CSWITCH; EtwConsumerLoop blocks in ProcessTrace
+    // and dispatches into the two handlers. Process events mutate
+    // processIndex_ and bump processGeneration_ under etwMutex_;
+    // context-switch events only touch etwCpuCyclesByPid_.
+    // PublishEtwCpuWindow runs from Update(): it converts the window's
+    // accumulated cycles into cpuPercent on the table rows and resets
+    // the accounting for the next window.
+    bool StartEtwSession();
+    void StopEtwSession();
+    void EtwConsumerLoop();
+    void OnEtwProcessEvent(uint32_t pid, bool started, const std::wstring& imageName);
+    void OnEtwContextSwitch(uint32_t pid, uint64_t cycles);
+    void PublishEtwCpuWindow();
 };
 
 /**
@@ -207,6 +382,8 @@ public:
     ProcessInfo GetProcessByPID(uint32_t pid) const override { return ProcessInfo{}; }
     std::vector<ProcessInfo> GetAllProcesses() const override { return {}; }
     bool KillProcess(uint32_t pid) override { return false; }
+    uint64_t GetProcessGeneration() const override { return 0; }
+    ProcessDelta GetProcessChanges(uint64_t sinceGeneration) const override { return ProcessDelta{}; }
     std::vector<NetworkInterfaceInfo> GetNetworkInterfaces() const override { return {}; }
     NetworkInterfaceInfo GetNetworkInterface(const std::wstring& name) const override { return NetworkInterfaceInfo{}; }
     std::wstring GetPublicIP() const override { return L""; }
@@ -0,0 +1,254 @@
+#pragma once
+// timer_wheel.h - Hierarchical timer wheel for timeout tracking
+// Copyright (c) 2025 RainmeterManager. All rights reserved.
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace RainmeterManager {
+namespace Core {
+
+/**
+ * @brief Hierarchical timer wheel: O(1) schedule/cancel, bulk expiry
+ *
+ * Tracking request timeouts by scanning every pending entry (or arming
+ * a per-request wait) makes timeout bookkeeping scale with the number
+ * of in-flight requests — measurable at hundreds of requests per
+ * second, and scan-based expiry adds latency jitter. The wheel hashes
+ * each deadline into a slot across four levels of 64 slots (tick
+ * granularity at level 0, coarser per level, ~46 hours of range at the
+ * default 10ms tick), so Schedule and Cancel are constant-time slot
+ * operations and one coarse tick thread expires whole slots at once.
+ *
+ * Callbacks fire on the tick thread, outside the wheel lock, so they
+ * may call back into Schedule/Cancel; keep them short (complete a
+ * promise, notify a waiter), never blocking. Expiry is quantized to the
+ * tick: a timeout fires up to one tick late, which is the right trade
+ * for IPC timeouts measured in seconds.
+ *
+ * Stop() drains: timers still pending when the wheel stops fire
+ * immediately (on the stopping thread), so a waiter keyed to a timeout
+ * can never be left blocked by shutdown.
+ */
+class TimerWheel {
+public:
+    using TimerId = uint64_t;
+    using TimerCallback = std::function<void()>;
+
+    explicit TimerWheel(uint32_t tickMs = 10)
+        : tickMs_(tickMs == 0 ? 1 : tickMs) {}
+
+    ~TimerWheel() {
+        Stop();
+    }
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    /**
+     * @brief Start the tick thread (idempotent)
+     */
+    void Start() {
+        std::lock_guard<std::mutex> lock(wheelMutex_);
+        if (tickThread_.joinable()) {
+            return;
+        }
+        stopRequested_ = false;
+        tickThread_ = std::thread(&TimerWheel::TickLoop, this);
+    }
+
+    /**
+     * @brief Stop the tick thread and fire all pending timers
+     */
+    void Stop() {
+        {
+            std::lock_guard<std::mutex> lock(wheelMutex_);
+            if (!tickThread_.joinable()) {
+                return;
+            }
+            stopRequested_ = true;
+        }
+        stopCondition_.notify_all();
+        tickThread_.join();
+
+        // Drain: fire whatever is still parked so timeout waiters wake
+        std::vector<TimerCallback> pending;
+        {
+            std::lock_guard<std::mutex> lock(wheelMutex_);
+            for (auto& level : wheel_) {
+                for (auto& slot : level) {
+                    for (auto& timer : slot) {
+                        pending.push_back(std::move(timer.callback));
+                    }
+                    slot.clear();
+                }
+            }
+            index_.clear();
+        }
+        for (auto& callback : pending) {
+            callback();
+        }
+    }
+
+    /**
+     * @brief Schedule a callback after delayMs (O(1))
+     * @param delayMs Delay until expiry; quantized up to the tick
+     * @param callback Fired once on the tick thread
+     * @return Id for Cancel
+     */
+    TimerId Schedule(uint32_t delayMs, TimerCallback callback) {
+        std::lock_guard<std::mutex> lock(wheelMutex_);
+
+        const uint64_t delayTicks =
+            (static_cast<uint64_t>(delayMs) + tickMs_ - 1) / tickMs_;
+        Timer timer;
+        timer.id = nextTimerId_++;
+        // At least one tick out, so a zero delay still fires from the
+        // tick thread rather than inline
+        timer.expiryTick = currentTick_ + (delayTicks == 0 ? 1 : delayTicks);
+        timer.callback = std::move(callback);
+
+        PlaceTimer(std::move(timer));
+        return nextTimerId_ - 1;
+    }
+
+    /**
+     * @brief Cancel a scheduled timer (O(1))
+     * @return True if the timer was still pending (callback will not run)
+     */
+    bool Cancel(TimerId id) {
+        std::lock_guard<std::mutex> lock(wheelMutex_);
+        auto it = index_.find(id);
+        if (it == index_.end()) {
+            return false;
+        }
+        wheel_[it->second.level][it->second.slot].erase(it->second.position);
+        index_.erase(it);
+        return true;
+    }
+
+    /**
+     * @brief Number of timers currently scheduled
+     */
+    size_t GetPendingCount() const {
+        std::lock_guard<std::mutex> lock(wheelMutex_);
+        return index_.size();
+    }
+
+private:
+    static constexpr size_t LEVELS = 4;
+    static constexpr size_t SLOT_BITS = 6;
+    static constexpr size_t SLOTS_PER_LEVEL = 1u << SLOT_BITS;   // 64
+    static constexpr uint64_t SLOT_MASK = SLOTS_PER_LEVEL - 1;
+
+    struct Timer {
+        TimerId id;
+        uint64_t expiryTick;
+        TimerCallback callback;
+    };
+    using Slot = std::list<Timer>;
+
+    struct TimerLocation {
+        size_t level;
+        size_t slot;
+        Slot::iterator position;
+    };
+
+    // Buckets a timer by how far out it expires: level 0 holds the next
+    // 64 ticks at tick granularity, each higher level is 64x coarser.
+    // Timers cascade down a level as the wheel turns past their bucket.
+    // Caller holds wheelMutex_.
+    void PlaceTimer(Timer&& timer) {
+        const uint64_t delta = timer.expiryTick - currentTick_;
+
+        size_t level = 0;
+        while (level + 1 < LEVELS && delta >= (1ull << (SLOT_BITS * (level + 1)))) {
+            ++level;
+        }
+        const size_t slot = static_cast<size_t>(
+            (timer.expiryTick >> (SLOT_BITS * level)) & SLOT_MASK);
+
+        Slot& bucket = wheel_[level][slot];
+        bucket.push_back(std::move(timer));
+        auto position = std::prev(bucket.end());
+        index_[position->id] = TimerLocation{ level, slot, position };
+    }
+
+    void TickLoop() {
+        auto nextTick = std::chrono::steady_clock::now() +
+                        std::chrono::milliseconds(tickMs_);
+
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(wheelMutex_);
+                if (stopCondition_.wait_until(lock, nextTick,
+                                              [this] { return stopRequested_; })) {
+                    return;
+                }
+            }
+            nextTick += std::chrono::milliseconds(tickMs_);
+
+            // Expire the current level-0 slot in bulk; callbacks run
+            // outside the lock so they can re-enter Schedule/Cancel
+            std::vector<TimerCallback> expired;
+            {
+                std::lock_guard<std::mutex> lock(wheelMutex_);
+                ++currentTick_;
+
+                const size_t slot = static_cast<size_t>(currentTick_ & SLOT_MASK);
+                Slot& bucket = wheel_[0][slot];
+                for (auto& timer : bucket) {
+                    index_.erase(timer.id);
+                    expired.push_back(std::move(timer.callback));
+                }
+                bucket.clear();
+
+                // When a level wraps, cascade the next level's current
+                // slot down so its timers land in finer buckets
+                for (size_t level = 1; level < LEVELS; ++level) {
+                    if ((currentTick_ & ((1ull << (SLOT_BITS * level)) - 1)) != 0) {
+                        break;
+                    }
+                    const size_t upperSlot = static_cast<size_t>(
+                        (currentTick_ >> (SLOT_BITS * level)) & SLOT_MASK);
+                    Slot cascade;
+                    cascade.swap(wheel_[level][upperSlot]);
+                    for (auto& timer : cascade) {
+                        index_.erase(timer.id);
+                        if (timer.expiryTick <= currentTick_) {
+                            expired.push_back(std::move(timer.callback));
+                        } else {
+                            PlaceTimer(std::move(timer));
+                        }
+                    }
+                }
+            }
+
+            for (auto& callback : expired) {
+                callback();
+            }
+        }
+    }
+
+    const uint32_t tickMs_;
+    Slot wheel_[LEVELS][SLOTS_PER_LEVEL];
+    std::unordered_map<TimerId, TimerLocation> index_;
+    uint64_t currentTick_ = 0;
+    TimerId nextTimerId_ = 1;
+
+    mutable std::mutex wheelMutex_;
+    std::condition_variable stopCondition_;
+    bool stopRequested_ = false;
+    std::thread tickThread_;
+};
+
+} // namespace Core
+} // namespace RainmeterManager
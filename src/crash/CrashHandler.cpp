@@ -1,5 +1,7 @@
 #include "CrashHandler.h"
+#include "FlightRecorder.h"
 #include <dbghelp.h>
+#include <processsnapshot.h>
 #include <sstream>
 #include <iomanip>
 #include "../core/logger.h"
@@ -12,15 +14,54 @@ namespace Crash {
 // Static member definitions
 bool CrashHandler::initialized_ = false;
 void* CrashHandler::hVectoredHandler_ = nullptr;
+unsigned char* CrashHandler::crashArena_ = nullptr;
+size_t CrashHandler::crashArenaSize_ = 0;
+size_t CrashHandler::crashArenaUsed_ = 0;
+HANDLE CrashHandler::hWatchdogProcess_ = nullptr;
+HANDLE CrashHandler::hCrashEvent_ = nullptr;
+HANDLE CrashHandler::hDumpDoneEvent_ = nullptr;
+void* CrashHandler::pSharedRequest_ = nullptr;
+
+namespace {
+
+// Shared between the faulting process and the watchdog via file mapping
+struct CrashDumpRequest {
+    DWORD processId;
+    DWORD threadId;
+    ULONG64 exceptionPointers;  // Address in the faulting process
+    wchar_t dumpPath[MAX_PATH];
+};
+
+const size_t CRASH_ARENA_SIZE = 1024 * 1024;  // 1 MB, reserved at Install
+const DWORD WATCHDOG_DUMP_TIMEOUT_MS = 30000;
+
+} // anonymous namespace
 
 void CrashHandler::Install() {
     if (initialized_) {
         return; // Already installed
     }
-    
+
+    // Reserve the crash-path arena up front: the handler must never
+    // allocate from the process heap, which may be the thing that broke
+    crashArena_ = static_cast<unsigned char*>(
+        VirtualAlloc(nullptr, CRASH_ARENA_SIZE, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE));
+    if (crashArena_) {
+        crashArenaSize_ = CRASH_ARENA_SIZE;
+        crashArenaUsed_ = 0;
+    } else {
+        LOG_WARNING("Failed to reserve crash arena; crash path will avoid extras");
+    }
+
+    // Pre-spawn the watchdog so dump writing happens out of process and
+    // the faulting process is suspended only for milliseconds
+    if (!SpawnWatchdog()) {
+        LOG_WARNING("Failed to spawn crash watchdog; falling back to in-process dumps");
+    }
+
     // Add vectored exception handler (first in chain)
     hVectoredHandler_ = AddVectoredExceptionHandler(1, VectoredExceptionHandler);
-    
+
     if (hVectoredHandler_) {
         initialized_ = true;
         LOG_INFO("CrashHandler installed successfully");
@@ -29,6 +70,179 @@ void CrashHandler::Install() {
     }
 }
 
+unsigned char* CrashHandler::AllocFromArena(size_t bytes) {
+    if (!crashArena_ || crashArenaUsed_ + bytes > crashArenaSize_) {
+        return nullptr;
+    }
+    unsigned char* p = crashArena_ + crashArenaUsed_;
+    crashArenaUsed_ += bytes;
+    return p;
+}
+
+bool CrashHandler::SpawnWatchdog() {
+    SECURITY_ATTRIBUTES sa = {sizeof(SECURITY_ATTRIBUTES), nullptr, TRUE};
+
+    HANDLE hMapping = CreateFileMappingW(INVALID_HANDLE_VALUE, &sa, PAGE_READWRITE,
+                                         0, sizeof(CrashDumpRequest), nullptr);
+    if (!hMapping) {
+        return false;
+    }
+
+    pSharedRequest_ = MapViewOfFile(hMapping, FILE_MAP_ALL_ACCESS, 0, 0,
+                                    sizeof(CrashDumpRequest));
+    hCrashEvent_ = CreateEventW(&sa, FALSE, FALSE, nullptr);
+    hDumpDoneEvent_ = CreateEventW(&sa, FALSE, FALSE, nullptr);
+
+    if (!pSharedRequest_ || !hCrashEvent_ || !hDumpDoneEvent_) {
+        CloseHandle(hMapping);
+        return false;
+    }
+
+    wchar_t exePath[MAX_PATH];
+    if (!GetModuleFileNameW(nullptr, exePath, MAX_PATH)) {
+        CloseHandle(hMapping);
+        return false;
+    }
+
+    // Inherited handle values are passed numerically on the command line
+    wchar_t commandLine[MAX_PATH + 128];
+    swprintf_s(commandLine, L"\"%s\" --crash-watchdog %lu %llu %llu %llu",
+               exePath, GetCurrentProcessId(),
+               reinterpret_cast<unsigned long long>(hMapping),
+               reinterpret_cast<unsigned long long>(hCrashEvent_),
+               reinterpret_cast<unsigned long long>(hDumpDoneEvent_));
+
+    STARTUPINFOW si = {sizeof(STARTUPINFOW)};
+    PROCESS_INFORMATION pi = {};
+    if (!CreateProcessW(exePath, commandLine, nullptr, nullptr, TRUE,
+                        CREATE_NO_WINDOW, nullptr, nullptr, &si, &pi)) {
+        CloseHandle(hMapping);
+        return false;
+    }
+
+    CloseHandle(pi.hThread);
+    hWatchdogProcess_ = pi.hProcess;
+    return true;
+}
+
+bool CrashHandler::RequestWatchdogDump(EXCEPTION_POINTERS* pExceptionInfo) {
+    if (!hWatchdogProcess_ || !pSharedRequest_ || !hCrashEvent_ || !hDumpDoneEvent_) {
+        return false;
+    }
+
+    // Watchdog may already be gone (killed, failed to start its loop)
+    if (WaitForSingleObject(hWatchdogProcess_, 0) != WAIT_TIMEOUT) {
+        return false;
+    }
+
+    CrashDumpRequest* request = static_cast<CrashDumpRequest*>(pSharedRequest_);
+    request->processId = GetCurrentProcessId();
+    request->threadId = GetCurrentThreadId();
+    request->exceptionPointers = reinterpret_cast<ULONG64>(pExceptionInfo);
+
+    SYSTEMTIME st;
+    GetLocalTime(&st);
+    swprintf_s(request->dumpPath, MAX_PATH, L"dumps\\RainmeterManager_%04d%02d%02d_%02d%02d%02d.dmp",
+               st.wYear, st.wMonth, st.wDay, st.wHour, st.wMinute, st.wSecond);
+
+    SetEvent(hCrashEvent_);
+    return WaitForSingleObject(hDumpDoneEvent_, WATCHDOG_DUMP_TIMEOUT_MS) == WAIT_OBJECT_0;
+}
+
+int CrashHandler::WatchdogMain(const wchar_t* commandLine) {
+    // Command line: ... --crash-watchdog <pid> <mapping> <crashEvent> <doneEvent>
+    DWORD parentPid = 0;
+    unsigned long long mappingValue = 0, crashEventValue = 0, doneEventValue = 0;
+
+    const wchar_t* args = wcsstr(commandLine, L"--crash-watchdog");
+    if (!args || swscanf_s(args, L"--crash-watchdog %lu %llu %llu %llu",
+                           &parentPid, &mappingValue, &crashEventValue,
+                           &doneEventValue) != 4) {
+        return 1;
+    }
+
+    HANDLE hMapping = reinterpret_cast<HANDLE>(mappingValue);
+    HANDLE hCrashEvent = reinterpret_cast<HANDLE>(crashEventValue);
+    HANDLE hDoneEvent = reinterpret_cast<HANDLE>(doneEventValue);
+
+    CrashDumpRequest* request = static_cast<CrashDumpRequest*>(
+        MapViewOfFile(hMapping, FILE_MAP_ALL_ACCESS, 0, 0, sizeof(CrashDumpRequest)));
+    HANDLE hParent = OpenProcess(PROCESS_QUERY_INFORMATION | PROCESS_VM_READ |
+                                 PROCESS_DUP_HANDLE, FALSE, parentPid);
+    if (!request || !hParent) {
+        return 1;
+    }
+
+    // Sleep until the parent crashes or exits cleanly
+    HANDLE waitHandles[2] = {hCrashEvent, hParent};
+    DWORD wait = WaitForMultipleObjects(2, waitHandles, FALSE, INFINITE);
+    if (wait != WAIT_OBJECT_0) {
+        return 0;  // Parent exited without crashing
+    }
+
+    CreateDirectoryW(L"dumps", nullptr);
+    HANDLE hFile = CreateFileW(request->dumpPath, GENERIC_WRITE, FILE_SHARE_READ,
+                               nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (hFile == INVALID_HANDLE_VALUE) {
+        SetEvent(hDoneEvent);
+        return 1;
+    }
+
+    // Capture a PSS snapshot (VA clone) first: capture takes milliseconds,
+    // after which the parent is released and the slow MiniDumpWriteDump
+    // runs against the clone instead of the suspended process.
+    HPSS hSnapshot = nullptr;
+    DWORD captureStatus = PssCaptureSnapshot(
+        hParent,
+        static_cast<PSS_CAPTURE_FLAGS>(
+            PSS_CAPTURE_VA_CLONE |
+            PSS_CAPTURE_HANDLES |
+            PSS_CAPTURE_THREADS |
+            PSS_CAPTURE_THREAD_CONTEXT |
+            PSS_CAPTURE_THREAD_CONTEXT_EXTENDED),
+        CONTEXT_ALL,
+        &hSnapshot);
+
+    HANDLE hDumpTarget = hParent;
+    DWORD dumpTargetPid = request->processId;
+    PSS_VA_CLONE_INFORMATION cloneInfo = {};
+    if (captureStatus == ERROR_SUCCESS &&
+        PssQuerySnapshot(hSnapshot, PSS_QUERY_VA_CLONE_INFORMATION,
+                         &cloneInfo, sizeof(cloneInfo)) == ERROR_SUCCESS) {
+        hDumpTarget = cloneInfo.VaCloneHandle;
+        dumpTargetPid = GetProcessId(cloneInfo.VaCloneHandle);
+        // Release the faulting process now that its state is cloned
+        SetEvent(hDoneEvent);
+    }
+
+    // ClientPointers=TRUE: the exception record lives in the target's
+    // address space; MiniDumpWriteDump reads it across the boundary
+    MINIDUMP_EXCEPTION_INFORMATION mdei;
+    mdei.ThreadId = request->threadId;
+    mdei.ExceptionPointers =
+        reinterpret_cast<PEXCEPTION_POINTERS>(request->exceptionPointers);
+    mdei.ClientPointers = TRUE;
+
+    MINIDUMP_TYPE dumpType = static_cast<MINIDUMP_TYPE>(
+        MiniDumpWithFullMemory |
+        MiniDumpWithHandleData |
+        MiniDumpWithThreadInfo |
+        MiniDumpWithFullMemoryInfo
+    );
+
+    BOOL result = MiniDumpWriteDump(hDumpTarget, dumpTargetPid, hFile,
+                                    dumpType, &mdei, nullptr, nullptr);
+    CloseHandle(hFile);
+
+    if (hSnapshot) {
+        PssFreeSnapshot(GetCurrentProcess(), hSnapshot);
+    }
+
+    // Fallback path dumped the live process; release it only now
+    SetEvent(hDoneEvent);
+    return result ? 0 : 1;
+}
+
 LONG CALLBACK CrashHandler::VectoredExceptionHandler(PEXCEPTION_POINTERS pExceptionInfo) {
     // Handle the exception
     HandleException(pExceptionInfo);
@@ -56,8 +270,14 @@ int CrashHandler::HandleException(EXCEPTION_POINTERS* pExceptionInfo) {
            << ", Address: 0x" << std::setw(16) << reinterpret_cast<uintptr_t>(exceptionAddress);
         LOG_CRITICAL(ss.str());
         
-        // Generate minidump
-        bool dumpCreated = GenerateMinidump(pExceptionInfo);
+        // Prefer the out-of-process watchdog: the faulting process is
+        // suspended only while the watchdog snapshots it, not for the
+        // full dump write. Fall back to in-process dumping if the
+        // watchdog is unavailable.
+        bool dumpCreated = RequestWatchdogDump(pExceptionInfo);
+        if (!dumpCreated) {
+            dumpCreated = GenerateMinidump(pExceptionInfo);
+        }
         if (dumpCreated) {
             LOG_INFO("Crash minidump generated successfully");
         } else {
@@ -113,13 +333,34 @@ bool CrashHandler::GenerateMinidump(EXCEPTION_POINTERS* pExceptionInfo, const wc
             MiniDumpWithFullMemoryInfo
         );
         
+        // Embed the flight recorder timeline as a user stream so the
+        // lead-up to the crash travels inside the dump itself. The
+        // snapshot is staged in the preallocated arena: no heap use on
+        // the crash path.
+        MINIDUMP_USER_STREAM flightStream;
+        MINIDUMP_USER_STREAM_INFORMATION userStreams;
+        PMINIDUMP_USER_STREAM_INFORMATION pUserStreams = nullptr;
+        unsigned char* flightBuffer = AllocFromArena(crashArenaSize_ / 2);
+        if (flightBuffer) {
+            size_t flightBytes =
+                FlightRecorder::CollectSnapshotInto(flightBuffer, crashArenaSize_ / 2);
+            if (flightBytes > 0) {
+                flightStream.Type = FLIGHT_RECORDER_STREAM_TYPE;
+                flightStream.Buffer = flightBuffer;
+                flightStream.BufferSize = static_cast<ULONG>(flightBytes);
+                userStreams.UserStreamCount = 1;
+                userStreams.UserStreamArray = &flightStream;
+                pUserStreams = &userStreams;
+            }
+        }
+
         BOOL result = MiniDumpWriteDump(
             GetCurrentProcess(),
             GetCurrentProcessId(),
             hFile,
             dumpType,
             &mdei,
-            nullptr,
+            pUserStreams,
             nullptr
         );
         
@@ -34,11 +34,40 @@ public:
      * @brief Log symbolicated stack trace to log file
      */
     static void LogStackTrace(EXCEPTION_POINTERS* pExceptionInfo);
-    
+
+    /**
+     * @brief Entry point for the pre-spawned dump watchdog helper process
+     *
+     * Install() launches the application binary again with
+     * --crash-watchdog and inherited handles; wWinMain dispatches here
+     * before any other initialization. The watchdog sleeps until either
+     * the crash event fires (then writes the minidump out-of-process via
+     * ClientPointers so the faulting process is suspended only for
+     * milliseconds) or the parent exits.
+     * @param commandLine Full command line of the helper invocation
+     * @return Process exit code
+     */
+    static int WatchdogMain(const wchar_t* commandLine);
+
 private:
     static LONG CALLBACK VectoredExceptionHandler(PEXCEPTION_POINTERS pExceptionInfo);
+
+    // Crash-path infrastructure reserved at Install() time: a fixed
+    // arena so the handler never touches the (possibly corrupt) process
+    // heap, and a watchdog helper that owns the slow MiniDumpWriteDump.
+    static bool SpawnWatchdog();
+    static bool RequestWatchdogDump(EXCEPTION_POINTERS* pExceptionInfo);
+    static unsigned char* AllocFromArena(size_t bytes);
+
     static bool initialized_;
     static void* hVectoredHandler_;
+    static unsigned char* crashArena_;
+    static size_t crashArenaSize_;
+    static size_t crashArenaUsed_;
+    static HANDLE hWatchdogProcess_;
+    static HANDLE hCrashEvent_;
+    static HANDLE hDumpDoneEvent_;
+    static void* pSharedRequest_;  // Mapped view shared with the watchdog
 };
 
 } // namespace Crash
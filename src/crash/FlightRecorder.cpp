@@ -0,0 +1,230 @@
+#include "FlightRecorder.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <cstring>
+
+namespace RainmeterManager {
+namespace Crash {
+
+namespace {
+
+// One ring per thread. Only the owning thread writes; the crash handler
+// reads through the release-ordered write index. Rings are never freed:
+// a thread that exits marks its ring retired so its final activity is
+// still available post-mortem.
+struct ThreadRing {
+    std::vector<TraceRecord> slots;
+    size_t mask = 0;
+    std::atomic<uint64_t> writeIndex{0};
+    uint32_t threadId = 0;
+    std::atomic<bool> retired{false};
+};
+
+std::mutex g_registryMutex;
+std::vector<std::unique_ptr<ThreadRing>> g_rings;
+size_t g_ringCapacity = 4096;
+
+// Retires the thread's ring when the thread exits
+struct ThreadRingHandle {
+    ThreadRing* ring = nullptr;
+    ~ThreadRingHandle() {
+        if (ring) {
+            ring->retired.store(true, std::memory_order_release);
+        }
+    }
+};
+
+thread_local ThreadRingHandle t_ringHandle;
+
+ThreadRing* AcquireThreadRing() {
+    if (t_ringHandle.ring) {
+        return t_ringHandle.ring;
+    }
+
+    size_t capacity = 1;
+    while (capacity < g_ringCapacity) {
+        capacity <<= 1;
+    }
+
+    auto ring = std::make_unique<ThreadRing>();
+    ring->slots.resize(capacity);
+    ring->mask = capacity - 1;
+    ring->threadId = GetCurrentThreadId();
+
+    t_ringHandle.ring = ring.get();
+    {
+        std::lock_guard<std::mutex> lock(g_registryMutex);
+        g_rings.push_back(std::move(ring));
+    }
+    return t_ringHandle.ring;
+}
+
+void AppendBytes(std::vector<unsigned char>& out, const void* data, size_t size) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    out.insert(out.end(), bytes, bytes + size);
+}
+
+// Snapshot header preceding the per-ring record runs
+#pragma pack(push, 4)
+struct SnapshotHeader {
+    uint32_t magic;          // 'RMFR'
+    uint32_t version;
+    uint64_t qpcFrequency;
+    uint32_t ringCount;
+    uint32_t reserved;
+};
+
+struct RingHeader {
+    uint32_t threadId;
+    uint32_t retired;
+    uint64_t recordCount;
+};
+#pragma pack(pop)
+
+const uint32_t SNAPSHOT_MAGIC = 0x524D4652;  // 'RMFR'
+const uint32_t SNAPSHOT_VERSION = 1;
+
+} // anonymous namespace
+
+void FlightRecorder::SetRingCapacity(size_t records) {
+    if (records > 0) {
+        g_ringCapacity = records;
+    }
+}
+
+void FlightRecorder::Emit(uint16_t eventId, TraceCategory category,
+                          uint64_t arg0, uint64_t arg1) {
+    ThreadRing* ring = AcquireThreadRing();
+
+    LARGE_INTEGER now;
+    QueryPerformanceCounter(&now);
+
+    uint64_t index = ring->writeIndex.load(std::memory_order_relaxed);
+    TraceRecord& slot = ring->slots[index & ring->mask];
+    slot.timestampQpc = static_cast<uint64_t>(now.QuadPart);
+    slot.eventId = eventId;
+    slot.category = static_cast<uint16_t>(category);
+    slot.threadId = ring->threadId;
+    slot.arg0 = arg0;
+    slot.arg1 = arg1;
+
+    // Publish after the record is fully written so the crash handler
+    // never reads a half-filled slot below the index.
+    ring->writeIndex.store(index + 1, std::memory_order_release);
+}
+
+size_t FlightRecorder::CollectSnapshot(std::vector<unsigned char>& out) {
+    out.clear();
+
+    // Best effort at crash time: never block on a thread that died while
+    // holding the registry lock. Without the lock we still only read the
+    // entries visible at the size we sample.
+    bool locked = g_registryMutex.try_lock();
+    size_t ringCount = g_rings.size();
+
+    LARGE_INTEGER frequency;
+    QueryPerformanceFrequency(&frequency);
+
+    SnapshotHeader header;
+    header.magic = SNAPSHOT_MAGIC;
+    header.version = SNAPSHOT_VERSION;
+    header.qpcFrequency = static_cast<uint64_t>(frequency.QuadPart);
+    header.ringCount = static_cast<uint32_t>(ringCount);
+    header.reserved = 0;
+    AppendBytes(out, &header, sizeof(header));
+
+    size_t totalRecords = 0;
+    for (size_t i = 0; i < ringCount; ++i) {
+        ThreadRing* ring = g_rings[i].get();
+        uint64_t written = ring->writeIndex.load(std::memory_order_acquire);
+        uint64_t capacity = ring->mask + 1;
+        uint64_t retained = (written < capacity) ? written : capacity;
+
+        RingHeader ringHeader;
+        ringHeader.threadId = ring->threadId;
+        ringHeader.retired = ring->retired.load(std::memory_order_acquire) ? 1 : 0;
+        ringHeader.recordCount = retained;
+        AppendBytes(out, &ringHeader, sizeof(ringHeader));
+
+        // Oldest record first. The owning thread may still be writing;
+        // at worst the oldest slot of a live ring is mid-overwrite.
+        uint64_t start = written - retained;
+        for (uint64_t r = 0; r < retained; ++r) {
+            const TraceRecord& record = ring->slots[(start + r) & ring->mask];
+            AppendBytes(out, &record, sizeof(record));
+        }
+        totalRecords += static_cast<size_t>(retained);
+    }
+
+    if (locked) {
+        g_registryMutex.unlock();
+    }
+
+    if (totalRecords == 0) {
+        out.clear();
+    }
+    return totalRecords;
+}
+
+size_t FlightRecorder::CollectSnapshotInto(unsigned char* buffer, size_t capacity) {
+    if (!buffer || capacity < sizeof(SnapshotHeader)) {
+        return 0;
+    }
+
+    bool locked = g_registryMutex.try_lock();
+    size_t ringCount = g_rings.size();
+
+    LARGE_INTEGER frequency;
+    QueryPerformanceFrequency(&frequency);
+
+    SnapshotHeader* header = reinterpret_cast<SnapshotHeader*>(buffer);
+    header->magic = SNAPSHOT_MAGIC;
+    header->version = SNAPSHOT_VERSION;
+    header->qpcFrequency = static_cast<uint64_t>(frequency.QuadPart);
+    header->ringCount = 0;
+    header->reserved = 0;
+
+    size_t used = sizeof(SnapshotHeader);
+    size_t totalRecords = 0;
+
+    for (size_t i = 0; i < ringCount; ++i) {
+        if (used + sizeof(RingHeader) + sizeof(TraceRecord) > capacity) {
+            break;  // No room for another ring with at least one record
+        }
+
+        ThreadRing* ring = g_rings[i].get();
+        uint64_t written = ring->writeIndex.load(std::memory_order_acquire);
+        uint64_t ringCapacity = ring->mask + 1;
+        uint64_t retained = (written < ringCapacity) ? written : ringCapacity;
+
+        // Keep the newest records when the buffer cannot hold them all
+        uint64_t roomFor = (capacity - used - sizeof(RingHeader)) / sizeof(TraceRecord);
+        uint64_t emit = (retained < roomFor) ? retained : roomFor;
+
+        RingHeader* ringHeader = reinterpret_cast<RingHeader*>(buffer + used);
+        ringHeader->threadId = ring->threadId;
+        ringHeader->retired = ring->retired.load(std::memory_order_acquire) ? 1 : 0;
+        ringHeader->recordCount = emit;
+        used += sizeof(RingHeader);
+
+        uint64_t start = written - emit;
+        for (uint64_t r = 0; r < emit; ++r) {
+            std::memcpy(buffer + used, &ring->slots[(start + r) & ring->mask],
+                        sizeof(TraceRecord));
+            used += sizeof(TraceRecord);
+        }
+
+        header->ringCount++;
+        totalRecords += static_cast<size_t>(emit);
+    }
+
+    if (locked) {
+        g_registryMutex.unlock();
+    }
+
+    return (totalRecords > 0) ? used : 0;
+}
+
+} // namespace Crash
+} // namespace RainmeterManager
@@ -0,0 +1,103 @@
+#pragma once
+#include <windows.h>
+#include <cstdint>
+#include <vector>
+
+namespace RainmeterManager {
+namespace Crash {
+
+/**
+ * @brief One compact trace record written by a hot path
+ *
+ * Fixed 32-byte layout so rings are plain memory the crash handler can
+ * serialize without touching any other subsystem.
+ */
+#pragma pack(push, 4)
+struct TraceRecord {
+    uint64_t timestampQpc;   // QueryPerformanceCounter ticks
+    uint16_t eventId;        // Caller-defined event code
+    uint16_t category;       // TraceCategory
+    uint32_t threadId;
+    uint64_t arg0;
+    uint64_t arg1;
+};
+#pragma pack(pop)
+
+/**
+ * @brief Coarse subsystem tag for trace records
+ */
+enum class TraceCategory : uint16_t {
+    General = 0,
+    Render,
+    Ipc,
+    Config,
+    Measure,
+    Widget,
+    Service
+};
+
+/**
+ * @brief In-memory flight recorder for post-mortem timelines
+ *
+ * Hot paths call Emit to write compact records into a per-thread ring
+ * buffer at near-zero cost: each thread owns its ring, so writes are a
+ * timestamp, three stores, and one release-ordered index bump — no
+ * locks and no I/O. Rings are registered globally; at crash time
+ * CollectSnapshot serializes the retained tail of every ring (including
+ * rings of threads that have since exited) and CrashHandler embeds it
+ * in the minidump as a user stream, giving the lead-up timeline without
+ * paying for runtime file logging.
+ */
+class FlightRecorder {
+public:
+    /**
+     * @brief Set per-thread ring capacity in records (rounded up to a power of two)
+     *
+     * Affects rings created after the call; set once at startup before
+     * hot paths run. Default is 4096 records (128 KB) per thread.
+     */
+    static void SetRingCapacity(size_t records);
+
+    /**
+     * @brief Write one trace record into the calling thread's ring
+     *
+     * Safe to call from any thread; the first call on a thread creates
+     * and registers its ring.
+     */
+    static void Emit(uint16_t eventId, TraceCategory category,
+                     uint64_t arg0 = 0, uint64_t arg1 = 0);
+
+    /**
+     * @brief Serialize the retained tail of every ring
+     * @param out Receives a self-describing binary snapshot ('RMFR' header,
+     *            QPC frequency, then per-ring record runs oldest-first)
+     * @return Number of records captured, 0 when nothing was recorded
+     *
+     * Crash-safe by best effort: the ring registry is read under try_lock
+     * so a crash while another thread registers a ring cannot deadlock
+     * the handler.
+     */
+    static size_t CollectSnapshot(std::vector<unsigned char>& out);
+
+    /**
+     * @brief Serialize into a caller-provided buffer without allocating
+     * @param buffer Destination (typically the crash handler's arena)
+     * @param capacity Buffer size in bytes
+     * @return Bytes written, 0 when nothing was recorded or nothing fits
+     *
+     * Same format as CollectSnapshot; rings whose records do not fit are
+     * truncated to their newest records. Heap-free for use on the crash
+     * path where the process heap may be corrupt.
+     */
+    static size_t CollectSnapshotInto(unsigned char* buffer, size_t capacity);
+};
+
+// Minidump user stream type carrying the flight recorder snapshot
+const ULONG32 FLIGHT_RECORDER_STREAM_TYPE = 0x524D4652;  // 'RMFR'
+
+// Hot-path convenience wrapper
+#define FLIGHT_TRACE(eventId, category, arg0, arg1) \
+    ::RainmeterManager::Crash::FlightRecorder::Emit((eventId), (category), (arg0), (arg1))
+
+} // namespace Crash
+} // namespace RainmeterManager
@@ -1,6 +1,7 @@
 // ipc_manager.cpp - Windows Named Pipes IPC Manager Implementation
 #include "ipc_manager.h"
 #include "../core/logger.h"
+#include <algorithm>
 #include <sstream>
 #include <iomanip>
 #include <random>
@@ -14,7 +15,6 @@ IPCManager::IPCManager()
     , stopRequested_(false)
     , clientPipe_(INVALID_HANDLE_VALUE)
     , clientConnected_(false)
-    , stats_{0, 0, 0, 0, 0}
 {
     LOG_INFO("IPCManager created");
 }
@@ -48,7 +48,10 @@ bool IPCManager::Start(const IPCConfig& config) {
     
     // Start sender thread
     senderThread_ = std::make_unique<std::thread>(&IPCManager::SenderLoop, this);
-    
+
+    // Request timeouts expire off this wheel (see SendRequest)
+    requestTimeouts_.Start();
+
     LOG_INFO("IPCManager started successfully");
     return true;
 }
@@ -63,7 +66,11 @@ void IPCManager::Stop() {
     
     stopRequested_ = true;
     sendQueueCV_.notify_all();
-    
+
+    // Stopping the wheel fires every pending timeout, so SendRequest
+    // callers blocked on a response wake with a timeout result
+    requestTimeouts_.Stop();
+
     // Join threads
     if (listenerThread_ && listenerThread_->joinable()) {
         listenerThread_->join();
@@ -77,7 +84,20 @@ void IPCManager::Stop() {
         }
     }
     connectionThreads_.clear();
-    
+
+    // Complete outstanding zero-copy sends as failed so callers can
+    // release their payload buffers
+    {
+        std::lock_guard<std::mutex> lock(sendQueueMutex_);
+        while (!rawSendQueue_.empty()) {
+            RawSendItem item = std::move(rawSendQueue_.front());
+            rawSendQueue_.pop();
+            if (item.onComplete) {
+                item.onComplete(false);
+            }
+        }
+    }
+
     // Close connections
     if (mode_ == IPCMode::Server) {
         std::lock_guard<std::mutex> lock(connectionsMutex_);
@@ -94,6 +114,14 @@ void IPCManager::Stop() {
     }
     
     running_ = false;
+
+    // Per-tag allocation picture for soak-test analysis; which subsystem
+    // grew is otherwise invisible once the process exits
+    std::string memoryReport = Core::MemoryRegistry::GetInstance().GetStatisticsReport();
+    if (!memoryReport.empty()) {
+        LOG_INFO("Tagged memory statistics at IPC shutdown:\n" + memoryReport);
+    }
+
     LOG_INFO("IPCManager stopped");
 }
 
@@ -145,6 +173,29 @@ bool IPCManager::SendTo(DWORD targetProcessId, const std::string& channel, const
     return false;
 }
 
+// Queue a caller-owned payload for the zero-copy send path
+bool IPCManager::SendZeroCopy(const std::string& channel, const char* payload, size_t payloadSize,
+                              SendCompleteHandler onComplete) {
+    if (!running_ || !payload) {
+        if (onComplete) onComplete(false);
+        return false;
+    }
+
+    RawSendItem item;
+    item.channel = channel;
+    item.messageId = GenerateMessageId();
+    item.payload = payload;
+    item.payloadSize = payloadSize;
+    item.timestamp = GetTimestamp();
+    item.onComplete = std::move(onComplete);
+
+    std::lock_guard<std::mutex> lock(sendQueueMutex_);
+    rawSendQueue_.push(std::move(item));
+    sendQueueCV_.notify_one();
+
+    return true;
+}
+
 // Broadcast to all connections
 bool IPCManager::Broadcast(const std::string& channel, const std::string& payload) {
     if (!running_ || mode_ != IPCMode::Server) {
@@ -158,18 +209,78 @@ bool IPCManager::Broadcast(const std::string& channel, const std::string& payloa
     msg.payload = payload;
     msg.timestamp = GetTimestamp();
     
+    // Serialize once; every connection's queue shares the same frame
+    // bytes and drains them from its own sender thread, so a slow pipe
+    // only delays its own subscriber
+    OutboundFrame frame;
+    frame.channel = channel;
+    frame.frame = std::make_shared<const std::string>(SerializeWireFrame(msg));
+
     std::lock_guard<std::mutex> lock(connectionsMutex_);
-    bool anySuccess = false;
-    
+    bool anyQueued = false;
+
     for (auto& conn : connections_) {
-        if (conn.active) {
-            if (SendMessageInternal(conn.pipeHandle, msg)) {
-                anySuccess = true;
+        if (conn.active && conn.outbound) {
+            EnqueueOutbound(conn, frame);
+            anyQueued = true;
+        }
+    }
+
+    return anyQueued;
+}
+
+// Push a frame onto a connection's bounded queue, dropping the oldest
+// frame of the same channel when full (a stale snapshot is superseded
+// by the newer one)
+void IPCManager::EnqueueOutbound(ConnectionInfo& conn, const OutboundFrame& frame) {
+    OutboundQueue& queue = *conn.outbound;
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if ((int)queue.frames.size() >= config_.maxOutboundQueueDepth) {
+            auto stale = std::find_if(queue.frames.begin(), queue.frames.end(),
+                [&](const OutboundFrame& f) { return f.channel == frame.channel; });
+            if (stale != queue.frames.end()) {
+                queue.frames.erase(stale);
+            } else {
+                queue.frames.pop_front();
             }
+            queue.droppedFrames++;
+            statCounters_.Add(STAT_BROADCAST_FRAMES_DROPPED);
+        }
+        queue.frames.push_back(frame);
+    }
+    queue.cv.notify_one();
+}
+
+// Drain one connection's outbound queue onto its pipe
+void IPCManager::ConnectionSenderLoop(std::shared_ptr<OutboundQueue> queue, HANDLE pipe) {
+    while (!queue->stop) {
+        OutboundFrame frame;
+        {
+            std::unique_lock<std::mutex> lock(queue->mutex);
+            queue->cv.wait(lock, [&]{ return !queue->frames.empty() || queue->stop; });
+            if (queue->stop) break;
+            frame = std::move(queue->frames.front());
+            queue->frames.pop_front();
+        }
+
+        DWORD bytesWritten = 0;
+        bool success = WriteFile(
+            pipe,
+            frame.frame->c_str(),
+            static_cast<DWORD>(frame.frame->length()),
+            &bytesWritten,
+            nullptr
+        );
+
+        if (success) {
+            statCounters_.Add(STAT_MESSAGES_SENT);
+            statCounters_.Add(STAT_BYTES_TRANSFERRED, bytesWritten);
+        } else {
+            // Pipe is gone; the receive side tears the connection down
+            break;
         }
     }
-    
-    return anySuccess;
 }
 
 // Send request and wait for response
@@ -188,36 +299,55 @@ std::string IPCManager::SendRequest(const std::string& channel, const std::strin
     // Create pending request
     auto pending = std::make_shared<PendingRequest>();
     pending->completed = false;
-    
+
     {
         std::lock_guard<std::mutex> lock(requestsMutex_);
         pendingRequests_[msg.messageId] = pending;
     }
-    
+
+    // Arm the timeout on the wheel: O(1), no per-request timed wait.
+    // If the response loses the race the callback is a no-op.
+    auto timeoutTimer = requestTimeouts_.Schedule(
+        static_cast<uint32_t>(timeoutMs), [pending]() {
+            std::lock_guard<std::mutex> lock(pending->mutex);
+            if (!pending->completed) {
+                pending->timedOut = true;
+                pending->completed = true;
+                pending->cv.notify_all();
+            }
+        });
+
     // Send message
     {
         std::lock_guard<std::mutex> lock(sendQueueMutex_);
         sendQueue_.push(msg);
         sendQueueCV_.notify_one();
     }
-    
-    // Wait for response
-    std::unique_lock<std::mutex> lock(pending->mutex);
-    if (pending->cv.wait_for(lock, std::chrono::milliseconds(timeoutMs), [&]{ return pending->completed; })) {
-        std::string response = pending->response;
-        
+
+    // Wait for completion: either the response arrives or the wheel
+    // expires the request (Stop() drains the wheel, so shutdown also
+    // wakes us)
+    std::string response;
+    bool timedOut;
+    {
+        std::unique_lock<std::mutex> lock(pending->mutex);
+        pending->cv.wait(lock, [&]{ return pending->completed; });
+        timedOut = pending->timedOut;
+        response = pending->response;
+    }
+
+    requestTimeouts_.Cancel(timeoutTimer);
+
+    {
         std::lock_guard<std::mutex> reqLock(requestsMutex_);
         pendingRequests_.erase(msg.messageId);
-        
-        return response;
-    } else {
+    }
+
+    if (timedOut) {
         LOG_WARNING("Request timeout: " + msg.messageId);
-        
-        std::lock_guard<std::mutex> reqLock(requestsMutex_);
-        pendingRequests_.erase(msg.messageId);
-        
         return "";
     }
+    return response;
 }
 
 // Send response to request
@@ -238,10 +368,24 @@ void IPCManager::SendResponse(const std::string& messageId, const std::string& p
     sendQueueCV_.notify_one();
 }
 
-// Register message handler for channel
+// Register message handler for channel, interning the channel name to
+// its numeric dispatch ID
 void IPCManager::OnMessage(const std::string& channel, MessageHandler handler) {
+    uint64_t channelId = HashChannelId(channel);
+
     std::lock_guard<std::mutex> lock(handlersMutex_);
-    messageHandlers_[channel] = std::move(handler);
+    for (auto& entry : messageHandlers_) {
+        if (entry.channelId == channelId) {
+            if (entry.channel != channel) {
+                LOG_ERROR("Channel ID collision: '" + channel + "' hashes like '" +
+                          entry.channel + "', handler not registered");
+                return;
+            }
+            entry.handler = std::move(handler);
+            return;
+        }
+    }
+    messageHandlers_.push_back({channelId, channel, std::move(handler)});
     LOG_INFO("Registered message handler for channel: " + channel);
 }
 
@@ -304,8 +448,15 @@ void IPCManager::DisconnectProcess(DWORD processId) {
 
 // Get statistics
 IPCManager::Statistics IPCManager::GetStatistics() const {
-    std::lock_guard<std::mutex> lock(statsMutex_);
-    return stats_;
+    // Lazy aggregation across the per-thread shards
+    Statistics stats;
+    stats.messagesSent = statCounters_.Sum(STAT_MESSAGES_SENT);
+    stats.messagesReceived = statCounters_.Sum(STAT_MESSAGES_RECEIVED);
+    stats.bytesTransferred = statCounters_.Sum(STAT_BYTES_TRANSFERRED);
+    stats.connectionsFailed = statCounters_.Sum(STAT_CONNECTIONS_FAILED);
+    stats.reconnectAttempts = statCounters_.Sum(STAT_RECONNECT_ATTEMPTS);
+    stats.broadcastFramesDropped = statCounters_.Sum(STAT_BROADCAST_FRAMES_DROPPED);
+    return stats;
 }
 
 // Server listener loop
@@ -346,6 +497,9 @@ void IPCManager::ServerListenerLoop() {
                 conn.processId = clientProcessId;
                 conn.active = true;
                 conn.lastActivity = std::chrono::steady_clock::now();
+                conn.outbound = std::make_shared<OutboundQueue>();
+                conn.outbound->senderThread = std::thread(
+                    &IPCManager::ConnectionSenderLoop, this, conn.outbound, pipeHandle);
                 connections_.push_back(conn);
             }
             
@@ -432,10 +586,8 @@ void IPCManager::ClientConnectionLoop() {
             }
         } else {
             reconnectAttempts++;
-            
-            std::lock_guard<std::mutex> lock(statsMutex_);
-            stats_.connectionsFailed++;
-            
+            statCounters_.Add(STAT_CONNECTIONS_FAILED);
+
             if (!config_.enableReconnect || reconnectAttempts >= config_.maxReconnectAttempts) {
                 LOG_ERROR("Failed to connect after " + std::to_string(reconnectAttempts) + " attempts");
                 break;
@@ -445,7 +597,7 @@ void IPCManager::ClientConnectionLoop() {
                        std::to_string(config_.reconnectDelayMs) + "ms");
             std::this_thread::sleep_for(std::chrono::milliseconds(config_.reconnectDelayMs));
             
-            stats_.reconnectAttempts++;
+            statCounters_.Add(STAT_RECONNECT_ATTEMPTS);
         }
     }
     
@@ -523,15 +675,42 @@ void IPCManager::SenderLoop() {
     
     while (!stopRequested_) {
         std::unique_lock<std::mutex> lock(sendQueueMutex_);
-        sendQueueCV_.wait(lock, [this]{ return !sendQueue_.empty() || stopRequested_; });
-        
+        sendQueueCV_.wait(lock, [this]{
+            return !sendQueue_.empty() || !rawSendQueue_.empty() || stopRequested_;
+        });
+
         if (stopRequested_) break;
-        
+
+        if (!rawSendQueue_.empty()) {
+            RawSendItem item = std::move(rawSendQueue_.front());
+            rawSendQueue_.pop();
+            lock.unlock();
+
+            bool anySuccess = false;
+            if (mode_ == IPCMode::Server) {
+                std::lock_guard<std::mutex> connLock(connectionsMutex_);
+                for (auto& conn : connections_) {
+                    if (conn.active && SendRawFrame(conn.pipeHandle, item)) {
+                        anySuccess = true;
+                    }
+                }
+            } else {
+                if (clientConnected_ && clientPipe_ != INVALID_HANDLE_VALUE) {
+                    anySuccess = SendRawFrame(clientPipe_, item);
+                }
+            }
+
+            if (item.onComplete) {
+                item.onComplete(anySuccess);
+            }
+            continue;
+        }
+
         if (!sendQueue_.empty()) {
             IPCMessage msg = sendQueue_.front();
             sendQueue_.pop();
             lock.unlock();
-            
+
             // Send message
             if (mode_ == IPCMode::Server) {
                 // Broadcast to all active connections
@@ -549,65 +728,160 @@ void IPCManager::SenderLoop() {
             }
         }
     }
-    
+
     LOG_INFO("Sender thread stopped");
 }
 
+// Frame and write a zero-copy send in a single pipe write
+bool IPCManager::SendRawFrame(HANDLE pipe, const RawSendItem& item) {
+    // Message-mode pipes need one contiguous WriteFile per message, so
+    // the wire header and the caller's payload are assembled in a
+    // pooled buffer: one copy of the payload total, no allocation once
+    // the pool is warm
+    if (item.messageId.size() > UINT16_MAX || item.payloadSize > UINT32_MAX) {
+        NotifyError("Zero-copy message exceeds wire frame limits", 0);
+        return false;
+    }
+
+    IPCWireHeader header = {};
+    header.magic = IPC_WIRE_MAGIC;
+    header.version = IPC_WIRE_VERSION;
+    header.flags = IPC_FRAME_NOTIFICATION;
+    header.channelId = HashChannelId(item.channel);
+    header.timestamp = item.timestamp;
+    header.messageIdLength = static_cast<uint16_t>(item.messageId.size());
+    header.payloadLength = static_cast<uint32_t>(item.payloadSize);
+
+    size_t frameSize = sizeof(header) + item.messageId.size() + item.payloadSize;
+    std::vector<char> frame = AcquireFramingBuffer(frameSize);
+
+    char* cursor = frame.data();
+    memcpy(cursor, &header, sizeof(header));
+    cursor += sizeof(header);
+    memcpy(cursor, item.messageId.data(), item.messageId.size());
+    cursor += item.messageId.size();
+    memcpy(cursor, item.payload, item.payloadSize);
+
+    DWORD bytesWritten = 0;
+    bool success = WriteFile(
+        pipe,
+        frame.data(),
+        static_cast<DWORD>(frameSize),
+        &bytesWritten,
+        nullptr
+    );
+
+    ReleaseFramingBuffer(std::move(frame));
+
+    if (success) {
+        statCounters_.Add(STAT_MESSAGES_SENT);
+        statCounters_.Add(STAT_BYTES_TRANSFERRED, bytesWritten);
+    } else {
+        NotifyError("Failed to send zero-copy message", GetLastError());
+    }
+
+    return success;
+}
+
+// Take a framing buffer from the pool (or grow a fresh one)
+std::vector<char> IPCManager::AcquireFramingBuffer(size_t minSize) {
+    {
+        std::lock_guard<std::mutex> lock(framingPoolMutex_);
+        if (!framingPool_.empty()) {
+            std::vector<char> buffer = std::move(framingPool_.back());
+            framingPool_.pop_back();
+            if (buffer.size() < minSize) {
+                buffer.resize(minSize);
+            }
+            return buffer;
+        }
+    }
+    return std::vector<char>(minSize);
+}
+
+// Return a framing buffer to the pool for reuse
+void IPCManager::ReleaseFramingBuffer(std::vector<char>&& buffer) {
+    std::lock_guard<std::mutex> lock(framingPoolMutex_);
+    if (framingPool_.size() < FRAMING_POOL_MAX) {
+        framingPool_.push_back(std::move(buffer));
+    }
+}
+
 // Send message over pipe
 bool IPCManager::SendMessageInternal(HANDLE pipe, const IPCMessage& message) {
-    std::string serialized = SerializeMessage(message);
+    if (message.messageId.size() > UINT16_MAX || message.payload.size() > UINT32_MAX) {
+        NotifyError("Message exceeds wire frame limits", 0);
+        return false;
+    }
+
+    size_t frameSize = sizeof(IPCWireHeader) + message.messageId.size() +
+                       message.payload.size();
+    std::vector<char> frame = AcquireFramingBuffer(frameSize);
+    BuildWireFrame(message, frame.data());
+
     DWORD bytesWritten = 0;
-    
     bool success = WriteFile(
         pipe,
-        serialized.c_str(),
-        static_cast<DWORD>(serialized.length()),
+        frame.data(),
+        static_cast<DWORD>(frameSize),
         &bytesWritten,
         nullptr
     );
-    
+
+    ReleaseFramingBuffer(std::move(frame));
+
     if (success) {
-        std::lock_guard<std::mutex> lock(statsMutex_);
-        stats_.messagesSent++;
-        stats_.bytesTransferred += bytesWritten;
+        statCounters_.Add(STAT_MESSAGES_SENT);
+        statCounters_.Add(STAT_BYTES_TRANSFERRED, bytesWritten);
     } else {
         NotifyError("Failed to send message", GetLastError());
     }
-    
+
     return success;
 }
 
-// Receive message from pipe
+// Receive message from pipe: one read pulls the whole message-mode
+// frame into a pooled buffer, then framing is a header check plus two
+// exact-length assigns - no delimiter scanning
 bool IPCManager::ReceiveMessage(HANDLE pipe, IPCMessage& message) {
-    char buffer[65536];
+    static constexpr DWORD RECEIVE_BUFFER_SIZE = 65536;
+
+    std::vector<char> buffer = AcquireFramingBuffer(RECEIVE_BUFFER_SIZE);
     DWORD bytesRead = 0;
-    
+
     bool success = ReadFile(
         pipe,
-        buffer,
-        sizeof(buffer) - 1,
+        buffer.data(),
+        RECEIVE_BUFFER_SIZE,
         &bytesRead,
         nullptr
     );
-    
+
     if (!success || bytesRead == 0) {
+        ReleaseFramingBuffer(std::move(buffer));
         return false;
     }
-    
-    buffer[bytesRead] = '\0';
-    
-    try {
-        message = DeserializeMessage(std::string(buffer, bytesRead));
-        
-        std::lock_guard<std::mutex> lock(statsMutex_);
-        stats_.messagesReceived++;
-        stats_.bytesTransferred += bytesRead;
-        
-        return true;
-    } catch (const std::exception& e) {
-        LOG_ERROR(std::string("Failed to deserialize message: ") + e.what());
-        return false;
+
+    bool parsed = false;
+    if (ParseWireFrame(buffer.data(), bytesRead, message)) {
+        parsed = true;
+    } else {
+        // Legacy peer: text-framed JSON
+        try {
+            message = DeserializeMessage(std::string(buffer.data(), bytesRead));
+            parsed = true;
+        } catch (const std::exception& e) {
+            LOG_ERROR(std::string("Failed to deserialize message: ") + e.what());
+        }
+    }
+
+    ReleaseFramingBuffer(std::move(buffer));
+
+    if (parsed) {
+        statCounters_.Add(STAT_MESSAGES_RECEIVED);
+        statCounters_.Add(STAT_BYTES_TRANSFERRED, bytesRead);
     }
+    return parsed;
 }
 
 // Process incoming message
@@ -623,24 +897,113 @@ void IPCManager::ProcessIncomingMessage(const IPCMessage& message) {
             it->second->cv.notify_one();
         }
     } else {
-        // Route to channel handler
+        // Route by interned channel ID: frames from current peers carry
+        // it, frames from older peers fall back to hashing the name once
+        uint64_t channelId = message.channelId != 0
+            ? message.channelId
+            : HashChannelId(message.channel);
+
         std::lock_guard<std::mutex> lock(handlersMutex_);
-        auto it = messageHandlers_.find(message.channel);
-        if (it != messageHandlers_.end() && it->second) {
-            try {
-                it->second(message);
-            } catch (const std::exception& e) {
-                LOG_ERROR(std::string("Message handler exception: ") + e.what());
+        for (const auto& entry : messageHandlers_) {
+            if (entry.channelId != channelId) {
+                continue;
+            }
+            if (entry.handler) {
+                try {
+                    entry.handler(message);
+                } catch (const std::exception& e) {
+                    LOG_ERROR(std::string("Message handler exception: ") + e.what());
+                }
             }
+            break;
         }
     }
 }
 
-// Serialize message to JSON string
+namespace {
+
+uint16_t WireFlagsFromType(const std::string& type) {
+    if (type == "request") return IPC_FRAME_REQUEST;
+    if (type == "response") return IPC_FRAME_RESPONSE;
+    return IPC_FRAME_NOTIFICATION;
+}
+
+const char* TypeFromWireFlags(uint16_t flags) {
+    if (flags & IPC_FRAME_REQUEST) return "request";
+    if (flags & IPC_FRAME_RESPONSE) return "response";
+    return "notification";
+}
+
+} // namespace
+
+// Write a complete wire frame into out, which must hold
+// sizeof(IPCWireHeader) + messageId + payload bytes
+void IPCManager::BuildWireFrame(const IPCMessage& message, char* out) const {
+    IPCWireHeader header = {};
+    header.magic = IPC_WIRE_MAGIC;
+    header.version = IPC_WIRE_VERSION;
+    header.flags = WireFlagsFromType(message.type);
+    header.channelId = message.channelId != 0
+        ? message.channelId : HashChannelId(message.channel);
+    header.timestamp = message.timestamp;
+    header.messageIdLength = static_cast<uint16_t>(message.messageId.size());
+    header.payloadLength = static_cast<uint32_t>(message.payload.size());
+
+    memcpy(out, &header, sizeof(header));
+    out += sizeof(header);
+    memcpy(out, message.messageId.data(), message.messageId.size());
+    out += message.messageId.size();
+    memcpy(out, message.payload.data(), message.payload.size());
+}
+
+// Frame into a string for the shared broadcast path, where one
+// serialization is refcounted across every connection's queue
+std::string IPCManager::SerializeWireFrame(const IPCMessage& message) const {
+    std::string frame;
+    frame.resize(sizeof(IPCWireHeader) + message.messageId.size() +
+                 message.payload.size());
+    BuildWireFrame(message, &frame[0]);
+    return frame;
+}
+
+// Validate and unpack a binary frame; false means "not this format"
+// and the caller falls back to the legacy JSON parser
+bool IPCManager::ParseWireFrame(const char* data, size_t size, IPCMessage& message) const {
+    if (size < sizeof(IPCWireHeader)) {
+        return false;
+    }
+
+    IPCWireHeader header;
+    memcpy(&header, data, sizeof(header));
+    if (header.magic != IPC_WIRE_MAGIC || header.version != IPC_WIRE_VERSION) {
+        return false;
+    }
+
+    // Message-mode pipes deliver whole frames; anything else is corrupt
+    size_t expected = sizeof(header) + header.messageIdLength + header.payloadLength;
+    if (expected != size) {
+        LOG_ERROR("Wire frame length mismatch; dropping frame");
+        return false;
+    }
+
+    const char* cursor = data + sizeof(header);
+    message.channel.clear();  // binary frames carry the channel ID only
+    message.channelId = header.channelId;
+    message.type = TypeFromWireFlags(header.flags);
+    message.messageId.assign(cursor, header.messageIdLength);
+    cursor += header.messageIdLength;
+    message.payload.assign(cursor, header.payloadLength);
+    message.timestamp = header.timestamp;
+    return true;
+}
+
+// Serialize message to JSON string (legacy peers only)
 std::string IPCManager::SerializeMessage(const IPCMessage& message) const {
     std::ostringstream json;
     json << "{";
     json << R"("channel":"" << message.channel << "",";
+    json << R"("channelId":)" << (message.channelId != 0
+        ? message.channelId : HashChannelId(message.channel)) << ",";
     json << R"("type":"" << message.type << "",";
     json << R"("messageId":"" << message.messageId << "",";
     json << R"("payload":"" << message.payload << "",";
@@ -672,6 +1035,14 @@ IPCMessage IPCManager::DeserializeMessage(const std::string& data) const {
     
     msg.channel = extractValue("channel");
     msg.type = extractValue("type");
+
+    // Frames from older peers have no channelId; the dispatcher falls
+    // back to hashing the channel name
+    std::string channelIdStr = extractValue("channelId");
+    if (!channelIdStr.empty()) {
+        msg.channelId = std::stoull(channelIdStr);
+    }
+
     msg.messageId = extractValue("messageId");
     msg.payload = extractValue("payload");
     
@@ -683,6 +1054,18 @@ IPCMessage IPCManager::DeserializeMessage(const std::string& data) const {
     return msg;
 }
 
+// Intern a channel name to its numeric dispatch ID (FNV-1a 64-bit).
+// Deterministic, so both pipe ends agree on the ID without negotiation
+uint64_t IPCManager::HashChannelId(const std::string& channel) {
+    uint64_t hash = 14695981039346656037ull;
+    for (unsigned char c : channel) {
+        hash ^= c;
+        hash *= 1099511628211ull;
+    }
+    // Reserve 0 as "no ID in frame"
+    return hash != 0 ? hash : 1;
+}
+
 // Generate unique message ID
 std::string IPCManager::GenerateMessageId() const {
     static std::random_device rd;
@@ -716,12 +1099,21 @@ void IPCManager::NotifyError(const std::string& error, DWORD errorCode) {
 
 // Close connection
 void IPCManager::CloseConnection(ConnectionInfo& conn) {
+    // Signal the outbound sender first; closing the pipe below unblocks
+    // a WriteFile in flight, then the thread can be joined
+    if (conn.outbound) {
+        conn.outbound->stop = true;
+        conn.outbound->cv.notify_all();
+    }
     if (conn.pipeHandle != INVALID_HANDLE_VALUE) {
         FlushFileBuffers(conn.pipeHandle);
         DisconnectNamedPipe(conn.pipeHandle);
         CloseHandle(conn.pipeHandle);
         conn.pipeHandle = INVALID_HANDLE_VALUE;
     }
+    if (conn.outbound && conn.outbound->senderThread.joinable()) {
+        conn.outbound->senderThread.join();
+    }
     conn.active = false;
 }
 
@@ -8,9 +8,13 @@
 #include <thread>
 #include <unordered_map>
 #include <queue>
+#include <deque>
 #include <atomic>
 #include <condition_variable>
 #include <windows.h>
+#include "../core/memory_pool.h"
+#include "../core/sharded_counter.h"
+#include "../core/timer_wheel.h"
 
 namespace RainmeterManager {
 namespace IPC {
@@ -18,12 +22,64 @@ namespace IPC {
 // IPC message structure
 struct IPCMessage {
     std::string channel;
+    uint64_t channelId = 0;   // Interned channel hash carried in the wire frame
     std::string type;         // "request", "response", "notification"
     std::string messageId;    // For request-response tracking
     std::string payload;      // JSON serialized data
     uint64_t timestamp;
 };
 
+// Binary wire framing. Every frame is a fixed header followed by the
+// messageId bytes and the payload as an opaque span, so receive-side
+// framing is a header read plus one exact-size body read - no
+// delimiter scanning and no per-field text parsing. The channel
+// crosses the wire as its interned 64-bit ID only (HashChannelId);
+// dispatch is by ID, and IPCMessage::channel stays empty on frames
+// received in this format. Frames from older peers still arrive as
+// JSON and are detected by the missing magic.
+constexpr uint32_t IPC_WIRE_MAGIC = 0x524D4950;  // 'RMIP'
+constexpr uint16_t IPC_WIRE_VERSION = 1;
+
+enum IPCWireFlags : uint16_t {
+    IPC_FRAME_NOTIFICATION = 0x0000,
+    IPC_FRAME_REQUEST      = 0x0001,
+    IPC_FRAME_RESPONSE     = 0x0002,
+    IPC_FRAME_COMPRESSED   = 0x0004,  // reserved for the LZ4 wire path
+};
+
+#pragma pack(push, 1)
+struct IPCWireHeader {
+    uint32_t magic;            // IPC_WIRE_MAGIC
+    uint16_t version;          // IPC_WIRE_VERSION; bump on layout change
+    uint16_t flags;            // IPCWireFlags
+    uint64_t channelId;        // interned channel hash
+    uint64_t timestamp;
+    uint16_t messageIdLength;  // bytes of messageId following the header
+    uint16_t reserved;
+    uint32_t payloadLength;    // bytes of payload following the messageId
+};
+#pragma pack(pop)
+static_assert(sizeof(IPCWireHeader) == 32, "wire header layout is part of the protocol");
+
+// One serialized broadcast frame; the bytes are shared (refcounted)
+// across every connection's outbound queue instead of copied per pipe
+struct OutboundFrame {
+    std::string channel;
+    std::shared_ptr<const std::string> frame;
+};
+
+// Bounded per-connection outbound queue drained by a dedicated sender
+// thread, so one slow consumer never delays the others
+struct OutboundQueue {
+    std::deque<OutboundFrame,
+               Core::TaggedAllocator<OutboundFrame, Core::MemoryTag::IPC>> frames;
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::thread senderThread;
+    std::atomic<bool> stop{false};
+    uint64_t droppedFrames = 0;
+};
+
 // IPC connection info
 struct ConnectionInfo {
     HANDLE pipeHandle;
@@ -31,6 +87,7 @@ struct ConnectionInfo {
     DWORD processId;
     bool active;
     std::chrono::steady_clock::time_point lastActivity;
+    std::shared_ptr<OutboundQueue> outbound;
 };
 
 // IPC operation mode
@@ -49,6 +106,7 @@ struct IPCConfig {
     bool enableReconnect = true;
     int reconnectDelayMs = 1000;
     int maxReconnectAttempts = 5;
+    int maxOutboundQueueDepth = 64;  // Per-connection broadcast queue bound (drop-oldest)
 };
 
 /**
@@ -69,6 +127,7 @@ public:
     using MessageHandler = std::function<void(const IPCMessage&)>;
     using ConnectionHandler = std::function<void(DWORD processId, bool connected)>;
     using ErrorHandler = std::function<void(const std::string&, DWORD errorCode)>;
+    using SendCompleteHandler = std::function<void(bool success)>;
 
     IPCManager();
     ~IPCManager();
@@ -82,6 +141,20 @@ public:
     bool Send(const std::string& channel, const std::string& payload);
     bool SendTo(DWORD targetProcessId, const std::string& channel, const std::string& payload);
     bool Broadcast(const std::string& channel, const std::string& payload);
+
+    /**
+     * @brief Send a caller-owned payload without the IPCMessage copy
+     *
+     * The payload buffer is not copied into an IPCMessage; the sender
+     * frames it directly into a pooled write buffer when the pipe write
+     * happens, so large blobs (widget configurations of several hundred
+     * KB) cross the pipe with one copy and no per-send allocation.
+     * The caller must keep the buffer alive until onComplete fires
+     * (or Stop() is called, which completes outstanding sends as
+     * failed). Like Send, the payload must already be JSON-safe.
+     */
+    bool SendZeroCopy(const std::string& channel, const char* payload, size_t payloadSize,
+                      SendCompleteHandler onComplete = nullptr);
     
     // Request-response pattern
     std::string SendRequest(const std::string& channel, const std::string& payload, int timeoutMs = 5000);
@@ -104,6 +177,7 @@ public:
         uint64_t bytesTransferred;
         uint64_t connectionsFailed;
         uint64_t reconnectAttempts;
+        uint64_t broadcastFramesDropped;
     };
     Statistics GetStatistics() const;
 
@@ -122,35 +196,81 @@ private:
     HANDLE clientPipe_;
     std::atomic<bool> clientConnected_;
 
-    // Message handling
-    std::unordered_map<std::string, MessageHandler> messageHandlers_;
+    // Message handling. Channels are interned to a 64-bit hash at
+    // registration and carried numerically in the wire frame, so
+    // routing an incoming message is a few integer compares over this
+    // flat table instead of per-message string hashing and comparison.
+    // The channel name is kept per entry for logging and to detect
+    // (vanishingly unlikely) hash collisions at registration.
+    struct ChannelHandlerEntry {
+        uint64_t channelId;
+        std::string channel;
+        MessageHandler handler;
+    };
+    std::vector<ChannelHandlerEntry> messageHandlers_;
     std::mutex handlersMutex_;
     ConnectionHandler connectionHandler_;
     ErrorHandler errorHandler_;
 
-    // Message queues
-    std::queue<IPCMessage> sendQueue_;
+    // Message queues; node churn recycles through the tagged IPC pool
+    // and is attributed in MemoryRegistry statistics
+    std::queue<IPCMessage,
+               std::deque<IPCMessage,
+                          Core::TaggedAllocator<IPCMessage, Core::MemoryTag::IPC>>> sendQueue_;
     std::mutex sendQueueMutex_;
     std::condition_variable sendQueueCV_;
 
-    // Request-response tracking
+    // Zero-copy send path: queued frames reference caller-owned payload
+    // bytes until the pipe write happens
+    struct RawSendItem {
+        std::string channel;
+        std::string messageId;
+        const char* payload;
+        size_t payloadSize;
+        uint64_t timestamp;
+        SendCompleteHandler onComplete;
+    };
+    std::queue<RawSendItem,
+               std::deque<RawSendItem,
+                          Core::TaggedAllocator<RawSendItem, Core::MemoryTag::IPC>>> rawSendQueue_;
+
+    // Pooled framing buffers reused across zero-copy sends
+    std::vector<std::vector<char>> framingPool_;
+    std::mutex framingPoolMutex_;
+    static constexpr size_t FRAMING_POOL_MAX = 8;
+
+    // Request-response tracking. Timeouts come from the shared timer
+    // wheel (one coarse tick thread, O(1) per request) instead of a
+    // timed wait per caller; the wheel callback completes the request
+    // with timedOut set and the waiter just waits for completion.
     struct PendingRequest {
         std::string response;
         bool completed;
+        bool timedOut = false;
         std::mutex mutex;
         std::condition_variable cv;
     };
     std::unordered_map<std::string, std::shared_ptr<PendingRequest>> pendingRequests_;
     std::mutex requestsMutex_;
+    Core::TimerWheel requestTimeouts_;
 
     // Worker threads
     std::unique_ptr<std::thread> listenerThread_;
     std::unique_ptr<std::thread> senderThread_;
     std::vector<std::unique_ptr<std::thread>> connectionThreads_;
 
-    // Statistics
-    Statistics stats_;
-    mutable std::mutex statsMutex_;
+    // Statistics: sharded per-thread counters (see sharded_counter.h);
+    // message paths do one relaxed add, GetStatistics aggregates
+    enum StatCounter : size_t {
+        STAT_MESSAGES_SENT = 0,
+        STAT_MESSAGES_RECEIVED,
+        STAT_BYTES_TRANSFERRED,
+        STAT_CONNECTIONS_FAILED,
+        STAT_RECONNECT_ATTEMPTS,
+        STAT_BROADCAST_FRAMES_DROPPED,
+        STAT_COUNT
+    };
+    Core::ShardedCounters<STAT_COUNT> statCounters_;
 
     // Server mode functions
     void ServerListenerLoop();
@@ -165,14 +285,28 @@ private:
     // Message processing
     void SenderLoop();
     bool SendMessageInternal(HANDLE pipe, const IPCMessage& message);
+    bool SendRawFrame(HANDLE pipe, const RawSendItem& item);
+    std::vector<char> AcquireFramingBuffer(size_t minSize);
+    void ReleaseFramingBuffer(std::vector<char>&& buffer);
+
+    // Per-connection broadcast fan-out
+    void ConnectionSenderLoop(std::shared_ptr<OutboundQueue> queue, HANDLE pipe);
+    void EnqueueOutbound(ConnectionInfo& conn, const OutboundFrame& frame);
     bool ReceiveMessage(HANDLE pipe, IPCMessage& message);
     void ProcessIncomingMessage(const IPCMessage& message);
     
-    // Serialization
+    // Wire framing (binary, see IPCWireHeader)
+    std::string SerializeWireFrame(const IPCMessage& message) const;
+    void BuildWireFrame(const IPCMessage& message, char* out) const;
+    bool ParseWireFrame(const char* data, size_t size, IPCMessage& message) const;
+
+    // Legacy JSON serialization, kept as the receive fallback for
+    // frames from peers that predate the binary format
     std::string SerializeMessage(const IPCMessage& message) const;
     IPCMessage DeserializeMessage(const std::string& data) const;
     
     // Utilities
+    static uint64_t HashChannelId(const std::string& channel);
     std::string GenerateMessageId() const;
     uint64_t GetTimestamp() const;
     void NotifyError(const std::string& error, DWORD errorCode);
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace RainmeterManager::Render {
+
+    /**
+     * @brief Per-frame bump arena for render command construction
+     *
+     * Commands and their ContentParameters payloads are built into the
+     * arena while a batch is assembled, serialized for IPC, and then the
+     * whole arena is reset in O(1) once the batch completes — no
+     * per-command malloc/free in the render hot loop. Memory is kept
+     * across resets, so a steady-state frame allocates nothing.
+     *
+     * Reset does NOT run destructors: only place trivially destructible
+     * data here, or data whose lifetime ends with serialization (the
+     * batch path serializes before reset). Not thread-safe; each arena
+     * belongs to one producer (the frame scheduler owns one per tick).
+     */
+    class FrameArena {
+    public:
+        explicit FrameArena(size_t blockSize = 256 * 1024)
+            : blockSize_(blockSize) {
+            blocks_.push_back(std::make_unique<uint8_t[]>(blockSize_));
+        }
+
+        FrameArena(const FrameArena&) = delete;
+        FrameArena& operator=(const FrameArena&) = delete;
+
+        /**
+         * @brief Allocate raw bytes from the current block
+         *
+         * Grows by whole blocks; allocations larger than the block size
+         * get a dedicated oversize block that is released on Reset.
+         */
+        void* Allocate(size_t bytes, size_t alignment = alignof(std::max_align_t)) {
+            size_t aligned = (offset_ + alignment - 1) & ~(alignment - 1);
+
+            if (bytes > blockSize_) {
+                // Oversize: dedicated block, freed on Reset
+                oversizeBlocks_.push_back(std::make_unique<uint8_t[]>(bytes));
+                return oversizeBlocks_.back().get();
+            }
+
+            if (aligned + bytes > blockSize_) {
+                if (++currentBlock_ >= blocks_.size()) {
+                    blocks_.push_back(std::make_unique<uint8_t[]>(blockSize_));
+                }
+                aligned = 0;
+            }
+
+            offset_ = aligned + bytes;
+            return blocks_[currentBlock_].get() + aligned;
+        }
+
+        /**
+         * @brief Construct a T in the arena (no destructor will run)
+         */
+        template <typename T, typename... Args>
+        T* Create(Args&&... args) {
+            void* memory = Allocate(sizeof(T), alignof(T));
+            return new (memory) T(std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Recycle the whole arena; keeps regular blocks for reuse
+         */
+        void Reset() {
+            currentBlock_ = 0;
+            offset_ = 0;
+            oversizeBlocks_.clear();
+        }
+
+        size_t GetBlockCount() const { return blocks_.size(); }
+        size_t GetBytesUsed() const { return currentBlock_ * blockSize_ + offset_; }
+
+    private:
+        size_t blockSize_;
+        std::vector<std::unique_ptr<uint8_t[]>> blocks_;
+        std::vector<std::unique_ptr<uint8_t[]>> oversizeBlocks_;
+        size_t currentBlock_ = 0;
+        size_t offset_ = 0;
+    };
+
+} // namespace RainmeterManager::Render
@@ -18,10 +18,15 @@ namespace RainmeterManager::Render {
     /**
      * @brief Interface for render backend proxy
      * 
-     * This interface provides C++ applications with access to the 
+     * This interface provides C++ applications with access to the
      * C# rendering process through IPC communication. It abstracts
      * the complexity of inter-process communication and provides
      * a clean, modern C++ API for rendering operations.
+     *
+     * The future-returning methods block a thread when waited on. For
+     * sequenced operations (initialize, set properties, render) prefer
+     * the coroutine API in render_awaitable.h, which is resumed by the
+     * bridge's receive thread and never parks a thread in a wait.
      */
     class IRenderBackendProxy {
     public:
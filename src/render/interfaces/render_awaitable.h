@@ -0,0 +1,165 @@
+#pragma once
+
+#include "render_command.h"
+#include "../ipc/render_ipc_bridge.h"
+
+// Coroutine-native command API. Compiled only under C++20 coroutine
+// support; the future-based IRenderBackendProxy surface is unaffected.
+#if defined(__cpp_impl_coroutine)
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <memory>
+#include <utility>
+
+namespace RainmeterManager::Render {
+
+    /**
+     * @brief Awaitable for one render command round-trip
+     *
+     * `co_await`ing sends the command and suspends the coroutine; the
+     * bridge's receive thread resumes it when the result arrives (or the
+     * timeout sweep fails it). No thread blocks in a future wait at any
+     * point. Failure to send resumes immediately with a failure result.
+     */
+    class CommandAwaitable {
+    public:
+        CommandAwaitable(RenderIPCBridge& bridge, RenderCommand command)
+            : bridge_(&bridge)
+            , command_(std::move(command))
+            , state_(std::make_shared<State>()) {}
+
+        bool await_ready() const noexcept { return false; }
+
+        bool await_suspend(std::coroutine_handle<> handle) {
+            state_->continuation = handle;
+
+            // The callback may run (inline on failure, or on the receive
+            // thread) before this frame finishes suspending; whichever
+            // side flips resumeReady second performs the resume, so the
+            // handoff is race-free without a lock
+            auto state = state_;
+            bridge_->SendCommandWithCallback(command_,
+                [state](const RenderResult& result) {
+                    state->result = result;
+                    if (state->resumeReady.exchange(true, std::memory_order_acq_rel)) {
+                        state->continuation.resume();
+                    }
+                });
+
+            return !state_->resumeReady.exchange(true, std::memory_order_acq_rel);
+        }
+
+        RenderResult await_resume() { return std::move(state_->result); }
+
+    private:
+        struct State {
+            RenderResult result;
+            std::coroutine_handle<> continuation;
+            std::atomic<bool> resumeReady{false};
+        };
+
+        RenderIPCBridge* bridge_;
+        RenderCommand command_;
+        std::shared_ptr<State> state_;
+    };
+
+    /**
+     * @brief Coroutine task returning a RenderResult
+     *
+     * Lazy: the body starts when the task is awaited (or Start() is
+     * called for a top-level task), and completion resumes the awaiting
+     * coroutine via symmetric transfer. Sequenced operations compose
+     * without parking a thread:
+     *
+     *   RenderTask BringUpWidget(RenderIPCBridge& bridge, ...) {
+     *       co_await CommandAwaitable(bridge, initializeCommand);
+     *       co_await CommandAwaitable(bridge, setPropertiesCommand);
+     *       co_return co_await CommandAwaitable(bridge, renderFrameCommand);
+     *   }
+     *
+     * The task object owns the coroutine frame; keep it alive until the
+     * coroutine completes.
+     */
+    class RenderTask {
+    public:
+        struct promise_type {
+            RenderResult result;
+            std::exception_ptr exception;
+            std::coroutine_handle<> continuation;
+
+            RenderTask get_return_object() {
+                return RenderTask(std::coroutine_handle<promise_type>::from_promise(*this));
+            }
+            std::suspend_always initial_suspend() noexcept { return {}; }
+
+            struct FinalAwaiter {
+                bool await_ready() const noexcept { return false; }
+                std::coroutine_handle<> await_suspend(
+                    std::coroutine_handle<promise_type> handle) noexcept {
+                    auto continuation = handle.promise().continuation;
+                    return continuation ? continuation : std::noop_coroutine();
+                }
+                void await_resume() const noexcept {}
+            };
+            FinalAwaiter final_suspend() noexcept { return {}; }
+
+            void return_value(RenderResult value) { result = std::move(value); }
+            void unhandled_exception() { exception = std::current_exception(); }
+        };
+
+        RenderTask() = default;
+        explicit RenderTask(std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+
+        RenderTask(RenderTask&& other) noexcept
+            : handle_(std::exchange(other.handle_, nullptr)) {}
+        RenderTask& operator=(RenderTask&& other) noexcept {
+            if (this != &other) {
+                if (handle_) {
+                    handle_.destroy();
+                }
+                handle_ = std::exchange(other.handle_, nullptr);
+            }
+            return *this;
+        }
+        ~RenderTask() {
+            if (handle_) {
+                handle_.destroy();
+            }
+        }
+
+        RenderTask(const RenderTask&) = delete;
+        RenderTask& operator=(const RenderTask&) = delete;
+
+        /**
+         * @brief Start a top-level task that nothing awaits
+         */
+        void Start() {
+            if (handle_ && !handle_.done()) {
+                handle_.resume();
+            }
+        }
+
+        bool IsDone() const { return !handle_ || handle_.done(); }
+
+        // Awaiting a task starts it and chains this coroutine after it
+        bool await_ready() const noexcept { return IsDone(); }
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> continuation) noexcept {
+            handle_.promise().continuation = continuation;
+            return handle_;
+        }
+        RenderResult await_resume() {
+            if (handle_.promise().exception) {
+                std::rethrow_exception(handle_.promise().exception);
+            }
+            return std::move(handle_.promise().result);
+        }
+
+    private:
+        std::coroutine_handle<promise_type> handle_ = nullptr;
+    };
+
+} // namespace RainmeterManager::Render
+
+#endif // __cpp_impl_coroutine
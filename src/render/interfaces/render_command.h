@@ -143,6 +143,18 @@ namespace RainmeterManager::Render {
     };
 
     // Performance metrics
+    // Percentile summary extracted from a latency histogram (microseconds)
+    struct LatencyPercentiles {
+        float p50Us;
+        float p90Us;
+        float p99Us;
+        float p999Us;
+        uint64_t sampleCount;
+
+        LatencyPercentiles() : p50Us(0.0f), p90Us(0.0f), p99Us(0.0f),
+                               p999Us(0.0f), sampleCount(0) {}
+    };
+
     struct PerformanceMetrics {
         float currentFps;
         float averageFps;
@@ -154,7 +166,12 @@ namespace RainmeterManager::Render {
         float gpuUsagePercent;
         uint64_t renderTimeMs;
         uint64_t contentLoadTimeMs;
-        
+
+        // Tail latency (percentiles, not averages — averages hide stalls)
+        LatencyPercentiles submitToComplete;  // RenderWidgetAsync call to future ready
+        LatencyPercentiles ipcRoundTrip;      // Batch send to response receipt
+        LatencyPercentiles frameRender;       // Render-process frame time
+
         PerformanceMetrics() : currentFps(0.0f), averageFps(0.0f), totalFrames(0),
                               droppedFrames(0), memoryUsageMB(0), vramUsageMB(0),
                               cpuUsagePercent(0.0f), gpuUsagePercent(0.0f),
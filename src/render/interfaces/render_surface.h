@@ -2,6 +2,7 @@
 
 #include "render_command.h"
 #include <functional>
+#include <vector>
 
 namespace RainmeterManager::Render {
 
@@ -232,6 +233,105 @@ namespace RainmeterManager::Render {
         virtual bool IsVSyncEnabled() const = 0;
     };
 
+    /**
+     * @brief Batched repositioning of several surfaces in one commit
+     *
+     * SetBounds moves each surface's window individually, so a layout
+     * change (monitor hot-plug, DPI change) issues one window-position
+     * call per surface and the compositor runs a layout pass for each.
+     * A transaction stages all bounds changes first and commits them as
+     * a single BeginDeferWindowPos/EndDeferWindowPos batch, so the
+     * whole rearrangement is one compositor transaction instead of a
+     * cascade of repaints.
+     *
+     * After Commit, each window receives WM_WINDOWPOSCHANGED and the
+     * surface updates its cached bounds through its normal resize path;
+     * the transaction never writes surface state directly. Surfaces
+     * staged without a valid window handle are skipped. Single-use:
+     * create on the stack, stage, commit.
+     */
+    class SurfaceLayoutTransaction {
+    public:
+        SurfaceLayoutTransaction() = default;
+
+        /**
+         * @brief Stage a bounds change; no window moves until Commit
+         * @param surface Surface to reposition
+         * @param bounds Target bounds in screen coordinates
+         */
+        void Stage(IRenderSurface& surface, const RenderRect& bounds) {
+            staged_.push_back({ &surface, bounds });
+        }
+
+        /**
+         * @brief Apply every staged change in one deferred batch
+         *
+         * Falls back to per-surface SetBounds if the defer handle cannot
+         * be allocated, so the layout always lands.
+         * @return True if all staged changes were applied
+         */
+        bool Commit() {
+            if (committed_ || staged_.empty()) {
+                return true;
+            }
+            committed_ = true;
+
+            HDWP deferHandle = BeginDeferWindowPos(static_cast<int>(staged_.size()));
+            if (!deferHandle) {
+                // Defer allocation failed; apply individually so the
+                // layout still lands
+                bool allApplied = true;
+                for (const StagedBounds& staged : staged_) {
+                    allApplied = staged.surface->SetBounds(staged.bounds) && allApplied;
+                }
+                staged_.clear();
+                return allApplied;
+            }
+
+            bool allDeferred = true;
+            for (const StagedBounds& staged : staged_) {
+                HWND window = staged.surface->GetWindowHandle();
+                if (!window) {
+                    allDeferred = false;
+                    continue;
+                }
+                deferHandle = DeferWindowPos(
+                    deferHandle, window, nullptr,
+                    staged.bounds.x, staged.bounds.y,
+                    staged.bounds.width, staged.bounds.height,
+                    SWP_NOZORDER | SWP_NOACTIVATE);
+                if (!deferHandle) {
+                    // A failed DeferWindowPos invalidates the whole
+                    // handle (no EndDeferWindowPos); apply everything
+                    // individually instead
+                    bool allApplied = true;
+                    for (const StagedBounds& fallback : staged_) {
+                        allApplied = fallback.surface->SetBounds(fallback.bounds) && allApplied;
+                    }
+                    staged_.clear();
+                    return allApplied;
+                }
+            }
+
+            const bool committed = EndDeferWindowPos(deferHandle) != FALSE;
+            staged_.clear();
+            return committed && allDeferred;
+        }
+
+        /**
+         * @brief Number of staged, uncommitted changes
+         */
+        size_t GetStagedCount() const { return staged_.size(); }
+
+    private:
+        struct StagedBounds {
+            IRenderSurface* surface;
+            RenderRect bounds;
+        };
+        std::vector<StagedBounds> staged_;
+        bool committed_ = false;
+    };
+
     /**
      * @brief Factory function to create render surface
      * @return Unique pointer to render surface implementation
@@ -0,0 +1,388 @@
+#include "frame_surface_pool.h"
+#include "shared_memory_manager.h"
+#include <sstream>
+#include <cstring>
+
+using namespace RainmeterManager::Render;
+
+FrameSurfacePool::FrameSurfacePool(const std::wstring& namePrefix)
+    : namePrefix_(namePrefix)
+{
+}
+
+FrameSurfacePool::~FrameSurfacePool()
+{
+    Cleanup();
+}
+
+// ===== SURFACE LIFECYCLE =====
+
+bool FrameSurfacePool::CreateSurfaces(uint32_t widgetId, int width, int height)
+{
+    if (width <= 0 || height <= 0 ||
+        width > MAX_SURFACE_DIMENSION || height > MAX_SURFACE_DIMENSION) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(surfacesMutex_);
+
+    if (surfaces_.count(widgetId) > 0) {
+        return false;
+    }
+
+    return MapSurfaceSet(widgetId, width, height, true, false);
+}
+
+bool FrameSurfacePool::OpenSurfaces(uint32_t widgetId, bool writable)
+{
+    std::lock_guard<std::mutex> lock(surfacesMutex_);
+
+    if (surfaces_.count(widgetId) > 0) {
+        return false;
+    }
+
+    return MapSurfaceSet(widgetId, 0, 0, false, writable);
+}
+
+bool FrameSurfacePool::ResizeSurfaces(uint32_t widgetId, int width, int height)
+{
+    if (width <= 0 || height <= 0 ||
+        width > MAX_SURFACE_DIMENSION || height > MAX_SURFACE_DIMENSION) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(surfacesMutex_);
+
+    auto it = surfaces_.find(widgetId);
+    if (it == surfaces_.end()) {
+        return false;
+    }
+
+    UnmapSurfaceSet(it->second);
+    surfaces_.erase(it);
+
+    return MapSurfaceSet(widgetId, width, height, true, false);
+}
+
+void FrameSurfacePool::DestroySurfaces(uint32_t widgetId)
+{
+    std::lock_guard<std::mutex> lock(surfacesMutex_);
+
+    auto it = surfaces_.find(widgetId);
+    if (it != surfaces_.end()) {
+        UnmapSurfaceSet(it->second);
+        surfaces_.erase(it);
+    }
+}
+
+void FrameSurfacePool::Cleanup()
+{
+    std::lock_guard<std::mutex> lock(surfacesMutex_);
+
+    for (auto& entry : surfaces_) {
+        UnmapSurfaceSet(entry.second);
+    }
+    surfaces_.clear();
+}
+
+// ===== PRODUCER SIDE =====
+
+bool FrameSurfacePool::AcquireWriteSlot(uint32_t widgetId, uint8_t** pixels, uint32_t& slotIndex)
+{
+    std::lock_guard<std::mutex> lock(surfacesMutex_);
+
+    auto it = surfaces_.find(widgetId);
+    if (it == surfaces_.end() || !it->second.writable) {
+        return false;
+    }
+
+    SurfaceSet& set = it->second;
+
+    // Prefer a Free slot; fall back to reclaiming the oldest Ready slot so
+    // the producer never stalls behind a slow consumer (latest-frame-wins)
+    for (uint32_t i = 0; i < SLOT_COUNT; ++i) {
+        uint32_t expected = static_cast<uint32_t>(SlotState::Free);
+        if (set.header->slots[i].state.compare_exchange_strong(
+                expected, static_cast<uint32_t>(SlotState::Writing))) {
+            *pixels = GetSlotPixels(set, i);
+            slotIndex = i;
+            return true;
+        }
+    }
+
+    uint32_t oldestSlot = SLOT_COUNT;
+    uint64_t oldestFrame = UINT64_MAX;
+    for (uint32_t i = 0; i < SLOT_COUNT; ++i) {
+        if (set.header->slots[i].state.load() == static_cast<uint32_t>(SlotState::Ready) &&
+            set.header->slots[i].frameNumber < oldestFrame) {
+            oldestFrame = set.header->slots[i].frameNumber;
+            oldestSlot = i;
+        }
+    }
+
+    if (oldestSlot < SLOT_COUNT) {
+        uint32_t expected = static_cast<uint32_t>(SlotState::Ready);
+        if (set.header->slots[oldestSlot].state.compare_exchange_strong(
+                expected, static_cast<uint32_t>(SlotState::Writing))) {
+            {
+                std::lock_guard<std::mutex> statsLock(statsMutex_);
+                stats_.framesDropped++;
+            }
+            *pixels = GetSlotPixels(set, oldestSlot);
+            slotIndex = oldestSlot;
+            return true;
+        }
+    }
+
+    std::lock_guard<std::mutex> statsLock(statsMutex_);
+    stats_.acquireFailures++;
+    return false;
+}
+
+bool FrameSurfacePool::PublishFrame(uint32_t widgetId, uint32_t slotIndex, FrameDescriptor& descriptor)
+{
+    if (slotIndex >= SLOT_COUNT) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(surfacesMutex_);
+
+    auto it = surfaces_.find(widgetId);
+    if (it == surfaces_.end()) {
+        return false;
+    }
+
+    SurfaceSet& set = it->second;
+    SurfaceSlotHeader& slot = set.header->slots[slotIndex];
+
+    uint32_t expected = static_cast<uint32_t>(SlotState::Writing);
+    if (slot.state.load() != expected) {
+        return false;
+    }
+
+    slot.frameNumber = set.header->nextFrameNumber.fetch_add(1) + 1;
+    slot.timestamp = GetTickCount64();
+    slot.state.store(static_cast<uint32_t>(SlotState::Ready));
+
+    descriptor.widgetId = widgetId;
+    descriptor.slotIndex = slotIndex;
+    descriptor.frameNumber = slot.frameNumber;
+    descriptor.width = set.header->width;
+    descriptor.height = set.header->height;
+    descriptor.strideBytes = set.header->strideBytes;
+    descriptor.timestamp = slot.timestamp;
+
+    std::lock_guard<std::mutex> statsLock(statsMutex_);
+    stats_.framesPublished++;
+    return true;
+}
+
+// ===== CONSUMER SIDE =====
+
+bool FrameSurfacePool::AcquireReadSlot(const FrameDescriptor& descriptor, const uint8_t** pixels)
+{
+    if (descriptor.slotIndex >= SLOT_COUNT) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(surfacesMutex_);
+
+    auto it = surfaces_.find(descriptor.widgetId);
+    if (it == surfaces_.end()) {
+        return false;
+    }
+
+    SurfaceSet& set = it->second;
+    SurfaceSlotHeader& slot = set.header->slots[descriptor.slotIndex];
+
+    uint32_t expected = static_cast<uint32_t>(SlotState::Ready);
+    if (!slot.state.compare_exchange_strong(
+            expected, static_cast<uint32_t>(SlotState::Reading))) {
+        return false;
+    }
+
+    // Stale descriptor: the producer already reused this slot for a newer
+    // frame, so hand back the slot and let the caller wait for the next one
+    if (slot.frameNumber != descriptor.frameNumber) {
+        slot.state.store(static_cast<uint32_t>(SlotState::Ready));
+        return false;
+    }
+
+    *pixels = GetSlotPixels(set, descriptor.slotIndex);
+
+    std::lock_guard<std::mutex> statsLock(statsMutex_);
+    stats_.framesConsumed++;
+    return true;
+}
+
+void FrameSurfacePool::ReleaseReadSlot(uint32_t widgetId, uint32_t slotIndex)
+{
+    if (slotIndex >= SLOT_COUNT) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(surfacesMutex_);
+
+    auto it = surfaces_.find(widgetId);
+    if (it == surfaces_.end()) {
+        return;
+    }
+
+    uint32_t expected = static_cast<uint32_t>(SlotState::Reading);
+    it->second.header->slots[slotIndex].state.compare_exchange_strong(
+        expected, static_cast<uint32_t>(SlotState::Free));
+}
+
+// ===== STATISTICS =====
+
+FrameSurfacePool::FrameSurfaceStats FrameSurfacePool::GetStatistics() const
+{
+    std::lock_guard<std::mutex> surfacesLock(surfacesMutex_);
+    std::lock_guard<std::mutex> statsLock(statsMutex_);
+
+    FrameSurfaceStats stats = stats_;
+    stats.activeSurfaceSets = surfaces_.size();
+    stats.mappedBytes = 0;
+    for (const auto& entry : surfaces_) {
+        stats.mappedBytes += entry.second.mappedSize;
+    }
+    return stats;
+}
+
+void FrameSurfacePool::ResetStatistics()
+{
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    stats_ = FrameSurfaceStats{};
+}
+
+// ===== INTERNAL IMPLEMENTATION =====
+
+bool FrameSurfacePool::MapSurfaceSet(uint32_t widgetId, int width, int height, bool createNew, bool writable)
+{
+    try {
+        SurfaceSet set;
+        std::wstring mappingName = GetMappingName(widgetId);
+
+        if (createNew) {
+            size_t stride = ComputeStride(width);
+            size_t slotSize = stride * static_cast<size_t>(height);
+            size_t totalSize = sizeof(SurfaceSetHeader) + slotSize * SLOT_COUNT;
+
+            // Per-surface buffers land on the NUMA node of the thread
+            // creating them (the one that consumes the pixels), so 4K
+            // frame reads stay node-local on multi-socket machines
+            set.fileMapping = CreateFileMappingNuma(
+                INVALID_HANDLE_VALUE,
+                nullptr,
+                PAGE_READWRITE,
+                static_cast<DWORD>(totalSize >> 32),
+                static_cast<DWORD>(totalSize & 0xFFFFFFFF),
+                mappingName.c_str(),
+                SharedMemoryManager::NumaNodeOfCallingThread()
+            );
+
+            if (!set.fileMapping || GetLastError() == ERROR_ALREADY_EXISTS) {
+                if (set.fileMapping) {
+                    CloseHandle(set.fileMapping);
+                }
+                return false;
+            }
+
+            // The creating side maps read-write once to initialize the
+            // header, even though the core only reads pixels afterwards
+            set.mappedView = MapViewOfFile(set.fileMapping, FILE_MAP_ALL_ACCESS, 0, 0, totalSize);
+            if (!set.mappedView) {
+                CloseHandle(set.fileMapping);
+                return false;
+            }
+
+            set.header = reinterpret_cast<SurfaceSetHeader*>(set.mappedView);
+            set.header->magic = SURFACE_MAGIC;
+            set.header->version = SURFACE_VERSION;
+            set.header->widgetId = widgetId;
+            set.header->width = width;
+            set.header->height = height;
+            set.header->strideBytes = static_cast<int32_t>(stride);
+            set.header->slotSizeBytes = slotSize;
+            set.header->nextFrameNumber.store(0);
+            for (uint32_t i = 0; i < SLOT_COUNT; ++i) {
+                set.header->slots[i].state.store(static_cast<uint32_t>(SlotState::Free));
+                set.header->slots[i].frameNumber = 0;
+                set.header->slots[i].timestamp = 0;
+            }
+
+            set.mappedSize = totalSize;
+        } else {
+            DWORD access = writable ? FILE_MAP_ALL_ACCESS : FILE_MAP_READ;
+            set.fileMapping = OpenFileMapping(FILE_MAP_ALL_ACCESS, FALSE, mappingName.c_str());
+            if (!set.fileMapping) {
+                return false;
+            }
+
+            // Map the header first to learn the layout, then the full region.
+            // Slot states are written from both sides, so the view itself is
+            // always read-write; "writable" only governs pixel access intent
+            (void)access;
+            set.mappedView = MapViewOfFile(set.fileMapping, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+            if (!set.mappedView) {
+                CloseHandle(set.fileMapping);
+                return false;
+            }
+
+            set.header = reinterpret_cast<SurfaceSetHeader*>(set.mappedView);
+            if (set.header->magic != SURFACE_MAGIC || set.header->version != SURFACE_VERSION) {
+                UnmapViewOfFile(set.mappedView);
+                CloseHandle(set.fileMapping);
+                return false;
+            }
+
+            set.mappedSize = sizeof(SurfaceSetHeader) +
+                             static_cast<size_t>(set.header->slotSizeBytes) * SLOT_COUNT;
+        }
+
+        set.pixelBase = reinterpret_cast<uint8_t*>(set.mappedView) + sizeof(SurfaceSetHeader);
+        set.writable = writable;
+
+        surfaces_.emplace(widgetId, set);
+        return true;
+
+    } catch (const std::exception& e) {
+        return false;
+    }
+}
+
+void FrameSurfacePool::UnmapSurfaceSet(SurfaceSet& set)
+{
+    if (set.mappedView) {
+        UnmapViewOfFile(set.mappedView);
+        set.mappedView = nullptr;
+    }
+
+    if (set.fileMapping) {
+        CloseHandle(set.fileMapping);
+        set.fileMapping = nullptr;
+    }
+
+    set.header = nullptr;
+    set.pixelBase = nullptr;
+    set.mappedSize = 0;
+}
+
+std::wstring FrameSurfacePool::GetMappingName(uint32_t widgetId) const
+{
+    std::wstringstream name;
+    name << namePrefix_ << L"_Frame_" << widgetId;
+    return name.str();
+}
+
+uint8_t* FrameSurfacePool::GetSlotPixels(const SurfaceSet& set, uint32_t slotIndex) const
+{
+    return set.pixelBase + static_cast<size_t>(set.header->slotSizeBytes) * slotIndex;
+}
+
+size_t FrameSurfacePool::ComputeStride(int width)
+{
+    // BGRA32 rows padded to the cache-line boundary
+    size_t rowBytes = static_cast<size_t>(width) * 4;
+    return (rowBytes + PIXEL_ALIGNMENT - 1) & ~(PIXEL_ALIGNMENT - 1);
+}
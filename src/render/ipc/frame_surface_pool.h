@@ -0,0 +1,212 @@
+#pragma once
+
+#include <windows.h>
+#include <string>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <map>
+#include <cstdint>
+
+namespace RainmeterManager::Render {
+
+    /**
+     * @brief Descriptor for a completed frame in a shared pixel surface
+     *
+     * Only this small structure travels through RenderIPCBridge; the pixel
+     * payload stays in shared memory and is never copied across the
+     * process boundary.
+     */
+    struct FrameDescriptor {
+        uint32_t widgetId;        // Owning widget
+        uint32_t slotIndex;       // Which buffer slot holds the frame
+        uint64_t frameNumber;     // Monotonic frame counter per widget
+        int32_t width;            // Frame width in pixels
+        int32_t height;           // Frame height in pixels
+        int32_t strideBytes;      // Row stride in bytes (BGRA32)
+        uint64_t timestamp;       // Render completion timestamp
+
+        FrameDescriptor() : widgetId(0), slotIndex(0), frameNumber(0),
+                           width(0), height(0), strideBytes(0), timestamp(0) {}
+    };
+
+    /**
+     * @brief Pooled shared-memory pixel surfaces for zero-copy frame transport
+     *
+     * Each widget gets a triple-buffered set of BGRA32 surfaces backed by a
+     * single file mapping. The C# render process writes frames directly into
+     * a slot; the core maps the region read-only and consumes completed
+     * frames in place, guided by FrameDescriptor notifications. Slot
+     * ownership is tracked with per-slot atomic states in the mapped header
+     * so neither side ever blocks on the other.
+     */
+    class FrameSurfacePool {
+    public:
+        explicit FrameSurfacePool(const std::wstring& namePrefix);
+        ~FrameSurfacePool();
+
+        // === Surface Lifecycle ===
+
+        /**
+         * @brief Create the triple-buffered surface set for a widget
+         * @param widgetId Widget identifier
+         * @param width Surface width in pixels
+         * @param height Surface height in pixels
+         * @return True if the surfaces were created and mapped
+         */
+        bool CreateSurfaces(uint32_t widgetId, int width, int height);
+
+        /**
+         * @brief Open an existing surface set (for the render process side)
+         * @param widgetId Widget identifier
+         * @param writable True to map read-write (renderer), false for read-only (core)
+         * @return True if the surfaces were opened and mapped
+         */
+        bool OpenSurfaces(uint32_t widgetId, bool writable);
+
+        /**
+         * @brief Resize a widget's surface set
+         *
+         * Recreates the mapping at the new dimensions; in-flight frames
+         * for the old size are dropped.
+         * @return True if resize succeeded
+         */
+        bool ResizeSurfaces(uint32_t widgetId, int width, int height);
+
+        /**
+         * @brief Destroy a widget's surface set and release the mapping
+         */
+        void DestroySurfaces(uint32_t widgetId);
+
+        /**
+         * @brief Release all surface sets
+         */
+        void Cleanup();
+
+        // === Producer Side (render process) ===
+
+        /**
+         * @brief Acquire a free slot for writing the next frame
+         * @param widgetId Widget identifier
+         * @param pixels Output pointer to writable pixel storage
+         * @param slotIndex Output slot index for the later descriptor
+         * @return True if a free slot was available
+         */
+        bool AcquireWriteSlot(uint32_t widgetId, uint8_t** pixels, uint32_t& slotIndex);
+
+        /**
+         * @brief Publish a written slot as the latest completed frame
+         * @param widgetId Widget identifier
+         * @param slotIndex Slot returned by AcquireWriteSlot
+         * @param descriptor Output descriptor to send through the IPC bridge
+         * @return True if the slot was published
+         */
+        bool PublishFrame(uint32_t widgetId, uint32_t slotIndex, FrameDescriptor& descriptor);
+
+        // === Consumer Side (core) ===
+
+        /**
+         * @brief Map the frame named by a descriptor for in-place reading
+         *
+         * The slot stays locked against reuse until ReleaseReadSlot.
+         * @param descriptor Descriptor received from the render process
+         * @param pixels Output pointer to read-only pixel data
+         * @return True if the frame is valid and now locked for reading
+         */
+        bool AcquireReadSlot(const FrameDescriptor& descriptor, const uint8_t** pixels);
+
+        /**
+         * @brief Return a slot to the pool after the core has consumed it
+         */
+        void ReleaseReadSlot(uint32_t widgetId, uint32_t slotIndex);
+
+        // === Statistics ===
+
+        struct FrameSurfaceStats {
+            uint64_t framesPublished = 0;
+            uint64_t framesConsumed = 0;
+            uint64_t framesDropped = 0;    // Publishes that replaced an unread frame
+            uint64_t acquireFailures = 0;  // No free slot available
+            size_t activeSurfaceSets = 0;
+            size_t mappedBytes = 0;
+        };
+
+        /**
+         * @brief Get frame surface statistics
+         * @return Statistics structure
+         */
+        FrameSurfaceStats GetStatistics() const;
+
+        /**
+         * @brief Reset statistics counters
+         */
+        void ResetStatistics();
+
+    private:
+        // === Internal Structures ===
+
+        // Per-slot ownership states; transitions are single-owner so plain
+        // compare-exchange is sufficient
+        enum class SlotState : uint32_t {
+            Free = 0,       // Available for the producer
+            Writing = 1,    // Producer is filling the slot
+            Ready = 2,      // Frame complete, waiting for the consumer
+            Reading = 3     // Consumer has the slot mapped
+        };
+
+        struct SurfaceSlotHeader {
+            std::atomic<uint32_t> state;   // SlotState
+            uint64_t frameNumber;          // Frame stored in this slot
+            uint64_t timestamp;            // Publish timestamp
+        };
+
+        struct SurfaceSetHeader {
+            uint32_t magic;               // Magic number for validation
+            uint32_t version;             // Layout version
+            uint32_t widgetId;
+            int32_t width;
+            int32_t height;
+            int32_t strideBytes;
+            uint64_t slotSizeBytes;       // Per-slot pixel storage size
+            std::atomic<uint64_t> nextFrameNumber;
+            SurfaceSlotHeader slots[3];
+        };
+
+        struct SurfaceSet {
+            HANDLE fileMapping = nullptr;
+            void* mappedView = nullptr;
+            SurfaceSetHeader* header = nullptr;
+            uint8_t* pixelBase = nullptr;
+            size_t mappedSize = 0;
+            bool writable = false;
+        };
+
+        // === Member Variables ===
+        std::wstring namePrefix_;
+        mutable std::mutex surfacesMutex_;
+        std::map<uint32_t, SurfaceSet> surfaces_;
+
+        // Statistics
+        mutable std::mutex statsMutex_;
+        FrameSurfaceStats stats_;
+
+        // Constants
+        static constexpr uint32_t SURFACE_MAGIC = 0x524D4653; // 'RMFS'
+        static constexpr uint32_t SURFACE_VERSION = 1;
+        static constexpr uint32_t SLOT_COUNT = 3;             // Triple buffering
+        static constexpr int MAX_SURFACE_DIMENSION = 16384;
+        static constexpr size_t PIXEL_ALIGNMENT = 64;         // Cache-line aligned rows
+
+        // === Internal Methods ===
+        bool MapSurfaceSet(uint32_t widgetId, int width, int height, bool createNew, bool writable);
+        void UnmapSurfaceSet(SurfaceSet& set);
+        std::wstring GetMappingName(uint32_t widgetId) const;
+        uint8_t* GetSlotPixels(const SurfaceSet& set, uint32_t slotIndex) const;
+        static size_t ComputeStride(int width);
+
+        // Non-copyable
+        FrameSurfacePool(const FrameSurfacePool&) = delete;
+        FrameSurfacePool& operator=(const FrameSurfacePool&) = delete;
+    };
+
+} // namespace RainmeterManager::Render
@@ -2,12 +2,15 @@
 
 #include "../interfaces/render_command.h"
 #include "../../core/logger.h"
+#include "../../core/error_handling.h"
+#include "../../core/memory_pool.h"
 #include <windows.h>
 #include <string>
 #include <memory>
 #include <thread>
 #include <atomic>
 #include <queue>
+#include <deque>
 #include <mutex>
 #include <condition_variable>
 #include <chrono>
@@ -137,6 +140,68 @@ namespace RainmeterManager::Render {
          */
         bool SetPipeSecurity(const std::wstring& securityDescriptor);
 
+        // === Overlapped / IOCP Mode ===
+
+        /**
+         * @brief Enable overlapped I/O serviced by an I/O completion port
+         *
+         * In overlapped mode every pipe instance created by
+         * CreateServer(maxInstances) is associated with one shared
+         * completion port and serviced by a small fixed worker pool, so
+         * multiple render surfaces and the diagnostics channel no longer
+         * cost one blocked thread per direction per connection. Must be
+         * called before CreateServer/ConnectAsClient.
+         * @param workerThreads Number of completion-port worker threads
+         * @return True if overlapped mode was enabled
+         */
+        bool EnableOverlappedMode(DWORD workerThreads = 2);
+
+        /**
+         * @brief Drain outstanding operations and stop the IOCP workers
+         */
+        void DisableOverlappedMode();
+
+        /**
+         * @brief Check whether overlapped mode is active
+         * @return True if I/O goes through the completion port
+         */
+        bool IsOverlappedModeEnabled() const;
+
+        // === Compression ===
+
+        /**
+         * @brief Enable transparent compression for large payloads
+         *
+         * Messages at or above the threshold are compressed with an
+         * LZ4 block-format codec before hitting the pipe; small messages
+         * go out untouched. The pipe buffer defaults to 64 KB, so large
+         * payloads (widget config blobs, web content) otherwise span
+         * many pipe writes — 3-4x reduction on typical text-heavy
+         * payloads is a direct latency win. Compression is applied only
+         * after both ends have advertised support through the heartbeat
+         * handshake; an old peer simply never sees a compressed frame.
+         * @param thresholdBytes Minimum payload size to compress
+         * @return True if compression was enabled
+         */
+        bool EnableCompression(size_t thresholdBytes = DEFAULT_COMPRESSION_THRESHOLD);
+
+        /**
+         * @brief Disable compression for subsequent messages
+         */
+        void DisableCompression();
+
+        /**
+         * @brief Check whether compression is enabled locally
+         * @return True if large payloads will be compressed once negotiated
+         */
+        bool IsCompressionEnabled() const;
+
+        /**
+         * @brief Get the active compression threshold
+         * @return Minimum payload size in bytes that triggers compression
+         */
+        size_t GetCompressionThreshold() const;
+
         // === Statistics ===
         
         struct PipeStatistics {
@@ -148,6 +213,9 @@ namespace RainmeterManager::Render {
             uint64_t disconnectionEvents = 0;
             uint64_t errorCount = 0;
             uint64_t timeoutCount = 0;
+            uint64_t compressedMessages = 0;
+            uint64_t bytesBeforeCompression = 0;
+            uint64_t bytesAfterCompression = 0;
             std::chrono::steady_clock::time_point lastActivity;
             double averageLatencyMs = 0.0;
         };
@@ -175,20 +243,41 @@ namespace RainmeterManager::Render {
         
         struct MessageHeader {
             uint32_t magic;        // Magic number for validation
-            uint32_t messageType;  // Message type identifier
-            uint64_t messageId;    // Unique message identifier  
-            uint64_t dataSize;     // Size of following data
+            uint32_t messageType;  // Message type identifier + flag bits
+            uint64_t messageId;    // Unique message identifier
+            uint64_t dataSize;     // Size of following data (on the wire)
             uint32_t checksum;     // Data integrity checksum
             uint64_t timestamp;    // Message timestamp
         };
-        
+
         enum class MessageType : uint32_t {
             Command = 1,
             Result = 2,
-            Heartbeat = 3,
+            Heartbeat = 3,    // Payload carries a capability bitmask
             Acknowledge = 4
         };
 
+        // High bits of MessageHeader::messageType carry per-message flags
+        // so the wire struct itself never changes shape. A compressed
+        // payload is prefixed with its uncompressed size (uint64) so the
+        // receiver can size the output buffer in one allocation.
+        static constexpr uint32_t MESSAGE_FLAG_COMPRESSED = 0x80000000;
+        static constexpr uint32_t MESSAGE_TYPE_MASK = 0x0000FFFF;
+
+        // Capability bits exchanged in the heartbeat payload
+        static constexpr uint32_t CAPABILITY_LZ4_COMPRESSION = 0x00000001;
+
+        // Per-operation context for overlapped I/O. The OVERLAPPED member
+        // must stay first so completion packets can be mapped back with a
+        // plain cast; the completion key identifies the pipe instance.
+        struct OverlappedContext {
+            OVERLAPPED overlapped;
+            MessageType messageType;
+            std::vector<uint8_t> buffer;
+            bool isRead;
+            HANDLE pipeInstance;
+        };
+
         // === Member Variables ===
         std::wstring pipeName_;
         std::wstring fullPipeName_;
@@ -205,10 +294,32 @@ namespace RainmeterManager::Render {
         std::thread asyncReceiveThread_;
         std::mutex pipeMutex_;
         std::condition_variable pipeCondition_;
-        
+
+        // Overlapped / IOCP state
+        std::atomic<bool> overlappedModeEnabled_{false};
+        HANDLE completionPort_;
+        std::vector<std::thread> iocpWorkers_;
+        std::vector<HANDLE> pipeInstances_;  // All server instances when maxInstances > 1
+
+        // Compression state. peerSupportsCompression_ flips true when a
+        // heartbeat from the other end advertises the LZ4 capability;
+        // until then everything goes out uncompressed. Scratch buffers
+        // are pooled so a steady stream of large messages does not churn
+        // multi-hundred-KB allocations on every send/receive.
+        std::atomic<bool> compressionEnabled_{false};
+        std::atomic<bool> peerSupportsCompression_{false};
+        std::atomic<size_t> compressionThreshold_{DEFAULT_COMPRESSION_THRESHOLD};
+        std::vector<std::vector<uint8_t>> scratchPool_;
+        std::mutex scratchPoolMutex_;
+
         // Message handling
         std::function<void(const RenderResult&)> asyncCallback_;
-        std::queue<std::vector<uint8_t>> messageQueue_;
+        // Render-command frames recycle through the tagged pool so the
+        // queue's node churn is attributed to RenderCommands
+        std::queue<std::vector<uint8_t>,
+                   std::deque<std::vector<uint8_t>,
+                              Core::TaggedAllocator<std::vector<uint8_t>,
+                                                    Core::MemoryTag::RenderCommands>>> messageQueue_;
         std::mutex queueMutex_;
         
         // Statistics
@@ -224,6 +335,8 @@ namespace RainmeterManager::Render {
         static constexpr DWORD MAX_MESSAGE_SIZE = 16 * 1024 * 1024; // 16MB
         static constexpr int DEFAULT_RETRY_ATTEMPTS = 3;
         static constexpr DWORD HEARTBEAT_INTERVAL_MS = 5000;
+        static constexpr size_t DEFAULT_COMPRESSION_THRESHOLD = 100 * 1024;
+        static constexpr size_t SCRATCH_POOL_CAP = 4;
 
         // === Internal Methods ===
         bool WriteMessage(MessageType type, const void* data, size_t dataSize);
@@ -233,13 +346,26 @@ namespace RainmeterManager::Render {
         bool ReadData(void* data, DWORD dataSize, DWORD timeoutMs = 5000);
         bool FlushPipe();
         void AsyncReceiveLoop();
+        void IOCPWorkerLoop();
+        bool AssociateWithCompletionPort(HANDLE pipeInstance);
+        bool IssueOverlappedRead(HANDLE pipeInstance);
         uint32_t CalculateChecksum(const void* data, size_t size);
         std::wstring GenerateFullPipeName() const;
         void SetLastError(const std::string& error) const;
         void UpdateStatistics(bool isSend, size_t bytes);
         bool SendHeartbeat();
         bool HandleHeartbeat();
-        
+
+        // Compression helpers (LZ4 block format; see the .cpp). These
+        // run per message, so they return the zero-allocation Result
+        // type — failure context stays inline and is only formatted if
+        // a caller actually logs it.
+        ::Result<void> CompressPayload(const uint8_t* data, size_t size, std::vector<uint8_t>& out);
+        ::Result<void> DecompressPayload(const uint8_t* data, size_t size, size_t uncompressedSize,
+                                         std::vector<uint8_t>& out);
+        std::vector<uint8_t> AcquireScratchBuffer(size_t minCapacity);
+        void ReleaseScratchBuffer(std::vector<uint8_t>&& buffer);
+
         // Serialization helpers
         size_t SerializeCommand(const RenderCommand& command, std::vector<uint8_t>& buffer);
         bool DeserializeCommand(const std::vector<uint8_t>& buffer, RenderCommand& command);
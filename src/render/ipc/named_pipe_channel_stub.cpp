@@ -1,9 +1,12 @@
 #include "named_pipe_channel.h"
+#include "../../core/lz4_block.h"
+
+#include <cstring>
 
 using namespace RainmeterManager::Render;
 
 NamedPipeChannel::NamedPipeChannel(const std::wstring& pipeName)
-    : pipeName_(pipeName), pipeHandle_(nullptr) {}
+    : pipeName_(pipeName), pipeHandle_(nullptr), completionPort_(nullptr) {}
 
 NamedPipeChannel::~NamedPipeChannel() { Cleanup(); }
 
@@ -31,11 +34,156 @@ void NamedPipeChannel::ResetStatistics() { stats_ = PipeStatistics{}; }
 
 bool NamedPipeChannel::SetPipeSecurity(const std::wstring& /*securityDescriptor*/) { return true; }
 
+// Overlapped/IOCP mode: the completion-port lifecycle is real so callers can
+// negotiate the mode; per-pipe transport remains stubbed with the rest of
+// the channel (see STUBS_README.md).
+bool NamedPipeChannel::EnableOverlappedMode(DWORD workerThreads) {
+    if (overlappedModeEnabled_ || isConnected_) {
+        return false;
+    }
+
+    completionPort_ = CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, workerThreads);
+    if (!completionPort_) {
+        return false;
+    }
+
+    shouldStop_ = false;
+    for (DWORD i = 0; i < workerThreads; ++i) {
+        iocpWorkers_.emplace_back(&NamedPipeChannel::IOCPWorkerLoop, this);
+    }
+
+    overlappedModeEnabled_ = true;
+    return true;
+}
+
+void NamedPipeChannel::DisableOverlappedMode() {
+    if (!overlappedModeEnabled_) {
+        return;
+    }
+
+    shouldStop_ = true;
+    for (size_t i = 0; i < iocpWorkers_.size(); ++i) {
+        PostQueuedCompletionStatus(completionPort_, 0, 0, nullptr);
+    }
+    for (auto& worker : iocpWorkers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    iocpWorkers_.clear();
+
+    if (completionPort_) {
+        CloseHandle(completionPort_);
+        completionPort_ = nullptr;
+    }
+
+    overlappedModeEnabled_ = false;
+}
+
+bool NamedPipeChannel::IsOverlappedModeEnabled() const { return overlappedModeEnabled_; }
+
+// Compression: the codec and the scratch pool are real so framing can be
+// exercised end to end; applying them on the wire happens in
+// WriteMessage/ReadMessage, which remain stubbed with the rest of the
+// transport (see STUBS_README.md).
+bool NamedPipeChannel::EnableCompression(size_t thresholdBytes) {
+    if (thresholdBytes == 0) {
+        return false;
+    }
+    compressionThreshold_ = thresholdBytes;
+    compressionEnabled_ = true;
+    return true;
+}
+
+void NamedPipeChannel::DisableCompression() { compressionEnabled_ = false; }
+
+bool NamedPipeChannel::IsCompressionEnabled() const { return compressionEnabled_; }
+
+size_t NamedPipeChannel::GetCompressionThreshold() const { return compressionThreshold_; }
+
+// The LZ4 block codec lives in core/lz4_block.h (shared with the
+// telemetry upload pipeline); the channel keeps its message-size cap.
+::Result<void> NamedPipeChannel::CompressPayload(const uint8_t* data, size_t size,
+                                                 std::vector<uint8_t>& out) {
+    return Core::Lz4BlockCompress(data, size, MAX_MESSAGE_SIZE, out);
+}
+
+::Result<void> NamedPipeChannel::DecompressPayload(const uint8_t* data, size_t size,
+                                                   size_t uncompressedSize,
+                                                   std::vector<uint8_t>& out) {
+    return Core::Lz4BlockDecompress(data, size, uncompressedSize, MAX_MESSAGE_SIZE, out);
+}
+
+std::vector<uint8_t> NamedPipeChannel::AcquireScratchBuffer(size_t minCapacity) {
+    std::vector<uint8_t> buffer;
+    {
+        std::lock_guard<std::mutex> lock(scratchPoolMutex_);
+        if (!scratchPool_.empty()) {
+            buffer = std::move(scratchPool_.back());
+            scratchPool_.pop_back();
+        }
+    }
+    buffer.clear();
+    buffer.reserve(minCapacity);
+    return buffer;
+}
+
+void NamedPipeChannel::ReleaseScratchBuffer(std::vector<uint8_t>&& buffer) {
+    std::lock_guard<std::mutex> lock(scratchPoolMutex_);
+    if (scratchPool_.size() < SCRATCH_POOL_CAP) {
+        scratchPool_.push_back(std::move(buffer));
+    }
+}
+
+void NamedPipeChannel::IOCPWorkerLoop() {
+    while (!shouldStop_) {
+        DWORD bytesTransferred = 0;
+        ULONG_PTR completionKey = 0;
+        LPOVERLAPPED overlapped = nullptr;
+
+        BOOL ok = GetQueuedCompletionStatus(completionPort_, &bytesTransferred,
+                                            &completionKey, &overlapped, INFINITE);
+
+        // Shutdown wake packet
+        if (!overlapped && !completionKey) {
+            break;
+        }
+
+        (void)ok;
+        (void)bytesTransferred; // Transport not implemented in the stub
+    }
+}
+
+bool NamedPipeChannel::AssociateWithCompletionPort(HANDLE pipeInstance) {
+    if (!completionPort_ || pipeInstance == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    return CreateIoCompletionPort(pipeInstance, completionPort_,
+                                  reinterpret_cast<ULONG_PTR>(pipeInstance), 0) != nullptr;
+}
+
+bool NamedPipeChannel::IssueOverlappedRead(HANDLE /*pipeInstance*/) { return false; }
+
 void NamedPipeChannel::Cleanup() {
+    DisableOverlappedMode();
+
+    for (HANDLE instance : pipeInstances_) {
+        if (instance && instance != INVALID_HANDLE_VALUE) {
+            CloseHandle(instance);
+        }
+    }
+    pipeInstances_.clear();
+
     if (pipeHandle_) {
         CloseHandle(pipeHandle_);
         pipeHandle_ = nullptr;
     }
+
+    {
+        std::lock_guard<std::mutex> lock(scratchPoolMutex_);
+        scratchPool_.clear();
+    }
+    peerSupportsCompression_ = false;
     isConnected_ = false;
 }
 
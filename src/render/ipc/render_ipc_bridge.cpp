@@ -17,6 +17,25 @@ namespace {
     const size_t DEFAULT_SHARED_MEMORY_SIZE = 4 * 1024 * 1024; // 4MB
     const uint32_t PROCESS_STARTUP_TIMEOUT = 10000; // 10 seconds
     const uint32_t COMMAND_TIMEOUT_CHECK_INTERVAL = 100; // 100ms
+
+    // QPC helpers for the latency trace; the frequency never changes
+    // after boot so it is read once
+    uint64_t QpcNow()
+    {
+        LARGE_INTEGER now;
+        QueryPerformanceCounter(&now);
+        return static_cast<uint64_t>(now.QuadPart);
+    }
+
+    uint64_t QpcDeltaToMicros(uint64_t ticks)
+    {
+        static const uint64_t frequency = [] {
+            LARGE_INTEGER freq;
+            QueryPerformanceFrequency(&freq);
+            return static_cast<uint64_t>(freq.QuadPart);
+        }();
+        return frequency ? (ticks * 1000000ULL) / frequency : 0;
+    }
 }
 
 RenderIPCBridge::RenderIPCBridge(IPCMode mode)
@@ -93,6 +112,7 @@ bool RenderIPCBridge::StartRenderProcess(const std::wstring& renderProcessPath,
         shouldStop_ = false;
         messageReceiveThread_ = std::thread(&RenderIPCBridge::MessageReceiveLoop, this);
         processMonitorThread_ = std::thread(&RenderIPCBridge::ProcessMonitorLoop, this);
+        timeoutWheel_.Start();
         
         processRunning_ = true;
         
@@ -147,10 +167,15 @@ bool RenderIPCBridge::StopRenderProcess(uint32_t timeoutMs)
         if (messageReceiveThread_.joinable()) {
             messageReceiveThread_.join();
         }
-        
+
         if (processMonitorThread_.joinable()) {
             processMonitorThread_.join();
         }
+
+        // Stopping the wheel fires every armed timeout; commands still
+        // parked in the pending table complete as timed out, the rest
+        // no-op against the empty slots
+        timeoutWheel_.Stop();
         
         // Cleanup process handles
         CleanupProcess();
@@ -203,9 +228,13 @@ bool RenderIPCBridge::InitializeIPC()
         
         if (ipcMode_ == IPCMode::SharedMemory || ipcMode_ == IPCMode::Hybrid) {
             sharedMemory_ = std::make_unique<SharedMemoryManager>(SHARED_MEMORY_NAME);
-            if (!sharedMemory_->CreateSharedBuffer(DEFAULT_SHARED_MEMORY_SIZE)) {
+            // Multi-MB transport buffer: worth large pages when the
+            // privilege is available; falls back silently otherwise
+            if (!sharedMemory_->CreateSharedBuffer(DEFAULT_SHARED_MEMORY_SIZE, true)) {
                 logger_.LogError(L"RenderIPCBridge: Failed to create shared memory buffer");
                 success = false;
+            } else if (sharedMemory_->IsLargePageBacked()) {
+                logger_.LogInfo(L"RenderIPCBridge: Shared memory buffer is large-page backed");
             }
         }
         
@@ -216,7 +245,11 @@ bool RenderIPCBridge::InitializeIPC()
                 success = false;
             }
         }
-        
+
+        // Frame pixels always travel through pooled shared surfaces;
+        // per-widget sets are created on demand by the render coordinator
+        framePool_ = std::make_unique<FrameSurfacePool>(SHARED_MEMORY_NAME);
+
         if (!success) {
             SetLastError("Failed to initialize IPC channels");
             CleanupIPC();
@@ -248,24 +281,38 @@ void RenderIPCBridge::CleanupIPC()
             sharedMemory_->Cleanup();
             sharedMemory_.reset();
         }
-        
-        // Clear pending commands
+
+        if (framePool_) {
+            framePool_->Cleanup();
+            framePool_.reset();
+        }
+
+        // Fail everything still parked in the pending table (singles and
+        // batch slots alike); the CAS in TryRemovePendingEntry keeps this
+        // safe against a racing receive thread
+        for (size_t i = 0; i < PENDING_SLOT_COUNT; ++i) {
+            PendingEntry* entry = pendingSlots_[i].load(std::memory_order_acquire);
+            if (!entry) {
+                continue;
+            }
+            if (pendingSlots_[i].compare_exchange_strong(entry, nullptr)) {
+                RenderResult failureResult;
+                failureResult.commandId = entry->commandId;
+                failureResult.status = RenderResultStatus::Failure;
+                failureResult.errorMessage = "IPC shutdown";
+                CompletePendingEntry(entry, failureResult);
+            }
+        }
+
+        // Drop the pooled entries for real
         {
-            std::lock_guard<std::mutex> lock(pendingCommandsMutex_);
-            for (auto& command : pendingCommands_) {
-                try {
-                    RenderResult failureResult;
-                    failureResult.commandId = command.first;
-                    failureResult.status = RenderResultStatus::Failure;
-                    failureResult.errorMessage = "IPC shutdown";
-                    command.second->promise.set_value(failureResult);
-                } catch (...) {
-                    // Ignore promise exceptions during cleanup
-                }
+            std::lock_guard<std::mutex> lock(entryFreeListMutex_);
+            for (PendingEntry* entry : entryFreeList_) {
+                delete entry;
             }
-            pendingCommands_.clear();
+            entryFreeList_.clear();
         }
-        
+
         logger_.LogInfo(L"RenderIPCBridge: IPC cleanup completed");
         
     } catch (const std::exception& e) {
@@ -276,58 +323,71 @@ void RenderIPCBridge::CleanupIPC()
 
 std::future<RenderResult> RenderIPCBridge::SendCommandAsync(const RenderCommand& command)
 {
-    std::lock_guard<std::mutex> lock(pendingCommandsMutex_);
-    
-    auto pendingCommand = std::make_unique<PendingCommand>();
-    pendingCommand->commandId = command.commandId;
-    pendingCommand->command = command;
-    pendingCommand->sentTime = std::chrono::steady_clock::now();
-    pendingCommand->timeoutMs = defaultTimeoutMs_;
-    
-    auto future = pendingCommand->promise.get_future();
-    
+    auto* entry = AcquirePendingEntry();
+    entry->commandId = command.commandId;
+    entry->command = command;
+    entry->sentTime = std::chrono::steady_clock::now();
+    entry->timeoutMs = defaultTimeoutMs_;
+    StampTraceOnSubmit(entry);
+
+    auto future = entry->promise.get_future();
+
+    // Park the entry before sending so a fast result on the receive
+    // thread always finds it; remove it again if the send fails
+    if (!TryInsertPendingEntry(entry)) {
+        RenderResult failureResult;
+        failureResult.commandId = command.commandId;
+        failureResult.status = RenderResultStatus::Failure;
+        failureResult.errorMessage = "Pending command table full";
+        CompletePendingEntry(entry, failureResult);
+        return future;
+    }
+
+    // Past this point the entry may complete (and recycle) at any time,
+    // so arm the timeout from local values, never through the pointer
+    ArmCommandTimeout(command.commandId, defaultTimeoutMs_);
+
     try {
         // Send command via appropriate channel
         bool sent = false;
-        
+
         if (ipcMode_ == IPCMode::SharedMemory || ipcMode_ == IPCMode::Hybrid) {
             if (sharedMemory_ && sharedMemory_->WriteCommand(command)) {
                 sharedMemory_->SignalCommandReady();
                 sent = true;
             }
         }
-        
+
         if (!sent && (ipcMode_ == IPCMode::NamedPipes || ipcMode_ == IPCMode::Hybrid)) {
             if (namedPipe_ && namedPipe_->SendCommand(command)) {
                 sent = true;
             }
         }
-        
+
         if (sent) {
-            pendingCommands_[command.commandId] = std::move(pendingCommand);
-            
-            // Update statistics
-            {
-                std::lock_guard<std::mutex> statsLock(statsMutex_);
-                stats_.totalCommandsSent++;
-            }
+            std::lock_guard<std::mutex> statsLock(statsMutex_);
+            stats_.totalCommandsSent++;
         } else {
-            // Command failed to send
+            // Command failed to send; reclaim the entry and fail it
+            if (auto* reclaimed = TryRemovePendingEntry(command.commandId)) {
+                RenderResult failureResult;
+                failureResult.commandId = command.commandId;
+                failureResult.status = RenderResultStatus::Failure;
+                failureResult.errorMessage = "Failed to send command via IPC";
+                CompletePendingEntry(reclaimed, failureResult);
+            }
+        }
+
+    } catch (const std::exception& e) {
+        if (auto* reclaimed = TryRemovePendingEntry(command.commandId)) {
             RenderResult failureResult;
             failureResult.commandId = command.commandId;
             failureResult.status = RenderResultStatus::Failure;
-            failureResult.errorMessage = "Failed to send command via IPC";
-            pendingCommand->promise.set_value(failureResult);
+            failureResult.errorMessage = std::string("Exception sending command: ") + e.what();
+            CompletePendingEntry(reclaimed, failureResult);
         }
-        
-    } catch (const std::exception& e) {
-        RenderResult failureResult;
-        failureResult.commandId = command.commandId;
-        failureResult.status = RenderResultStatus::Failure;
-        failureResult.errorMessage = std::string("Exception sending command: ") + e.what();
-        pendingCommand->promise.set_value(failureResult);
     }
-    
+
     return future;
 }
 
@@ -345,12 +405,13 @@ RenderResult RenderIPCBridge::SendCommand(const RenderCommand& command, uint32_t
             timeoutResult.status = RenderResultStatus::Failure;
             timeoutResult.errorMessage = "Command timed out";
             
-            // Remove from pending commands
-            {
-                std::lock_guard<std::mutex> lock(pendingCommandsMutex_);
-                pendingCommands_.erase(command.commandId);
+            // Reclaim the entry; the abandoned promise is fine since the
+            // caller gets this locally built timeout result
+            if (auto* entry = TryRemovePendingEntry(command.commandId)) {
+                ReleasePendingEntry(entry);
             }
-            
+
+
             {
                 std::lock_guard<std::mutex> statsLock(statsMutex_);
                 stats_.timeoutCommands++;
@@ -400,6 +461,205 @@ bool RenderIPCBridge::SendCommandFireAndForget(const RenderCommand& command)
     }
 }
 
+bool RenderIPCBridge::SendCommandWithCallback(const RenderCommand& command, ResultCallback callback)
+{
+    auto* entry = AcquirePendingEntry();
+    entry->commandId = command.commandId;
+    entry->command = command;
+    entry->callback = std::move(callback);
+    entry->sentTime = std::chrono::steady_clock::now();
+    entry->timeoutMs = defaultTimeoutMs_;
+    StampTraceOnSubmit(entry);
+
+    // Same ordering as SendCommandAsync: park first so a fast result on
+    // the receive thread always finds the entry
+    if (!TryInsertPendingEntry(entry)) {
+        RenderResult failureResult;
+        failureResult.commandId = command.commandId;
+        failureResult.status = RenderResultStatus::Failure;
+        failureResult.errorMessage = "Pending command table full";
+        CompletePendingEntry(entry, failureResult);
+        return false;
+    }
+
+    ArmCommandTimeout(command.commandId, defaultTimeoutMs_);
+
+    try {
+        bool sent = false;
+
+        if (ipcMode_ == IPCMode::SharedMemory || ipcMode_ == IPCMode::Hybrid) {
+            if (sharedMemory_ && sharedMemory_->WriteCommand(command)) {
+                sharedMemory_->SignalCommandReady();
+                sent = true;
+            }
+        }
+
+        if (!sent && (ipcMode_ == IPCMode::NamedPipes || ipcMode_ == IPCMode::Hybrid)) {
+            if (namedPipe_ && namedPipe_->SendCommand(command)) {
+                sent = true;
+            }
+        }
+
+        if (sent) {
+            std::lock_guard<std::mutex> statsLock(statsMutex_);
+            stats_.totalCommandsSent++;
+            return true;
+        }
+
+        if (auto* reclaimed = TryRemovePendingEntry(command.commandId)) {
+            RenderResult failureResult;
+            failureResult.commandId = command.commandId;
+            failureResult.status = RenderResultStatus::Failure;
+            failureResult.errorMessage = "Failed to send command via IPC";
+            CompletePendingEntry(reclaimed, failureResult);
+        }
+        return false;
+
+    } catch (const std::exception& e) {
+        if (auto* reclaimed = TryRemovePendingEntry(command.commandId)) {
+            RenderResult failureResult;
+            failureResult.commandId = command.commandId;
+            failureResult.status = RenderResultStatus::Failure;
+            failureResult.errorMessage = std::string("Exception sending command: ") + e.what();
+            CompletePendingEntry(reclaimed, failureResult);
+        }
+        return false;
+    }
+}
+
+std::future<std::vector<RenderResult>> RenderIPCBridge::SendCommandBatchAsync(
+    const std::vector<RenderCommand>& commands)
+{
+    auto batch = std::make_shared<PendingBatch>();
+    batch->results.resize(commands.size());
+    batch->remaining = commands.size();
+    batch->sentTime = std::chrono::steady_clock::now();
+    batch->timeoutMs = defaultTimeoutMs_;
+
+    auto future = batch->promise.get_future();
+
+    if (commands.empty()) {
+        batch->promise.set_value({});
+        return future;
+    }
+
+    try {
+        // Park every slot in the pending table before sending, so results
+        // arriving on the receive thread mid-burst always find their entry
+        std::vector<uint8_t> parked(commands.size(), 0);
+        for (size_t i = 0; i < commands.size(); ++i) {
+            auto* entry = AcquirePendingEntry();
+            entry->commandId = commands[i].commandId;
+            entry->command = commands[i];
+            entry->batch = batch;
+            entry->batchIndex = i;
+            entry->sentTime = batch->sentTime;
+            entry->timeoutMs = batch->timeoutMs;
+            StampTraceOnSubmit(entry);
+
+            if (TryInsertPendingEntry(entry)) {
+                parked[i] = 1;
+                ArmCommandTimeout(commands[i].commandId, batch->timeoutMs);
+            } else {
+                RenderResult failureResult;
+                failureResult.commandId = commands[i].commandId;
+                failureResult.widgetId = commands[i].widgetId;
+                failureResult.status = RenderResultStatus::Failure;
+                failureResult.errorMessage = "Pending command table full";
+                CompletePendingEntry(entry, failureResult);
+            }
+        }
+
+        // Enqueue the whole burst in one pass, then wake the consumer once
+        size_t sent = 0;
+        if ((ipcMode_ == IPCMode::SharedMemory || ipcMode_ == IPCMode::Hybrid) && sharedMemory_) {
+            sent = sharedMemory_->WriteCommands(commands);
+            if (sent > 0) {
+                sharedMemory_->SignalCommandReady();
+            }
+        }
+
+        // Pipe fallback for anything that did not fit in the ring
+        if (sent < commands.size() &&
+            (ipcMode_ == IPCMode::NamedPipes || ipcMode_ == IPCMode::Hybrid) && namedPipe_) {
+            while (sent < commands.size() && namedPipe_->SendCommand(commands[sent])) {
+                sent++;
+            }
+        }
+
+        // Unsent commands fail immediately in their slot
+        for (size_t i = sent; i < commands.size(); ++i) {
+            if (!parked[i]) {
+                continue;
+            }
+            if (auto* entry = TryRemovePendingEntry(commands[i].commandId)) {
+                RenderResult failureResult;
+                failureResult.commandId = commands[i].commandId;
+                failureResult.widgetId = commands[i].widgetId;
+                failureResult.status = RenderResultStatus::Failure;
+                failureResult.errorMessage = "Failed to send command via IPC";
+                CompletePendingEntry(entry, failureResult);
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> statsLock(statsMutex_);
+            stats_.totalCommandsSent += sent;
+            stats_.failedCommands += commands.size() - sent;
+        }
+
+    } catch (const std::exception& e) {
+        SetLastError(std::string("Exception in SendCommandBatchAsync: ") + e.what());
+        // Reclaim whatever is still parked and fail it; the last slot to
+        // complete fulfills the batch promise as usual
+        for (size_t i = 0; i < commands.size(); ++i) {
+            if (auto* entry = TryRemovePendingEntry(commands[i].commandId)) {
+                RenderResult failureResult;
+                failureResult.commandId = commands[i].commandId;
+                failureResult.widgetId = commands[i].widgetId;
+                failureResult.status = RenderResultStatus::Failure;
+                failureResult.errorMessage = "Exception sending batch";
+                CompletePendingEntry(entry, failureResult);
+            }
+        }
+    }
+
+    return future;
+}
+
+size_t RenderIPCBridge::SendCommandBatchFireAndForget(const std::vector<RenderCommand>& commands)
+{
+    try {
+        size_t sent = 0;
+
+        if ((ipcMode_ == IPCMode::SharedMemory || ipcMode_ == IPCMode::Hybrid) && sharedMemory_) {
+            sent = sharedMemory_->WriteCommands(commands);
+            if (sent > 0) {
+                sharedMemory_->SignalCommandReady();
+            }
+        }
+
+        if (sent < commands.size() &&
+            (ipcMode_ == IPCMode::NamedPipes || ipcMode_ == IPCMode::Hybrid) && namedPipe_) {
+            while (sent < commands.size() && namedPipe_->SendCommand(commands[sent])) {
+                sent++;
+            }
+        }
+
+        if (sent > 0) {
+            std::lock_guard<std::mutex> statsLock(statsMutex_);
+            stats_.totalCommandsSent += sent;
+        }
+
+        return sent;
+
+    } catch (const std::exception& e) {
+        logger_.LogError(L"RenderIPCBridge: SendCommandBatchFireAndForget exception: %s",
+                        std::wstring(e.what(), e.what() + strlen(e.what())).c_str());
+        return 0;
+    }
+}
+
 // ===== SYSTEM CAPABILITIES =====
 
 SystemCapabilities RenderIPCBridge::QuerySystemCapabilities(uint32_t timeoutMs)
@@ -464,8 +724,8 @@ RenderIPCBridge::IPCStats RenderIPCBridge::GetIPCStatistics() const
     std::lock_guard<std::mutex> lock(statsMutex_);
     
     IPCStats currentStats = stats_;
-    currentStats.queuedCommands = pendingCommands_.size();
-    
+    currentStats.queuedCommands = CountPendingEntries();
+
     return currentStats;
 }
 
@@ -473,9 +733,89 @@ void RenderIPCBridge::ResetIPCStatistics()
 {
     std::lock_guard<std::mutex> lock(statsMutex_);
     stats_ = IPCStats{};
+    traceAccumulator_ = CommandTraceAccumulator{};
     logger_.LogInfo(L"RenderIPCBridge: IPC statistics reset");
 }
 
+// ===== LATENCY TRACING =====
+
+RenderIPCBridge::CommandTraceStats RenderIPCBridge::GetCommandTraceStats() const
+{
+    std::lock_guard<std::mutex> lock(statsMutex_);
+
+    CommandTraceStats result;
+    result.tracedCommands = traceAccumulator_.tracedCommands;
+    if (result.tracedCommands > 0) {
+        result.buildToSubmitUs = traceAccumulator_.buildToSubmitUsSum / result.tracedCommands;
+        result.submitToRemoteUs = traceAccumulator_.submitToRemoteUsSum / result.tracedCommands;
+        result.remoteRenderUs = traceAccumulator_.remoteRenderUsSum / result.tracedCommands;
+        result.resultReturnUs = traceAccumulator_.resultReturnUsSum / result.tracedCommands;
+        result.totalRoundTripUs = traceAccumulator_.totalRoundTripUsSum / result.tracedCommands;
+    }
+    return result;
+}
+
+void RenderIPCBridge::SetTraceSampleRate(uint32_t oneInN)
+{
+    traceSampleRate_.store(oneInN, std::memory_order_relaxed);
+}
+
+bool RenderIPCBridge::ShouldTraceCommand()
+{
+    const uint32_t rate = traceSampleRate_.load(std::memory_order_relaxed);
+    if (rate == 0) {
+        return false;
+    }
+    return (traceCounter_.fetch_add(1, std::memory_order_relaxed) % rate) == 0;
+}
+
+void RenderIPCBridge::StampTraceOnSubmit(PendingEntry* entry)
+{
+    if (!ShouldTraceCommand()) {
+        return;
+    }
+    // Builders stamp command.timestamp with QPC at build time; untimed
+    // commands degrade to a zero-length build stage rather than skewing it
+    const uint64_t submitQpc = QpcNow();
+    entry->traceBuildQpc = entry->command.timestamp != 0 ? entry->command.timestamp : submitQpc;
+    entry->traceSubmitQpc = submitQpc;
+}
+
+void RenderIPCBridge::RecordCommandTrace(const PendingEntry& entry, const RenderResult& result)
+{
+    const uint64_t receiveQpc = QpcNow();
+    if (receiveQpc <= entry.traceBuildQpc || entry.traceSubmitQpc < entry.traceBuildQpc) {
+        return; // Clock went sideways; drop the sample rather than pollute
+    }
+
+    const uint64_t totalUs = QpcDeltaToMicros(receiveQpc - entry.traceBuildQpc);
+    const uint64_t buildToSubmitUs = QpcDeltaToMicros(entry.traceSubmitQpc - entry.traceBuildQpc);
+    const uint64_t remoteRenderUs = result.renderTimeMs * 1000;
+
+    // The render process stamps result.timestamp with its own QPC read
+    // just before writing the result. QPC is system-wide, so the stamp
+    // slots directly between our submit and receive stamps; peers that
+    // leave it zero collapse both wire legs into submitToRemote.
+    uint64_t submitToRemoteUs = 0;
+    uint64_t resultReturnUs = 0;
+    if (result.timestamp > entry.traceSubmitQpc && result.timestamp < receiveQpc) {
+        resultReturnUs = QpcDeltaToMicros(receiveQpc - result.timestamp);
+        const uint64_t outboundUs = QpcDeltaToMicros(result.timestamp - entry.traceSubmitQpc);
+        submitToRemoteUs = outboundUs > remoteRenderUs ? outboundUs - remoteRenderUs : 0;
+    } else {
+        const uint64_t accountedUs = buildToSubmitUs + remoteRenderUs;
+        submitToRemoteUs = totalUs > accountedUs ? totalUs - accountedUs : 0;
+    }
+
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    traceAccumulator_.tracedCommands++;
+    traceAccumulator_.buildToSubmitUsSum += buildToSubmitUs;
+    traceAccumulator_.submitToRemoteUsSum += submitToRemoteUs;
+    traceAccumulator_.remoteRenderUsSum += remoteRenderUs;
+    traceAccumulator_.resultReturnUsSum += resultReturnUs;
+    traceAccumulator_.totalRoundTripUsSum += totalUs;
+}
+
 // ===== ERROR HANDLING =====
 
 std::string RenderIPCBridge::GetLastError() const
@@ -612,9 +952,6 @@ void RenderIPCBridge::MessageReceiveLoop()
             logger_.LogError(L"RenderIPCBridge: Message receive loop exception: %s",
                            std::wstring(e.what(), e.what() + strlen(e.what())).c_str());
         }
-        
-        // Check for timed out commands
-        TimeoutPendingCommands();
     }
     
     logger_.LogInfo(L"RenderIPCBridge: Message receive thread stopped");
@@ -651,77 +988,180 @@ void RenderIPCBridge::ProcessMonitorLoop()
 void RenderIPCBridge::HandleReceivedMessage(const RenderResult& result)
 {
     try {
-        std::lock_guard<std::mutex> lock(pendingCommandsMutex_);
-        
-        auto it = pendingCommands_.find(result.commandId);
-        if (it != pendingCommands_.end()) {
-            // Calculate round trip time
+        // Completion is one CAS out of the pending table; no mutex on
+        // this path, so a burst of results never stalls submitters
+        PendingEntry* entry = TryRemovePendingEntry(result.commandId);
+        if (entry) {
             auto roundTripTime = std::chrono::duration_cast<std::chrono::milliseconds>(
-                std::chrono::steady_clock::now() - it->second->sentTime).count();
-            
-            // Update statistics
-            UpdateStats(it->second->command, result, roundTripTime);
-            
-            // Set the promise result
-            it->second->promise.set_value(result);
-            
-            // Remove from pending commands
-            pendingCommands_.erase(it);
+                std::chrono::steady_clock::now() - entry->sentTime).count();
+
+            UpdateStats(entry->command, result, roundTripTime);
+
+            if (entry->traceBuildQpc != 0) {
+                RecordCommandTrace(*entry, result);
+            }
+
+            // Fulfills the single promise, or fills the batch slot and
+            // completes the batch future on the last one
+            CompletePendingEntry(entry, result);
         }
-        
+
         // Trigger callback if set
         if (messageReceivedCallback_) {
             messageReceivedCallback_(result);
         }
-        
+
     } catch (const std::exception& e) {
         logger_.LogError(L"RenderIPCBridge: HandleReceivedMessage exception: %s",
                         std::wstring(e.what(), e.what() + strlen(e.what())).c_str());
     }
 }
 
-void RenderIPCBridge::TimeoutPendingCommands()
+void RenderIPCBridge::ArmCommandTimeout(uint64_t commandId, uint32_t timeoutMs)
+{
+    // No cancel on completion: a timer for a command that already
+    // finished just fails the TryRemovePendingEntry lookup below, and
+    // since command ids are never reused it can never hit a newer entry
+    timeoutWheel_.Schedule(timeoutMs, [this, commandId] {
+        ExpirePendingCommand(commandId);
+    });
+}
+
+void RenderIPCBridge::ExpirePendingCommand(uint64_t commandId)
 {
     try {
-        std::lock_guard<std::mutex> lock(pendingCommandsMutex_);
-        
-        auto now = std::chrono::steady_clock::now();
-        std::vector<uint64_t> timedOutCommands;
-        
-        for (auto& command : pendingCommands_) {
-            auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
-                now - command.second->sentTime).count();
-                
-            if (elapsed > command.second->timeoutMs) {
-                timedOutCommands.push_back(command.first);
-            }
+        // The removal CAS arbitrates against the receive thread, so a
+        // result that lands just before expiry wins cleanly
+        PendingEntry* entry = TryRemovePendingEntry(commandId);
+        if (!entry) {
+            return;
         }
-        
-        // Process timed out commands
-        for (auto commandId : timedOutCommands) {
-            auto it = pendingCommands_.find(commandId);
-            if (it != pendingCommands_.end()) {
-                RenderResult timeoutResult;
-                timeoutResult.commandId = commandId;
-                timeoutResult.status = RenderResultStatus::Failure;
-                timeoutResult.errorMessage = "Command timeout";
-                
-                it->second->promise.set_value(timeoutResult);
-                pendingCommands_.erase(it);
-                
-                {
-                    std::lock_guard<std::mutex> statsLock(statsMutex_);
-                    stats_.timeoutCommands++;
-                }
-            }
+
+        RenderResult timeoutResult;
+        timeoutResult.commandId = entry->commandId;
+        timeoutResult.status = RenderResultStatus::Failure;
+        timeoutResult.errorMessage = "Command timeout";
+        CompletePendingEntry(entry, timeoutResult);
+
+        {
+            std::lock_guard<std::mutex> statsLock(statsMutex_);
+            stats_.timeoutCommands++;
         }
-        
+
     } catch (const std::exception& e) {
-        logger_.LogError(L"RenderIPCBridge: TimeoutPendingCommands exception: %s",
+        logger_.LogError(L"RenderIPCBridge: ExpirePendingCommand exception: %s",
                         std::wstring(e.what(), e.what() + strlen(e.what())).c_str());
     }
 }
 
+// ===== PENDING TABLE PRIMITIVES =====
+
+bool RenderIPCBridge::TryInsertPendingEntry(PendingEntry* entry)
+{
+    size_t base = entry->commandId & (PENDING_SLOT_COUNT - 1);
+
+    for (size_t probe = 0; probe < PENDING_PROBE_WINDOW; ++probe) {
+        size_t index = (base + probe) & (PENDING_SLOT_COUNT - 1);
+        PendingEntry* expected = nullptr;
+        if (pendingSlots_[index].compare_exchange_strong(
+                expected, entry, std::memory_order_release,
+                std::memory_order_relaxed)) {
+            return true;
+        }
+    }
+
+    // Probe window exhausted: more than PENDING_PROBE_WINDOW in-flight
+    // commands collide on these slots. Caller fails the command.
+    return false;
+}
+
+RenderIPCBridge::PendingEntry* RenderIPCBridge::TryRemovePendingEntry(uint64_t commandId)
+{
+    size_t base = commandId & (PENDING_SLOT_COUNT - 1);
+
+    for (size_t probe = 0; probe < PENDING_PROBE_WINDOW; ++probe) {
+        size_t index = (base + probe) & (PENDING_SLOT_COUNT - 1);
+        PendingEntry* entry = pendingSlots_[index].load(std::memory_order_acquire);
+        if (entry && entry->commandId == commandId) {
+            // The CAS decides between the receive thread, the timeout
+            // sweep and cleanup; exactly one caller gets the entry
+            if (pendingSlots_[index].compare_exchange_strong(
+                    entry, nullptr, std::memory_order_acq_rel,
+                    std::memory_order_relaxed)) {
+                return entry;
+            }
+        }
+    }
+
+    return nullptr;
+}
+
+void RenderIPCBridge::CompletePendingEntry(PendingEntry* entry, const RenderResult& result)
+{
+    try {
+        if (entry->callback) {
+            entry->callback(result);
+        } else if (entry->batch) {
+            auto& batch = entry->batch;
+            batch->results[entry->batchIndex] = result;
+            if (batch->remaining.fetch_sub(1) == 1) {
+                batch->promise.set_value(std::move(batch->results));
+            }
+        } else {
+            entry->promise.set_value(result);
+        }
+    } catch (...) {
+        // Ignore promise exceptions (abandoned futures)
+    }
+
+    ReleasePendingEntry(entry);
+}
+
+RenderIPCBridge::PendingEntry* RenderIPCBridge::AcquirePendingEntry()
+{
+    {
+        std::lock_guard<std::mutex> lock(entryFreeListMutex_);
+        if (!entryFreeList_.empty()) {
+            PendingEntry* entry = entryFreeList_.back();
+            entryFreeList_.pop_back();
+            return entry;
+        }
+    }
+    return new PendingEntry();
+}
+
+void RenderIPCBridge::ReleasePendingEntry(PendingEntry* entry)
+{
+    // Re-arm for reuse; `command` is left as-is so its string/vector
+    // capacity is recycled by the next assignment
+    entry->commandId = 0;
+    entry->promise = std::promise<RenderResult>();
+    entry->batch.reset();
+    entry->callback = nullptr;
+    entry->traceBuildQpc = 0;
+    entry->traceSubmitQpc = 0;
+
+    {
+        std::lock_guard<std::mutex> lock(entryFreeListMutex_);
+        if (entryFreeList_.size() < ENTRY_FREELIST_CAP) {
+            entryFreeList_.push_back(entry);
+            return;
+        }
+    }
+    delete entry;
+}
+
+size_t RenderIPCBridge::CountPendingEntries() const
+{
+    size_t count = 0;
+    for (size_t i = 0; i < PENDING_SLOT_COUNT; ++i) {
+        if (pendingSlots_[i].load(std::memory_order_relaxed)) {
+            count++;
+        }
+    }
+    return count;
+}
+
 uint64_t RenderIPCBridge::GenerateCommandId()
 {
     return nextCommandId_++;
@@ -768,6 +1208,18 @@ void RenderIPCBridge::SetMessageReceivedCallback(MessageReceivedCallback callbac
     messageReceivedCallback_ = callback;
 }
 
+// ===== FRAME TRANSPORT =====
+
+FrameSurfacePool* RenderIPCBridge::GetFrameSurfacePool() const
+{
+    return framePool_.get();
+}
+
+void RenderIPCBridge::SetFrameReadyCallback(FrameReadyCallback callback)
+{
+    frameReadyCallback_ = callback;
+}
+
 // ===== CONFIGURATION =====
 
 void RenderIPCBridge::SetIPCMode(IPCMode mode)
@@ -1,8 +1,10 @@
 #pragma once
 
 #include "../interfaces/render_command.h"
+#include "frame_surface_pool.h"
 #include "../../core/logger.h"
 #include "../../core/logger_adapter.h"
+#include "../../core/timer_wheel.h"
 #include <windows.h>
 #include <memory>
 #include <functional>
@@ -12,7 +14,6 @@
 #include <queue>
 #include <mutex>
 #include <condition_variable>
-#include <map>
 
 namespace RainmeterManager::Render {
 
@@ -31,6 +32,8 @@ namespace RainmeterManager::Render {
     using ProcessStartedCallback = std::function<void(DWORD processId)>;
     using ProcessExitedCallback = std::function<void(DWORD exitCode)>;
     using MessageReceivedCallback = std::function<void(const RenderResult&)>;
+    using FrameReadyCallback = std::function<void(const FrameDescriptor&)>;
+    using ResultCallback = std::function<void(const RenderResult&)>;
 
     /**
      * @brief Main IPC bridge for render process communication
@@ -111,6 +114,58 @@ namespace RainmeterManager::Render {
          */
         bool SendCommandFireAndForget(const RenderCommand& command);
 
+        /**
+         * @brief Send command, delivering the result via callback
+         *
+         * The callback is invoked exactly once: from the receive thread
+         * when the result arrives, from the timer-wheel expiry, or inline if
+         * the command cannot be sent. This is the backing primitive for
+         * the coroutine awaitables in interfaces/render_awaitable.h — no
+         * thread parks in a future wait; the receive thread resumes the
+         * awaiting coroutine directly.
+         * @param command Command to send
+         * @param callback Invoked exactly once with the result
+         * @return True if the command went out over IPC
+         */
+        bool SendCommandWithCallback(const RenderCommand& command, ResultCallback callback);
+
+        /**
+         * @brief Send a batch of commands as one transport submission
+         *
+         * All commands are enqueued in one pass with a single wakeup
+         * signal, and the batch completes with a single future once every
+         * result has arrived. Results are returned in submission order.
+         * Use this for per-frame bursts (property updates, resizes,
+         * renders) instead of per-command futures.
+         * @param commands Commands to send
+         * @return Future resolving to one result per command
+         */
+        std::future<std::vector<RenderResult>> SendCommandBatchAsync(
+            const std::vector<RenderCommand>& commands);
+
+        /**
+         * @brief Send a batch of commands without waiting for results
+         * @param commands Commands to send
+         * @return Number of commands submitted
+         */
+        size_t SendCommandBatchFireAndForget(const std::vector<RenderCommand>& commands);
+
+        // === Frame Transport ===
+
+        /**
+         * @brief Get the shared-memory frame surface pool
+         *
+         * Rendered pixels travel through pooled triple-buffered surfaces;
+         * only FrameDescriptor notifications go through the command channel.
+         * @return Pool pointer (nullptr if IPC is not initialized)
+         */
+        FrameSurfacePool* GetFrameSurfacePool() const;
+
+        /**
+         * @brief Set callback invoked when a frame descriptor arrives
+         */
+        void SetFrameReadyCallback(FrameReadyCallback callback);
+
         // === System Capabilities ===
 
         /**
@@ -148,6 +203,42 @@ namespace RainmeterManager::Render {
          */
         void ResetIPCStatistics();
 
+        // === Latency Tracing ===
+
+        /**
+         * @brief Per-stage breakdown of sampled command journeys
+         *
+         * Stage boundaries are QueryPerformanceCounter stamps; QPC is
+         * system-wide, so the render process stamps the same clock and
+         * the stages correlate across the process boundary with only a
+         * frequency conversion — no clock-offset estimation. Fields are
+         * running averages in microseconds over the traced sample.
+         */
+        struct CommandTraceStats {
+            uint64_t tracedCommands = 0;
+            uint64_t buildToSubmitUs = 0;   // Command build -> IPC submit
+            uint64_t submitToRemoteUs = 0;  // Submit -> remote render start
+            uint64_t remoteRenderUs = 0;    // Remote render duration
+            uint64_t resultReturnUs = 0;    // Remote result stamp -> receive thread
+            uint64_t totalRoundTripUs = 0;
+        };
+
+        /**
+         * @brief Get the sampled per-stage latency breakdown
+         *
+         * Traced commands are sampled 1-in-N (see SetTraceSampleRate) so
+         * tracing is safe to leave on in production; a hot path that is
+         * not sampled pays one relaxed counter increment.
+         * @return Averaged stage breakdown since the last reset
+         */
+        CommandTraceStats GetCommandTraceStats() const;
+
+        /**
+         * @brief Set the trace sampling rate
+         * @param oneInN Trace every Nth command (0 disables tracing)
+         */
+        void SetTraceSampleRate(uint32_t oneInN);
+
         // === Event Callbacks ===
 
         /**
@@ -206,12 +297,35 @@ namespace RainmeterManager::Render {
     private:
         // === Internal Implementation ===
 
-        struct PendingCommand {
-            uint64_t commandId;
+        // One in-flight batch; individual results are scattered into
+        // `results` by submission order until `remaining` hits zero.
+        // `remaining` is atomic because slots complete from the receive
+        // thread, timer-wheel expiry and cleanup concurrently; whichever
+        // decrement reaches zero fulfills the promise.
+        struct PendingBatch {
+            std::promise<std::vector<RenderResult>> promise;
+            std::vector<RenderResult> results;
+            std::atomic<size_t> remaining{0};
+            std::chrono::steady_clock::time_point sentTime;
+            uint32_t timeoutMs = 0;
+        };
+
+        // One in-flight command (single or batch slot) parked in the
+        // lock-free pending table until its result arrives
+        struct PendingEntry {
+            uint64_t commandId = 0;
             RenderCommand command;
-            std::promise<RenderResult> promise;
+            std::promise<RenderResult> promise;       // Single command
+            std::shared_ptr<PendingBatch> batch;      // Set for batch slots
+            size_t batchIndex = 0;
+            ResultCallback callback;                  // Set for callback delivery
             std::chrono::steady_clock::time_point sentTime;
-            uint32_t timeoutMs;
+            uint32_t timeoutMs = 0;
+            // Latency-trace stamps (QPC ticks); zero when the command
+            // was not sampled. Written before the entry is parked so
+            // completion never races the submit path.
+            uint64_t traceBuildQpc = 0;
+            uint64_t traceSubmitQpc = 0;
         };
 
         // Process management
@@ -223,25 +337,66 @@ namespace RainmeterManager::Render {
         IPCMode ipcMode_;
         std::unique_ptr<SharedMemoryManager> sharedMemory_;
         std::unique_ptr<NamedPipeChannel> namedPipe_;
+        std::unique_ptr<FrameSurfacePool> framePool_;
         
         // Communication threads
         std::thread messageReceiveThread_;
         std::thread processMonitorThread_;
         std::atomic<bool> shouldStop_{false};
 
-        // Command queue management
-        std::mutex pendingCommandsMutex_;
-        std::map<uint64_t, std::unique_ptr<PendingCommand>> pendingCommands_;
+        // Command timeouts expire off the shared timer wheel instead of
+        // a periodic sweep over the whole pending table: arming is O(1)
+        // per command and expiry fires only for the commands actually
+        // due, so timeout latency no longer jitters with the sweep
+        // period. Stale timers for already-completed commands no-op
+        // against the table (command ids are never reused).
+        Core::TimerWheel timeoutWheel_;
+
+        // Lock-free pending table: fixed power-of-two slot array indexed
+        // by the low bits of commandId, with a short linear probe window
+        // to absorb index collisions. The submit path claims a free slot
+        // with a CAS from nullptr; whichever completer runs first
+        // (receive thread, timer-wheel expiry, cleanup) claims the entry back
+        // with a CAS to nullptr and fulfills it, so neither submit nor
+        // completion ever takes a mutex and submit latency is decoupled
+        // from result-processing bursts.
+        static constexpr size_t PENDING_SLOT_COUNT = 1024;   // Power of two
+        static constexpr size_t PENDING_PROBE_WINDOW = 8;
+        std::atomic<PendingEntry*> pendingSlots_[PENDING_SLOT_COUNT] = {};
         std::atomic<uint64_t> nextCommandId_{1};
 
+        // Freelist for pending entries: at hundreds of commands per
+        // second the entry churn was a top malloc caller, so completed
+        // entries are recycled instead of freed. Capped at the table
+        // size; the lock is held only for a pointer push/pop.
+        static constexpr size_t ENTRY_FREELIST_CAP = PENDING_SLOT_COUNT;
+        std::vector<PendingEntry*> entryFreeList_;
+        std::mutex entryFreeListMutex_;
+
         // Statistics
         mutable std::mutex statsMutex_;
         IPCStats stats_;
 
+        // Latency tracing: stage sums accumulate under statsMutex_ (the
+        // traced path is already off the fast path by construction);
+        // the sampling decision itself is one relaxed increment
+        struct CommandTraceAccumulator {
+            uint64_t tracedCommands = 0;
+            uint64_t buildToSubmitUsSum = 0;
+            uint64_t submitToRemoteUsSum = 0;
+            uint64_t remoteRenderUsSum = 0;
+            uint64_t resultReturnUsSum = 0;
+            uint64_t totalRoundTripUsSum = 0;
+        };
+        CommandTraceAccumulator traceAccumulator_;
+        std::atomic<uint32_t> traceSampleRate_{100};   // 1-in-N, 0 = off
+        std::atomic<uint64_t> traceCounter_{0};
+
         // Event callbacks
         ProcessStartedCallback processStartedCallback_;
         ProcessExitedCallback processExitedCallback_;
         MessageReceivedCallback messageReceivedCallback_;
+        FrameReadyCallback frameReadyCallback_;
 
         // Logging
         Core::Logger& logger_;
@@ -254,12 +409,26 @@ namespace RainmeterManager::Render {
         void MessageReceiveLoop();
         void ProcessMonitorLoop();
         void HandleReceivedMessage(const RenderResult& result);
-        void TimeoutPendingCommands();
+        // Timer-wheel timeout path (see timeoutWheel_)
+        void ArmCommandTimeout(uint64_t commandId, uint32_t timeoutMs);
+        void ExpirePendingCommand(uint64_t commandId);
+        // Pending table primitives (see pendingSlots_)
+        bool TryInsertPendingEntry(PendingEntry* entry);
+        PendingEntry* TryRemovePendingEntry(uint64_t commandId);
+        void CompletePendingEntry(PendingEntry* entry, const RenderResult& result);
+        size_t CountPendingEntries() const;
+        // Entry pooling (see entryFreeList_)
+        PendingEntry* AcquirePendingEntry();
+        void ReleasePendingEntry(PendingEntry* entry);
         bool StartProcessInternal(const std::wstring& path, const std::wstring& args);
         void CleanupProcess();
         uint64_t GenerateCommandId();
-        void UpdateStats(const RenderCommand& command, const RenderResult& result, 
+        void UpdateStats(const RenderCommand& command, const RenderResult& result,
                         uint64_t roundTripMs);
+        // Latency tracing (see traceAccumulator_)
+        bool ShouldTraceCommand();
+        void StampTraceOnSubmit(PendingEntry* entry);
+        void RecordCommandTrace(const PendingEntry& entry, const RenderResult& result);
         void SetLastError(const std::string& error) const;
 
         // Non-copyable
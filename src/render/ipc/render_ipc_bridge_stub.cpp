@@ -44,6 +44,7 @@ bool RenderIPCBridge::InitializeIPC() {
 void RenderIPCBridge::CleanupIPC() {
     sharedMemory_.reset();
     namedPipe_.reset();
+    framePool_.reset();
 }
 
 std::future<RenderResult> RenderIPCBridge::SendCommandAsync(const RenderCommand& command) {
@@ -68,6 +69,23 @@ bool RenderIPCBridge::SendCommandFireAndForget(const RenderCommand& /*command*/)
     return false;
 }
 
+std::future<std::vector<RenderResult>> RenderIPCBridge::SendCommandBatchAsync(
+    const std::vector<RenderCommand>& commands) {
+    std::promise<std::vector<RenderResult>> p;
+    std::vector<RenderResult> results(commands.size());
+    for (size_t i = 0; i < commands.size(); ++i) {
+        results[i].commandId = commands[i].commandId;
+        results[i].status = RenderResultStatus::Failure;
+        results[i].errorMessage = "IPC disabled (stub)";
+    }
+    p.set_value(std::move(results));
+    return p.get_future();
+}
+
+size_t RenderIPCBridge::SendCommandBatchFireAndForget(const std::vector<RenderCommand>& /*commands*/) {
+    return 0;
+}
+
 SystemCapabilities RenderIPCBridge::QuerySystemCapabilities(uint32_t /*timeoutMs*/) {
     return SystemCapabilities{};
 }
@@ -89,6 +107,9 @@ void RenderIPCBridge::ResetIPCStatistics() {
 void RenderIPCBridge::SetProcessStartedCallback(ProcessStartedCallback callback) { processStartedCallback_ = std::move(callback); }
 void RenderIPCBridge::SetProcessExitedCallback(ProcessExitedCallback callback) { processExitedCallback_ = std::move(callback); }
 void RenderIPCBridge::SetMessageReceivedCallback(MessageReceivedCallback callback) { messageReceivedCallback_ = std::move(callback); }
+void RenderIPCBridge::SetFrameReadyCallback(FrameReadyCallback callback) { frameReadyCallback_ = std::move(callback); }
+
+FrameSurfacePool* RenderIPCBridge::GetFrameSurfacePool() const { return framePool_.get(); }
 
 void RenderIPCBridge::SetIPCMode(IPCMode mode) { ipcMode_ = mode; }
 IPCMode RenderIPCBridge::GetIPCMode() const { return ipcMode_; }
@@ -0,0 +1,247 @@
+#include "render_wire_format.h"
+#include <cstring>
+
+namespace RainmeterManager::Render {
+
+namespace {
+    // Arena writer: appends a string and fills in its (offset, length) ref
+    void WriteArenaString(uint8_t* block, uint32_t& arenaCursor,
+                          const std::string& str, WireString& ref) {
+        ref.length = static_cast<uint32_t>(str.size());
+        if (str.empty()) {
+            ref.offset = 0;
+            return;
+        }
+        ref.offset = arenaCursor;
+        memcpy(block + arenaCursor, str.data(), str.size());
+        arenaCursor += static_cast<uint32_t>(str.size());
+    }
+
+    // A ref is acceptable when empty or when it lies fully inside the
+    // arena; the block comes from the other process, so refs are hostile
+    // input even after the table/arena extents have been checked
+    bool ArenaRefInBounds(const WireRenderCommand& wire, const WireString& ref) {
+        if (ref.length == 0) {
+            return true;
+        }
+        const uint64_t end = static_cast<uint64_t>(ref.offset) + ref.length;
+        return ref.offset >= wire.arenaOffset &&
+               end <= static_cast<uint64_t>(wire.arenaOffset) + wire.arenaSize;
+    }
+
+    std::string ReadArenaString(const uint8_t* block, const WireRenderCommand& wire,
+                                const WireString& ref) {
+        if (ref.length == 0 || !ArenaRefInBounds(wire, ref)) {
+            return std::string();
+        }
+        return std::string(reinterpret_cast<const char*>(block + ref.offset), ref.length);
+    }
+}
+
+size_t EncodeRenderCommand(const RenderCommand& command, std::vector<uint8_t>& buffer)
+{
+    const auto& content = command.content;
+
+    // Size the block up front: fixed header, pair tables, string arena
+    size_t arenaSize = content.sourceUrl.size() + content.templatePath.size() +
+                       content.authToken.size();
+    for (const auto& header : content.customHeaders) {
+        arenaSize += header.first.size() + header.second.size();
+    }
+    for (const auto& param : content.parameters) {
+        arenaSize += param.first.size() + param.second.size();
+    }
+
+    const size_t headerTableSize = content.customHeaders.size() * sizeof(WireStringPair);
+    const size_t parameterTableSize = content.parameters.size() * sizeof(WireStringPair);
+    const size_t totalSize = sizeof(WireRenderCommand) + headerTableSize +
+                             parameterTableSize + arenaSize;
+
+    if (totalSize > UINT32_MAX) {
+        return 0;
+    }
+
+    buffer.resize(totalSize);
+    uint8_t* block = buffer.data();
+
+    auto* wire = reinterpret_cast<WireRenderCommand*>(block);
+    memset(wire, 0, sizeof(WireRenderCommand));
+
+    wire->totalSize = static_cast<uint32_t>(totalSize);
+    wire->wireVersion = WIRE_FORMAT_VERSION;
+
+    wire->commandId = command.commandId;
+    wire->commandType = static_cast<uint32_t>(command.commandType);
+    wire->widgetId = command.widgetId;
+    wire->windowHandle = reinterpret_cast<uint64_t>(command.windowHandle);
+    wire->backendType = static_cast<uint32_t>(command.backendType);
+    wire->bounds = command.bounds;
+    wire->timestamp = command.timestamp;
+
+    wire->sourceType = static_cast<uint32_t>(content.sourceType);
+    wire->refreshIntervalMs = content.refreshIntervalMs;
+    wire->cacheEnabled = content.cacheEnabled ? 1 : 0;
+
+    wire->customHeaderCount = static_cast<uint32_t>(content.customHeaders.size());
+    wire->customHeaderTableOffset = static_cast<uint32_t>(sizeof(WireRenderCommand));
+    wire->parameterCount = static_cast<uint32_t>(content.parameters.size());
+    wire->parameterTableOffset =
+        static_cast<uint32_t>(sizeof(WireRenderCommand) + headerTableSize);
+
+    wire->properties = command.properties;
+
+    wire->arenaOffset =
+        static_cast<uint32_t>(sizeof(WireRenderCommand) + headerTableSize + parameterTableSize);
+    wire->arenaSize = static_cast<uint32_t>(arenaSize);
+
+    uint32_t arenaCursor = wire->arenaOffset;
+
+    WriteArenaString(block, arenaCursor, content.sourceUrl, wire->sourceUrl);
+    WriteArenaString(block, arenaCursor, content.templatePath, wire->templatePath);
+    WriteArenaString(block, arenaCursor, content.authToken, wire->authToken);
+
+    auto* headerTable = reinterpret_cast<WireStringPair*>(block + wire->customHeaderTableOffset);
+    for (size_t i = 0; i < content.customHeaders.size(); ++i) {
+        WriteArenaString(block, arenaCursor, content.customHeaders[i].first, headerTable[i].key);
+        WriteArenaString(block, arenaCursor, content.customHeaders[i].second, headerTable[i].value);
+    }
+
+    auto* parameterTable = reinterpret_cast<WireStringPair*>(block + wire->parameterTableOffset);
+    for (size_t i = 0; i < content.parameters.size(); ++i) {
+        WriteArenaString(block, arenaCursor, content.parameters[i].first, parameterTable[i].key);
+        WriteArenaString(block, arenaCursor, content.parameters[i].second, parameterTable[i].value);
+    }
+
+    return totalSize;
+}
+
+bool DecodeRenderCommand(const uint8_t* data, size_t size, RenderCommand& command)
+{
+    WireCommandView view(data, size);
+    if (!view.IsValid()) {
+        return false;
+    }
+
+    const WireRenderCommand& wire = view.Header();
+
+    command.commandId = wire.commandId;
+    command.commandType = static_cast<RenderCommandType>(wire.commandType);
+    command.widgetId = wire.widgetId;
+    command.windowHandle = reinterpret_cast<HWND>(static_cast<uintptr_t>(wire.windowHandle));
+    command.backendType = static_cast<RenderBackendType>(wire.backendType);
+    command.bounds = wire.bounds;
+    command.timestamp = wire.timestamp;
+
+    command.content.sourceType = static_cast<ContentSourceType>(wire.sourceType);
+    command.content.refreshIntervalMs = wire.refreshIntervalMs;
+    command.content.cacheEnabled = wire.cacheEnabled != 0;
+    command.content.sourceUrl = ReadArenaString(data, wire, wire.sourceUrl);
+    command.content.templatePath = ReadArenaString(data, wire, wire.templatePath);
+    command.content.authToken = ReadArenaString(data, wire, wire.authToken);
+
+    command.content.customHeaders.clear();
+    command.content.customHeaders.reserve(wire.customHeaderCount);
+    const WireStringPair* headerTable = view.CustomHeaders();
+    for (uint32_t i = 0; i < wire.customHeaderCount; ++i) {
+        command.content.customHeaders.emplace_back(
+            ReadArenaString(data, wire, headerTable[i].key),
+            ReadArenaString(data, wire, headerTable[i].value));
+    }
+
+    command.content.parameters.clear();
+    command.content.parameters.reserve(wire.parameterCount);
+    const WireStringPair* parameterTable = view.Parameters();
+    for (uint32_t i = 0; i < wire.parameterCount; ++i) {
+        command.content.parameters.emplace_back(
+            ReadArenaString(data, wire, parameterTable[i].key),
+            ReadArenaString(data, wire, parameterTable[i].value));
+    }
+
+    command.properties = wire.properties;
+
+    return true;
+}
+
+// ===== WIRE COMMAND VIEW =====
+
+WireCommandView::WireCommandView(const uint8_t* data, size_t size)
+    : data_(data)
+    , size_(size)
+    , valid_(Validate())
+{
+}
+
+bool WireCommandView::IsValid() const
+{
+    return valid_;
+}
+
+const WireRenderCommand& WireCommandView::Header() const
+{
+    return *reinterpret_cast<const WireRenderCommand*>(data_);
+}
+
+std::string_view WireCommandView::GetString(const WireString& ref) const
+{
+    // Table entries are not covered by Validate(), so check each ref here
+    if (ref.length == 0 || !valid_ || !ArenaRefInBounds(Header(), ref)) {
+        return std::string_view();
+    }
+    return std::string_view(reinterpret_cast<const char*>(data_ + ref.offset), ref.length);
+}
+
+std::string_view WireCommandView::SourceUrl() const
+{
+    return GetString(Header().sourceUrl);
+}
+
+std::string_view WireCommandView::TemplatePath() const
+{
+    return GetString(Header().templatePath);
+}
+
+std::string_view WireCommandView::AuthToken() const
+{
+    return GetString(Header().authToken);
+}
+
+const WireStringPair* WireCommandView::CustomHeaders() const
+{
+    return reinterpret_cast<const WireStringPair*>(data_ + Header().customHeaderTableOffset);
+}
+
+const WireStringPair* WireCommandView::Parameters() const
+{
+    return reinterpret_cast<const WireStringPair*>(data_ + Header().parameterTableOffset);
+}
+
+bool WireCommandView::Validate() const
+{
+    if (!data_ || size_ < sizeof(WireRenderCommand)) {
+        return false;
+    }
+
+    const WireRenderCommand& wire = Header();
+    if (wire.wireVersion != WIRE_FORMAT_VERSION || wire.totalSize != size_) {
+        return false;
+    }
+
+    // Tables and arena must lie fully inside the block
+    const uint64_t headerTableEnd = static_cast<uint64_t>(wire.customHeaderTableOffset) +
+                                    static_cast<uint64_t>(wire.customHeaderCount) * sizeof(WireStringPair);
+    const uint64_t parameterTableEnd = static_cast<uint64_t>(wire.parameterTableOffset) +
+                                       static_cast<uint64_t>(wire.parameterCount) * sizeof(WireStringPair);
+    const uint64_t arenaEnd = static_cast<uint64_t>(wire.arenaOffset) + wire.arenaSize;
+
+    if (headerTableEnd > size_ || parameterTableEnd > size_ || arenaEnd > size_) {
+        return false;
+    }
+
+    // Header string refs must point into the arena; table entries are
+    // checked at read time since their count is unbounded
+    return ArenaRefInBounds(wire, wire.sourceUrl) &&
+           ArenaRefInBounds(wire, wire.templatePath) &&
+           ArenaRefInBounds(wire, wire.authToken);
+}
+
+} // namespace RainmeterManager::Render
@@ -0,0 +1,133 @@
+#pragma once
+
+#include "../interfaces/render_command.h"
+#include <cstdint>
+#include <string_view>
+#include <vector>
+#include <type_traits>
+
+namespace RainmeterManager::Render {
+
+    /**
+     * @brief Flat fixed-offset binary wire format for RenderCommand
+     *
+     * A command encodes to one contiguous block: a fixed-layout header,
+     * then the header/parameter pair tables, then a trailing string arena.
+     * Strings are referenced by (offset, length) into the arena instead of
+     * pointers, so the block can be memcpy'd straight into the shared ring
+     * and read in place on the C# side with no parse step and no per-field
+     * heap allocations. All offsets are relative to the block start.
+     *
+     * Layout must stay in sync with WireFormat.cs in the render process.
+     */
+
+    // Reference to a string stored in the trailing arena
+    struct WireString {
+        uint32_t offset;   // Byte offset from block start (0 if empty)
+        uint32_t length;   // Length in bytes (no terminator)
+    };
+
+    // One key/value entry in the header or parameter table
+    struct WireStringPair {
+        WireString key;
+        WireString value;
+    };
+
+    // Fixed-layout portion of an encoded command
+    #pragma pack(push, 8)
+    struct WireRenderCommand {
+        uint32_t totalSize;        // Size of the whole block in bytes
+        uint32_t wireVersion;      // WIRE_FORMAT_VERSION
+
+        // RenderCommand fields
+        uint64_t commandId;
+        uint32_t commandType;      // RenderCommandType
+        uint32_t widgetId;
+        uint64_t windowHandle;     // HWND widened to 64 bits
+        uint32_t backendType;      // RenderBackendType
+        uint32_t reserved0;
+        RenderRect bounds;
+        uint64_t timestamp;
+
+        // ContentParameters fields
+        uint32_t sourceType;       // ContentSourceType
+        int32_t refreshIntervalMs;
+        uint32_t cacheEnabled;
+        uint32_t reserved1;
+        WireString sourceUrl;
+        WireString templatePath;
+        WireString authToken;
+        uint32_t customHeaderCount;
+        uint32_t customHeaderTableOffset;  // Offset of WireStringPair[customHeaderCount]
+        uint32_t parameterCount;
+        uint32_t parameterTableOffset;     // Offset of WireStringPair[parameterCount]
+
+        // RenderProperties is trivially copyable and already crosses the
+        // boundary as raw bytes in the existing serializer
+        RenderProperties properties;
+
+        uint32_t arenaOffset;      // Start of the string arena
+        uint32_t arenaSize;        // Arena size in bytes
+    };
+    #pragma pack(pop)
+
+    static_assert(std::is_trivially_copyable<RenderProperties>::value,
+                  "RenderProperties must stay memcpy-safe for the wire format");
+    static_assert(std::is_trivially_copyable<WireRenderCommand>::value,
+                  "WireRenderCommand must be memcpy-safe");
+
+    constexpr uint32_t WIRE_FORMAT_VERSION = 1;
+
+    /**
+     * @brief Encode a command into its flat wire representation
+     *
+     * Performs exactly one allocation (the output resize); every field is
+     * written with fixed offsets and the strings are packed into the arena.
+     * @param command Command to encode
+     * @param buffer Output buffer; resized to the encoded size
+     * @return Encoded size in bytes (0 on failure)
+     */
+    size_t EncodeRenderCommand(const RenderCommand& command, std::vector<uint8_t>& buffer);
+
+    /**
+     * @brief Decode a wire block back into a RenderCommand
+     * @param data Encoded block
+     * @param size Block size in bytes
+     * @param command Output command
+     * @return True if the block was valid
+     */
+    bool DecodeRenderCommand(const uint8_t* data, size_t size, RenderCommand& command);
+
+    /**
+     * @brief Zero-copy view over an encoded command block
+     *
+     * For readers that only need a few fields: strings are returned as
+     * views into the block, so nothing is copied or allocated.
+     */
+    class WireCommandView {
+    public:
+        WireCommandView(const uint8_t* data, size_t size);
+
+        /**
+         * @brief Check block magic sizes and offsets
+         * @return True if the block is structurally valid
+         */
+        bool IsValid() const;
+
+        const WireRenderCommand& Header() const;
+        std::string_view GetString(const WireString& ref) const;
+        std::string_view SourceUrl() const;
+        std::string_view TemplatePath() const;
+        std::string_view AuthToken() const;
+        const WireStringPair* CustomHeaders() const;
+        const WireStringPair* Parameters() const;
+
+    private:
+        const uint8_t* data_;
+        size_t size_;
+        bool valid_;
+
+        bool Validate() const;
+    };
+
+} // namespace RainmeterManager::Render
@@ -1,4 +1,5 @@
 #include "shared_memory_manager.h"
+#include "render_wire_format.h"
 #include <sstream>
 #include <algorithm>
 #include <cstring>
@@ -46,7 +47,8 @@ SharedMemoryManager::SharedMemoryManager(const std::wstring& name)
     , mappedView_(nullptr)
     , bufferSize_(0)
     , header_(nullptr)
-    , commandBuffer_(nullptr)
+    , commandRing_(nullptr)
+    , commandRingCapacity_(0)
     , resultBuffer_(nullptr)
     , commandEvent_(nullptr)
     , resultEvent_(nullptr)
@@ -61,24 +63,35 @@ SharedMemoryManager::~SharedMemoryManager()
 
 // ===== BUFFER MANAGEMENT =====
 
-bool SharedMemoryManager::CreateSharedBuffer(size_t bufferSize)
+bool SharedMemoryManager::CreateSharedBuffer(size_t bufferSize, bool requestLargePages)
 {
     if (bufferSize < MIN_BUFFER_SIZE || bufferSize > MAX_BUFFER_SIZE) {
         return false;
     }
-    
+
     try {
         bufferSize_ = bufferSize;
         isServer_ = true;
-        
+        largePagesRequested_ = requestLargePages;
+
         return InitializeBuffer(true);
-        
+
     } catch (const std::exception& e) {
         Cleanup();
         return false;
     }
 }
 
+bool SharedMemoryManager::IsLargePageBacked() const
+{
+    return largePagesActive_;
+}
+
+void SharedMemoryManager::SetPreferredNumaNode(DWORD node)
+{
+    preferredNumaNode_ = node;
+}
+
 bool SharedMemoryManager::ConnectToSharedBuffer()
 {
     try {
@@ -93,7 +106,7 @@ bool SharedMemoryManager::ConnectToSharedBuffer()
 
 bool SharedMemoryManager::IsReady() const
 {
-    return isReady_ && header_ && commandBuffer_ && resultBuffer_;
+    return isReady_ && header_ && commandRing_ && resultBuffer_;
 }
 
 size_t SharedMemoryManager::GetBufferSize() const
@@ -119,7 +132,8 @@ void SharedMemoryManager::Cleanup()
         }
         
         header_ = nullptr;
-        commandBuffer_ = nullptr;
+        commandRing_ = nullptr;
+        commandRingCapacity_ = 0;
         resultBuffer_ = nullptr;
         bufferSize_ = 0;
         
@@ -135,44 +149,44 @@ bool SharedMemoryManager::WriteCommand(const RenderCommand& command)
     if (!IsReady()) {
         return false;
     }
-    
+
     try {
-        // Wait for exclusive access
-        DWORD waitResult = WaitForSingleObject(accessMutex_, 5000);
-        if (waitResult != WAIT_OBJECT_0) {
+        // Encode to the flat wire format in scratch space; the block is then
+        // memcpy'd into the ring in one piece
+        size_t serializedSize = EncodeRenderCommand(command, scratchBuffer_);
+
+        if (serializedSize == 0) {
             return false;
         }
-        
-        // Calculate command buffer size (half of available space minus header)
-        size_t commandBufferSize = (bufferSize_ - sizeof(SharedBufferHeader)) / 2;
-        
-        // Serialize command
-        size_t serializedSize = SerializeCommand(command, commandBuffer_, commandBufferSize);
-        
-        if (serializedSize == 0 || serializedSize > commandBufferSize) {
-            ReleaseMutex(accessMutex_);
+
+        // Lock-free enqueue; only the producer process calls this
+        if (!EnqueueSerialized(scratchBuffer_.data(), serializedSize)) {
             return false;
         }
-        
-        // Update header
-        header_->commandSize = serializedSize;
+
         header_->commandSequence++;
-        header_->commandReady.store(true);
-        
+
         // Update statistics
         UpdateStats(true, serializedSize);
-        
-        ReleaseMutex(accessMutex_);
         return true;
-        
+
     } catch (const std::exception& e) {
-        if (accessMutex_) {
-            ReleaseMutex(accessMutex_);
-        }
         return false;
     }
 }
 
+size_t SharedMemoryManager::WriteCommands(const std::vector<RenderCommand>& commands)
+{
+    size_t written = 0;
+    for (const auto& command : commands) {
+        if (!WriteCommand(command)) {
+            break;
+        }
+        written++;
+    }
+    return written;
+}
+
 bool SharedMemoryManager::ReadResult(RenderResult& result)
 {
     if (!IsReady()) {
@@ -262,42 +276,50 @@ bool SharedMemoryManager::ReadCommand(RenderCommand& command)
     if (!IsReady()) {
         return false;
     }
-    
+
     try {
-        // Wait for exclusive access
-        DWORD waitResult = WaitForSingleObject(accessMutex_, 5000);
-        if (waitResult != WAIT_OBJECT_0) {
+        // Lock-free dequeue; only the consumer process calls this
+        std::vector<uint8_t> record;
+        if (!DequeueSerialized(record)) {
             return false;
         }
-        
-        // Check if command is ready
-        if (!header_->commandReady.load()) {
-            ReleaseMutex(accessMutex_);
-            return false;
-        }
-        
-        // Deserialize command
-        bool success = DeserializeCommand(commandBuffer_, header_->commandSize, command);
-        
+
+        bool success = DecodeRenderCommand(record.data(), record.size(), command);
+
         if (success) {
-            // Mark command as read
-            header_->commandReady.store(false);
-            
             // Update statistics
-            UpdateStats(false, header_->commandSize);
+            UpdateStats(false, record.size());
         }
-        
-        ReleaseMutex(accessMutex_);
+
         return success;
-        
+
     } catch (const std::exception& e) {
-        if (accessMutex_) {
-            ReleaseMutex(accessMutex_);
-        }
         return false;
     }
 }
 
+size_t SharedMemoryManager::DrainCommands(std::vector<RenderCommand>& commands, size_t maxCommands)
+{
+    size_t drained = 0;
+    RenderCommand command;
+    while ((maxCommands == 0 || drained < maxCommands) && ReadCommand(command)) {
+        commands.push_back(std::move(command));
+        command = RenderCommand{};
+        drained++;
+    }
+    return drained;
+}
+
+bool SharedMemoryManager::HasPendingCommands() const
+{
+    if (!IsReady()) {
+        return false;
+    }
+
+    return header_->commandHead.load(std::memory_order_acquire) !=
+           header_->commandTail.load(std::memory_order_acquire);
+}
+
 // ===== SYNCHRONIZATION =====
 
 bool SharedMemoryManager::SignalCommandReady()
@@ -342,18 +364,78 @@ bool SharedMemoryManager::WaitForResult(uint32_t timeoutMs)
 
 SharedMemoryManager::SharedMemoryStats SharedMemoryManager::GetStatistics() const
 {
-    std::lock_guard<std::mutex> lock(statsMutex_);
-    return stats_;
+    // Lazy aggregation across shards; eventually consistent
+    SharedMemoryStats stats;
+    stats.bytesWritten = statCounters_.Sum(STAT_BYTES_WRITTEN);
+    stats.bytesRead = statCounters_.Sum(STAT_BYTES_READ);
+    stats.writeOperations = statCounters_.Sum(STAT_WRITE_OPERATIONS);
+    stats.readOperations = statCounters_.Sum(STAT_READ_OPERATIONS);
+    stats.syncTimeouts = statCounters_.Sum(STAT_SYNC_TIMEOUTS);
+    stats.syncErrors = statCounters_.Sum(STAT_SYNC_ERRORS);
+    return stats;
 }
 
 void SharedMemoryManager::ResetStatistics()
 {
-    std::lock_guard<std::mutex> lock(statsMutex_);
-    stats_ = SharedMemoryStats{};
+    statCounters_.Reset();
 }
 
 // ===== INTERNAL IMPLEMENTATION =====
 
+namespace {
+
+// Large-page mappings need SeLockMemoryPrivilege; enabling it succeeds
+// only when the account has been granted the right (secpol: "Lock
+// pages in memory"). Attempted once per process.
+bool TryEnableLockMemoryPrivilege()
+{
+    static bool attempted = false;
+    static bool enabled = false;
+    if (attempted) {
+        return enabled;
+    }
+    attempted = true;
+
+    HANDLE token = nullptr;
+    if (!OpenProcessToken(GetCurrentProcess(), TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY,
+                          &token)) {
+        return false;
+    }
+
+    TOKEN_PRIVILEGES privileges = {};
+    privileges.PrivilegeCount = 1;
+    privileges.Privileges[0].Attributes = SE_PRIVILEGE_ENABLED;
+    if (LookupPrivilegeValueW(nullptr, SE_LOCK_MEMORY_NAME,
+                              &privileges.Privileges[0].Luid)) {
+        AdjustTokenPrivileges(token, FALSE, &privileges, 0, nullptr, nullptr);
+        // AdjustTokenPrivileges succeeds even when nothing was granted
+        enabled = GetLastError() == ERROR_SUCCESS;
+    }
+    CloseHandle(token);
+    return enabled;
+}
+
+} // namespace
+
+// Node of the thread creating the buffer; the render pipeline creates
+// each surface's buffer from the thread that will fill it, so this is
+// the locality the consumer wants
+DWORD SharedMemoryManager::NumaNodeOfCallingThread()
+{
+    ULONG highestNode = 0;
+    if (!GetNumaHighestNodeNumber(&highestNode) || highestNode == 0) {
+        return NUMA_NO_PREFERRED_NODE;  // single node: let the kernel place it
+    }
+
+    PROCESSOR_NUMBER processor = {};
+    GetCurrentProcessorNumberEx(&processor);
+    USHORT node = 0;
+    if (!GetNumaProcessorNodeEx(&processor, &node)) {
+        return NUMA_NO_PREFERRED_NODE;
+    }
+    return node;
+}
+
 bool SharedMemoryManager::InitializeBuffer(bool createNew)
 {
     try {
@@ -362,22 +444,60 @@ bool SharedMemoryManager::InitializeBuffer(bool createNew)
         DWORD access = createNew ? FILE_MAP_ALL_ACCESS : FILE_MAP_ALL_ACCESS;
         
         if (createNew) {
-            // Server creates the mapping
-            fileMapping_ = CreateFileMapping(
-                INVALID_HANDLE_VALUE,
-                nullptr,
-                protection,
-                0,
-                static_cast<DWORD>(bufferSize_),
-                bufferName_.c_str()
-            );
-            
-            if (!fileMapping_ || GetLastError() == ERROR_ALREADY_EXISTS) {
-                if (fileMapping_) {
-                    CloseHandle(fileMapping_);
-                    fileMapping_ = nullptr;
+            DWORD numaNode = preferredNumaNode_ != NUMA_NO_PREFERRED_NODE
+                ? preferredNumaNode_
+                : NumaNodeOfCallingThread();
+
+            // Large-page attempt first: fewer TLB misses on the big
+            // frame copies, but needs the lock-memory privilege and
+            // contiguous physical memory, so fall back gracefully
+            largePagesActive_ = false;
+            if (largePagesRequested_ && TryEnableLockMemoryPrivilege()) {
+                size_t largePage = GetLargePageMinimum();
+                if (largePage != 0) {
+                    size_t rounded = (bufferSize_ + largePage - 1) & ~(largePage - 1);
+                    fileMapping_ = CreateFileMappingNuma(
+                        INVALID_HANDLE_VALUE,
+                        nullptr,
+                        protection | SEC_COMMIT | SEC_LARGE_PAGES,
+                        0,
+                        static_cast<DWORD>(rounded),
+                        bufferName_.c_str(),
+                        numaNode
+                    );
+                    if (fileMapping_ && GetLastError() == ERROR_ALREADY_EXISTS) {
+                        // Name collision is a hard failure, not a
+                        // reason to retry with small pages
+                        CloseHandle(fileMapping_);
+                        fileMapping_ = nullptr;
+                        return false;
+                    }
+                    if (fileMapping_) {
+                        bufferSize_ = rounded;
+                        largePagesActive_ = true;
+                    }
+                }
+            }
+
+            if (!fileMapping_) {
+                // Server creates the mapping (default granularity)
+                fileMapping_ = CreateFileMappingNuma(
+                    INVALID_HANDLE_VALUE,
+                    nullptr,
+                    protection,
+                    0,
+                    static_cast<DWORD>(bufferSize_),
+                    bufferName_.c_str(),
+                    numaNode
+                );
+
+                if (!fileMapping_ || GetLastError() == ERROR_ALREADY_EXISTS) {
+                    if (fileMapping_) {
+                        CloseHandle(fileMapping_);
+                        fileMapping_ = nullptr;
+                    }
+                    return false;
                 }
-                return false;
             }
         } else {
             // Client opens existing mapping
@@ -419,21 +539,26 @@ bool SharedMemoryManager::InitializeBuffer(bool createNew)
         header_ = reinterpret_cast<SharedBufferHeader*>(mappedView_);
         uint8_t* dataStart = reinterpret_cast<uint8_t*>(mappedView_) + sizeof(SharedBufferHeader);
         size_t dataSize = bufferSize_ - sizeof(SharedBufferHeader);
-        
-        commandBuffer_ = dataStart;
+
+        commandRing_ = dataStart;
         resultBuffer_ = dataStart + (dataSize / 2);
-        
+
         // Initialize header if creating new
         if (createNew) {
             header_->magic = BUFFER_MAGIC;
             header_->version = PROTOCOL_VERSION;
-            header_->commandSize = 0;
+            // Command ring takes the first half of the data region,
+            // aligned down to the record alignment
+            header_->commandRingCapacity = (dataSize / 2) & ~(RING_RECORD_ALIGNMENT - 1);
             header_->resultSize = 0;
-            header_->commandReady.store(false);
             header_->resultReady.store(false);
             header_->commandSequence = 0;
             header_->resultSequence = 0;
+            header_->commandHead.store(0);
+            header_->commandTail.store(0);
         }
+
+        commandRingCapacity_ = static_cast<size_t>(header_->commandRingCapacity);
         
         // Validate buffer
         if (!ValidateBuffer()) {
@@ -503,124 +628,107 @@ bool SharedMemoryManager::ValidateBuffer() const
     if (!header_) {
         return false;
     }
-    
-    return header_->magic == BUFFER_MAGIC && 
+
+    return header_->magic == BUFFER_MAGIC &&
            header_->version == PROTOCOL_VERSION &&
            bufferSize_ >= MIN_BUFFER_SIZE &&
-           bufferSize_ <= MAX_BUFFER_SIZE;
+           bufferSize_ <= MAX_BUFFER_SIZE &&
+           header_->commandRingCapacity > 0 &&
+           header_->commandRingCapacity <= bufferSize_ - sizeof(SharedBufferHeader);
+}
+
+// ===== RING BUFFER PRIMITIVES =====
+
+namespace {
+    constexpr size_t AlignRecord(size_t size, size_t alignment) {
+        return (size + alignment - 1) & ~(alignment - 1);
+    }
 }
 
-size_t SharedMemoryManager::SerializeCommand(const RenderCommand& command, uint8_t* buffer, size_t bufferSize)
+bool SharedMemoryManager::EnqueueSerialized(const uint8_t* data, size_t size)
 {
-    try {
-        uint8_t* originalBuffer = buffer;
-        uint8_t* bufferEnd = buffer + bufferSize;
-        
-        // Check if we have enough space for basic fields
-        if (buffer + sizeof(command.commandId) + sizeof(command.commandType) + 
-            sizeof(command.widgetId) > bufferEnd) {
-            return 0;
-        }
-        
-        // Serialize basic fields
-        SerializeValue(buffer, command.commandId);
-        SerializeValue(buffer, command.commandType);
-        SerializeValue(buffer, command.widgetId);
-        SerializeValue(buffer, command.windowHandle);
-        SerializeValue(buffer, command.backendType);
-        SerializeValue(buffer, command.bounds);
-        SerializeValue(buffer, command.timestamp);
-        
-        // Serialize content parameters
-        SerializeValue(buffer, command.content.sourceType);
-        SerializeString(buffer, command.content.sourceUrl);
-        SerializeString(buffer, command.content.templatePath);
-        SerializeString(buffer, command.content.authToken);
-        SerializeValue(buffer, command.content.refreshIntervalMs);
-        SerializeValue(buffer, command.content.cacheEnabled);
-        
-        // Serialize custom headers
-        uint32_t headerCount = static_cast<uint32_t>(command.content.customHeaders.size());
-        SerializeValue(buffer, headerCount);
-        for (const auto& header : command.content.customHeaders) {
-            SerializeString(buffer, header.first);
-            SerializeString(buffer, header.second);
+    const uint64_t capacity = commandRingCapacity_;
+    const size_t stride = AlignRecord(sizeof(uint32_t) + size, RING_RECORD_ALIGNMENT);
+
+    // A record must always leave the ring distinguishable from empty
+    if (stride + RING_RECORD_ALIGNMENT >= capacity) {
+        return false;
+    }
+
+    const uint64_t head = header_->commandHead.load(std::memory_order_acquire);
+    const uint64_t tail = header_->commandTail.load(std::memory_order_relaxed);
+
+    uint8_t* slot = nullptr;
+    uint64_t newTail = 0;
+
+    if (tail >= head) {
+        // Free space is [tail, capacity) plus [0, head)
+        if (capacity - tail >= stride && (tail + stride) % capacity != head) {
+            slot = commandRing_ + tail;
+            newTail = (tail + stride) % capacity;
+        } else if (head > stride) {
+            // Record does not fit before the end: mark the wrap (if there is
+            // room for a marker) and place the record at the ring start
+            if (capacity - tail >= sizeof(uint32_t)) {
+                *reinterpret_cast<uint32_t*>(commandRing_ + tail) = RING_WRAP_MARKER;
+            }
+            slot = commandRing_;
+            newTail = stride;
+        } else {
+            return false; // Ring full
         }
-        
-        // Serialize parameters
-        uint32_t paramCount = static_cast<uint32_t>(command.content.parameters.size());
-        SerializeValue(buffer, paramCount);
-        for (const auto& param : command.content.parameters) {
-            SerializeString(buffer, param.first);
-            SerializeString(buffer, param.second);
+    } else {
+        // Free space is the contiguous gap [tail, head)
+        if (head - tail > stride) {
+            slot = commandRing_ + tail;
+            newTail = tail + stride;
+        } else {
+            return false; // Ring full
         }
-        
-        // Serialize render properties
-        SerializeValue(buffer, command.properties);
-        
-        return buffer - originalBuffer;
-        
-    } catch (const std::exception& e) {
-        return 0;
     }
+
+    *reinterpret_cast<uint32_t*>(slot) = static_cast<uint32_t>(size);
+    memcpy(slot + sizeof(uint32_t), data, size);
+
+    // Publish the record to the consumer
+    header_->commandTail.store(newTail, std::memory_order_release);
+    return true;
 }
 
-bool SharedMemoryManager::DeserializeCommand(const uint8_t* buffer, size_t bufferSize, RenderCommand& command)
+bool SharedMemoryManager::DequeueSerialized(std::vector<uint8_t>& record)
 {
-    try {
-        const uint8_t* bufferEnd = buffer + bufferSize;
-        
-        // Deserialize basic fields
-        DeserializeValue(buffer, command.commandId);
-        DeserializeValue(buffer, command.commandType);
-        DeserializeValue(buffer, command.widgetId);
-        DeserializeValue(buffer, command.windowHandle);
-        DeserializeValue(buffer, command.backendType);
-        DeserializeValue(buffer, command.bounds);
-        DeserializeValue(buffer, command.timestamp);
-        
-        // Deserialize content parameters
-        DeserializeValue(buffer, command.content.sourceType);
-        DeserializeString(buffer, command.content.sourceUrl);
-        DeserializeString(buffer, command.content.templatePath);
-        DeserializeString(buffer, command.content.authToken);
-        DeserializeValue(buffer, command.content.refreshIntervalMs);
-        DeserializeValue(buffer, command.content.cacheEnabled);
-        
-        // Deserialize custom headers
-        uint32_t headerCount;
-        DeserializeValue(buffer, headerCount);
-        command.content.customHeaders.clear();
-        command.content.customHeaders.reserve(headerCount);
-        
-        for (uint32_t i = 0; i < headerCount; ++i) {
-            std::string key, value;
-            DeserializeString(buffer, key);
-            DeserializeString(buffer, value);
-            command.content.customHeaders.emplace_back(std::move(key), std::move(value));
-        }
-        
-        // Deserialize parameters
-        uint32_t paramCount;
-        DeserializeValue(buffer, paramCount);
-        command.content.parameters.clear();
-        command.content.parameters.reserve(paramCount);
-        
-        for (uint32_t i = 0; i < paramCount; ++i) {
-            std::string key, value;
-            DeserializeString(buffer, key);
-            DeserializeString(buffer, value);
-            command.content.parameters.emplace_back(std::move(key), std::move(value));
+    const uint64_t capacity = commandRingCapacity_;
+    const uint64_t tail = header_->commandTail.load(std::memory_order_acquire);
+    uint64_t head = header_->commandHead.load(std::memory_order_relaxed);
+
+    if (head == tail) {
+        return false; // Ring empty
+    }
+
+    // Implicit wrap when there is not even room for a length field,
+    // explicit wrap when the producer left a marker
+    if (capacity - head < sizeof(uint32_t) ||
+        *reinterpret_cast<const uint32_t*>(commandRing_ + head) == RING_WRAP_MARKER) {
+        head = 0;
+        if (head == tail) {
+            header_->commandHead.store(head, std::memory_order_release);
+            return false;
         }
-        
-        // Deserialize render properties
-        DeserializeValue(buffer, command.properties);
-        
-        return buffer <= bufferEnd;
-        
-    } catch (const std::exception& e) {
-        return false;
     }
+
+    const uint32_t size = *reinterpret_cast<const uint32_t*>(commandRing_ + head);
+    if (size > capacity - head - sizeof(uint32_t)) {
+        return false; // Corrupt record; leave the ring untouched
+    }
+
+    record.assign(commandRing_ + head + sizeof(uint32_t),
+                  commandRing_ + head + sizeof(uint32_t) + size);
+
+    head = (head + AlignRecord(sizeof(uint32_t) + size, RING_RECORD_ALIGNMENT)) % capacity;
+
+    // Release the consumed space back to the producer
+    header_->commandHead.store(head, std::memory_order_release);
+    return true;
 }
 
 size_t SharedMemoryManager::SerializeResult(const RenderResult& result, uint8_t* buffer, size_t bufferSize)
@@ -682,13 +790,11 @@ std::wstring SharedMemoryManager::GetEventName(const std::wstring& suffix) const
 
 void SharedMemoryManager::UpdateStats(bool isWrite, size_t bytes)
 {
-    std::lock_guard<std::mutex> lock(statsMutex_);
-    
     if (isWrite) {
-        stats_.bytesWritten += bytes;
-        stats_.writeOperations++;
+        statCounters_.Add(STAT_BYTES_WRITTEN, bytes);
+        statCounters_.Add(STAT_WRITE_OPERATIONS);
     } else {
-        stats_.bytesRead += bytes;
-        stats_.readOperations++;
+        statCounters_.Add(STAT_BYTES_READ, bytes);
+        statCounters_.Add(STAT_READ_OPERATIONS);
     }
 }
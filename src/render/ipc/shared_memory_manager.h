@@ -1,11 +1,13 @@
 #pragma once
 
 #include "../interfaces/render_command.h"
+#include "../../core/sharded_counter.h"
 #include <windows.h>
 #include <string>
 #include <memory>
 #include <mutex>
 #include <atomic>
+#include <vector>
 
 namespace RainmeterManager::Render {
 
@@ -24,10 +26,22 @@ namespace RainmeterManager::Render {
         
         /**
          * @brief Create shared memory buffer
-         * @param bufferSize Size of buffer in bytes
+         *
+         * Multi-MB pixel-transport buffers benefit from large-page
+         * backing (fewer TLB misses on bandwidth-bound frame copies);
+         * when requested the mapping is created with SEC_LARGE_PAGES
+         * and falls back to default granularity if the privilege or
+         * contiguous memory is unavailable. On multi-node machines the
+         * mapping prefers the NUMA node of the creating thread (or the
+         * node set via SetPreferredNumaNode) so the consumer reads
+         * local memory.
+         *
+         * @param bufferSize Size of buffer in bytes (rounded up to the
+         *        large-page minimum when large pages engage)
+         * @param requestLargePages Attempt SEC_LARGE_PAGES backing
          * @return True if buffer creation succeeded
          */
-        bool CreateSharedBuffer(size_t bufferSize);
+        bool CreateSharedBuffer(size_t bufferSize, bool requestLargePages = false);
         
         /**
          * @brief Connect to existing shared memory buffer
@@ -40,6 +54,29 @@ namespace RainmeterManager::Render {
          * @return True if ready for read/write operations
          */
         bool IsReady() const;
+
+        /**
+         * @brief Whether the mapping actually got large-page backing
+         * (false after a graceful fallback)
+         */
+        bool IsLargePageBacked() const;
+
+        /**
+         * @brief Pin the mapping to a NUMA node before CreateSharedBuffer
+         *
+         * Defaults to the node of the thread that creates the buffer;
+         * callers that know the consuming thread's node set it here.
+         */
+        void SetPreferredNumaNode(DWORD node);
+
+        /**
+         * @brief NUMA node the calling thread runs on, or
+         * NUMA_NO_PREFERRED_NODE on single-node machines
+         *
+         * Shared with FrameSurfacePool so per-surface mappings get the
+         * same placement policy as the command buffer.
+         */
+        static DWORD NumaNodeOfCallingThread();
         
         /**
          * @brief Get buffer size
@@ -53,14 +90,27 @@ namespace RainmeterManager::Render {
         void Cleanup();
 
         // === Communication ===
-        
+
         /**
-         * @brief Write command to shared memory
-         * @param command Command to write
-         * @return True if write succeeded
+         * @brief Enqueue command into the shared SPSC ring buffer
+         *
+         * Commands are appended lock-free; the consumer drains them in
+         * batches, so many commands per frame share a single wakeup.
+         * @param command Command to enqueue
+         * @return True if the command fit into the ring
          */
         bool WriteCommand(const RenderCommand& command);
-        
+
+        /**
+         * @brief Enqueue a batch of commands into the ring buffer
+         *
+         * All-or-nothing per command: enqueues as many as fit, in order.
+         * Callers should signal once after the batch, not per command.
+         * @param commands Commands to enqueue
+         * @return Number of commands successfully enqueued
+         */
+        size_t WriteCommands(const std::vector<RenderCommand>& commands);
+
         /**
          * @brief Read result from shared memory
          * @param result Output result structure
@@ -76,12 +126,26 @@ namespace RainmeterManager::Render {
         bool WriteResult(const RenderResult& result);
         
         /**
-         * @brief Read command from shared memory (for C# process)
+         * @brief Dequeue one command from the ring buffer (for C# process)
          * @param command Output command structure
-         * @return True if read succeeded
+         * @return True if a command was dequeued
          */
         bool ReadCommand(RenderCommand& command);
 
+        /**
+         * @brief Drain all pending commands from the ring buffer (for C# process)
+         * @param commands Output vector; drained commands are appended
+         * @param maxCommands Maximum number of commands to drain (0 = unlimited)
+         * @return Number of commands drained
+         */
+        size_t DrainCommands(std::vector<RenderCommand>& commands, size_t maxCommands = 0);
+
+        /**
+         * @brief Check whether the command ring has unread entries
+         * @return True if at least one command is pending
+         */
+        bool HasPendingCommands() const;
+
         // === Synchronization ===
         
         /**
@@ -136,14 +200,19 @@ namespace RainmeterManager::Render {
         // === Internal Structures ===
         
         struct SharedBufferHeader {
-            uint32_t magic;           // Magic number for validation
-            uint32_t version;         // Protocol version
-            uint64_t commandSize;     // Size of command data
-            uint64_t resultSize;      // Size of result data
-            std::atomic<bool> commandReady;
+            uint32_t magic;              // Magic number for validation
+            uint32_t version;            // Protocol version
+            uint64_t commandRingCapacity; // Capacity of the command ring in bytes
+            uint64_t resultSize;         // Size of result data
             std::atomic<bool> resultReady;
-            uint64_t commandSequence; // Sequence number for commands
-            uint64_t resultSequence;  // Sequence number for results
+            uint64_t commandSequence;    // Count of commands enqueued by producer
+            uint64_t resultSequence;     // Sequence number for results
+
+            // SPSC ring indices. Head is owned by the consumer, tail by the
+            // producer; they live on separate cache lines to avoid false
+            // sharing between the two processes.
+            alignas(64) std::atomic<uint64_t> commandHead;
+            alignas(64) std::atomic<uint64_t> commandTail;
         };
 
         // === Member Variables ===
@@ -152,8 +221,12 @@ namespace RainmeterManager::Render {
         void* mappedView_;
         size_t bufferSize_;
         SharedBufferHeader* header_;
-        uint8_t* commandBuffer_;
+        uint8_t* commandRing_;
+        size_t commandRingCapacity_;
         uint8_t* resultBuffer_;
+
+        // Producer-side scratch space for serializing before the ring copy
+        std::vector<uint8_t> scratchBuffer_;
         
         // Synchronization objects
         HANDLE commandEvent_;
@@ -163,24 +236,39 @@ namespace RainmeterManager::Render {
         // State
         std::atomic<bool> isReady_{false};
         std::atomic<bool> isServer_{false};
+        bool largePagesRequested_ = false;
+        bool largePagesActive_ = false;
+        DWORD preferredNumaNode_ = NUMA_NO_PREFERRED_NODE;
         
-        // Statistics
-        mutable std::mutex statsMutex_;
-        SharedMemoryStats stats_;
-        
+        // Statistics: per-thread sharded counters so the ring read/write
+        // paths pay one relaxed fetch_add instead of a mutex; aggregated
+        // lazily in GetStatistics
+        enum StatCounter : size_t {
+            STAT_BYTES_WRITTEN = 0,
+            STAT_BYTES_READ,
+            STAT_WRITE_OPERATIONS,
+            STAT_READ_OPERATIONS,
+            STAT_SYNC_TIMEOUTS,
+            STAT_SYNC_ERRORS,
+            STAT_COUNT
+        };
+        Core::ShardedCounters<STAT_COUNT> statCounters_;
+
         // Constants
         static constexpr uint32_t BUFFER_MAGIC = 0x524D5348; // 'RMSH'
-        static constexpr uint32_t PROTOCOL_VERSION = 1;
+        static constexpr uint32_t PROTOCOL_VERSION = 3; // v3: flat wire-format commands
         static constexpr size_t MIN_BUFFER_SIZE = 64 * 1024;  // 64KB
         static constexpr size_t MAX_BUFFER_SIZE = 16 * 1024 * 1024; // 16MB
+        static constexpr uint32_t RING_WRAP_MARKER = 0xFFFFFFFF;
+        static constexpr size_t RING_RECORD_ALIGNMENT = 8;
 
         // === Internal Methods ===
         bool InitializeBuffer(bool createNew);
+        bool EnqueueSerialized(const uint8_t* data, size_t size);
+        bool DequeueSerialized(std::vector<uint8_t>& record);
         bool SetupSynchronization();
         void CleanupSynchronization();
         bool ValidateBuffer() const;
-        size_t SerializeCommand(const RenderCommand& command, uint8_t* buffer, size_t bufferSize);
-        bool DeserializeCommand(const uint8_t* buffer, size_t bufferSize, RenderCommand& command);
         size_t SerializeResult(const RenderResult& result, uint8_t* buffer, size_t bufferSize);
         bool DeserializeResult(const uint8_t* buffer, size_t bufferSize, RenderResult& result);
         std::wstring GetEventName(const std::wstring& suffix) const;
@@ -10,6 +10,7 @@
 #include <functional>
 #include <unordered_map>
 #include <atomic>
+#include <utility>
 
 namespace RainmeterManager::Render {
 
@@ -52,6 +53,11 @@ namespace RainmeterManager::Render {
         
         /**
          * @brief Refresh monitor information
+         *
+         * Re-enumerates displays and DPI, then publishes the result as a
+         * new topology snapshot (see RebuildTopologySnapshot). Only called
+         * from Initialize and the HandleDisplayChange/HandleDPIChange event
+         * path — query methods never trigger enumeration themselves.
          * @return True if refresh succeeded
          */
         bool RefreshMonitors();
@@ -100,6 +106,9 @@ namespace RainmeterManager::Render {
         
         /**
          * @brief Get DPI for monitor
+         *
+         * Served from the cached topology snapshot; safe to call at drag
+         * frequency from the UI thread without hitting the DPI APIs.
          * @param monitorId Monitor identifier
          * @param dpiX Output DPI X value
          * @param dpiY Output DPI Y value
@@ -206,8 +215,26 @@ namespace RainmeterManager::Render {
          */
         bool MaximizeWindowToMonitor(HWND windowHandle, int monitorId);
         
+        /**
+         * @brief Reposition several windows in one deferred batch
+         *
+         * The HandleDisplayChange path gathers the new bounds for every
+         * affected window and commits them through one
+         * BeginDeferWindowPos/EndDeferWindowPos batch (see
+         * SurfaceLayoutTransaction), so a monitor hot-plug or DPI change
+         * is a single compositor transaction instead of a sequential
+         * per-window cascade of repaints.
+         * @param layout Target bounds per window, in screen coordinates
+         * @return True if every window was repositioned
+         */
+        bool ApplyWindowLayout(const std::vector<std::pair<HWND, RenderRect>>& layout);
+
         /**
          * @brief Get optimal monitor for window
+         *
+         * Resolves the window rect against the cached topology snapshot
+         * rather than re-enumerating, so repeated calls during a window
+         * drag stay off the display APIs entirely.
          * @param windowHandle Window handle
          * @param preferPrimary Prefer primary monitor
          * @return Recommended monitor ID
@@ -236,13 +263,18 @@ namespace RainmeterManager::Render {
         
         /**
          * @brief Handle Windows display change message
+         *
+         * The only path (besides Initialize) that invalidates and rebuilds
+         * the cached topology snapshot.
          * @param wParam Message wParam
          * @param lParam Message lParam
          */
         void HandleDisplayChange(WPARAM wParam, LPARAM lParam);
-        
+
         /**
          * @brief Handle Windows DPI change message
+         *
+         * Republishes the topology snapshot with the updated DPI values.
          * @param windowHandle Affected window
          * @param wParam Message wParam
          * @param lParam Message lParam
@@ -329,6 +361,38 @@ namespace RainmeterManager::Render {
             UINT_PTR changeTimer;
         };
 
+        /**
+         * @brief Flattened per-monitor entry in the topology snapshot
+         *
+         * Everything the hot query paths need, copied out of MonitorData
+         * at publish time so reads never touch the live enumeration state.
+         */
+        struct TopologyEntry {
+            MonitorInfo info;
+            HMONITOR hMonitor;
+            float dpiX;
+            float dpiY;
+            float dpiScaling;
+            int refreshRate;
+        };
+
+        /**
+         * @brief Always-valid cached monitor topology
+         *
+         * Published under a seqlock: the writer bumps topologySequence_ to
+         * an odd value, swaps the snapshot in, then bumps it even; readers
+         * retry if the sequence was odd or changed across the copy. Query
+         * methods (GetMonitorDPI, GetMonitorFromPoint, GetOptimal-
+         * MonitorForWindow, ...) only ever read this snapshot, so window
+         * drags never re-enumerate displays on the UI thread.
+         */
+        struct TopologySnapshot {
+            std::vector<TopologyEntry> entries;
+            int primaryMonitorId;
+            RenderRect virtualBounds;
+            uint64_t version;
+        };
+
         // === Member Variables ===
         
         // Core components
@@ -338,6 +402,10 @@ namespace RainmeterManager::Render {
         std::vector<std::unique_ptr<MonitorData>> monitors_;
         mutable std::shared_mutex monitorsMutex_;
         std::atomic<bool> initialized_{false};
+
+        // Cached topology (seqlock; writer side serialized by monitorsMutex_)
+        TopologySnapshot topology_;
+        mutable std::atomic<uint32_t> topologySequence_{0};
         
         // Change detection
         MonitorChangeData changeData_;
@@ -388,6 +456,12 @@ namespace RainmeterManager::Render {
         bool CompareMonitorSets(const std::vector<MonitorInfo>& set1, 
                                const std::vector<MonitorInfo>& set2) const;
         
+        // Topology snapshot (seqlock)
+        void RebuildTopologySnapshot();      // Writer: odd seq, copy, even seq
+        TopologySnapshot ReadTopologySnapshot() const;  // Reader: retry loop
+        const TopologyEntry* FindTopologyEntry(const TopologySnapshot& snapshot,
+                                               int monitorId) const;
+
         // DPI management
         bool UpdateDPICache();
         float CalculateDPIScaling(float dpi) const;
@@ -2,10 +2,13 @@
 
 #include "../interfaces/render_command.h"
 #include "../interfaces/irender_backend_proxy.h"
+#include "../interfaces/frame_arena.h"
 #include "../render_process_launcher.h"
+#include "../render_process_standby_pool.h"
 #include "../ipc/render_ipc_bridge.h"
 #include "monitor_manager.h"
 #include "../../core/service_locator.h"
+#include "../../core/power_governor.h"
 #include "../../config/config_manager.h"
 #include <memory>
 #include <unordered_map>
@@ -110,6 +113,11 @@ namespace RainmeterManager::Render {
         
         /**
          * @brief Render content for specific widget
+         *
+         * The request is queued on the frame scheduler rather than sent
+         * immediately; it goes out in the coalesced batch for the next
+         * vsync tick the widget is due on (see FrameSchedulerLoop). The
+         * returned future completes when that batch's result arrives.
          * @param widgetId Widget identifier
          * @param content Content parameters
          * @param properties Render properties
@@ -185,6 +193,12 @@ namespace RainmeterManager::Render {
         
         /**
          * @brief Process pending render commands
+         *
+         * Drains non-frame commands (create/destroy/resize) as they
+         * arrive. Frame renders are NOT drained here — they are held on
+         * the frame scheduler and submitted one coalesced batch per
+         * vsync tick, so N widgets no longer produce N scattered IPC
+         * wakeups per frame.
          * Call this from main message loop for optimal performance
          */
         void ProcessPendingCommands();
@@ -197,13 +211,32 @@ namespace RainmeterManager::Render {
         
         /**
          * @brief Get performance metrics for specific widget
+         *
+         * The latency fields (submitToComplete, ipcRoundTrip, frameRender)
+         * are percentiles extracted from the widget's histograms at call
+         * time, covering everything aggregated up to the last epoch flip.
          * @param widgetId Widget identifier
          * @return Widget-specific performance metrics
          */
         PerformanceMetrics GetWidgetPerformanceMetrics(uint32_t widgetId) const;
-        
+
+        /**
+         * @brief Get the IPC bridge for diagnostics access
+         *
+         * Exposed for the latency-trace dump in the render_core_test
+         * harness and diagnostic tooling; command submission still goes
+         * through the coordinator's queue, not directly via the bridge.
+         * @return Bridge pointer (nullptr before Initialize)
+         */
+        std::shared_ptr<RenderIPCBridge> GetIPCBridge() const;
+
         /**
          * @brief Enable performance profiling
+         *
+         * While enabled, the hot paths record latencies into thread-local
+         * histograms (one relaxed increment each, no locks); the profiling
+         * thread folds them into per-widget aggregates every intervalMs
+         * via an epoch flip (see LatencyHistogram).
          * @param enabled True to enable profiling
          * @param intervalMs Profiling update interval
          */
@@ -272,8 +305,54 @@ namespace RainmeterManager::Render {
          */
         bool MoveWidgetToMonitor(uint32_t widgetId, int monitorId);
 
+        // === Visibility & Occlusion Culling ===
+
+        /**
+         * @brief Report a widget window's occlusion state
+         *
+         * Wired to the window procedure's DWM cloak/occlusion
+         * notifications. While a widget's window is fully occluded
+         * (covered by other windows, on an inactive virtual desktop) the
+         * frame scheduler stops submitting RenderWidgetAsync batches and
+         * content refreshes for it; when the window becomes visible
+         * again the widget is forced due on the next tick with a full
+         * redraw, so stale pixels never flash.
+         * @param windowHandle Widget window whose occlusion changed
+         * @param occluded True if the window is now fully occluded
+         */
+        void HandleWindowOcclusion(HWND windowHandle, bool occluded);
+
+        /**
+         * @brief Report a full-screen app taking over a monitor
+         *
+         * Suspends frame submission for every widget whose bounds lie on
+         * that monitor — with a full-screen game running the render
+         * process should idle near zero CPU. Resuming forces a redraw.
+         * @param monitorId Monitor covered (or released), per MonitorManager
+         * @param fullScreenActive True while a full-screen app covers it
+         */
+        void HandleFullScreenChange(int monitorId, bool fullScreenActive);
+
+        /**
+         * @brief Report a monitor powering off or on
+         *
+         * Driven by the power-broadcast path alongside MonitorManager's
+         * display-change handling. Widgets on a powered-off monitor are
+         * suspended exactly like occluded ones.
+         * @param monitorId Affected monitor, per MonitorManager
+         * @param poweredOn True when the monitor is powered on
+         */
+        void HandleMonitorPowerChange(int monitorId, bool poweredOn);
+
+        /**
+         * @brief Whether the scheduler is currently culling a widget
+         * @param widgetId Widget identifier
+         * @return True if frame submission is suspended for the widget
+         */
+        bool IsWidgetRenderSuspended(uint32_t widgetId) const;
+
         // === Advanced Features ===
-        
+
         /**
          * @brief Capture widget frame to file
          * @param widgetId Widget identifier
@@ -354,6 +433,50 @@ namespace RainmeterManager::Render {
             bool enableProfiling = true;
             uint32_t profileIntervalMs = 1000;
             bool enableDebugLogging = false;
+            bool vsyncAlignedScheduling = true;   // Coalesce frame renders per compositor tick
+            uint32_t schedulerFallbackHz = 60;    // Tick rate when vsync wait is unavailable
+        };
+
+        /**
+         * @brief One queued frame render awaiting the next scheduler tick
+         *
+         * Holds the promise backing the future handed out by
+         * RenderWidgetAsync; fulfilled when the batch result for the
+         * tick comes back over IPC.
+         */
+        struct PendingFrameRequest {
+            uint32_t widgetId;
+            ContentParameters content;
+            RenderProperties properties;
+            std::promise<RenderResult> promise;
+            std::chrono::steady_clock::time_point submitTime;
+        };
+
+        /**
+         * @brief Log-bucketed latency histogram (HDR-style)
+         *
+         * 48 power-of-two microsecond buckets cover 1us to ~3.3 days with
+         * bounded relative error. Recording is a single relaxed atomic
+         * increment on the calling thread's local instance; the profiling
+         * thread flips profilingEpoch_ and folds the thread-local
+         * histograms of the retired epoch into the per-widget aggregates,
+         * so the render hot path never takes a lock or shares a cache
+         * line with other recorders.
+         */
+        struct LatencyHistogram {
+            static constexpr size_t BUCKET_COUNT = 48;
+            std::atomic<uint64_t> buckets[BUCKET_COUNT];
+
+            void Record(uint64_t micros);           // Relaxed increment, hot path
+            void MergeInto(LatencyHistogram& target) const;
+            LatencyPercentiles ExtractPercentiles() const;
+            void Reset();
+        };
+
+        struct WidgetHistograms {
+            LatencyHistogram submitToComplete;
+            LatencyHistogram ipcRoundTrip;
+            LatencyHistogram frameRender;
         };
 
         // === Member Variables ===
@@ -361,6 +484,7 @@ namespace RainmeterManager::Render {
         // Core components
         std::shared_ptr<RenderIPCBridge> ipcBridge_;
         std::unique_ptr<MonitorManager> monitorManager_;
+        std::unique_ptr<RenderProcessStandbyPool> standbyPool_;
         Core::ServiceLocator& serviceLocator_;
         Config::ConfigManager& configManager_;
         Core::Logger& logger_;
@@ -375,6 +499,16 @@ namespace RainmeterManager::Render {
         std::thread maintenanceThread_;
         std::atomic<bool> isRunning_{false};
         std::atomic<bool> shouldStop_{false};
+
+        // Frame scheduler (vsync-aligned batch submission)
+        std::thread frameSchedulerThread_;
+        std::vector<PendingFrameRequest> frameQueue_;
+        mutable std::mutex frameQueueMutex_;
+        std::unordered_map<uint32_t, uint64_t> widgetLastTick_;  // Per-widget skip bookkeeping
+        std::atomic<uint64_t> schedulerTick_{0};
+        // Per-tick command construction arena: the batch is built here,
+        // serialized, and the arena reset once the batch completes
+        FrameArena frameArena_;
         
         // Configuration
         RenderConfig config_;
@@ -386,6 +520,11 @@ namespace RainmeterManager::Render {
         std::atomic<uint32_t> profilingInterval_{1000};
         mutable std::mutex performanceMutex_;
         PerformanceMetrics overallMetrics_;
+
+        // Latency histograms (aggregation side; recording is thread-local)
+        std::unordered_map<uint32_t, std::unique_ptr<WidgetHistograms>> widgetHistograms_;
+        mutable std::shared_mutex histogramMutex_;
+        std::atomic<uint32_t> profilingEpoch_{0};
         
         // Event callbacks
         RenderReadyCallback renderReadyCallback_;
@@ -404,6 +543,32 @@ namespace RainmeterManager::Render {
             std::chrono::steady_clock::time_point startTime;
         } stats_;
         
+        /**
+         * @brief Why a widget's frame submission is suspended
+         *
+         * Bit flags so independent causes stack (an occluded window on a
+         * powered-off monitor); the widget resumes only once every
+         * reason clears.
+         */
+        enum VisibilitySuspendReason : uint32_t {
+            SUSPEND_NONE        = 0,
+            SUSPEND_OCCLUDED    = 1u << 0,  // Window fully occluded / cloaked
+            SUSPEND_FULLSCREEN  = 1u << 1,  // Full-screen app covers the monitor
+            SUSPEND_MONITOR_OFF = 1u << 2   // Monitor powered off
+        };
+
+        struct VisibilityState {
+            uint32_t suspendReasons = SUSPEND_NONE;
+            bool redrawPending = false;  // Forced full redraw queued for resume
+        };
+
+        // Visibility tracking for render culling. Suspended widgets are
+        // never due in IsWidgetDueThisTick — their queued frame requests
+        // stay parked on the scheduler, so an invisible widget costs no
+        // IPC batches and no render-process work.
+        std::unordered_map<uint32_t, VisibilityState> visibilityStates_;
+        mutable std::shared_mutex visibilityMutex_;
+
         // Advanced features
         std::atomic<bool> debugRenderingEnabled_{false};
         std::unordered_map<uint32_t, bool> recordingWidgets_;
@@ -430,16 +595,51 @@ namespace RainmeterManager::Render {
         void MaintenanceLoop();
         void UpdatePerformanceMetrics();
         void PerformMaintenance();
+
+        // Frame scheduler
+        // Loop: block on the compositor vsync (DwmFlush; timed sleep at
+        // schedulerFallbackHz when composition is off), take the queued
+        // requests due this tick, and submit them as one IPC batch.
+        // Widgets whose RenderProperties::targetFps is below the tick rate
+        // stay queued and skip ticks until their frame interval elapses.
+        // The due check runs against EffectiveTargetFps, which divides
+        // targetFps by the PowerGovernor stretch (battery, user-idle,
+        // and the occluded factor for widgets suspended by overlap), so
+        // frame rates sag on battery and snap back on interaction.
+        // Suspended widgets (see visibilityStates_) are never due; a
+        // widget resuming from suspension is due immediately with its
+        // redrawPending flag forcing a full-frame render.
+        void FrameSchedulerLoop();
+        void QueueFrameRequest(PendingFrameRequest&& request);
+        bool IsWidgetDueThisTick(const PendingFrameRequest& request,
+                                 uint64_t tick, uint32_t tickRateHz) const;
+        uint32_t EffectiveTargetFps(const PendingFrameRequest& request) const;
+        void SubmitFrameBatch(std::vector<PendingFrameRequest>& batch);
+        bool WaitForCompositorTick();
+
+        // Visibility culling helpers
+        void SetSuspendReason(uint32_t widgetId, uint32_t reason, bool active);
+        uint32_t FindWidgetByWindow(HWND windowHandle) const;
+        std::vector<uint32_t> FindWidgetsOnMonitor(int monitorId) const;
         
         // Error handling
         void HandleRenderError(const std::string& error, uint32_t widgetId);
         void HandleIPCError(const std::string& error);
         void HandleBackendError(uint32_t widgetId, RenderBackendType backendType);
+        // On render-process crash: adopt a warm process from standbyPool_
+        // and reconnect the IPC bridge to its pipe instead of cold-starting
+        bool FailoverToStandbyProcess();
         
         // Performance and statistics
         void UpdateWidgetMetrics(uint32_t widgetId, const PerformanceMetrics& metrics);
         void AggregatePerformanceMetrics();
         void LogPerformanceStatistics() const;
+
+        // Latency instrumentation (no-ops when profiling is disabled)
+        void RecordSubmitToComplete(uint32_t widgetId, uint64_t micros);
+        void RecordIpcRoundTrip(uint32_t widgetId, uint64_t micros);
+        void RecordFrameRender(uint32_t widgetId, uint64_t micros);
+        void AdvanceProfilingEpoch();   // Fold retired thread-local histograms
         
         // Utility methods
         RenderBackendType DetermineOptimalBackend(ContentSourceType contentType, 
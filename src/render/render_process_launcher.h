@@ -134,6 +134,7 @@ public:
     DWORD GetProcessId() const;
     ProcessInfo GetProcessInfo() const;
     std::chrono::milliseconds GetUptime() const;
+    const LaunchConfig& GetLaunchConfig() const { return config_; }
     
     // Event handlers
     void OnCrashed(CrashHandler handler);
@@ -0,0 +1,233 @@
+// render_process_standby_pool.cpp - Pre-warmed Render Process Standby Pool Implementation
+#include "render_process_standby_pool.h"
+#include "../core/logger.h"
+
+namespace RainmeterManager {
+namespace Render {
+
+namespace {
+    constexpr int REPLENISH_RETRY_DELAY_MS = 5000;
+    constexpr int POOL_SWEEP_INTERVAL_MS = 1000;
+}
+
+// Constructor
+RenderProcessStandbyPool::RenderProcessStandbyPool(size_t poolSize)
+    : targetPoolSize_(poolSize == 0 ? 1 : poolSize)
+    , running_(false)
+    , stopRequested_(false)
+    , standbyCounter_(0)
+{
+    LOG_INFO("RenderProcessStandbyPool created (target size: " +
+             std::to_string(targetPoolSize_) + ")");
+}
+
+// Destructor
+RenderProcessStandbyPool::~RenderProcessStandbyPool() {
+    Stop();
+}
+
+// Warm the initial standbys and start background replenishment
+bool RenderProcessStandbyPool::Start(const LaunchConfig& config) {
+    if (running_) {
+        LOG_WARNING("Standby pool already running");
+        return false;
+    }
+
+    if (config.executablePath.empty()) {
+        LOG_ERROR("No executable path specified for standby pool");
+        return false;
+    }
+
+    baseConfig_ = config;
+    stopRequested_ = false;
+
+    // Warm the first standby synchronously so failover is covered from
+    // the moment Start returns; the rest fill in on the background thread
+    auto standby = WarmNewProcess();
+    if (standby) {
+        std::lock_guard<std::mutex> lock(poolMutex_);
+        warmProcesses_.push_back(std::move(standby));
+    } else {
+        LOG_WARNING("Initial standby warm-up failed; replenish thread will retry");
+    }
+
+    running_ = true;
+    replenishThread_ = std::make_unique<std::thread>(
+        &RenderProcessStandbyPool::ReplenishLoop, this);
+
+    LOG_INFO("Standby pool started (" + std::to_string(GetWarmCount()) +
+             "/" + std::to_string(targetPoolSize_) + " warm)");
+    return true;
+}
+
+// Stop pool and terminate parked standbys
+void RenderProcessStandbyPool::Stop() {
+    if (!running_) {
+        return;
+    }
+
+    LOG_INFO("Stopping standby pool...");
+
+    stopRequested_ = true;
+    replenishCondition_.notify_all();
+
+    if (replenishThread_ && replenishThread_->joinable()) {
+        replenishThread_->join();
+    }
+    replenishThread_.reset();
+
+    std::vector<std::unique_ptr<RenderProcessLauncher>> parked;
+    {
+        std::lock_guard<std::mutex> lock(poolMutex_);
+        parked.swap(warmProcesses_);
+    }
+    for (auto& launcher : parked) {
+        launcher->Terminate();
+    }
+
+    running_ = false;
+    LOG_INFO("Standby pool stopped");
+}
+
+bool RenderProcessStandbyPool::IsRunning() const {
+    return running_;
+}
+
+// Hand over a warm process for instant failover
+std::unique_ptr<RenderProcessLauncher> RenderProcessStandbyPool::TakeWarmProcess() {
+    std::unique_ptr<RenderProcessLauncher> taken;
+    {
+        std::lock_guard<std::mutex> lock(poolMutex_);
+        while (!warmProcesses_.empty() && !taken) {
+            taken = std::move(warmProcesses_.back());
+            warmProcesses_.pop_back();
+
+            // A standby may have died while parked; skip it
+            if (!taken->IsRunning()) {
+                LOG_WARNING("Discarding dead standby (PID: " +
+                            std::to_string(taken->GetProcessId()) + ")");
+                taken->Terminate();
+                taken.reset();
+            }
+        }
+    }
+
+    // Wake the replenish thread to restore the pool either way
+    replenishCondition_.notify_one();
+
+    if (taken) {
+        LOG_INFO("Warm render process handed over (PID: " +
+                 std::to_string(taken->GetProcessId()) + ")");
+    } else {
+        LOG_WARNING("Standby pool empty; caller must cold-start");
+    }
+    return taken;
+}
+
+// Current warm count
+size_t RenderProcessStandbyPool::GetWarmCount() const {
+    std::lock_guard<std::mutex> lock(poolMutex_);
+    return warmProcesses_.size();
+}
+
+// Register replenish handler
+void RenderProcessStandbyPool::OnReplenished(ReplenishHandler handler) {
+    replenishHandler_ = std::move(handler);
+}
+
+// Background replenishment loop
+void RenderProcessStandbyPool::ReplenishLoop() {
+    LOG_INFO("Standby replenish thread started");
+
+    while (!stopRequested_) {
+        SweepDeadStandbys();
+
+        size_t warmCount = GetWarmCount();
+        if (warmCount < targetPoolSize_) {
+            auto standby = WarmNewProcess();
+            bool success = standby != nullptr;
+
+            if (success) {
+                std::lock_guard<std::mutex> lock(poolMutex_);
+                warmProcesses_.push_back(std::move(standby));
+            }
+
+            if (replenishHandler_) {
+                try {
+                    replenishHandler_(success);
+                } catch (const std::exception& e) {
+                    LOG_ERROR(std::string("Replenish handler exception: ") + e.what());
+                }
+            }
+
+            if (!success) {
+                // Back off before retrying a failed warm-up
+                std::unique_lock<std::mutex> lock(replenishMutex_);
+                replenishCondition_.wait_for(
+                    lock, std::chrono::milliseconds(REPLENISH_RETRY_DELAY_MS),
+                    [this] { return stopRequested_.load(); });
+            }
+            continue;
+        }
+
+        // Pool is full; sleep until a standby is taken or we stop
+        std::unique_lock<std::mutex> lock(replenishMutex_);
+        replenishCondition_.wait_for(
+            lock, std::chrono::milliseconds(POOL_SWEEP_INTERVAL_MS),
+            [this] { return stopRequested_.load(); });
+    }
+
+    LOG_INFO("Standby replenish thread stopped");
+}
+
+// Launch and sandbox one standby process
+std::unique_ptr<RenderProcessLauncher> RenderProcessStandbyPool::WarmNewProcess() {
+    auto launcher = std::make_unique<RenderProcessLauncher>();
+
+    LaunchConfig standbyConfig = MakeStandbyConfig();
+    if (!launcher->Launch(standbyConfig)) {
+        LOG_WARNING("Failed to warm standby render process");
+        return nullptr;
+    }
+
+    LOG_INFO("Standby render process warmed (PID: " +
+             std::to_string(launcher->GetProcessId()) +
+             ", pipe: " + standbyConfig.ipcPipeName + ")");
+    return launcher;
+}
+
+// Derive a per-standby config from the template
+LaunchConfig RenderProcessStandbyPool::MakeStandbyConfig() {
+    LaunchConfig standbyConfig = baseConfig_;
+
+    // Parked standbys are never auto-restarted; the adopting coordinator
+    // decides restart policy after failover
+    standbyConfig.restartPolicy = RestartPolicy::Never;
+
+    // Unique pipe name so the coordinator can connect straight to the
+    // standby after TakeWarmProcess
+    uint64_t id = ++standbyCounter_;
+    if (!standbyConfig.ipcPipeName.empty()) {
+        standbyConfig.ipcPipeName += "-standby" + std::to_string(id);
+    }
+
+    return standbyConfig;
+}
+
+// Drop standbys that crashed while parked
+void RenderProcessStandbyPool::SweepDeadStandbys() {
+    std::lock_guard<std::mutex> lock(poolMutex_);
+    for (auto it = warmProcesses_.begin(); it != warmProcesses_.end();) {
+        if (!(*it)->IsRunning()) {
+            LOG_WARNING("Standby died while parked (PID: " +
+                        std::to_string((*it)->GetProcessId()) + "); replacing");
+            (*it)->Terminate();
+            it = warmProcesses_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+} // namespace Render
+} // namespace RainmeterManager
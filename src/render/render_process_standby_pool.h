@@ -0,0 +1,89 @@
+// render_process_standby_pool.h - Pre-warmed Render Process Standby Pool
+#pragma once
+
+#include "render_process_launcher.h"
+#include <condition_variable>
+#include <functional>
+#include <vector>
+
+namespace RainmeterManager {
+namespace Render {
+
+/**
+ * @brief Pre-warmed Render Process Standby Pool
+ *
+ * Cold-starting the render process (spawn, runtime init, backend init)
+ * takes multiple seconds, during which every widget is blank. The pool
+ * keeps one or more fully launched and sandboxed render processes idle
+ * so that after a crash the coordinator can take a warm process and
+ * fail over immediately; the pool replenishes itself on a background
+ * thread.
+ *
+ * Features:
+ * - Standby processes launched with the same SandboxConfig as the live one
+ * - TakeWarmProcess() hands over ownership without blocking on spawn
+ * - Background replenishment back to the target pool size
+ * - Dead standbys (crashed while parked) are swept and replaced
+ * - Per-standby IPC pipe names so the coordinator can connect directly
+ */
+class RenderProcessStandbyPool {
+public:
+    using ReplenishHandler = std::function<void(bool success)>;
+
+    explicit RenderProcessStandbyPool(size_t poolSize = 1);
+    ~RenderProcessStandbyPool();
+
+    // Lifecycle
+    /**
+     * Warm the initial standbys synchronously and start the background
+     * replenishment thread. The config is used as a template; each
+     * standby gets a unique IPC pipe name and RestartPolicy::Never
+     * while parked (the adopting coordinator owns restart policy).
+     */
+    bool Start(const LaunchConfig& config);
+    void Stop();
+    bool IsRunning() const;
+
+    // Failover
+    /**
+     * Take ownership of a warm, already-sandboxed render process.
+     * Returns nullptr if the pool is empty (caller falls back to a cold
+     * Launch). Triggers background replenishment either way. The
+     * standby's IPC pipe name is available via GetLaunchConfig() on the
+     * returned launcher.
+     */
+    std::unique_ptr<RenderProcessLauncher> TakeWarmProcess();
+    size_t GetWarmCount() const;
+
+    // Event handlers
+    void OnReplenished(ReplenishHandler handler);
+
+private:
+    // Internal methods
+    void ReplenishLoop();
+    std::unique_ptr<RenderProcessLauncher> WarmNewProcess();
+    LaunchConfig MakeStandbyConfig();
+    void SweepDeadStandbys();
+
+    // Configuration
+    LaunchConfig baseConfig_;
+    size_t targetPoolSize_;
+
+    // Pool state
+    std::vector<std::unique_ptr<RenderProcessLauncher>> warmProcesses_;
+    mutable std::mutex poolMutex_;
+    std::atomic<bool> running_;
+    std::atomic<bool> stopRequested_;
+    std::atomic<uint64_t> standbyCounter_;
+
+    // Replenishment
+    std::unique_ptr<std::thread> replenishThread_;
+    std::condition_variable replenishCondition_;
+    std::mutex replenishMutex_;
+
+    // Event handlers
+    ReplenishHandler replenishHandler_;
+};
+
+} // namespace Render
+} // namespace RainmeterManager
@@ -44,7 +44,8 @@ public:
                 return false;
             }
 
-            // Step 4: Cleanup
+            // Step 4: Dump the sampled IPC latency breakdown, then cleanup
+            DumpIpcLatencyTrace();
             Cleanup();
 
             LOG_INFO("✅ RenderCore Illustro Clock Test completed successfully!");
@@ -253,6 +254,29 @@ private:
         return testWindow;
     }
 
+    void DumpIpcLatencyTrace() {
+        auto bridge = renderCoordinator_->GetIPCBridge();
+        if (!bridge) {
+            LOG_WARNING("⚠️ No IPC bridge available for latency trace dump");
+            return;
+        }
+
+        auto trace = bridge->GetCommandTraceStats();
+        if (trace.tracedCommands == 0) {
+            LOG_INFO("📊 IPC latency trace: no commands sampled");
+            return;
+        }
+
+        // Per-stage averages over the sampled commands (QPC-stamped on
+        // both sides of the process boundary)
+        LOG_INFO("📊 IPC latency trace (" + std::to_string(trace.tracedCommands) + " commands sampled):");
+        LOG_INFO("   build→submit:  " + std::to_string(trace.buildToSubmitUs) + "us");
+        LOG_INFO("   submit→remote: " + std::to_string(trace.submitToRemoteUs) + "us");
+        LOG_INFO("   remote render: " + std::to_string(trace.remoteRenderUs) + "us");
+        LOG_INFO("   result return: " + std::to_string(trace.resultReturnUs) + "us");
+        LOG_INFO("   total:         " + std::to_string(trace.totalRoundTripUs) + "us");
+    }
+
     void Cleanup() {
         LOG_INFO("🧹 Cleaning up RenderCore test...");
 
@@ -0,0 +1,171 @@
+// dll_validation_pipeline.h - Parallel DLL validation for startup scans
+#pragma once
+
+#include <string>
+#include <vector>
+#include <queue>
+#include <thread>
+#include <mutex>
+#include <functional>
+#include <condition_variable>
+#include "dll_validator.h"
+
+namespace RainmeterManager {
+namespace Security {
+
+/**
+ * @brief Callback invoked with each completed validation outcome
+ *
+ * Called from a pipeline worker thread, in completion order rather than
+ * submission order. Keep the callback cheap and thread-safe; marshal to
+ * the UI thread yourself if needed.
+ */
+using ValidationCompleteCallback = std::function<void(const DLLValidationContext&)>;
+
+/**
+ * @brief Worker pool that validates DLLs concurrently
+ *
+ * When a skin package ships a dozen plugin DLLs, validating them one at
+ * a time on the loading thread serializes hashing and signature checks
+ * into the biggest cold-start stall after config load. Bulk validation
+ * is embarrassingly parallel: each job runs the full
+ * DLLValidator::ValidateDLL pass (hash, whitelist, signature — with the
+ * persistent signature cache short-circuiting unchanged files) on a
+ * worker and delivers the DLLValidationContext through the callback
+ * order-independently.
+ *
+ * DLLValidator is thread-safe, so one validator instance is shared by
+ * all workers. The pipeline does not outlive its validator.
+ */
+class DLLValidationPipeline {
+public:
+    /**
+     * @brief Create the pipeline and start its workers
+     * @param validator Shared validator that performs each check
+     * @param workerCount Worker threads; 0 picks a count from hardware concurrency
+     */
+    explicit DLLValidationPipeline(DLLValidator& validator, size_t workerCount = 0)
+        : validator_(validator)
+        , activeJobs_(0)
+        , stopRequested_(false)
+    {
+        if (workerCount == 0) {
+            size_t hw = std::thread::hardware_concurrency();
+            workerCount = (hw >= 2) ? ((hw < 8) ? hw : 8) : 2;
+        }
+        workers_.reserve(workerCount);
+        for (size_t i = 0; i < workerCount; ++i) {
+            workers_.emplace_back(&DLLValidationPipeline::WorkerLoop, this);
+        }
+    }
+
+    ~DLLValidationPipeline() {
+        {
+            std::lock_guard<std::mutex> lock(jobMutex_);
+            stopRequested_ = true;
+        }
+        jobCondition_.notify_all();
+        for (auto& worker : workers_) {
+            if (worker.joinable()) {
+                worker.join();
+            }
+        }
+    }
+
+    DLLValidationPipeline(const DLLValidationPipeline&) = delete;
+    DLLValidationPipeline& operator=(const DLLValidationPipeline&) = delete;
+
+    /**
+     * @brief Queue one DLL for validation
+     */
+    void Submit(const std::string& dllPath, ValidationCompleteCallback callback) {
+        {
+            std::lock_guard<std::mutex> lock(jobMutex_);
+            jobs_.push(Job{dllPath, std::move(callback)});
+        }
+        jobCondition_.notify_one();
+    }
+
+    /**
+     * @brief Queue a batch of DLLs (typical startup scan entry point)
+     * @return Number of jobs queued
+     */
+    size_t SubmitBatch(const std::vector<std::string>& dllPaths, ValidationCompleteCallback callback) {
+        {
+            std::lock_guard<std::mutex> lock(jobMutex_);
+            for (const auto& path : dllPaths) {
+                jobs_.push(Job{path, callback});
+            }
+        }
+        jobCondition_.notify_all();
+        return dllPaths.size();
+    }
+
+    /**
+     * @brief Block until every submitted job has completed
+     */
+    void Wait() {
+        std::unique_lock<std::mutex> lock(jobMutex_);
+        idleCondition_.wait(lock, [this] {
+            return jobs_.empty() && activeJobs_ == 0;
+        });
+    }
+
+    size_t GetPendingCount() const {
+        std::lock_guard<std::mutex> lock(jobMutex_);
+        return jobs_.size() + activeJobs_;
+    }
+
+    size_t GetWorkerCount() const {
+        return workers_.size();
+    }
+
+private:
+    struct Job {
+        std::string dllPath;
+        ValidationCompleteCallback callback;
+    };
+
+    void WorkerLoop() {
+        for (;;) {
+            Job job;
+            {
+                std::unique_lock<std::mutex> lock(jobMutex_);
+                jobCondition_.wait(lock, [this] {
+                    return stopRequested_ || !jobs_.empty();
+                });
+                if (stopRequested_ && jobs_.empty()) {
+                    return;
+                }
+                job = std::move(jobs_.front());
+                jobs_.pop();
+                ++activeJobs_;
+            }
+
+            DLLValidationContext context = validator_.ValidateDLL(job.dllPath);
+            if (job.callback) {
+                job.callback(context);
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(jobMutex_);
+                --activeJobs_;
+                if (jobs_.empty() && activeJobs_ == 0) {
+                    idleCondition_.notify_all();
+                }
+            }
+        }
+    }
+
+    DLLValidator& validator_;
+    std::vector<std::thread> workers_;
+    std::queue<Job> jobs_;
+    mutable std::mutex jobMutex_;
+    std::condition_variable jobCondition_;
+    std::condition_variable idleCondition_;
+    size_t activeJobs_;
+    bool stopRequested_;
+};
+
+} // namespace Security
+} // namespace RainmeterManager
@@ -5,6 +5,7 @@
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
+#include <memory>
 #include <mutex>
 #include <windows.h>
 #include <wintrust.h>
@@ -80,16 +81,21 @@ struct DLLValidatorConfig {
     bool promptOnUnsigned = true;         // Ask user for unsigned DLLs
     bool autoTrustSystemDLLs = true;      // Trust Windows system DLLs
     bool enableHashWhitelist = true;      // Check known-good hashes
-    
+    bool enableSignatureCache = true;     // Reuse verification outcomes across sessions
+
     std::string userCertThumbprint;       // User's code signing cert
     std::string communityDBPath;          // Community trust database
     std::string hashWhitelistPath;        // Known-good DLL hashes
     std::string userTrustStorePath;       // User's trust decisions
+    std::string signatureCachePath;       // Persistent signature verification cache
 };
 
+// Persistent cache of verification outcomes (signature_validation_cache.h)
+class SignatureValidationCache;
+
 /**
  * @brief Smart DLL Validator - Help Users Be Safe and Creative
- * 
+ *
  * Philosophy:
  * - Verify signatures and provide risk assessment
  * - Trust user-signed DLLs (encourage signing their work)
@@ -109,10 +115,15 @@ public:
     DLLValidationContext ValidateDLL(const std::string& dllPath);
     bool ShouldAllowLoad(const DLLValidationContext& context);
     
-    // Signature verification
+    // Signature verification. VerifySignature consults the persistent
+    // cache first: when (hash, size, mtime) match a previous session the
+    // stored SignatureInfo is returned and the WinVerifyTrust call is
+    // skipped entirely.
     SignatureInfo VerifySignature(const std::string& dllPath);
     bool IsSignedByUser(const SignatureInfo& sig);
     bool IsSignedByTrustedPublisher(const SignatureInfo& sig);
+    void InvalidateSignatureCache(const std::string& sha256Hash);
+    void FlushSignatureCache();
     
     // Hash verification
     std::string ComputeSHA256(const std::string& filePath);
@@ -153,6 +164,7 @@ public:
         uint64_t communityApprovedDLLs;
         uint64_t blockedDLLs;
         uint64_t userApprovedDLLs;
+        uint64_t signatureCacheHits;
     };
     Statistics GetStatistics() const;
 
@@ -164,7 +176,10 @@ private:
     std::unordered_map<std::string, UserTrustDecision> userTrustStore_;      // hash -> decision
     std::unordered_map<std::string, std::string> hashWhitelist_;              // hash -> description
     std::unordered_map<std::string, std::unordered_set<std::string>> communityDB_;  // dllName -> hashes
-    
+
+    // Persistent signature verification cache
+    std::unique_ptr<SignatureValidationCache> signatureCache_;
+
     // Statistics
     Statistics stats_;
     mutable std::mutex statsMutex_;
@@ -177,6 +192,10 @@ private:
     void SaveUserTrustStore();
     void LoadHashWhitelist();
     void LoadCommunityDatabase();
+    void LoadSignatureCache();
+    bool GetFileIdentity(const std::string& filePath, uint64_t& fileSize, int64_t& lastWriteTime);
+    bool TryGetCachedSignature(const std::string& dllPath, const std::string& sha256Hash, SignatureInfo& info);
+    void StoreCachedSignature(const std::string& dllPath, const std::string& sha256Hash, const SignatureInfo& info);
     std::string ExtractCertificateInfo(PCCERT_CONTEXT certContext, const std::string& field);
 };
 
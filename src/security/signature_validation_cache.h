@@ -0,0 +1,206 @@
+// signature_validation_cache.h - Persistent cache of signature verification outcomes
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <mutex>
+#include <fstream>
+#include <sstream>
+#include <cstdint>
+#include "dll_validator.h"
+
+namespace RainmeterManager {
+namespace Security {
+
+/**
+ * @brief Identity of a file as last verified
+ *
+ * A DLL is considered unchanged when all three fields match; any edit
+ * changes the hash, and size/mtime catch the cheap cases before the
+ * hash is even compared.
+ */
+struct SignatureCacheKey {
+    std::string sha256Hash;
+    uint64_t fileSize;
+    int64_t lastWriteTime;  // FILETIME as 100ns ticks, or any stable mtime encoding
+};
+
+/**
+ * @brief Persistent cache of WinVerifyTrust-class verification results
+ *
+ * Signature checks add seconds to plugin load on machines with many
+ * third-party DLLs. This cache stores the full SignatureInfo outcome
+ * keyed by (hash, size, mtime), so a DLL that has not changed since a
+ * previous session skips cryptographic verification entirely. It is a
+ * performance cache, not a trust store: a hit replays what verification
+ * concluded last time for identical bytes, and any change to the file
+ * misses and forces a fresh verification.
+ *
+ * Storage is a plain text file, one tab-separated entry per line.
+ * Thread-safe.
+ */
+class SignatureValidationCache {
+public:
+    explicit SignatureValidationCache(const std::string& cachePath)
+        : cachePath_(cachePath)
+        , dirty_(false)
+    {
+    }
+
+    ~SignatureValidationCache() {
+        Save();
+    }
+
+    /**
+     * @brief Load cached entries from disk
+     * @return true if the cache file was read (a missing file is not an error)
+     */
+    bool Load() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries_.clear();
+
+        std::ifstream file(cachePath_);
+        if (!file.is_open()) {
+            return false;
+        }
+
+        std::string line;
+        while (std::getline(file, line)) {
+            std::string key;
+            SignatureInfo info;
+            if (ParseLine(line, key, info)) {
+                entries_[key] = info;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Write all entries back to disk if anything changed
+     * @return true on success or when there was nothing to write
+     */
+    bool Save() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!dirty_) {
+            return true;
+        }
+
+        std::ofstream file(cachePath_, std::ios::trunc);
+        if (!file.is_open()) {
+            return false;
+        }
+
+        for (const auto& [key, info] : entries_) {
+            file << FormatLine(key, info) << '\n';
+        }
+        dirty_ = false;
+        return true;
+    }
+
+    /**
+     * @brief Look up a previously verified outcome
+     * @param key File identity (hash, size, mtime)
+     * @param info Receives the cached SignatureInfo on a hit
+     * @return true when the exact identity was verified before
+     */
+    bool Lookup(const SignatureCacheKey& key, SignatureInfo& info) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = entries_.find(ComposeKey(key));
+        if (it == entries_.end()) {
+            return false;
+        }
+        info = it->second;
+        return true;
+    }
+
+    /**
+     * @brief Record a fresh verification outcome
+     */
+    void Store(const SignatureCacheKey& key, const SignatureInfo& info) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries_[ComposeKey(key)] = info;
+        dirty_ = true;
+    }
+
+    /**
+     * @brief Drop every entry for a given content hash (any size/mtime)
+     */
+    void Invalidate(const std::string& sha256Hash) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto it = entries_.begin(); it != entries_.end();) {
+            if (it->first.compare(0, sha256Hash.size(), sha256Hash) == 0) {
+                it = entries_.erase(it);
+                dirty_ = true;
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    void Clear() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!entries_.empty()) {
+            entries_.clear();
+            dirty_ = true;
+        }
+    }
+
+    size_t GetEntryCount() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return entries_.size();
+    }
+
+private:
+    static std::string ComposeKey(const SignatureCacheKey& key) {
+        std::ostringstream oss;
+        oss << key.sha256Hash << '|' << key.fileSize << '|' << key.lastWriteTime;
+        return oss.str();
+    }
+
+    // One entry per line: key, then the SignatureInfo fields, tab-separated.
+    // Certificate text fields never legitimately contain tabs; a line that
+    // fails to parse is simply dropped (the DLL gets re-verified).
+    static std::string FormatLine(const std::string& key, const SignatureInfo& info) {
+        std::ostringstream oss;
+        oss << key << '\t'
+            << (info.isSigned ? 1 : 0) << '\t'
+            << (info.isValid ? 1 : 0) << '\t'
+            << (info.isTrusted ? 1 : 0) << '\t'
+            << info.publisherName << '\t'
+            << info.issuerName << '\t'
+            << info.serialNumber << '\t'
+            << info.thumbprint << '\t'
+            << info.signatureAlgorithm << '\t'
+            << info.timestamp;
+        return oss.str();
+    }
+
+    static bool ParseLine(const std::string& line, std::string& key, SignatureInfo& info) {
+        std::istringstream iss(line);
+        std::string isSigned, isValid, isTrusted;
+        if (!std::getline(iss, key, '\t') ||
+            !std::getline(iss, isSigned, '\t') ||
+            !std::getline(iss, isValid, '\t') ||
+            !std::getline(iss, isTrusted, '\t') ||
+            !std::getline(iss, info.publisherName, '\t') ||
+            !std::getline(iss, info.issuerName, '\t') ||
+            !std::getline(iss, info.serialNumber, '\t') ||
+            !std::getline(iss, info.thumbprint, '\t') ||
+            !std::getline(iss, info.signatureAlgorithm, '\t') ||
+            !std::getline(iss, info.timestamp)) {
+            return false;
+        }
+        info.isSigned = (isSigned == "1");
+        info.isValid = (isValid == "1");
+        info.isTrusted = (isTrusted == "1");
+        return true;
+    }
+
+    std::string cachePath_;
+    std::unordered_map<std::string, SignatureInfo> entries_;  // composed key -> outcome
+    mutable std::mutex mutex_;
+    bool dirty_;
+};
+
+} // namespace Security
+} // namespace RainmeterManager
@@ -0,0 +1,180 @@
+// pii_scrubber.cpp - Batch PII scrubbing for telemetry records
+#include "pii_scrubber.h"
+#include "telemetry_service.h"
+#include <windows.h>
+#include <lmcons.h>
+
+namespace RainmeterManager {
+namespace Services {
+
+namespace {
+    constexpr uint8_t FIRST_BYTE_LITERAL = 0x01;
+    constexpr uint8_t FIRST_BYTE_IPV4 = 0x02;
+
+    std::string NarrowEnvString(const wchar_t* value) {
+        std::string out;
+        for (const wchar_t* p = value; *p; ++p) {
+            if (*p < 128) out.push_back(static_cast<char>(*p));
+        }
+        return out;
+    }
+}
+
+PiiScrubber::PiiScrubber() {
+    // Local account name
+    wchar_t userName[UNLEN + 1] = {0};
+    DWORD userLen = UNLEN + 1;
+    if (GetUserNameW(userName, &userLen) && userLen > 1) {
+        AddLiteral(NarrowEnvString(userName), "<user>");
+    }
+
+    // User profile directory (covers paths under C:\Users\<name>)
+    wchar_t profile[MAX_PATH] = {0};
+    DWORD profileLen = GetEnvironmentVariableW(L"USERPROFILE", profile, MAX_PATH);
+    if (profileLen > 0 && profileLen < MAX_PATH) {
+        AddLiteral(NarrowEnvString(profile), "<profile>");
+    }
+
+    // Computer name shows up in UNC paths and error text
+    wchar_t computer[MAX_COMPUTERNAME_LENGTH + 1] = {0};
+    DWORD computerLen = MAX_COMPUTERNAME_LENGTH + 1;
+    if (GetComputerNameW(computer, &computerLen) && computerLen > 1) {
+        AddLiteral(NarrowEnvString(computer), "<host>");
+    }
+
+    // IPv4 addresses start with a digit
+    for (char c = '0'; c <= '9'; ++c) {
+        firstByteTable_[static_cast<uint8_t>(c)] |= FIRST_BYTE_IPV4;
+    }
+}
+
+void PiiScrubber::AddLiteral(const std::string& text, const char* replacement) {
+    if (text.size() < 3) {
+        return;  // Too short to match safely; would redact innocents
+    }
+    std::string lowered = text;
+    for (char& c : lowered) {
+        c = ToLowerAscii(c);
+    }
+    uint8_t first = static_cast<uint8_t>(lowered[0]);
+    firstByteTable_[first] |= FIRST_BYTE_LITERAL;
+    // Paths appear in both cases; mark the uppercase start too
+    if (first >= 'a' && first <= 'z') {
+        firstByteTable_[first - 32] |= FIRST_BYTE_LITERAL;
+    }
+    literals_.push_back(LiteralPattern{std::move(lowered), replacement});
+}
+
+size_t PiiScrubber::MatchIPv4(const std::string& text, size_t pos) {
+    size_t p = pos;
+    int octets = 0;
+    while (octets < 4) {
+        size_t digits = 0;
+        int value = 0;
+        while (p < text.size() && digits < 3 &&
+               text[p] >= '0' && text[p] <= '9') {
+            value = value * 10 + (text[p] - '0');
+            ++p;
+            ++digits;
+        }
+        if (digits == 0 || value > 255) {
+            return 0;
+        }
+        ++octets;
+        if (octets < 4) {
+            if (p >= text.size() || text[p] != '.') {
+                return 0;
+            }
+            ++p;
+        }
+    }
+    // Reject when embedded in a longer dotted number (version strings)
+    if (p < text.size() && (text[p] == '.' || (text[p] >= '0' && text[p] <= '9'))) {
+        return 0;
+    }
+    return p - pos;
+}
+
+bool PiiScrubber::ScrubInPlace(std::string& text) const {
+    bool redacted = false;
+    size_t pos = 0;
+    while (pos < text.size()) {
+        uint8_t flags = firstByteTable_[static_cast<uint8_t>(text[pos])];
+        if (flags == 0) {
+            ++pos;  // Common case: this byte starts nothing
+            continue;
+        }
+
+        if (flags & FIRST_BYTE_LITERAL) {
+            bool matched = false;
+            for (const LiteralPattern& pattern : literals_) {
+                const size_t len = pattern.text.size();
+                if (pos + len > text.size()) {
+                    continue;
+                }
+                size_t i = 0;
+                while (i < len && ToLowerAscii(text[pos + i]) == pattern.text[i]) {
+                    ++i;
+                }
+                if (i == len) {
+                    text.replace(pos, len, pattern.replacement);
+                    pos += std::char_traits<char>::length(pattern.replacement);
+                    redacted = true;
+                    matched = true;
+                    break;
+                }
+            }
+            if (matched) {
+                continue;
+            }
+        }
+
+        if (flags & FIRST_BYTE_IPV4) {
+            // Only at a token boundary; "1.2.3.4" inside "v1.2.3.45" is not an address
+            bool atBoundary = (pos == 0) ||
+                !((text[pos - 1] >= '0' && text[pos - 1] <= '9') || text[pos - 1] == '.');
+            size_t len = atBoundary ? MatchIPv4(text, pos) : 0;
+            if (len > 0) {
+                text.replace(pos, len, "<ip>");
+                pos += 4;
+                redacted = true;
+                continue;
+            }
+        }
+
+        ++pos;
+    }
+    return redacted;
+}
+
+void PiiScrubber::ScrubEvent(TelemetryEvent& event) const {
+    ScrubInPlace(event.eventName);
+    for (auto& property : event.properties) {
+        ScrubInPlace(property.second);
+    }
+}
+
+void PiiScrubber::ScrubError(ErrorTelemetry& error) const {
+    ScrubInPlace(error.errorMessage);
+    ScrubInPlace(error.stackTrace);
+    for (auto& entry : error.context) {
+        ScrubInPlace(entry.second);
+    }
+}
+
+size_t PiiScrubber::ScrubBatch(std::vector<TelemetryEvent>& events) const {
+    size_t touched = 0;
+    for (TelemetryEvent& event : events) {
+        bool redacted = ScrubInPlace(event.eventName);
+        for (auto& property : event.properties) {
+            redacted = ScrubInPlace(property.second) || redacted;
+        }
+        if (redacted) {
+            ++touched;
+        }
+    }
+    return touched;
+}
+
+} // namespace Services
+} // namespace RainmeterManager
@@ -0,0 +1,74 @@
+// pii_scrubber.h - Batch PII scrubbing for telemetry records
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace RainmeterManager {
+namespace Services {
+
+struct TelemetryEvent;
+struct ErrorTelemetry;
+
+/**
+ * @brief Multi-pattern PII scanner run on the telemetry worker thread
+ *
+ * Scrubbing used to happen inline where events are recorded, which
+ * made telemetry calls too expensive for frequent paths. The scrubber
+ * instead runs over whole batches inside ProcessBatch, so the hot path
+ * only enqueues.
+ *
+ * The scan is a single pass per string: a 256-entry first-byte table
+ * marks which bytes can start any pattern, so the common case (byte
+ * starts nothing) is one table load; literal patterns (the local
+ * username, the user-profile path) verify in place and structural
+ * matchers handle IPv4 addresses. No regex engine and no per-field
+ * re-scans.
+ */
+class PiiScrubber {
+public:
+    PiiScrubber();
+
+    /**
+     * @brief Replace PII occurrences in place
+     * @return True if anything was redacted
+     */
+    bool ScrubInPlace(std::string& text) const;
+
+    /**
+     * @brief Scrub event name and all property values
+     */
+    void ScrubEvent(TelemetryEvent& event) const;
+
+    /**
+     * @brief Scrub error message, stack trace and context values
+     */
+    void ScrubError(ErrorTelemetry& error) const;
+
+    /**
+     * @brief Scrub a whole batch
+     * @return Number of records in which something was redacted
+     */
+    size_t ScrubBatch(std::vector<TelemetryEvent>& events) const;
+
+private:
+    struct LiteralPattern {
+        std::string text;         // Matched case-insensitively
+        const char* replacement;
+    };
+
+    void AddLiteral(const std::string& text, const char* replacement);
+    // Length of an IPv4 address starting at pos, or 0
+    static size_t MatchIPv4(const std::string& text, size_t pos);
+    static char ToLowerAscii(char c) {
+        return (c >= 'A' && c <= 'Z') ? static_cast<char>(c + 32) : c;
+    }
+
+    std::vector<LiteralPattern> literals_;
+    // Bit 0: some literal starts with this byte; bit 1: possible IPv4 start
+    uint8_t firstByteTable_[256] = {0};
+};
+
+} // namespace Services
+} // namespace RainmeterManager
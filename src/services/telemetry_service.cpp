@@ -1,11 +1,17 @@
 // telemetry_service.cpp - Enterprise-grade Telemetry Service Implementation
 #include "telemetry_service.h"
+#include "../core/lz4_block.h"
+#include "../core/string_intern.h"
 #include <sstream>
 #include <iomanip>
 #include <random>
+#include <limits>
 #include <filesystem>
 #include <windows.h>
 #include <wincrypt.h>
+#include <winhttp.h>
+
+#pragma comment(lib, "winhttp.lib")
 
 namespace fs = std::filesystem;
 
@@ -16,9 +22,11 @@ namespace Services {
 TelemetryService::TelemetryService()
     : running_(false)
     , stopRequested_(false)
+    , spoolStopRequested_(false)
+    , aggregateCount_(0)
     , eventsThisMinute_(0)
     , lastMinute_(std::chrono::steady_clock::now())
-    , stats_{0, 0, 0, 0, 0, 0}
+    , stats_{0, 0, 0, 0, 0, 0, 0}
 {
     // Set default storage directory
     char* appdata = nullptr;
@@ -53,10 +61,27 @@ void TelemetryService::Start() {
     
     running_ = true;
     stopRequested_ = false;
-    
+    spoolStopRequested_ = false;
+
+    // Round the spool ring capacity up to a power of two for the mask
+    size_t ringCapacity = 1;
+    while (ringCapacity < static_cast<size_t>(config_.spoolRingCapacity)) {
+        ringCapacity <<= 1;
+    }
+    spoolRing_ = std::make_unique<SpoolRing>(ringCapacity);
+
     // Start worker thread for async batch processing
     workerThread_ = std::make_unique<std::thread>(&TelemetryService::WorkerThreadFunction, this);
-    
+
+    // Start spool writer thread for batched disk flushes
+    spoolThread_ = std::make_unique<std::thread>(&TelemetryService::SpoolWriterFunction, this);
+
+    // Remote uploads run only when an endpoint is configured
+    if (!config_.endpoint.empty()) {
+        uploadStopRequested_ = false;
+        uploadThread_ = std::make_unique<std::thread>(&TelemetryService::UploadWorkerFunction, this);
+    }
+
     LOG_INFO("TelemetryService started successfully");
     TrackEvent("TelemetryService.Started", TelemetryEventType::SystemEvent, PrivacyLevel::Essential);
 }
@@ -79,10 +104,26 @@ void TelemetryService::Stop() {
     }
     
     running_ = false;
-    
+
     // Flush remaining events
     Flush();
-    
+
+    // Stop the upload worker; anything still in the backlog is lost for
+    // this session but the same records are in the offline spool
+    uploadStopRequested_ = true;
+    uploadCondition_.notify_all();
+    if (uploadThread_ && uploadThread_->joinable()) {
+        uploadThread_->join();
+    }
+
+    // Stop the spool writer last so the final batch reaches disk; it
+    // drains the ring once more before exiting.
+    spoolStopRequested_ = true;
+    spoolCondition_.notify_all();
+    if (spoolThread_ && spoolThread_->joinable()) {
+        spoolThread_->join();
+    }
+
     EndSession();
     
     LOG_INFO("TelemetryService stopped");
@@ -222,6 +263,118 @@ void TelemetryService::TrackMetricWithTags(
     }
 }
 
+// AggregatedMetric slot construction
+TelemetryService::AggregatedMetric::AggregatedMetric(
+    const std::string& name, double width, size_t bucketCount)
+    : metricName(name)
+    , bucketWidth(width)
+    , buckets(bucketCount)
+    , sampleCount(0)
+    , sum(0.0)
+    , minimum(std::numeric_limits<double>::infinity())
+    , maximum(-std::numeric_limits<double>::infinity())
+{
+}
+
+// Register a pre-aggregated metric slot
+size_t TelemetryService::RegisterAggregatedMetric(
+    const std::string& metricName,
+    double bucketWidth,
+    size_t bucketCount
+) {
+    if (bucketWidth <= 0.0 || bucketCount == 0) {
+        LOG_WARNING("Invalid aggregated metric parameters for: " + metricName);
+        return INVALID_AGGREGATE_HANDLE;
+    }
+
+    std::lock_guard<std::mutex> lock(aggregateRegisterMutex_);
+
+    size_t count = aggregateCount_.load(std::memory_order_relaxed);
+
+    // Re-registering the same name returns the existing handle
+    for (size_t i = 0; i < count; ++i) {
+        if (aggregates_[i]->metricName == metricName) {
+            return i;
+        }
+    }
+
+    if (count >= MAX_AGGREGATED_METRICS) {
+        LOG_WARNING("Aggregated metric slots exhausted, dropping: " + metricName);
+        return INVALID_AGGREGATE_HANDLE;
+    }
+
+    aggregates_[count] = std::make_unique<AggregatedMetric>(metricName, bucketWidth, bucketCount);
+    aggregateCount_.store(count + 1, std::memory_order_release);
+    return count;
+}
+
+// Record one sample into a pre-aggregated metric (lock-free)
+void TelemetryService::TrackAggregatedMetric(size_t handle, double value) {
+    if (handle >= aggregateCount_.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    AggregatedMetric& agg = *aggregates_[handle];
+
+    // Values past the last bucket edge land in the overflow bucket
+    size_t bucket = static_cast<size_t>((value > 0.0) ? (value / agg.bucketWidth) : 0.0);
+    if (bucket >= agg.buckets.size()) {
+        bucket = agg.buckets.size() - 1;
+    }
+    agg.buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    agg.sampleCount.fetch_add(1, std::memory_order_relaxed);
+
+    // std::atomic<double> has no fetch_add pre-C++20; CAS loops instead
+    double expected = agg.sum.load(std::memory_order_relaxed);
+    while (!agg.sum.compare_exchange_weak(expected, expected + value, std::memory_order_relaxed)) {
+    }
+
+    expected = agg.minimum.load(std::memory_order_relaxed);
+    while (value < expected &&
+           !agg.minimum.compare_exchange_weak(expected, value, std::memory_order_relaxed)) {
+    }
+
+    expected = agg.maximum.load(std::memory_order_relaxed);
+    while (value > expected &&
+           !agg.maximum.compare_exchange_weak(expected, value, std::memory_order_relaxed)) {
+    }
+}
+
+// Snapshot and reset every aggregate, emitting one summary record each
+void TelemetryService::FlushAggregatedMetrics() {
+    size_t count = aggregateCount_.load(std::memory_order_acquire);
+
+    for (size_t i = 0; i < count; ++i) {
+        AggregatedMetric& agg = *aggregates_[i];
+
+        uint64_t samples = agg.sampleCount.exchange(0, std::memory_order_relaxed);
+        if (samples == 0) {
+            continue;  // No traffic this interval, nothing to record
+        }
+
+        MetricAggregateSummary summary;
+        summary.metricName = agg.metricName;
+        summary.sampleCount = samples;
+        summary.sum = agg.sum.exchange(0.0, std::memory_order_relaxed);
+        summary.minimum = agg.minimum.exchange(
+            std::numeric_limits<double>::infinity(), std::memory_order_relaxed);
+        summary.maximum = agg.maximum.exchange(
+            -std::numeric_limits<double>::infinity(), std::memory_order_relaxed);
+        summary.bucketWidth = agg.bucketWidth;
+        summary.intervalEnd = std::chrono::system_clock::now();
+
+        summary.buckets.reserve(agg.buckets.size());
+        for (auto& bucket : agg.buckets) {
+            summary.buckets.push_back(bucket.exchange(0, std::memory_order_relaxed));
+        }
+
+        SaveAggregateToLocalStorage(summary);
+
+        std::lock_guard<std::mutex> statsLock(statsMutex_);
+        stats_.metricsTracked += samples;
+    }
+}
+
 // ScopedTimer implementation
 TelemetryService::ScopedTimer::ScopedTimer(TelemetryService* service, const std::string& operationName)
     : service_(service)
@@ -381,21 +534,50 @@ void TelemetryService::ProcessBatch() {
         }
     }
     
+    // Scrub PII here on the worker thread, over the whole batch, so
+    // tracking calls on hot paths never pay for the scan
+    piiScrubber_.ScrubBatch(events);
+    for (auto& error : errors) {
+        piiScrubber_.ScrubError(error);
+    }
+
     // Save to local storage
     if (!events.empty()) {
         SaveToLocalStorage(events);
-        
+
         std::lock_guard<std::mutex> statsLock(statsMutex_);
         stats_.eventsSent += events.size();
     }
-    
+
     for (const auto& error : errors) {
         SaveErrorToLocalStorage(error);
     }
-    
+
     for (const auto& metric : metrics) {
         SaveMetricToLocalStorage(metric);
     }
+
+    // Feed the remote upload pipeline; errors coalesce by signature so a
+    // repeating failure ships as one record with a count
+    bool uploadActive;
+    {
+        std::lock_guard<std::mutex> configLock(configMutex_);
+        uploadActive = !config_.endpoint.empty();
+    }
+    if (uploadActive) {
+        for (const auto& event : events) {
+            QueueForUpload(SerializeEventToJson(event));
+        }
+        for (const auto& error : errors) {
+            CoalesceErrorForUpload(error);
+        }
+        for (const auto& metric : metrics) {
+            QueueForUpload(SerializeMetricToJson(metric));
+        }
+    }
+
+    // Pre-aggregated metrics flush one summary record per interval
+    FlushAggregatedMetrics();
 }
 
 // Check privacy settings
@@ -437,63 +619,439 @@ bool TelemetryService::CheckRateLimit() {
     return true;
 }
 
-// Save events to local JSON storage
-void TelemetryService::SaveToLocalStorage(const std::vector<TelemetryEvent>& events) {
-    if (!config_.offlineStorage || events.empty()) {
+// SpoolRing: bounded lock-free MPMC ring using per-slot sequence numbers
+TelemetryService::SpoolRing::SpoolRing(size_t capacity)
+    : slots_(new Slot[capacity])
+    , mask_(capacity - 1)
+    , enqueuePos_(0)
+    , dequeuePos_(0)
+{
+    for (size_t i = 0; i < capacity; ++i) {
+        slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+bool TelemetryService::SpoolRing::TryPush(std::string&& record) {
+    size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+    for (;;) {
+        Slot& slot = slots_[pos & mask_];
+        size_t seq = slot.sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+        if (diff == 0) {
+            if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                slot.record = std::move(record);
+                slot.sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            return false;  // Ring full
+        } else {
+            pos = enqueuePos_.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool TelemetryService::SpoolRing::TryPop(std::string& record) {
+    size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+    for (;;) {
+        Slot& slot = slots_[pos & mask_];
+        size_t seq = slot.sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+        if (diff == 0) {
+            if (dequeuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                record = std::move(slot.record);
+                slot.record.clear();
+                slot.sequence.store(pos + mask_ + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            return false;  // Ring empty
+        } else {
+            pos = dequeuePos_.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+// Push a serialized record into the spool ring (lock-free, drops when full)
+void TelemetryService::EnqueueSpoolRecord(std::string&& record) {
+    if (!spoolRing_) {
         return;
     }
-    
+
+    if (spoolRing_->TryPush(std::move(record))) {
+        spoolCondition_.notify_one();
+    } else {
+        std::lock_guard<std::mutex> statsLock(statsMutex_);
+        stats_.spoolRecordsDropped++;
+    }
+}
+
+// Spool writer thread: drains the ring in batches into one append-only file
+void TelemetryService::SpoolWriterFunction() {
+    LOG_INFO("Telemetry spool writer started");
+
+    std::ofstream spool;
+    uint64_t bytesWritten = 0;
+
     try {
-        std::string filePath = GetStorageFilePath("events");
-        std::ofstream file(filePath, std::ios::app);
-        
-        if (file.is_open()) {
-            for (const auto& event : events) {
-                file << SerializeEventToJson(event) << std::endl;
-            }
-            file.close();
+        std::string path = GetSpoolFilePath();
+        spool.open(path, std::ios::binary | std::ios::app);
+        if (spool.is_open()) {
+            spool.seekp(0, std::ios::end);
+            bytesWritten = static_cast<uint64_t>(spool.tellp());
         } else {
-            LOG_ERROR("Failed to open telemetry storage file: " + filePath);
+            LOG_ERROR("Failed to open telemetry spool file: " + path);
         }
     } catch (const std::exception& e) {
-        LOG_ERROR(std::string("Error saving telemetry to storage: ") + e.what());
+        LOG_ERROR(std::string("Error opening telemetry spool: ") + e.what());
+    }
+
+    while (!spoolStopRequested_) {
+        {
+            std::unique_lock<std::mutex> lock(spoolWakeMutex_);
+            spoolCondition_.wait_for(lock, std::chrono::milliseconds(250));
+        }
+        DrainSpoolToFile(spool, bytesWritten);
+    }
+
+    // Final drain so records produced during shutdown reach disk
+    DrainSpoolToFile(spool, bytesWritten);
+
+    if (spool.is_open()) {
+        spool.close();
     }
+
+    LOG_INFO("Telemetry spool writer stopped");
 }
 
-void TelemetryService::SaveErrorToLocalStorage(const ErrorTelemetry& error) {
-    if (!config_.offlineStorage) {
+// Write every queued record as [uint32 length][bytes], one flush per batch
+void TelemetryService::DrainSpoolToFile(std::ofstream& spool, uint64_t& bytesWritten) {
+    if (!spoolRing_ || !spool.is_open()) {
+        std::string discard;
+        while (spoolRing_ && spoolRing_->TryPop(discard)) {
+            // No destination; drop so producers do not spin on a full ring
+        }
         return;
     }
-    
+
+    const uint64_t maxBytes = static_cast<uint64_t>(config_.spoolMaxFileSizeMB) * 1024 * 1024;
+
+    std::string record;
+    bool wroteAny = false;
+    while (spoolRing_->TryPop(record)) {
+        uint32_t length = static_cast<uint32_t>(record.size());
+        spool.write(reinterpret_cast<const char*>(&length), sizeof(length));
+        spool.write(record.data(), record.size());
+        bytesWritten += sizeof(length) + record.size();
+        wroteAny = true;
+
+        if (bytesWritten >= maxBytes) {
+            spool.flush();
+            RotateSpoolFile(spool, bytesWritten);
+            wroteAny = false;
+        }
+    }
+
+    if (wroteAny) {
+        spool.flush();
+    }
+}
+
+// Replace the previous rotated spool and start a fresh one
+void TelemetryService::RotateSpoolFile(std::ofstream& spool, uint64_t& bytesWritten) {
     try {
-        std::string filePath = GetStorageFilePath("errors");
-        std::ofstream file(filePath, std::ios::app);
-        
-        if (file.is_open()) {
-            file << SerializeErrorToJson(error) << std::endl;
-            file.close();
+        std::string path = GetSpoolFilePath();
+        spool.close();
+
+        fs::path current(path);
+        fs::path rotated(path + ".1");
+        std::error_code ec;
+        fs::remove(rotated, ec);
+        fs::rename(current, rotated, ec);
+        if (ec) {
+            LOG_WARNING("Failed to rotate telemetry spool: " + ec.message());
         }
+
+        spool.open(path, std::ios::binary | std::ios::trunc);
+        bytesWritten = 0;
     } catch (const std::exception& e) {
-        LOG_ERROR(std::string("Error saving error telemetry: ") + e.what());
+        LOG_ERROR(std::string("Error rotating telemetry spool: ") + e.what());
+    }
+}
+
+std::string TelemetryService::GetSpoolFilePath() const {
+    fs::path fullPath = fs::path(config_.storageDirectory) / "telemetry.spool";
+    return fullPath.string();
+}
+
+// Remote upload pipeline
+
+void TelemetryService::QueueForUpload(std::string&& record) {
+    size_t maxBacklog;
+    {
+        std::lock_guard<std::mutex> configLock(configMutex_);
+        maxBacklog = static_cast<size_t>(config_.maxUploadBacklog);
+    }
+
+    std::lock_guard<std::mutex> lock(uploadMutex_);
+    if (uploadBacklog_.size() >= maxBacklog) {
+        // Drop-oldest keeps the freshest diagnostics through an outage
+        uploadBacklog_.erase(uploadBacklog_.begin());
+        std::lock_guard<std::mutex> statsLock(statsMutex_);
+        stats_.uploadRecordsDropped++;
     }
+    uploadBacklog_.push_back(std::move(record));
+}
+
+void TelemetryService::CoalesceErrorForUpload(const ErrorTelemetry& error) {
+    const std::string signature =
+        error.component + "|" + error.errorCode + "|" + error.errorMessage;
+    const std::string record = SerializeErrorToJson(error);
+
+    std::lock_guard<std::mutex> lock(uploadMutex_);
+    auto existing = coalescedErrors_.find(signature);
+    if (existing != coalescedErrors_.end()) {
+        existing->second.count++;
+        std::lock_guard<std::mutex> statsLock(statsMutex_);
+        stats_.errorsCoalesced++;
+        return;
+    }
+
+    CoalescedError entry;
+    entry.serializedRecord = record;
+    entry.count = 1;
+    coalescedErrors_.emplace(signature, std::move(entry));
+}
+
+size_t TelemetryService::TakeUploadBatch(std::vector<std::string>& batch) {
+    size_t byteCap;
+    {
+        std::lock_guard<std::mutex> configLock(configMutex_);
+        byteCap = static_cast<size_t>(config_.maxUploadBytesPerInterval);
+    }
+
+    std::lock_guard<std::mutex> lock(uploadMutex_);
+
+    // Coalesced errors join the backlog with their repeat count spliced
+    // into the record, so the endpoint sees one entry per signature
+    for (auto& [signature, entry] : coalescedErrors_) {
+        std::string record = std::move(entry.serializedRecord);
+        if (entry.count > 1) {
+            record.insert(1, "\"count\":" + std::to_string(entry.count) + ",");
+        }
+        uploadBacklog_.push_back(std::move(record));
+    }
+    coalescedErrors_.clear();
+
+    // Take whole records up to the per-interval bandwidth cap (always at
+    // least one - a record cannot be split); the rest waits for the next
+    // cycle
+    size_t bytes = 0;
+    size_t taken = 0;
+    while (taken < uploadBacklog_.size()) {
+        bytes += uploadBacklog_[taken].size() + 1;  // +1 newline separator
+        ++taken;
+        if (bytes >= byteCap) break;
+    }
+
+    batch.assign(std::make_move_iterator(uploadBacklog_.begin()),
+                 std::make_move_iterator(uploadBacklog_.begin() + taken));
+    uploadBacklog_.erase(uploadBacklog_.begin(), uploadBacklog_.begin() + taken);
+    return bytes;
+}
+
+void TelemetryService::UploadWorkerFunction() {
+    LOG_INFO("Telemetry upload worker started");
+
+    std::mt19937 jitterRng(std::random_device{}());
+    int consecutiveFailures = 0;
+
+    while (!uploadStopRequested_) {
+        int intervalSeconds, jitterSeconds, maxRetries;
+        {
+            std::lock_guard<std::mutex> configLock(configMutex_);
+            intervalSeconds = config_.uploadIntervalSeconds;
+            jitterSeconds = config_.uploadJitterSeconds;
+            maxRetries = config_.maxRetries;
+        }
+
+        // Jitter decorrelates the fleet: thousands of seats started by
+        // the same login storm would otherwise hit the endpoint in sync
+        int waitSeconds = intervalSeconds;
+        if (jitterSeconds > 0) {
+            waitSeconds += std::uniform_int_distribution<int>(0, jitterSeconds)(jitterRng);
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(uploadMutex_);
+            uploadCondition_.wait_for(lock, std::chrono::seconds(waitSeconds), [this]() {
+                return uploadStopRequested_.load();
+            });
+        }
+        if (uploadStopRequested_) {
+            break;
+        }
+
+        std::vector<std::string> batch;
+        if (TakeUploadBatch(batch) == 0) {
+            continue;
+        }
+
+        std::string payload;
+        for (const auto& record : batch) {
+            payload += record;
+            payload += '\n';
+        }
+
+        if (PerformUpload(payload)) {
+            consecutiveFailures = 0;
+            std::lock_guard<std::mutex> statsLock(statsMutex_);
+            stats_.uploadsSent++;
+        } else if (++consecutiveFailures > maxRetries) {
+            // Endpoint persistently unreachable: drop this batch rather
+            // than cycling it forever; the records remain in the offline
+            // spool on disk
+            consecutiveFailures = 0;
+            std::lock_guard<std::mutex> statsLock(statsMutex_);
+            stats_.uploadRecordsDropped += batch.size();
+        } else {
+            // Failed batch returns to the front for the next cycle
+            std::lock_guard<std::mutex> lock(uploadMutex_);
+            uploadBacklog_.insert(uploadBacklog_.begin(),
+                                  std::make_move_iterator(batch.begin()),
+                                  std::make_move_iterator(batch.end()));
+        }
+    }
+
+    LOG_INFO("Telemetry upload worker stopped");
+}
+
+bool TelemetryService::PerformUpload(const std::string& payload) {
+    std::string endpoint;
+    bool compress;
+    {
+        std::lock_guard<std::mutex> configLock(configMutex_);
+        endpoint = config_.endpoint;
+        compress = config_.compressUploads;
+    }
+    if (endpoint.empty() || payload.empty()) {
+        return false;
+    }
+
+    // LZ4-compress the batch; incompressible (or tiny) payloads ship raw
+    // with no Content-Encoding header
+    std::vector<uint8_t> compressed;
+    const char* body = payload.data();
+    size_t bodySize = payload.size();
+    bool usingCompression = false;
+    if (compress) {
+        auto result = Core::Lz4BlockCompress(
+            reinterpret_cast<const uint8_t*>(payload.data()), payload.size(),
+            payload.size(), compressed);
+        if (result) {
+            body = reinterpret_cast<const char*>(compressed.data());
+            bodySize = compressed.size();
+            usingCompression = true;
+        }
+    }
+
+    // The endpoint is a stable config value converted on every upload
+    // cycle; the intern table caches its wide form
+    const std::wstring& wideEndpoint =
+        Core::StringInternTable::GetInstance().Intern(endpoint).Utf16();
+    URL_COMPONENTS parts = {};
+    parts.dwStructSize = sizeof(parts);
+    wchar_t host[256] = {};
+    wchar_t path[1024] = {};
+    parts.lpszHostName = host;
+    parts.dwHostNameLength = 255;
+    parts.lpszUrlPath = path;
+    parts.dwUrlPathLength = 1023;
+    if (!WinHttpCrackUrl(wideEndpoint.c_str(), 0, 0, &parts)) {
+        LOG_WARNING("Telemetry upload: invalid endpoint URL");
+        return false;
+    }
+
+    bool success = false;
+    HINTERNET session = WinHttpOpen(L"RainmeterManager-Telemetry/1.0",
+                                    WINHTTP_ACCESS_TYPE_DEFAULT_PROXY,
+                                    WINHTTP_NO_PROXY_NAME, WINHTTP_NO_PROXY_BYPASS, 0);
+    HINTERNET connection = nullptr;
+    HINTERNET request = nullptr;
+
+    if (session) {
+        connection = WinHttpConnect(session, host, parts.nPort, 0);
+    }
+    if (connection) {
+        DWORD flags = parts.nScheme == INTERNET_SCHEME_HTTPS ? WINHTTP_FLAG_SECURE : 0;
+        request = WinHttpOpenRequest(connection, L"POST", path, nullptr,
+                                     WINHTTP_NO_REFERER, WINHTTP_DEFAULT_ACCEPT_TYPES, flags);
+    }
+    if (request) {
+        std::wstring headers = L"Content-Type: application/x-ndjson\r\n";
+        if (usingCompression) {
+            headers += L"Content-Encoding: lz4-block\r\n";
+            headers += L"X-Uncompressed-Size: " + std::to_wstring(payload.size()) + L"\r\n";
+        }
+
+        if (WinHttpSendRequest(request, headers.c_str(), static_cast<DWORD>(headers.size()),
+                               const_cast<char*>(body), static_cast<DWORD>(bodySize),
+                               static_cast<DWORD>(bodySize), 0) &&
+            WinHttpReceiveResponse(request, nullptr)) {
+            DWORD statusCode = 0;
+            DWORD statusSize = sizeof(statusCode);
+            WinHttpQueryHeaders(request,
+                                WINHTTP_QUERY_STATUS_CODE | WINHTTP_QUERY_FLAG_NUMBER,
+                                WINHTTP_HEADER_NAME_BY_INDEX, &statusCode,
+                                &statusSize, WINHTTP_NO_HEADER_INDEX);
+            success = statusCode >= 200 && statusCode < 300;
+        }
+    }
+
+    if (request) WinHttpCloseHandle(request);
+    if (connection) WinHttpCloseHandle(connection);
+    if (session) WinHttpCloseHandle(session);
+
+    if (success) {
+        std::lock_guard<std::mutex> statsLock(statsMutex_);
+        stats_.uploadBytesSent += bodySize;
+    }
+    return success;
+}
+
+// Spool events to local storage in one batched append
+void TelemetryService::SaveToLocalStorage(const std::vector<TelemetryEvent>& events) {
+    if (!config_.offlineStorage || events.empty()) {
+        return;
+    }
+
+    for (const auto& event : events) {
+        EnqueueSpoolRecord(SerializeEventToJson(event));
+    }
+}
+
+void TelemetryService::SaveErrorToLocalStorage(const ErrorTelemetry& error) {
+    if (!config_.offlineStorage) {
+        return;
+    }
+
+    EnqueueSpoolRecord(SerializeErrorToJson(error));
 }
 
 void TelemetryService::SaveMetricToLocalStorage(const PerformanceMetric& metric) {
     if (!config_.offlineStorage) {
         return;
     }
-    
-    try {
-        std::string filePath = GetStorageFilePath("metrics");
-        std::ofstream file(filePath, std::ios::app);
-        
-        if (file.is_open()) {
-            file << SerializeMetricToJson(metric) << std::endl;
-            file.close();
-        }
-    } catch (const std::exception& e) {
-        LOG_ERROR(std::string("Error saving metric telemetry: ") + e.what());
+
+    EnqueueSpoolRecord(SerializeMetricToJson(metric));
+}
+
+void TelemetryService::SaveAggregateToLocalStorage(const MetricAggregateSummary& summary) {
+    if (!config_.offlineStorage) {
+        return;
     }
+
+    EnqueueSpoolRecord(SerializeAggregateToJson(summary));
 }
 
 // JSON serialization helpers
@@ -586,6 +1144,28 @@ std::string TelemetryService::SerializeMetricToJson(const PerformanceMetric& met
     return json.str();
 }
 
+std::string TelemetryService::SerializeAggregateToJson(const MetricAggregateSummary& summary) const {
+    std::ostringstream json;
+    json << "{";
+    json << "\"metricName\":\"" << summary.metricName << "\",";
+    json << "\"aggregate\":true,";
+    json << "\"count\":" << summary.sampleCount << ",";
+    json << "\"sum\":" << summary.sum << ",";
+    json << "\"min\":" << summary.minimum << ",";
+    json << "\"max\":" << summary.maximum << ",";
+    json << "\"avg\":" << (summary.sum / static_cast<double>(summary.sampleCount)) << ",";
+    json << "\"bucketWidth\":" << summary.bucketWidth << ",";
+    json << "\"buckets\":[";
+    for (size_t i = 0; i < summary.buckets.size(); ++i) {
+        if (i > 0) json << ",";
+        json << summary.buckets[i];
+    }
+    json << "],";
+    json << "\"timestamp\":" << std::chrono::system_clock::to_time_t(summary.intervalEnd);
+    json << "}";
+    return json.str();
+}
+
 // ID generation
 std::string TelemetryService::GenerateEventId() const {
     std::random_device rd;
@@ -7,12 +7,15 @@
 #include <memory>
 #include <mutex>
 #include <queue>
+#include <deque>
 #include <thread>
 #include <condition_variable>
 #include <chrono>
 #include <atomic>
 #include <fstream>
 #include "../core/logger.h"
+#include "../core/memory_pool.h"
+#include "pii_scrubber.h"
 
 namespace RainmeterManager {
 namespace Services {
@@ -76,6 +79,18 @@ struct PerformanceMetric {
     std::unordered_map<std::string, std::string> tags;
 };
 
+// Snapshot of a pre-aggregated metric, flushed once per interval
+struct MetricAggregateSummary {
+    std::string metricName;
+    uint64_t sampleCount;
+    double sum;
+    double minimum;
+    double maximum;
+    double bucketWidth;
+    std::vector<uint64_t> buckets;  // last bucket collects overflow
+    std::chrono::system_clock::time_point intervalEnd;
+};
+
 // Telemetry configuration
 struct TelemetryConfig {
     bool enabled = true;
@@ -89,6 +104,19 @@ struct TelemetryConfig {
     std::string storageDirectory;
     std::string endpoint;                  // Optional remote endpoint
     bool offlineStorage = true;            // Store locally if offline
+    int spoolRingCapacity = 4096;          // Slots in the lock-free spool ring (rounded up to a power of two)
+    int spoolMaxFileSizeMB = 8;            // Spool file size before rotation
+
+    // Remote upload pipeline (active only when endpoint is set). Records
+    // accumulate between uploads, identical error signatures coalesce to
+    // one record with a count, and each cycle ships one LZ4-compressed
+    // batch. Jitter spreads the fleet's upload times so thousands of
+    // seats don't hit the endpoint on the same schedule tick.
+    int uploadIntervalSeconds = 300;       // Base upload cadence
+    int uploadJitterSeconds = 60;          // Uniform random addition per cycle
+    int maxUploadBytesPerInterval = 262144; // Bandwidth cap per cycle (uncompressed)
+    int maxUploadBacklog = 20000;          // Pending records before drop-oldest
+    bool compressUploads = true;           // LZ4 block compression on batches
 };
 
 /**
@@ -159,6 +187,19 @@ public:
         MetricType type = MetricType::Gauge
     );
 
+    // Pre-aggregated metrics for high-frequency series (frame time, IPC
+    // latency). TrackMetric allocates a PerformanceMetric with two maps
+    // per data point; these instead update a fixed-bucket histogram in
+    // place with atomics and flush one summary record per interval.
+    // Register all handles at startup, before the hot path runs.
+    static constexpr size_t INVALID_AGGREGATE_HANDLE = static_cast<size_t>(-1);
+    size_t RegisterAggregatedMetric(
+        const std::string& metricName,
+        double bucketWidth,
+        size_t bucketCount = 32
+    );
+    void TrackAggregatedMetric(size_t handle, double value);
+
     // Timer helpers
     class ScopedTimer {
     public:
@@ -196,6 +237,11 @@ public:
         uint64_t errorsTracked;
         uint64_t metricsTracked;
         uint64_t rateLimitHits;
+        uint64_t spoolRecordsDropped;
+        uint64_t uploadsSent;
+        uint64_t uploadBytesSent;        // On-the-wire bytes (post-compression)
+        uint64_t uploadRecordsDropped;   // Backlog overflow while offline
+        uint64_t errorsCoalesced;
     };
     Statistics GetStatistics() const;
 
@@ -209,10 +255,14 @@ private:
     std::string userId_;  // Anonymous hashed ID
     std::chrono::system_clock::time_point sessionStart_;
 
-    // Event queue and processing
-    std::queue<TelemetryEvent> eventQueue_;
-    std::queue<ErrorTelemetry> errorQueue_;
-    std::queue<PerformanceMetric> metricQueue_;
+    // Event queue and processing; queue node churn recycles through the
+    // tagged Telemetry pool and is attributed in MemoryRegistry
+    template <typename T>
+    using TelemetryQueue =
+        std::queue<T, std::deque<T, Core::TaggedAllocator<T, Core::MemoryTag::Telemetry>>>;
+    TelemetryQueue<TelemetryEvent> eventQueue_;
+    TelemetryQueue<ErrorTelemetry> errorQueue_;
+    TelemetryQueue<PerformanceMetric> metricQueue_;
     mutable std::mutex queueMutex_;
     std::condition_variable queueCondition_;
 
@@ -221,6 +271,70 @@ private:
     std::atomic<bool> running_;
     std::atomic<bool> stopRequested_;
 
+    // PII scrubbing runs over batches on the worker thread (see
+    // pii_scrubber.h), never inline on the tracking call
+    PiiScrubber piiScrubber_;
+
+    // Spool ring: bounded lock-free MPMC ring (Vyukov sequence scheme)
+    // holding serialized records. Producers push without taking a lock;
+    // one writer thread drains batches into a single append-only spool
+    // file with length-prefixed records, rotating by size. Bounded by
+    // design: under a storm, excess records are dropped and counted
+    // rather than saturating the disk queue with file-per-event writes.
+    class SpoolRing {
+    public:
+        explicit SpoolRing(size_t capacity);
+        bool TryPush(std::string&& record);
+        bool TryPop(std::string& record);
+    private:
+        struct Slot {
+            std::atomic<size_t> sequence;
+            std::string record;
+        };
+        std::unique_ptr<Slot[]> slots_;
+        size_t mask_;
+        std::atomic<size_t> enqueuePos_;
+        std::atomic<size_t> dequeuePos_;
+    };
+    std::unique_ptr<SpoolRing> spoolRing_;
+    std::unique_ptr<std::thread> spoolThread_;
+    std::condition_variable spoolCondition_;
+    std::mutex spoolWakeMutex_;  // Only pairs with spoolCondition_; never on the push path
+    std::atomic<bool> spoolStopRequested_;
+
+    // Pre-aggregated metrics. Slots are fixed so the hot path can
+    // dereference a registered handle without locking; registration
+    // publishes the count with release semantics.
+    struct AggregatedMetric {
+        std::string metricName;
+        double bucketWidth;
+        std::vector<std::atomic<uint64_t>> buckets;
+        std::atomic<uint64_t> sampleCount;
+        std::atomic<double> sum;
+        std::atomic<double> minimum;
+        std::atomic<double> maximum;
+        AggregatedMetric(const std::string& name, double width, size_t bucketCount);
+    };
+    static constexpr size_t MAX_AGGREGATED_METRICS = 64;
+    std::unique_ptr<AggregatedMetric> aggregates_[MAX_AGGREGATED_METRICS];
+    std::atomic<size_t> aggregateCount_;
+    std::mutex aggregateRegisterMutex_;
+
+    // Upload pipeline. uploadBacklog_ accumulates serialized records
+    // between cycles (bounded drop-oldest); identical error signatures
+    // (component + code + message) coalesce into one entry with a count
+    // instead of filling the backlog with repeats of the same failure.
+    struct CoalescedError {
+        std::string serializedRecord;   // First occurrence, count spliced in at upload
+        uint64_t count = 0;
+    };
+    std::vector<std::string> uploadBacklog_;
+    std::unordered_map<std::string, CoalescedError> coalescedErrors_;
+    std::mutex uploadMutex_;
+    std::condition_variable uploadCondition_;
+    std::unique_ptr<std::thread> uploadThread_;
+    std::atomic<bool> uploadStopRequested_{false};
+
     // Rate limiting
     std::chrono::steady_clock::time_point lastMinute_;
     std::atomic<int> eventsThisMinute_;
@@ -238,14 +352,29 @@ private:
     void SaveToLocalStorage(const std::vector<TelemetryEvent>& events);
     void SaveErrorToLocalStorage(const ErrorTelemetry& error);
     void SaveMetricToLocalStorage(const PerformanceMetric& metric);
+    void FlushAggregatedMetrics();
+    void SaveAggregateToLocalStorage(const MetricAggregateSummary& summary);
+    void EnqueueSpoolRecord(std::string&& record);
+    void SpoolWriterFunction();
+    void DrainSpoolToFile(std::ofstream& spool, uint64_t& bytesWritten);
+    void RotateSpoolFile(std::ofstream& spool, uint64_t& bytesWritten);
+    std::string GetSpoolFilePath() const;
     std::string GenerateEventId() const;
     std::string GenerateSessionId() const;
     std::string GenerateUserId() const;
     std::string SerializeEventToJson(const TelemetryEvent& event) const;
     std::string SerializeErrorToJson(const ErrorTelemetry& error) const;
     std::string SerializeMetricToJson(const PerformanceMetric& metric) const;
+    std::string SerializeAggregateToJson(const MetricAggregateSummary& summary) const;
     void EnsureStorageDirectory();
     std::string GetStorageFilePath(const std::string& prefix) const;
+
+    // Upload pipeline internals
+    void QueueForUpload(std::string&& record);
+    void CoalesceErrorForUpload(const ErrorTelemetry& error);
+    void UploadWorkerFunction();
+    size_t TakeUploadBatch(std::vector<std::string>& batch);
+    bool PerformUpload(const std::string& payload);
 };
 
 // Convenience macros
@@ -1,5 +1,6 @@
 #include "dashboard_tab.h"
 #include "ui_theme.h"
+#include "ui_paint_context.h"
 #include "ui_prefs.h"
 #include "../render/ipc/render_ipc_bridge.h"
 #include "../render/interfaces/render_command.h"
@@ -13,11 +14,11 @@ using namespace RainmeterManager::UI;
 static const wchar_t* kDashboardTabClass = L"RainmeterManagerDashboardTab";
 static const wchar_t* kTileClass = L"RainmeterManagerTile";
 
+// Posted by the collector thread when a fresh snapshot is pending
+static constexpr UINT kSnapshotReadyMsg = WM_APP + 1;
+
 namespace {
     ThemeColors gTheme{};
-    HBRUSH gBgBrush = nullptr;
-    HFONT gTileTitleFont = nullptr;
-    HFONT gTileMetricFont = nullptr;
 
     LRESULT CALLBACK TileProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam) {
         switch (msg) {
@@ -27,33 +28,25 @@ namespace {
         case WM_SETFONT:
             // Allow WM_SETFONT to pass through
             return 0;
-        case WM_ERASEBKGND: {
-            HDC hdc = (HDC)wParam;
-            RECT rc; GetClientRect(hwnd, &rc);
-            HBRUSH hbr = CreateSolidBrush(gTheme.Background);
-            FillRect(hdc, &rc, hbr);
-            DeleteObject(hbr);
+        case WM_ERASEBKGND:
+            // WM_PAINT fills the whole client rect offscreen; erasing
+            // the window DC here would just reintroduce flicker.
             return 1;
-        }
         case WM_PAINT: {
-            PAINTSTRUCT ps; HDC hdc = BeginPaint(hwnd, &ps);
-            RECT rc; GetClientRect(hwnd, &rc);
+            BufferedPaint bp(hwnd);
+            HDC hdc = bp.Dc();
+            const RECT& rc = bp.Rect();
+            FillRect(hdc, &rc, CachedSolidBrush(gTheme.Background));
 
             // Draw card background with rounded rect
             const int radius = 12;
             RECT card = rc; InflateRect(&card, -8, -8);
 
-            HBRUSH cardBrush = CreateSolidBrush(gTheme.Card);
-            HBRUSH borderBrush = CreateSolidBrush(gTheme.CardBorder);
-            HPEN borderPen = CreatePen(PS_SOLID, 1, gTheme.CardBorder);
-            HGDIOBJ oldPen = SelectObject(hdc, borderPen);
-            HGDIOBJ oldBrush = SelectObject(hdc, cardBrush);
+            HGDIOBJ oldPen = SelectObject(hdc, CachedSolidPen(1, gTheme.CardBorder));
+            HGDIOBJ oldBrush = SelectObject(hdc, CachedSolidBrush(gTheme.Card));
             RoundRect(hdc, card.left, card.top, card.right, card.bottom, radius, radius);
             SelectObject(hdc, oldBrush);
             SelectObject(hdc, oldPen);
-            DeleteObject(cardBrush);
-            DeleteObject(borderPen);
-            DeleteObject(borderBrush);
 
             // Tile text: use window text
             wchar_t text[256];
@@ -72,18 +65,17 @@ namespace {
 
             SetBkMode(hdc, TRANSPARENT);
             SetTextColor(hdc, gTheme.TextSecondary);
-            HFONT oldFont = (HFONT)SelectObject(hdc, gTileTitleFont);
+            HFONT oldFont = (HFONT)SelectObject(hdc, CachedUIFont(11, FW_SEMIBOLD));
 
             RECT titleRc = card; titleRc.bottom = titleRc.top + (card.bottom - card.top) / 3;
             DrawTextW(hdc, title.c_str(), -1, &titleRc, DT_LEFT | DT_VCENTER | DT_SINGLELINE | DT_END_ELLIPSIS | DT_NOPREFIX);
 
             SetTextColor(hdc, gTheme.TextPrimary);
-            SelectObject(hdc, gTileMetricFont);
+            SelectObject(hdc, CachedUIFont(20, FW_BOLD));
             RECT metricRc = card; metricRc.top = titleRc.bottom + 6;
             DrawTextW(hdc, metric.empty() ? L"--" : metric.c_str(), -1, &metricRc, DT_LEFT | DT_TOP | DT_SINGLELINE | DT_END_ELLIPSIS | DT_NOPREFIX);
 
             SelectObject(hdc, oldFont);
-            EndPaint(hwnd, &ps);
             return 0;
         }
         default:
@@ -95,7 +87,9 @@ namespace {
 DashboardTab::DashboardTab(HINSTANCE hInstance, HWND hParentTab)
     : hInstance_(hInstance), hParentTab_(hParentTab) {}
 
-DashboardTab::~DashboardTab() {}
+DashboardTab::~DashboardTab() {
+    StopPolling();
+}
 
 bool DashboardTab::Create() {
     // Register parent (container) class
@@ -119,11 +113,6 @@ bool DashboardTab::Create() {
     wct.hbrBackground = nullptr;
     RegisterClass(&wct);
 
-    // Create theme resources
-    if (!gBgBrush) gBgBrush = CreateSolidBrush(gTheme.Background);
-    if (!gTileTitleFont) gTileTitleFont = CreateUIFont(11, FW_SEMIBOLD);
-    if (!gTileMetricFont) gTileMetricFont = CreateUIFont(20, FW_BOLD);
-
     hwnd_ = CreateWindowEx(WS_EX_COMPOSITED, kDashboardTabClass, L"",
         WS_CHILD | WS_VISIBLE,
         0, 0, 100, 100,
@@ -161,18 +150,15 @@ LRESULT DashboardTab::HandleMessage(HWND hwnd, UINT msg, WPARAM wParam, LPARAM l
     case WM_ERASEBKGND: {
         HDC hdc = (HDC)wParam;
         RECT rc; GetClientRect(hwnd_, &rc);
-        FillRect(hdc, &rc, gBgBrush);
+        FillRect(hdc, &rc, CachedSolidBrush(gTheme.Background));
         return 1;
     }
     case WM_SIZE:
         LayoutChildren();
         return 0;
-    case WM_TIMER:
-        if (wParam == 1001) {
-            RequestAndUpdateSnapshot();
-            return 0;
-        }
-        break;
+    case kSnapshotReadyMsg:
+        ApplySnapshot();
+        return 0;
     case WM_DESTROY:
         StopPolling();
         break;
@@ -197,9 +183,9 @@ void DashboardTab::CreateChildren() {
         0, 0, 100, 24, hwnd_, nullptr, hInstance_, nullptr);
 
     // Apply fonts
-    SendMessageW(hTileCpu_, WM_SETFONT, (WPARAM)gTileTitleFont, TRUE);
-    SendMessageW(hTileMem_, WM_SETFONT, (WPARAM)gTileTitleFont, TRUE);
-    SendMessageW(hTileNet_, WM_SETFONT, (WPARAM)gTileTitleFont, TRUE);
+    SendMessageW(hTileCpu_, WM_SETFONT, (WPARAM)CachedUIFont(11, FW_SEMIBOLD), TRUE);
+    SendMessageW(hTileMem_, WM_SETFONT, (WPARAM)CachedUIFont(11, FW_SEMIBOLD), TRUE);
+    SendMessageW(hTileNet_, WM_SETFONT, (WPARAM)CachedUIFont(11, FW_SEMIBOLD), TRUE);
 
     // Start polling IPC after creating children
     StartPolling();
@@ -222,20 +208,15 @@ void DashboardTab::LayoutChildren() {
 }
 
 void DashboardTab::StartPolling() {
-    UI::GeneralPrefs gp{};
-    bool useIPC = UI::LoadGeneralPrefs(gp) ? gp.enableIPC : false;
-    if (useIPC) {
-        EnsureIPC();
-    }
-    if (timerId_ == 0) {
-        timerId_ = SetTimer(hwnd_, 1001, 1000, nullptr); // 1s
-    }
+    if (collectorThread_.joinable()) return;
+    collectorStop_ = false;
+    collectorThread_ = std::thread(&DashboardTab::CollectorLoop, this);
 }
 
 void DashboardTab::StopPolling() {
-    if (timerId_ != 0) {
-        KillTimer(hwnd_, timerId_);
-        timerId_ = 0;
+    collectorStop_ = true;
+    if (collectorThread_.joinable()) {
+        collectorThread_.join();
     }
 }
 
@@ -319,17 +300,35 @@ bool DashboardTab::ExtractDouble(const std::string& json, const char* keyPascal,
     } catch (...) { return false; }
 }
 
-void DashboardTab::RequestAndUpdateSnapshot() {
+void DashboardTab::CollectorLoop() {
+    while (!collectorStop_) {
+        auto snapshot = std::make_shared<DashboardSnapshot>();
+        bool changed = CollectSnapshot(*snapshot);
+
+        if (changed) {
+            {
+                std::lock_guard<std::mutex> lock(snapshotMutex_);
+                pendingSnapshot_ = std::move(snapshot);
+            }
+            PostMessageW(hwnd_, kSnapshotReadyMsg, 0, 0);
+        }
+
+        // 1s cadence, sliced so StopPolling never waits a full period
+        for (int i = 0; i < 10 && !collectorStop_; ++i) {
+            Sleep(100);
+        }
+    }
+}
+
+bool DashboardTab::CollectSnapshot(DashboardSnapshot& out) {
     UI::GeneralPrefs gp{};
     bool useIPC = UI::LoadGeneralPrefs(gp) ? gp.enableIPC : false;
     if (!useIPC) {
-        SetWindowTextW(hTileCpu_, L"CPU: --%");
-        SetWindowTextW(hTileMem_, L"Memory: -- / -- MB");
-        SetWindowTextW(hTileNet_, L"Network: Rx -- MB/s | Tx -- MB/s");
-        return;
+        out.fromIpc = false;
+        return true;
     }
     EnsureIPC();
-    if (!ipc_) return;
+    if (!ipc_) return false;
 
     RainmeterManager::Render::RenderCommand cmd{};
     cmd.commandId = localCommandId_++;
@@ -341,23 +340,58 @@ void DashboardTab::RequestAndUpdateSnapshot() {
     cmd.timestamp = (uint64_t)GetTickCount64();
 
     auto result = ipc_->SendCommand(cmd, 1500);
-    if (result.status == RainmeterManager::Render::RenderResultStatus::Success) {
-        const std::string& json = result.errorMessage;
-        // Parse fields (support both PascalCase and camelCase)
-        double cpu = 0.0, memUsed = 0.0, memTotal = 0.0, rx = 0.0, tx = 0.0;
-        ExtractDouble(json, "CpuTotalPercent", "cpuTotalPercent", cpu);
-        ExtractDouble(json, "MemoryUsedMB", "memoryUsedMB", memUsed);
-        ExtractDouble(json, "MemoryTotalMB", "memoryTotalMB", memTotal);
-        ExtractDouble(json, "NetworkRecvMBps", "networkRecvMBps", rx);
-        ExtractDouble(json, "NetworkSendMBps", "networkSendMBps", tx);
-
-        std::wstring cpuText = L"CPU: " + FormatDouble(cpu, 1) + L"%";
-        std::wstring memText = L"Memory: " + FormatDouble(memUsed, 0) + L" / " + FormatDouble(memTotal, 0) + L" MB";
-        std::wstring netText = L"Network: Rx " + FormatDouble(rx, 2) + L" MB/s | Tx " + FormatDouble(tx, 2) + L" MB/s";
+    if (result.status != RainmeterManager::Render::RenderResultStatus::Success) {
+        return false;  // Keep showing the last good snapshot
+    }
+
+    const std::string& json = result.errorMessage;
+    // Parse fields (support both PascalCase and camelCase)
+    out.fromIpc = true;
+    ExtractDouble(json, "CpuTotalPercent", "cpuTotalPercent", out.cpu);
+    ExtractDouble(json, "MemoryUsedMB", "memoryUsedMB", out.memUsed);
+    ExtractDouble(json, "MemoryTotalMB", "memoryTotalMB", out.memTotal);
+    ExtractDouble(json, "NetworkRecvMBps", "networkRecvMBps", out.rx);
+    ExtractDouble(json, "NetworkSendMBps", "networkSendMBps", out.tx);
+    return true;
+}
+
+void DashboardTab::ApplySnapshot() {
+    std::shared_ptr<const DashboardSnapshot> snapshot;
+    {
+        std::lock_guard<std::mutex> lock(snapshotMutex_);
+        snapshot = std::move(pendingSnapshot_);
+    }
+    if (!snapshot) return;
 
+    const DashboardSnapshot* prev = currentSnapshot_.get();
+
+    if (!snapshot->fromIpc) {
+        if (!prev || prev->fromIpc) {
+            SetWindowTextW(hTileCpu_, L"CPU: --%");
+            SetWindowTextW(hTileMem_, L"Memory: -- / -- MB");
+            SetWindowTextW(hTileNet_, L"Network: Rx -- MB/s | Tx -- MB/s");
+        }
+        currentSnapshot_ = std::move(snapshot);
+        return;
+    }
+
+    // Repaint only tiles whose values differ from the previous snapshot;
+    // SetWindowText invalidates the tile, so unchanged tiles cost nothing
+    bool sourceChanged = !prev || !prev->fromIpc;
+
+    if (sourceChanged || prev->cpu != snapshot->cpu) {
+        std::wstring cpuText = L"CPU: " + FormatDouble(snapshot->cpu, 1) + L"%";
         SetWindowTextW(hTileCpu_, cpuText.c_str());
+    }
+    if (sourceChanged || prev->memUsed != snapshot->memUsed || prev->memTotal != snapshot->memTotal) {
+        std::wstring memText = L"Memory: " + FormatDouble(snapshot->memUsed, 0) + L" / " + FormatDouble(snapshot->memTotal, 0) + L" MB";
         SetWindowTextW(hTileMem_, memText.c_str());
+    }
+    if (sourceChanged || prev->rx != snapshot->rx || prev->tx != snapshot->tx) {
+        std::wstring netText = L"Network: Rx " + FormatDouble(snapshot->rx, 2) + L" MB/s | Tx " + FormatDouble(snapshot->tx, 2) + L" MB/s";
         SetWindowTextW(hTileNet_, netText.c_str());
     }
+
+    currentSnapshot_ = std::move(snapshot);
 }
 
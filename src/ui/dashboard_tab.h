@@ -4,6 +4,9 @@
 #include <windows.h>
 #include <string>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <atomic>
 #include "ui_theme.h"
 
 namespace RainmeterManager {
@@ -28,11 +31,27 @@ private:
     void CreateChildren();
     void LayoutChildren();
 
-    // IPC wiring
+    // Immutable dashboard state assembled off-thread. The collector
+    // builds a complete snapshot (IPC round trip and parsing included),
+    // publishes it, and the UI thread just swaps a pointer and repaints
+    // tiles whose values changed — WM_PAINT never waits on data.
+    struct DashboardSnapshot {
+        bool fromIpc = false;
+        double cpu = 0.0;
+        double memUsed = 0.0;
+        double memTotal = 0.0;
+        double rx = 0.0;
+        double tx = 0.0;
+    };
+
+    // IPC wiring (collector thread only; the UI thread never touches ipc_)
     void StartPolling();
     void StopPolling();
     void EnsureIPC();
-    void RequestAndUpdateSnapshot();
+    void CollectorLoop();
+    bool CollectSnapshot(DashboardSnapshot& out);
+    // UI thread: swap in the pending snapshot and update changed tiles
+    void ApplySnapshot();
     bool ResolveRenderProcess(std::wstring& outPath, std::wstring& outArgs);
 
     static bool ExtractDouble(const std::string& json, const char* keyPascal, const char* keyCamel, double& outVal);
@@ -47,9 +66,15 @@ private:
     HWND hTileNet_ = nullptr;
 
     // State
-    UINT_PTR timerId_ = 0;
     std::unique_ptr<RainmeterManager::Render::RenderIPCBridge> ipc_;
     uint64_t localCommandId_ = 1;
+
+    // Snapshot double-buffer
+    std::thread collectorThread_;
+    std::atomic<bool> collectorStop_{false};
+    std::mutex snapshotMutex_;
+    std::shared_ptr<const DashboardSnapshot> pendingSnapshot_;
+    std::shared_ptr<const DashboardSnapshot> currentSnapshot_;
 };
 
 } // namespace UI
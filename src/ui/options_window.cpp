@@ -1,5 +1,6 @@
 #include "options_window.h"
 #include "ui_theme.h"
+#include "ui_paint_context.h"
 #include <commctrl.h>
 
 #pragma comment(lib, "comctl32.lib")
@@ -10,8 +11,6 @@ static const wchar_t* kOptionsClass = L"RainmeterManagerOptionsWindow";
 
 namespace {
     ThemeColors gTheme{};
-    HBRUSH gBgBrush = nullptr;
-    HFONT gTabFont = nullptr;
 }
 
 OptionsWindow::OptionsWindow(HINSTANCE hInstance)
@@ -34,9 +33,6 @@ bool OptionsWindow::Create() {
         if (err != ERROR_CLASS_ALREADY_EXISTS) return false;
     }
 
-    if (!gBgBrush) gBgBrush = CreateSolidBrush(gTheme.Background);
-    if (!gTabFont) gTabFont = CreateUIFont(10, FW_SEMIBOLD);
-
     hwnd_ = CreateWindowEx(
         WS_EX_APPWINDOW | WS_EX_COMPOSITED,
         kOptionsClass,
@@ -76,7 +72,7 @@ LRESULT OptionsWindow::HandleMessage(HWND hwnd, UINT msg, WPARAM wParam, LPARAM
     case WM_ERASEBKGND: {
         HDC hdc = (HDC)wParam;
         RECT rc; GetClientRect(hwnd_, &rc);
-        FillRect(hdc, &rc, gBgBrush);
+        FillRect(hdc, &rc, CachedSolidBrush(gTheme.Background));
         return 1;
     }
     case WM_SIZE:
@@ -106,24 +102,20 @@ LRESULT OptionsWindow::HandleMessage(HWND hwnd, UINT msg, WPARAM wParam, LPARAM
             bool selected = (dis->itemState & ODS_SELECTED) != 0;
 
             // Background
-            HBRUSH bg = CreateSolidBrush(gTheme.Background);
-            FillRect(hdc, &r, bg);
-            DeleteObject(bg);
+            FillRect(hdc, &r, CachedSolidBrush(gTheme.Background));
 
             // Bottom border / accent for selected
             if (selected) {
-                HPEN pen = CreatePen(PS_SOLID, 3, gTheme.Accent);
-                HGDIOBJ oldPen = SelectObject(hdc, pen);
+                HGDIOBJ oldPen = SelectObject(hdc, CachedSolidPen(3, gTheme.Accent));
                 MoveToEx(hdc, r.left + 6, r.bottom - 2, nullptr);
                 LineTo(hdc, r.right - 6, r.bottom - 2);
                 SelectObject(hdc, oldPen);
-                DeleteObject(pen);
             }
 
             // Text
             SetBkMode(hdc, TRANSPARENT);
             SetTextColor(hdc, selected ? gTheme.TextPrimary : gTheme.TextSecondary);
-            HFONT old = (HFONT)SelectObject(hdc, gTabFont);
+            HFONT old = (HFONT)SelectObject(hdc, CachedUIFont(10, FW_SEMIBOLD));
             DrawTextW(hdc, text, -1, &r, DT_CENTER | DT_VCENTER | DT_SINGLELINE | DT_END_ELLIPSIS);
             SelectObject(hdc, old);
             return TRUE;
@@ -146,7 +138,7 @@ void OptionsWindow::CreateTabs() {
         hwnd_, nullptr, hInstance_, nullptr);
 
     // Apply tab font
-    SendMessageW(hTab_, WM_SETFONT, (WPARAM)gTabFont, TRUE);
+    SendMessageW(hTab_, WM_SETFONT, (WPARAM)CachedUIFont(10, FW_SEMIBOLD), TRUE);
 
     TCITEM tie{}; tie.mask = TCIF_TEXT;
     tie.pszText = const_cast<LPWSTR>(L"Dashboard");
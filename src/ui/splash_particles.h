@@ -0,0 +1,320 @@
+#ifndef SPLASH_PARTICLES_H
+#define SPLASH_PARTICLES_H
+
+#include <cstdint>
+#include <cmath>
+#include <mutex>
+#include <vector>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#include <emmintrin.h>
+#define RMM_SPLASH_SIM_SSE2 1
+#endif
+
+namespace RainmeterManager {
+namespace UI {
+
+/**
+ * @brief Per-ripple values the renderer needs for one frame
+ */
+struct RippleRenderState {
+    float centerX;
+    float centerY;
+    float radius;
+    float alpha;
+};
+
+/**
+ * @brief Per-leaf values the renderer needs for one frame
+ */
+struct LeafRenderState {
+    float x;
+    float y;          // Bobbing already applied
+    float rotation;
+};
+
+/**
+ * @brief Frame-coherent copy of particle state for the render thread
+ */
+struct ParticleRenderSnapshot {
+    std::vector<RippleRenderState> ripples;
+    std::vector<LeafRenderState> leaves;
+};
+
+/**
+ * @brief SoA particle simulation for the cinematic splash screen
+ *
+ * Ripple and leaf state lives in contiguous structure-of-arrays float
+ * lanes instead of per-object structs, so the per-frame integration
+ * (radius growth, amplitude decay, bob phase advance, drift toward
+ * target) runs as batch kernels four lanes at a time under SSE2 with a
+ * scalar fallback elsewhere. Transcendentals (sin for bobbing) are only
+ * evaluated when a snapshot is published, once per particle per frame.
+ *
+ * Simulation and rendering are decoupled: the animation thread calls
+ * Step, which integrates and publishes a snapshot under a short lock;
+ * the UI thread calls CaptureSnapshot and draws from its own copy, so
+ * particle count scales without the paint handler ever waiting on
+ * physics (or vice versa).
+ */
+class SplashParticleSystem {
+public:
+    struct Params {
+        float impactRadius = 50.0f;     // Ripple starting radius
+        float rippleSpeed = 300.0f;     // Radius growth per second
+        float rippleDecay = 0.95f;      // Amplitude decay factor per second
+        float rippleLifetime = 5.0f;    // Seconds before forced deactivation
+        float rippleFadeTime = 3.0f;    // Seconds over which alpha ramps out
+        float leafDriftRate = 0.5f;     // Fraction of remaining distance per second
+        float leafBobAmplitude = 3.0f;  // Vertical bob in pixels
+    };
+
+    /**
+     * @brief Size the lanes; discards existing particles
+     */
+    void Configure(const Params& params, size_t maxRipples, size_t leafCount) {
+        params_ = params;
+
+        rippleCenterX_.assign(maxRipples, 0.0f);
+        rippleCenterY_.assign(maxRipples, 0.0f);
+        rippleRadius_.assign(maxRipples, 0.0f);
+        rippleAmplitude_.assign(maxRipples, 0.0f);
+        rippleAge_.assign(maxRipples, 0.0f);
+        rippleActive_.assign(maxRipples, 0);
+        nextRipple_ = 0;
+
+        leafX_.assign(leafCount, 0.0f);
+        leafY_.assign(leafCount, 0.0f);
+        leafTargetX_.assign(leafCount, 0.0f);
+        leafTargetY_.assign(leafCount, 0.0f);
+        leafRotation_.assign(leafCount, 0.0f);
+        leafBobPhase_.assign(leafCount, 0.0f);
+        leafBobSpeed_.assign(leafCount, 0.0f);
+    }
+
+    /**
+     * @brief Place one leaf (call after Configure, before stepping)
+     */
+    void SeedLeaf(size_t index, float x, float y, float rotation, float bobSpeed) {
+        if (index >= leafX_.size()) {
+            return;
+        }
+        leafX_[index] = x;
+        leafY_[index] = y;
+        leafTargetX_[index] = x;
+        leafTargetY_[index] = y;
+        leafRotation_[index] = rotation;
+        leafBobPhase_[index] = 0.0f;
+        leafBobSpeed_[index] = bobSpeed;
+    }
+
+    /**
+     * @brief Activate a ripple in the next free slot (thread-safe)
+     */
+    void SpawnRipple(float x, float y, float intensity) {
+        std::lock_guard<std::mutex> lock(spawnMutex_);
+        pendingSpawns_.push_back({x, y, intensity});
+    }
+
+    /**
+     * @brief Integrate one simulation step and publish a snapshot
+     *
+     * Simulation-thread only.
+     */
+    void Step(float deltaTime) {
+        DrainSpawns();
+        StepRipples(deltaTime);
+        StepLeaves(deltaTime);
+        PublishSnapshot();
+    }
+
+    /**
+     * @brief Copy the most recently published frame for rendering
+     */
+    void CaptureSnapshot(ParticleRenderSnapshot& out) const {
+        std::lock_guard<std::mutex> lock(snapshotMutex_);
+        out = published_;
+    }
+
+    size_t GetMaxRipples() const { return rippleCenterX_.size(); }
+    size_t GetLeafCount() const { return leafX_.size(); }
+
+private:
+    struct SpawnRequest {
+        float x;
+        float y;
+        float intensity;
+    };
+
+    void DrainSpawns() {
+        std::lock_guard<std::mutex> lock(spawnMutex_);
+        for (const auto& spawn : pendingSpawns_) {
+            size_t count = rippleActive_.size();
+            for (size_t i = 0; i < count; ++i) {
+                size_t slot = (nextRipple_ + i) % count;
+                if (!rippleActive_[slot]) {
+                    rippleCenterX_[slot] = spawn.x;
+                    rippleCenterY_[slot] = spawn.y;
+                    rippleRadius_[slot] = params_.impactRadius;
+                    rippleAmplitude_[slot] = spawn.intensity;
+                    rippleAge_[slot] = 0.0f;
+                    rippleActive_[slot] = 1;
+                    nextRipple_ = (slot + 1) % count;
+                    break;
+                }
+            }
+        }
+        pendingSpawns_.clear();
+    }
+
+    // values[i] = values[i] * scale + add, four lanes at a time
+    static void ScaleAddLanes(float* values, size_t count, float scale, float add) {
+        size_t i = 0;
+#ifdef RMM_SPLASH_SIM_SSE2
+        __m128 vScale = _mm_set1_ps(scale);
+        __m128 vAdd = _mm_set1_ps(add);
+        for (; i + 4 <= count; i += 4) {
+            __m128 v = _mm_loadu_ps(values + i);
+            v = _mm_add_ps(_mm_mul_ps(v, vScale), vAdd);
+            _mm_storeu_ps(values + i, v);
+        }
+#endif
+        for (; i < count; ++i) {
+            values[i] = values[i] * scale + add;
+        }
+    }
+
+    // values[i] += rates[i] * deltaTime, four lanes at a time
+    static void IntegrateLanes(float* values, const float* rates, size_t count,
+                               float deltaTime) {
+        size_t i = 0;
+#ifdef RMM_SPLASH_SIM_SSE2
+        __m128 vDt = _mm_set1_ps(deltaTime);
+        for (; i + 4 <= count; i += 4) {
+            __m128 v = _mm_loadu_ps(values + i);
+            __m128 r = _mm_loadu_ps(rates + i);
+            v = _mm_add_ps(v, _mm_mul_ps(r, vDt));
+            _mm_storeu_ps(values + i, v);
+        }
+#endif
+        for (; i < count; ++i) {
+            values[i] += rates[i] * deltaTime;
+        }
+    }
+
+    void StepRipples(float deltaTime) {
+        size_t count = rippleRadius_.size();
+        if (count == 0) {
+            return;
+        }
+
+        // Per-step decay factor once, then pure multiplies per lane
+        float decayFactor = std::pow(params_.rippleDecay, deltaTime);
+
+        ScaleAddLanes(rippleRadius_.data(), count, 1.0f, params_.rippleSpeed * deltaTime);
+        ScaleAddLanes(rippleAmplitude_.data(), count, decayFactor, 0.0f);
+        ScaleAddLanes(rippleAge_.data(), count, 1.0f, deltaTime);
+
+        // Deactivation is a cheap scalar sweep over the age/amplitude lanes
+        for (size_t i = 0; i < count; ++i) {
+            if (rippleActive_[i] &&
+                (rippleAge_[i] > params_.rippleLifetime || rippleAmplitude_[i] < 0.01f)) {
+                rippleActive_[i] = 0;
+            }
+        }
+    }
+
+    void StepLeaves(float deltaTime) {
+        size_t count = leafX_.size();
+        if (count == 0) {
+            return;
+        }
+
+        IntegrateLanes(leafBobPhase_.data(), leafBobSpeed_.data(), count, deltaTime);
+
+        // Exponential drift toward target: x += (target - x) * rate * dt
+        float blend = params_.leafDriftRate * deltaTime;
+        if (blend > 1.0f) {
+            blend = 1.0f;
+        }
+        size_t i = 0;
+#ifdef RMM_SPLASH_SIM_SSE2
+        __m128 vBlend = _mm_set1_ps(blend);
+        for (; i + 4 <= count; i += 4) {
+            __m128 x = _mm_loadu_ps(leafX_.data() + i);
+            __m128 tx = _mm_loadu_ps(leafTargetX_.data() + i);
+            _mm_storeu_ps(leafX_.data() + i,
+                          _mm_add_ps(x, _mm_mul_ps(_mm_sub_ps(tx, x), vBlend)));
+
+            __m128 y = _mm_loadu_ps(leafY_.data() + i);
+            __m128 ty = _mm_loadu_ps(leafTargetY_.data() + i);
+            _mm_storeu_ps(leafY_.data() + i,
+                          _mm_add_ps(y, _mm_mul_ps(_mm_sub_ps(ty, y), vBlend)));
+        }
+#endif
+        for (; i < count; ++i) {
+            leafX_[i] += (leafTargetX_[i] - leafX_[i]) * blend;
+            leafY_[i] += (leafTargetY_[i] - leafY_[i]) * blend;
+        }
+    }
+
+    void PublishSnapshot() {
+        scratch_.ripples.clear();
+        scratch_.leaves.clear();
+
+        for (size_t i = 0; i < rippleActive_.size(); ++i) {
+            if (!rippleActive_[i]) {
+                continue;
+            }
+            float fade = 1.0f - (rippleAge_[i] / params_.rippleFadeTime);
+            if (fade <= 0.0f) {
+                continue;
+            }
+            scratch_.ripples.push_back(
+                {rippleCenterX_[i], rippleCenterY_[i], rippleRadius_[i],
+                 rippleAmplitude_[i] * fade});
+        }
+
+        for (size_t i = 0; i < leafX_.size(); ++i) {
+            float bob = std::sin(leafBobPhase_[i]) * params_.leafBobAmplitude;
+            scratch_.leaves.push_back({leafX_[i], leafY_[i] + bob, leafRotation_[i]});
+        }
+
+        std::lock_guard<std::mutex> lock(snapshotMutex_);
+        std::swap(published_, scratch_);
+    }
+
+    Params params_;
+
+    // Ripple lanes (SoA)
+    std::vector<float> rippleCenterX_;
+    std::vector<float> rippleCenterY_;
+    std::vector<float> rippleRadius_;
+    std::vector<float> rippleAmplitude_;
+    std::vector<float> rippleAge_;
+    std::vector<uint8_t> rippleActive_;
+    size_t nextRipple_ = 0;
+
+    // Leaf lanes (SoA)
+    std::vector<float> leafX_;
+    std::vector<float> leafY_;
+    std::vector<float> leafTargetX_;
+    std::vector<float> leafTargetY_;
+    std::vector<float> leafRotation_;
+    std::vector<float> leafBobPhase_;
+    std::vector<float> leafBobSpeed_;
+
+    // Spawn requests crossing from other threads into the sim step
+    std::mutex spawnMutex_;
+    std::vector<SpawnRequest> pendingSpawns_;
+
+    // Double-buffered publication to the render thread
+    mutable std::mutex snapshotMutex_;
+    ParticleRenderSnapshot published_;
+    ParticleRenderSnapshot scratch_;
+};
+
+} // namespace UI
+} // namespace RainmeterManager
+
+#endif // SPLASH_PARTICLES_H
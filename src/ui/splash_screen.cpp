@@ -1,5 +1,6 @@
 #include "splash_screen.h"
 #include "../core/logger_adapter.h"
+#include "../core/resource_bundle.h"
 #include <dwmapi.h>
 #include <shellapi.h>
 #include <random>
@@ -61,7 +62,6 @@ CinematicSplashScreen::CinematicSplashScreen(HINSTANCE hInstance, const Config&
     , dropVelocity_(0)
     , dropVisible_(false)
     , dropFalling_(false)
-    , nextRippleIndex_(0)
     , audioEnumerator_(nullptr)
     , audioDevice_(nullptr)
     , audioClient_(nullptr)
@@ -88,9 +88,13 @@ CinematicSplashScreen::CinematicSplashScreen(HINSTANCE hInstance, const Config&
         return;
     }
     
-    // Initialize ripples array
-    ripples_.resize(config_.physics.maxRipples);
-    
+    // Size the particle simulation lanes from the physics config
+    SplashParticleSystem::Params simParams;
+    simParams.impactRadius = config_.physics.impactRadius;
+    simParams.rippleSpeed = config_.physics.rippleSpeed;
+    simParams.rippleDecay = config_.physics.rippleDecay;
+    particleSim_.Configure(simParams, static_cast<size_t>(config_.physics.maxRipples), 3);
+
     // Initialize leaves
     InitializeLeaves();
     
@@ -418,12 +422,258 @@ bool CinematicSplashScreen::LoadResources() {
     titleFormat_->SetParagraphAlignment(DWRITE_PARAGRAPH_ALIGNMENT_CENTER);
     statusFormat_->SetTextAlignment(DWRITE_TEXT_ALIGNMENT_CENTER);
     statusFormat_->SetParagraphAlignment(DWRITE_PARAGRAPH_ALIGNMENT_CENTER);
-    
+
+    // Background asset and cached layers are device-dependent; reload them
+    // whenever the render target is (re)created
+    if (!config_.backgroundImagePath.empty()) {
+        LoadBackgroundAsset();
+    }
+    InvalidateStaticLayers();
+
     return true;
 }
 
+bool CinematicSplashScreen::BuildStaticLayers() {
+    if (!renderTarget_) {
+        return false;
+    }
+
+    InvalidateStaticLayers();
+
+    ID2D1BitmapRenderTarget* layerTarget = nullptr;
+    HRESULT hr = renderTarget_->CreateCompatibleRenderTarget(&layerTarget);
+    if (FAILED(hr) || !layerTarget) {
+        LogEvent(L"Failed to create offscreen target for static layers", ::LogLevel::WARNING);
+        return false;
+    }
+
+    D2D1_SIZE_F size = layerTarget->GetSize();
+    float surfaceY = size.height * 0.7f;
+
+    layerTarget->BeginDraw();
+    layerTarget->Clear(D2D1::ColorF(0.0f, 0.0f, 0.0f, 0.0f));
+
+    // Decoded background asset, if one was configured
+    if (backgroundAsset_) {
+        layerTarget->DrawBitmap(
+            backgroundAsset_,
+            D2D1::RectF(0, 0, size.width, size.height),
+            1.0f,
+            D2D1_BITMAP_INTERPOLATION_MODE_LINEAR
+        );
+    }
+
+    // Water body: vertical gradient from the surface line to the bottom
+    ID2D1GradientStopCollection* bodyStops = nullptr;
+    D2D1_GRADIENT_STOP stops[3] = {
+        { 0.0f, D2D1::ColorF(0.15f, 0.35f, 0.6f, 0.5f) },
+        { 0.4f, D2D1::ColorF(0.08f, 0.22f, 0.45f, 0.6f) },
+        { 1.0f, D2D1::ColorF(0.03f, 0.1f, 0.25f, 0.7f) }
+    };
+    hr = layerTarget->CreateGradientStopCollection(
+        stops, 3, D2D1_GAMMA_2_2, D2D1_EXTEND_MODE_CLAMP, &bodyStops
+    );
+    if (SUCCEEDED(hr)) {
+        ID2D1LinearGradientBrush* bodyBrush = nullptr;
+        hr = layerTarget->CreateLinearGradientBrush(
+            D2D1::LinearGradientBrushProperties(
+                D2D1::Point2F(0, surfaceY),
+                D2D1::Point2F(0, size.height)
+            ),
+            bodyStops, &bodyBrush
+        );
+        if (SUCCEEDED(hr)) {
+            layerTarget->FillRectangle(
+                D2D1::RectF(0, surfaceY, size.width, size.height), bodyBrush
+            );
+            bodyBrush->Release();
+        }
+        bodyStops->Release();
+    }
+
+    // Fixed depth bands below the surface (these used to be redrawn as
+    // part of the per-frame line loop even though they never move)
+    ID2D1SolidColorBrush* bandBrush = nullptr;
+    hr = layerTarget->CreateSolidColorBrush(
+        D2D1::ColorF(0.1f, 0.3f, 0.6f, 1.0f), &bandBrush
+    );
+    if (SUCCEEDED(hr)) {
+        for (int i = 0; i < 14; ++i) {
+            float y = surfaceY + 12.0f + i * 9.0f;
+            bandBrush->SetOpacity(0.12f - i * 0.006f);
+            layerTarget->DrawLine(
+                D2D1::Point2F(0, y),
+                D2D1::Point2F(size.width, y),
+                bandBrush, 2.0f
+            );
+        }
+
+        // Reflection highlights: soft mirrored glints just under the surface
+        if (config_.enableReflections) {
+            bandBrush->SetColor(D2D1::ColorF(0.8f, 0.92f, 1.0f, 1.0f));
+            for (int i = 0; i < 5; ++i) {
+                float cx = size.width * (0.15f + i * 0.175f);
+                float cy = surfaceY + 18.0f + (i % 2) * 10.0f;
+                bandBrush->SetOpacity(0.08f);
+                layerTarget->FillEllipse(
+                    D2D1::Ellipse(D2D1::Point2F(cx, cy), size.width * 0.06f, 6.0f),
+                    bandBrush
+                );
+            }
+        }
+        bandBrush->Release();
+    }
+
+    hr = layerTarget->EndDraw();
+    if (SUCCEEDED(hr)) {
+        hr = layerTarget->GetBitmap(&staticLayerBitmap_);
+    }
+    layerTarget->Release();
+
+    if (FAILED(hr) || !staticLayerBitmap_) {
+        LogEvent(L"Failed to compose static background layers", ::LogLevel::WARNING);
+        return false;
+    }
+
+    staticLayerValid_ = true;
+    return true;
+}
+
+void CinematicSplashScreen::InvalidateStaticLayers() {
+    if (staticLayerBitmap_) {
+        staticLayerBitmap_->Release();
+        staticLayerBitmap_ = nullptr;
+    }
+    staticLayerValid_ = false;
+}
+
+bool CinematicSplashScreen::LoadBackgroundAsset() {
+    if (!renderTarget_) {
+        return false;
+    }
+
+    if (backgroundAsset_) {
+        backgroundAsset_->Release();
+        backgroundAsset_ = nullptr;
+    }
+
+    // Prefer the packed asset bundle: the archive is already mapped, so
+    // resolving the asset is a binary search plus page-in with no file open
+    const BYTE* encoded = nullptr;
+    DWORD encodedSize = 0;
+    if (!config_.backgroundBundleAsset.empty()) {
+        const auto& bundle = RainmeterManager::Core::SharedResourceBundle();
+        if (bundle.IsOpen()) {
+            auto asset = bundle.Find(config_.backgroundBundleAsset);
+            if (asset.IsValid() && asset.size <= MAXDWORD) {
+                encoded = asset.data;
+                encodedSize = static_cast<DWORD>(asset.size);
+            } else {
+                LogEvent(L"Background asset not in bundle: " + config_.backgroundBundleAsset,
+                         ::LogLevel::WARNING);
+            }
+        }
+    }
+
+    // Loose-file fallback: map the encoded file read-only; WIC decodes
+    // straight from the view so the compressed bytes never get a heap copy
+    HANDLE hFile = INVALID_HANDLE_VALUE;
+    HANDLE hMapping = nullptr;
+    void* view = nullptr;
+    if (!encoded) {
+        hFile = CreateFileW(
+            config_.backgroundImagePath.c_str(), GENERIC_READ, FILE_SHARE_READ,
+            nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr
+        );
+        if (hFile == INVALID_HANDLE_VALUE) {
+            LogEvent(L"Background asset not found: " + config_.backgroundImagePath,
+                     ::LogLevel::WARNING);
+            return false;
+        }
+
+        LARGE_INTEGER fileSize = {};
+        if (GetFileSizeEx(hFile, &fileSize) && fileSize.QuadPart > 0 &&
+            fileSize.QuadPart <= MAXDWORD) {
+            hMapping = CreateFileMappingW(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (hMapping) {
+                view = MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+            }
+        }
+        if (view) {
+            encoded = static_cast<const BYTE*>(view);
+            encodedSize = static_cast<DWORD>(fileSize.QuadPart);
+        }
+    }
+
+    bool loaded = false;
+    if (encoded) {
+        IWICImagingFactory* wicFactory = nullptr;
+        HRESULT hr = CoCreateInstance(
+            CLSID_WICImagingFactory, nullptr, CLSCTX_INPROC_SERVER,
+            IID_PPV_ARGS(&wicFactory)
+        );
+        if (SUCCEEDED(hr)) {
+            IWICStream* stream = nullptr;
+            IWICBitmapDecoder* decoder = nullptr;
+            IWICBitmapFrameDecode* frame = nullptr;
+            IWICFormatConverter* converter = nullptr;
+
+            hr = wicFactory->CreateStream(&stream);
+            if (SUCCEEDED(hr)) {
+                hr = stream->InitializeFromMemory(
+                    const_cast<BYTE*>(encoded), encodedSize
+                );
+            }
+            if (SUCCEEDED(hr)) {
+                hr = wicFactory->CreateDecoderFromStream(
+                    stream, nullptr, WICDecodeMetadataCacheOnDemand, &decoder
+                );
+            }
+            if (SUCCEEDED(hr)) {
+                hr = decoder->GetFrame(0, &frame);
+            }
+            if (SUCCEEDED(hr)) {
+                hr = wicFactory->CreateFormatConverter(&converter);
+            }
+            if (SUCCEEDED(hr)) {
+                hr = converter->Initialize(
+                    frame, GUID_WICPixelFormat32bppPBGRA,
+                    WICBitmapDitherTypeNone, nullptr, 0.0,
+                    WICBitmapPaletteTypeMedianCut
+                );
+            }
+            if (SUCCEEDED(hr)) {
+                // Pixels are uploaded to the GPU here; the mapping can be
+                // released as soon as this returns
+                hr = renderTarget_->CreateBitmapFromWicBitmap(
+                    converter, nullptr, &backgroundAsset_
+                );
+            }
+            loaded = SUCCEEDED(hr) && backgroundAsset_;
+
+            if (converter) converter->Release();
+            if (frame) frame->Release();
+            if (decoder) decoder->Release();
+            if (stream) stream->Release();
+            wicFactory->Release();
+        }
+    }
+
+    if (view) UnmapViewOfFile(view);
+    if (hMapping) CloseHandle(hMapping);
+    if (hFile != INVALID_HANDLE_VALUE) CloseHandle(hFile);
+
+    if (!loaded) {
+        LogEvent(L"Failed to decode background asset: " + config_.backgroundImagePath,
+                 ::LogLevel::WARNING);
+    }
+    return loaded;
+}
+
 void CinematicSplashScreen::CleanupResources() {
     StopLifecycleWatchdog();
+    InvalidateStaticLayers();
+    if (backgroundAsset_) { backgroundAsset_->Release(); backgroundAsset_ = nullptr; }
     if (rippleGradientBrush_) rippleGradientBrush_->Release();
     if (leafBrush_) leafBrush_->Release();
     if (dropBrush_) dropBrush_->Release();
@@ -492,12 +742,29 @@ void CinematicSplashScreen::OnPaint() {
         return;
     }
     
+    // Pull the simulation's latest published frame; drawing below never
+    // touches live particle state
+    particleSim_.CaptureSnapshot(particleSnapshot_);
+
     renderTarget_->BeginDraw();
-    
+
     // Clear with transparent background
     renderTarget_->Clear(D2D1::ColorF(0.0f, 0.1f, 0.2f, config_.transparency));
-    
-    // Render water background
+
+    // Static layers (asset, water body, depth bands, reflections) come
+    // from the offscreen cache as one bitmap draw
+    if (!staticLayerValid_) {
+        BuildStaticLayers();
+    }
+    if (staticLayerBitmap_) {
+        D2D1_SIZE_F size = renderTarget_->GetSize();
+        renderTarget_->DrawBitmap(
+            staticLayerBitmap_,
+            D2D1::RectF(0, 0, size.width, size.height)
+        );
+    }
+
+    // Render animated water surface shimmer
     RenderWaterBackground();
     
     // Render floating leaves
@@ -533,7 +800,13 @@ void CinematicSplashScreen::OnPaint() {
     
     HRESULT hr = renderTarget_->EndDraw();
     if (hr == D2DERR_RECREATE_TARGET) {
-        // Need to recreate render target
+        // Need to recreate render target; everything device-dependent goes
+        // with it, including the cached layers and decoded asset
+        InvalidateStaticLayers();
+        if (backgroundAsset_) {
+            backgroundAsset_->Release();
+            backgroundAsset_ = nullptr;
+        }
         renderTarget_->Release();
         renderTarget_ = nullptr;
         LoadResources();
@@ -548,12 +821,14 @@ void CinematicSplashScreen::RenderWaterBackground() {
     // Create subtle water movement effect
     auto now = std::chrono::steady_clock::now();
     auto elapsed = std::chrono::duration<float>(now - startTime_).count();
-    
-    // Draw water surface with gentle waves
-    for (int i = 0; i < 20; ++i) {
+
+    // Only the animated shimmer at the surface line is drawn per frame;
+    // the water body, depth bands and reflections come from the cached
+    // static layer composed in BuildStaticLayers
+    for (int i = 0; i < 6; ++i) {
         float y = size.height * 0.7f + std::sin(elapsed * 0.5f + i * 0.3f) * 5.0f;
         float alpha = 0.1f + 0.1f * std::sin(elapsed * 0.3f + i * 0.5f);
-        
+
         waterBrush_->SetOpacity(alpha);
         renderTarget_->DrawLine(
             D2D1::Point2F(0, y),
@@ -565,24 +840,14 @@ void CinematicSplashScreen::RenderWaterBackground() {
 
 void CinematicSplashScreen::RenderFloatingLeaves() {
     if (!leafBrush_) return;
-    
-    auto now = std::chrono::steady_clock::now();
-    D2D1_SIZE_F size = renderTarget_->GetSize();
-    
-    for (auto& leaf : leaves_) {
-        if (!leaf.visible) continue;
-        
-        auto elapsed = std::chrono::duration<float>(now - leaf.startTime).count();
-        
-        // Update leaf position with gentle floating motion
-        leaf.bobOffset = std::sin(elapsed * leaf.bobSpeed) * 3.0f;
-        
+
+    // Bobbing is already applied in the snapshot by the simulation step
+    leafBrush_->SetOpacity(0.7f);
+    for (const auto& leaf : particleSnapshot_.leaves) {
         D2D1_ELLIPSE leafEllipse = D2D1::Ellipse(
-            D2D1::Point2F(leaf.x, leaf.y + leaf.bobOffset),
+            D2D1::Point2F(leaf.x, leaf.y),
             15.0f, 8.0f
         );
-        
-        leafBrush_->SetOpacity(0.7f);
         renderTarget_->FillEllipse(leafEllipse, leafBrush_);
     }
 }
@@ -602,30 +867,19 @@ void CinematicSplashScreen::RenderWaterDrop() {
 
 void CinematicSplashScreen::RenderRipples() {
     if (!rippleGradientBrush_) return;
-    
-    auto now = std::chrono::steady_clock::now();
-    
-    for (const auto& ripple : ripples_) {
-        if (!ripple.active) continue;
-        
-        auto elapsed = std::chrono::duration<float>(now - ripple.startTime).count();
-        float normalizedTime = elapsed / 3.0f; // Ripple lasts 3 seconds
-        
-        if (normalizedTime >= 1.0f) continue;
-        
-        // Update gradient center
+
+    // Snapshot alpha already folds amplitude decay and fade-out together
+    for (const auto& ripple : particleSnapshot_.ripples) {
         rippleGradientBrush_->SetCenter(D2D1::Point2F(ripple.centerX, ripple.centerY));
         rippleGradientBrush_->SetRadiusX(ripple.radius);
         rippleGradientBrush_->SetRadiusY(ripple.radius);
-        
-        float alpha = ripple.amplitude * (1.0f - normalizedTime);
-        rippleGradientBrush_->SetOpacity(alpha);
-        
+        rippleGradientBrush_->SetOpacity(ripple.alpha);
+
         D2D1_ELLIPSE rippleEllipse = D2D1::Ellipse(
             D2D1::Point2F(ripple.centerX, ripple.centerY),
             ripple.radius, ripple.radius
         );
-        
+
         renderTarget_->DrawEllipse(rippleEllipse, rippleGradientBrush_, 2.0f);
     }
 }
@@ -743,12 +997,9 @@ void CinematicSplashScreen::AnimationThreadFunc() {
         if (dropVisible_ && dropFalling_) {
             UpdateWaterDrop(deltaTime);
         }
-        
-        // Update ripples
-        UpdateRipples(deltaTime);
-        
-        // Update leaves
-        UpdateLeaves(deltaTime);
+
+        // Batch-integrate ripples and leaves and publish the render snapshot
+        particleSim_.Step(deltaTime);
 
         // Rotate witty messages
         if (config_.enableAutoMessages) {
@@ -810,61 +1061,19 @@ void CinematicSplashScreen::UpdateWaterDrop(float deltaTime) {
     }
 }
 
-void CinematicSplashScreen::UpdateRipples(float deltaTime) {
-    auto now = std::chrono::steady_clock::now();
-    
-    for (auto& ripple : ripples_) {
-        if (!ripple.active) continue;
-        
-        auto elapsed = std::chrono::duration<float>(now - ripple.startTime).count();
-        
-        // Update ripple properties
-        ripple.radius = config_.physics.impactRadius + 
-                       config_.physics.rippleSpeed * elapsed;
-        ripple.amplitude = std::pow(config_.physics.rippleDecay, elapsed);
-        
-        // Deactivate old ripples
-        if (elapsed > 5.0f || ripple.amplitude < 0.01f) {
-            ripple.active = false;
-        }
-    }
-}
-
-void CinematicSplashScreen::UpdateLeaves(float deltaTime) {
-    // Gentle floating motion for leaves is handled in rendering
-    // This could be expanded for more complex leaf physics
-}
-
 void CinematicSplashScreen::CreateRipple(float x, float y, float intensity) {
-    // Find next available ripple slot
-    for (int i = 0; i < config_.physics.maxRipples; ++i) {
-        int index = (nextRippleIndex_ + i) % config_.physics.maxRipples;
-        if (!ripples_[index].active) {
-            ripples_[index].centerX = x;
-            ripples_[index].centerY = y;
-            ripples_[index].radius = config_.physics.impactRadius;
-            ripples_[index].amplitude = intensity;
-            ripples_[index].phase = 0;
-            ripples_[index].startTime = std::chrono::steady_clock::now();
-            ripples_[index].active = true;
-            nextRippleIndex_ = (index + 1) % config_.physics.maxRipples;
-            break;
-        }
-    }
+    particleSim_.SpawnRipple(x, y, intensity);
 }
 
 void CinematicSplashScreen::InitializeLeaves() {
-    leaves_.resize(3); // Start with 3 leaves
-    
-    for (size_t i = 0; i < leaves_.size(); ++i) {
-        leaves_[i].x = config_.width * (0.2f + 0.6f * dis(gen));
-        leaves_[i].y = config_.height * 0.7f + dis(gen) * 20.0f;
-        leaves_[i].targetX = leaves_[i].x;
-        leaves_[i].targetY = leaves_[i].y;
-        leaves_[i].rotation = dis(gen) * TWO_PI;
-        leaves_[i].bobSpeed = 1.0f + dis(gen) * 2.0f;
-        leaves_[i].startTime = std::chrono::steady_clock::now();
-        leaves_[i].visible = true;
+    for (size_t i = 0; i < particleSim_.GetLeafCount(); ++i) {
+        particleSim_.SeedLeaf(
+            i,
+            config_.width * (0.2f + 0.6f * dis(gen)),
+            config_.height * 0.7f + dis(gen) * 20.0f,
+            dis(gen) * TWO_PI,
+            1.0f + dis(gen) * 2.0f
+        );
     }
 }
 
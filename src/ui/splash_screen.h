@@ -21,6 +21,7 @@
 #include <vector>
 #include <cmath>
 #include "ui_framework.h"
+#include "splash_particles.h"
 #include "../core/logger.h"
 
 #pragma comment(lib, "d2d1.lib")
@@ -63,35 +64,8 @@ public:
         float animationSpeed = 0.3f;         // Slow motion factor (0.3 = 30% speed)
     };
 
-    /**
-     * @brief Ripple effect data
-     */
-    struct Ripple {
-        float centerX, centerY;              // Ripple center
-        float radius;                        // Current radius
-        float amplitude;                     // Current amplitude
-        float phase;                         // Animation phase
-        std::chrono::steady_clock::time_point startTime;
-        bool active;
-        
-        Ripple() : centerX(0), centerY(0), radius(0), amplitude(0), phase(0), active(false) {}
-    };
-
-    /**
-     * @brief Leaf object floating on water
-     */
-    struct FloatingLeaf {
-        float x, y;                          // Current position
-        float targetX, targetY;              // Target position
-        float rotation;                      // Current rotation
-        float bobOffset;                     // Vertical bobbing offset
-        float bobSpeed;                      // Bobbing animation speed
-        std::chrono::steady_clock::time_point startTime;
-        bool visible;
-        
-        FloatingLeaf() : x(0), y(0), targetX(0), targetY(0), rotation(0), 
-                        bobOffset(0), bobSpeed(2.0f), visible(true) {}
-    };
+    // Ripple and leaf state lives in SplashParticleSystem (SoA lanes in
+    // splash_particles.h); the renderer draws from ParticleRenderSnapshot.
 
     /**
      * @brief Cinematic splash screen configuration
@@ -111,6 +85,8 @@ public:
         WaterDropPhysics physics;            // Water physics parameters
         bool enableParticles = true;         // Enable water particle effects
         bool enableReflections = true;       // Enable water reflections
+        std::wstring backgroundImagePath;    // Optional background asset (decoded from a memory-mapped file)
+        std::wstring backgroundBundleAsset;  // Bundle-relative asset path; preferred over the loose file when the shared bundle is open
         float ambientVolume = 0.3f;          // Ambient sound volume (0.0-1.0)
         bool enableAutoMessages = true;      // Rotate helpful or witty messages
     };
@@ -296,6 +272,32 @@ private:
     void RenderRipples();
     void RenderUI();
 
+    /**
+     * @brief Compose the static background layers into an offscreen cache
+     *
+     * The water body gradient, depth bands and reflection highlights never
+     * change between frames, so they are rendered once into a compatible
+     * offscreen target and replayed as a single bitmap draw per frame.
+     * Rebuilt lazily after the render target is recreated.
+     */
+    bool BuildStaticLayers();
+
+    /**
+     * @brief Drop the cached static layer (forces rebuild on next paint)
+     */
+    void InvalidateStaticLayers();
+
+    /**
+     * @brief Decode the optional background asset from mapped memory
+     *
+     * Resolves backgroundBundleAsset from the shared packed bundle first
+     * (already mapped; lookup is a binary search plus page-in), falling
+     * back to mapping the loose backgroundImagePath file read-only. WIC
+     * decodes straight from the mapped bytes either way, so the
+     * compressed data is never copied to the heap.
+     */
+    bool LoadBackgroundAsset();
+
     /**
      * @brief Animation thread function
      */
@@ -339,8 +341,6 @@ private:
     // Animation helpers
     void TriggerWaterDrop(float x = -1.0f, float y = -1.0f);
     void UpdateWaterDrop(float deltaTime);
-    void UpdateRipples(float deltaTime);
-    void UpdateLeaves(float deltaTime);
     void CreateRipple(float x, float y, float intensity);
     void InitializeLeaves();
 
@@ -359,6 +359,11 @@ private:
     ID2D1SolidColorBrush* leafBrush_ = nullptr;
     ID2D1RadialGradientBrush* rippleGradientBrush_ = nullptr;
 
+    // Cached static background layers (see BuildStaticLayers)
+    ID2D1Bitmap* staticLayerBitmap_ = nullptr;
+    ID2D1Bitmap* backgroundAsset_ = nullptr;
+    bool staticLayerValid_ = false;
+
     // Audio resources
     IMMDeviceEnumerator* audioEnumerator_ = nullptr;
     IMMDevice* audioDevice_ = nullptr;
@@ -372,10 +377,12 @@ private:
     bool dropVisible_ = false;
     bool dropFalling_ = false;
 
-    // Ripple/leaf animation
-    std::vector<Ripple> ripples_;
-    std::vector<FloatingLeaf> leaves_;
-    int nextRippleIndex_ = 0;
+    // Ripple/leaf simulation (SoA, batch kernels) and the render-side
+    // copy it publishes each step. The animation thread steps the
+    // simulation; OnPaint captures and draws the snapshot, so neither
+    // thread ever blocks on the other's frame.
+    SplashParticleSystem particleSim_;
+    ParticleRenderSnapshot particleSnapshot_;
     std::chrono::steady_clock::time_point dropStartTime_;
 
     // Audio state
@@ -2,12 +2,14 @@
 #include "../render/ipc/render_ipc_bridge.h"
 #include "../render/interfaces/render_command.h"
 #include "ui_theme.h"
+#include "ui_paint_context.h"
 #include "ui_prefs.h"
 #include <commctrl.h>
 #include <windowsx.h>
 #include <string>
 #include <vector>
 #include <algorithm>
+#include <cstdlib>
 #include <deque>
 #include <unordered_map>
 #include "dashboard_tab.h"
@@ -159,6 +161,10 @@ LRESULT TaskManagerTab::HandleMessage(HWND hwnd, UINT msg, WPARAM wParam, LPARAM
                 SaveTaskManagerPrefs(p);
                 return 0;
             }
+            if (hdr->code == LVN_GETDISPINFOW) {
+                OnGetDispInfo(reinterpret_cast<NMLVDISPINFOW*>(lParam));
+                return 0;
+            }
             if (hdr->code == LVN_ITEMCHANGED) {
                 auto nmlv = reinterpret_cast<LPNMLISTVIEW>(lParam);
                 if ((nmlv->uChanged & LVIF_STATE) && ((nmlv->uNewState ^ nmlv->uOldState) & LVIS_SELECTED)) {
@@ -205,11 +211,12 @@ LRESULT CALLBACK TaskManagerTab::SummaryProc(HWND hwnd, UINT msg, WPARAM wParam,
     }
     auto self = reinterpret_cast<TaskManagerTab*>(GetWindowLongPtr(hwnd, GWLP_USERDATA));
     switch (msg) {
+    case WM_ERASEBKGND:
+        // DrawSummary fills the whole rect through the back buffer
+        return 1;
     case WM_PAINT: {
-        PAINTSTRUCT ps; HDC hdc = BeginPaint(hwnd, &ps);
-        RECT rc; GetClientRect(hwnd, &rc);
-        if (self) self->DrawSummary(hdc, rc);
-        EndPaint(hwnd, &ps);
+        BufferedPaint bp(hwnd);
+        if (self) self->DrawSummary(bp.Dc(), bp.Rect());
         return 0;
     }
     default:
@@ -218,9 +225,7 @@ LRESULT CALLBACK TaskManagerTab::SummaryProc(HWND hwnd, UINT msg, WPARAM wParam,
 }
 
 void TaskManagerTab::DrawSummary(HDC hdc, const RECT& rc) {
-    HBRUSH bg = CreateSolidBrush(RGB(32,34,37));
-    FillRect(hdc, &rc, bg);
-    DeleteObject(bg);
+    FillRect(hdc, &rc, CachedSolidBrush(RGB(32,34,37)));
     int w = rc.right - rc.left;
     int h = rc.bottom - rc.top;
     int pad = 8;
@@ -228,18 +233,18 @@ void TaskManagerTab::DrawSummary(HDC hdc, const RECT& rc) {
 
     auto drawChart = [&](int x, int y, int cw, int ch, const std::deque<double>& data, COLORREF color, const wchar_t* label, const wchar_t* value) {
         RECT box{ x, y, x + cw, y + ch };
-        HBRUSH boxBg = CreateSolidBrush(RGB(45,47,51)); FillRect(hdc, &box, boxBg); DeleteObject(boxBg);
+        FillRect(hdc, &box, CachedSolidBrush(RGB(45,47,51)));
         Rectangle(hdc, box.left, box.top, box.right, box.bottom);
         // label
         SetBkMode(hdc, TRANSPARENT); SetTextColor(hdc, RGB(160,165,175));
         RECT lr{ box.left + 6, box.top + 4, box.right - 6, box.top + 20 }; DrawTextW(hdc, label, -1, &lr, DT_LEFT | DT_VCENTER | DT_SINGLELINE | DT_END_ELLIPSIS);
         // value
-        SetTextColor(hdc, RGB(230,234,239)); HFONT font = CreateUIFont(12, FW_BOLD); HGDIOBJ of = SelectObject(hdc, font);
+        SetTextColor(hdc, RGB(230,234,239)); HGDIOBJ of = SelectObject(hdc, CachedUIFont(12, FW_BOLD));
         RECT vr{ box.left + 6, box.top + 22, box.right - 6, box.top + 40 }; DrawTextW(hdc, value, -1, &vr, DT_LEFT | DT_VCENTER | DT_SINGLELINE | DT_END_ELLIPSIS);
-        SelectObject(hdc, of); DeleteObject(font);
+        SelectObject(hdc, of);
         // sparkline
         if (data.size() > 1) {
-            HPEN pen = CreatePen(PS_SOLID, 1, color); HGDIOBJ op = SelectObject(hdc, pen);
+            HGDIOBJ op = SelectObject(hdc, CachedSolidPen(1, color));
             int n = (int)data.size(); int gw = cw - 12; int gh = ch - 44;
             int gx = box.left + 6; int gy = box.top + 44;
             for (int i = 0; i < n; ++i) {
@@ -256,7 +261,7 @@ void TaskManagerTab::DrawSummary(HDC hdc, const RECT& rc) {
                 }
                 if (i == 0) MoveToEx(hdc, x, y, nullptr); else LineTo(hdc, x, y);
             }
-            SelectObject(hdc, op); DeleteObject(pen);
+            SelectObject(hdc, op);
         }
     };
 
@@ -331,9 +336,10 @@ void TaskManagerTab::CreateChildren() {
         WS_CHILD | WS_VISIBLE,
         0, 0, 100, 60, hwnd_, nullptr, hInstance_, this);
 
-    // List view
+    // List view in virtual mode: the control asks for cell text on
+    // demand instead of owning hundreds of recreated rows per poll
     hList_ = CreateWindowEx(WS_EX_CLIENTEDGE, WC_LISTVIEW, L"",
-        WS_CHILD | WS_VISIBLE | LVS_REPORT | LVS_SINGLESEL | LVS_SHOWSELALWAYS,
+        WS_CHILD | WS_VISIBLE | LVS_REPORT | LVS_SINGLESEL | LVS_SHOWSELALWAYS | LVS_OWNERDATA,
         0, 0, 100, 100, hwnd_, nullptr, hInstance_, nullptr);
 
     // Load user prefs
@@ -356,12 +362,12 @@ void TaskManagerTab::InitListView() {
 }
 
 void TaskManagerTab::PopulatePlaceholder() {
-    LVITEM item{}; item.mask = LVIF_TEXT; item.iItem = 0; item.iSubItem = 0;
-    item.pszText = const_cast<LPWSTR>(L"1234"); ListView_InsertItem(hList_, &item);
-    ListView_SetItemText(hList_, 0, 1, const_cast<LPWSTR>(L"example.exe"));
-    ListView_SetItemText(hList_, 0, 2, const_cast<LPWSTR>(L"0.0"));
-    ListView_SetItemText(hList_, 0, 3, const_cast<LPWSTR>(L"12.3"));
-    ListView_SetItemText(hList_, 0, 4, const_cast<LPWSTR>(L"8"));
+    // Owner-data list: seed the backing rows and set the count; the
+    // control pulls the text through LVN_GETDISPINFO
+    Row r{1234, L"example.exe", 0.0f, 12ULL, 8, L"", L"", 0.0f, 0.0f, L"", L"", false};
+    lastRows_.clear();
+    lastRows_.push_back(r);
+    RebuildDisplay();
 }
 
 void TaskManagerTab::LayoutChildren() {
@@ -466,6 +472,7 @@ void TaskManagerTab::ToggleColumnVisibility(int columnIndex) {
     if (columnIndex < 0 || columnIndex >= (int)colVisible_.size()) return;
     colVisible_[columnIndex] = !colVisible_[columnIndex];
     BuildColumns();
+    prevDisplayRows_.clear();  // Column layout changed; force a full redraw
     RebuildDisplay();
     RainmeterManager::UI::TaskManagerPrefs p{colVisible_, sortColumn_, sortAsc_, filterText_};
     SaveTaskManagerPrefs(p);
@@ -517,7 +524,7 @@ void TaskManagerTab::UpdateHeaderSortGlyphs() {
 
 void TaskManagerTab::CreateDetailsPane() {
     auto makeLabel = [&](const wchar_t* text) { return CreateWindowEx(0, L"STATIC", text, WS_CHILD | WS_VISIBLE, 0,0,0,0, hwnd_, nullptr, hInstance_, nullptr); };
-    auto makeValue = [&]() { HWND h = CreateWindowEx(0, L"STATIC", L"--", WS_CHILD | WS_VISIBLE | SS_LEFTNOWORDWRAP, 0,0,0,0, hwnd_, nullptr, hInstance_, nullptr); SendMessageW(h, WM_SETFONT, (WPARAM)CreateUIFont(10, FW_NORMAL), TRUE); return h; };
+    auto makeValue = [&]() { HWND h = CreateWindowEx(0, L"STATIC", L"--", WS_CHILD | WS_VISIBLE | SS_LEFTNOWORDWRAP, 0,0,0,0, hwnd_, nullptr, hInstance_, nullptr); SendMessageW(h, WM_SETFONT, (WPARAM)CachedUIFont(10, FW_NORMAL), TRUE); return h; };
 
     hLblName_ = makeLabel(L"Name:");   hValName_ = makeValue();
     hLblPid_  = makeLabel(L"PID:");    hValPid_  = makeValue();
@@ -592,14 +599,29 @@ void TaskManagerTab::RequestAndUpdateProcessList() {
     cmd.backendType = RainmeterManager::Render::RenderBackendType::Auto;
     cmd.bounds = {0,0,0,0};
     cmd.timestamp = (uint64_t)GetTickCount64();
+    // Ask for a delta against the last generation we applied; a render
+    // process that predates the delta protocol ignores the parameter
+    // and replies with the legacy full array
+    cmd.content.parameters.push_back({"sinceGeneration", std::to_string(ackedSnapshotGeneration_)});
 
     auto result = ipc_->SendCommand(cmd, 2000);
     if (result.status != RainmeterManager::Render::RenderResultStatus::Success) return;
 
-    const std::string& json = result.errorMessage; // JSON array of objects
+    ApplySnapshotDelta(result.errorMessage);
+
+    // Update CPU history from the applied table; unchanged rows repeat
+    // their last value so sparklines keep a sample per poll
+    for (const auto& r : lastRows_) {
+        auto& dq = cpuHist_[r.pid];
+        dq.push_back(r.cpu);
+        while ((int)dq.size() > kHistLen) dq.pop_front();
+    }
+
+    RebuildDisplay();
+}
 
-    std::vector<Row> rows; rows.reserve(256);
-    size_t pos = 0;
+void TaskManagerTab::ParseRowObjects(const std::string& json, size_t from, std::vector<Row>& rows) {
+    size_t pos = from;
     while (true) {
         size_t objStart = json.find('{', pos);
         if (objStart == std::string::npos) break;
@@ -613,7 +635,7 @@ void TaskManagerTab::RequestAndUpdateProcessList() {
         ExtractULong(json, cursor, "WorkingSetMB", r.mem);
         ExtractInt(json, cursor, "Threads", r.threads);
         std::wstring p; if (ExtractString(json, cursor, "ImagePath", p)) r.path = p;
-        std::wstring cmd; if (ExtractString(json, cursor, "CommandLine", cmd)) r.cmd = cmd;
+        std::wstring cmdLine; if (ExtractString(json, cursor, "CommandLine", cmdLine)) r.cmd = cmdLine;
         float ior=0, iow=0; ExtractFloat(json, cursor, "IoReadMBps", ior); ExtractFloat(json, cursor, "IoWriteMBps", iow); r.ioReadMBps = ior; r.ioWriteMBps = iow;
         std::wstring pub; if (ExtractString(json, cursor, "Publisher", pub)) r.publisher = pub;
         std::wstring integ; if (ExtractString(json, cursor, "IntegrityLevel", integ)) r.integrity = integ;
@@ -621,16 +643,72 @@ void TaskManagerTab::RequestAndUpdateProcessList() {
         rows.push_back(r);
         pos = objEnd + 1;
     }
+}
 
-    // Update CPU history
-    for (const auto& r : rows) {
-        auto& dq = cpuHist_[r.pid];
-        dq.push_back(r.cpu);
-        while ((int)dq.size() > kHistLen) dq.pop_front();
+void TaskManagerTab::ApplySnapshotDelta(const std::string& json) {
+    size_t first = json.find_first_not_of(" \t\r\n");
+    if (first == std::string::npos) return;
+
+    // Legacy full-array response: rebuild the whole table and reset the
+    // generation handshake
+    if (json[first] == '[') {
+        std::vector<Row> rows; rows.reserve(256);
+        ParseRowObjects(json, first, rows);
+        rowsByPid_.clear();
+        for (auto& r : rows) rowsByPid_[r.pid] = std::move(r);
+        ackedSnapshotGeneration_ = 0;
+        RebuildRowsFromIndex();
+        return;
+    }
+    if (json[first] != '{') return;
+
+    // Delta object: {"Generation":N,"Full":0|1,"Removed":[pid,...],"Rows":[{...},...]}
+    size_t cursor = first;
+    unsigned long long generation = 0;
+    ExtractULong(json, cursor, "Generation", generation);
+    int full = 0;
+    ExtractInt(json, cursor, "Full", full);
+    if (full) rowsByPid_.clear();
+
+    // Removed PIDs (absent or empty on a full resync)
+    size_t removedKey = json.find("\"Removed\"", first);
+    if (removedKey != std::string::npos) {
+        size_t arrStart = json.find('[', removedKey);
+        size_t arrEnd = (arrStart != std::string::npos) ? json.find(']', arrStart) : std::string::npos;
+        if (arrEnd != std::string::npos) {
+            size_t p = arrStart + 1;
+            while (p < arrEnd) {
+                char* end = nullptr;
+                long pid = strtol(json.c_str() + p, &end, 10);
+                size_t consumed = (size_t)(end - json.c_str());
+                if (consumed <= p) break;
+                rowsByPid_.erase((int)pid);
+                cpuHist_.erase((int)pid);
+                p = json.find(',', consumed);
+                if (p == std::string::npos || p >= arrEnd) break;
+                ++p;
+            }
+        }
     }
 
-    lastRows_.swap(rows);
-    RebuildDisplay();
+    // Changed/added rows upsert by PID
+    size_t rowsKey = json.find("\"Rows\"", first);
+    if (rowsKey != std::string::npos) {
+        std::vector<Row> rows;
+        ParseRowObjects(json, rowsKey, rows);
+        for (auto& r : rows) rowsByPid_[r.pid] = std::move(r);
+    }
+
+    ackedSnapshotGeneration_ = generation;
+    RebuildRowsFromIndex();
+}
+
+void TaskManagerTab::RebuildRowsFromIndex() {
+    lastRows_.clear();
+    lastRows_.reserve(rowsByPid_.size());
+    for (const auto& entry : rowsByPid_) {
+        lastRows_.push_back(entry.second);
+    }
 }
 
 void TaskManagerTab::RebuildDisplay() {
@@ -663,33 +741,76 @@ void TaskManagerTab::RebuildDisplay() {
 
     UpdateHeaderSortGlyphs();
 
-    // Repopulate list with current visible columns
-    ListView_DeleteAllItems(hList_);
-    int index = 0;
-    for (const auto& r : displayRows_) {
-        wchar_t buf[256];
-        LVITEM item{}; item.mask = LVIF_TEXT; item.iItem = index; item.iSubItem = 0;
-        if (colVisible_[0]) { swprintf(buf, 256, L"%d", r.pid); item.pszText = buf; } else { item.pszText = const_cast<LPWSTR>(L""); }
-        int rowIndex = ListView_InsertItem(hList_, &item);
-        int col = 1;
-        if (colVisible_[1]) { ListView_SetItemText(hList_, rowIndex, col++, const_cast<LPWSTR>(r.name.c_str())); }
-        if (colVisible_[2]) { swprintf(buf, 256, L"%.1f", r.cpu); ListView_SetItemText(hList_, rowIndex, col++, buf); }
-        if (colVisible_[3]) { swprintf(buf, 256, L"%llu", r.mem); ListView_SetItemText(hList_, rowIndex, col++, buf); }
-        if (colVisible_[4]) { swprintf(buf, 256, L"%d", r.threads); ListView_SetItemText(hList_, rowIndex, col++, buf); }
-        if (colVisible_[5]) { swprintf(buf, 256, L"%.2f", r.ioReadMBps); ListView_SetItemText(hList_, rowIndex, col++, buf); }
-        if (colVisible_[6]) { swprintf(buf, 256, L"%.2f", r.ioWriteMBps); ListView_SetItemText(hList_, rowIndex, col++, buf); }
-        ++index;
-    }
-
-    // Autosize columns
-    int totalCols = 0; for (bool v : colVisible_) if (v) ++totalCols;
-    for (int c = 0; c < totalCols; ++c) {
-        ListView_SetColumnWidth(hList_, c, LVSCW_AUTOSIZE_USEHEADER);
+    // Virtual list: adjust the count without discarding item state,
+    // then redraw only the rows whose displayed values changed since
+    // the previous poll so cost tracks churn, not process count
+    size_t prevCount = prevDisplayRows_.size();
+    if (displayRows_.size() != prevCount) {
+        ListView_SetItemCountEx(hList_, (int)displayRows_.size(),
+            LVSICF_NOINVALIDATEALL | LVSICF_NOSCROLL);
+    }
+
+    auto rowChanged = [](const Row& a, const Row& b) {
+        return a.pid != b.pid || a.cpu != b.cpu || a.mem != b.mem ||
+               a.threads != b.threads || a.ioReadMBps != b.ioReadMBps ||
+               a.ioWriteMBps != b.ioWriteMBps || a.name != b.name;
+    };
+
+    size_t common = (std::min)(displayRows_.size(), prevCount);
+    int rangeStart = -1;
+    for (size_t i = 0; i < common; ++i) {
+        if (rowChanged(displayRows_[i], prevDisplayRows_[i])) {
+            if (rangeStart < 0) rangeStart = (int)i;
+        } else if (rangeStart >= 0) {
+            ListView_RedrawItems(hList_, rangeStart, (int)i - 1);
+            rangeStart = -1;
+        }
+    }
+    if (rangeStart >= 0) {
+        ListView_RedrawItems(hList_, rangeStart, (int)common - 1);
     }
+    if (displayRows_.size() > prevCount) {
+        ListView_RedrawItems(hList_, (int)prevCount, (int)displayRows_.size() - 1);
+    }
+
+    prevDisplayRows_ = displayRows_;
 
     UpdateDetailsFromSelection();
 }
 
+int TaskManagerTab::VisibleToLogicalColumn(int visibleCol) const {
+    int seen = 0;
+    for (int logical = 0; logical < (int)colVisible_.size(); ++logical) {
+        if (!colVisible_[logical]) continue;
+        if (seen == visibleCol) return logical;
+        ++seen;
+    }
+    return -1;
+}
+
+void TaskManagerTab::OnGetDispInfo(NMLVDISPINFOW* info) {
+    if (!(info->item.mask & LVIF_TEXT)) return;
+    int row = info->item.iItem;
+    if (row < 0 || row >= (int)displayRows_.size()) {
+        if (info->item.cchTextMax > 0) info->item.pszText[0] = L'\0';
+        return;
+    }
+
+    const Row& r = displayRows_[row];
+    wchar_t* out = info->item.pszText;
+    int cap = info->item.cchTextMax;
+    switch (VisibleToLogicalColumn(info->item.iSubItem)) {
+        case 0: swprintf(out, cap, L"%d", r.pid); break;
+        case 1: wcsncpy_s(out, cap, r.name.c_str(), _TRUNCATE); break;
+        case 2: swprintf(out, cap, L"%.1f", r.cpu); break;
+        case 3: swprintf(out, cap, L"%llu", r.mem); break;
+        case 4: swprintf(out, cap, L"%d", r.threads); break;
+        case 5: swprintf(out, cap, L"%.2f", r.ioReadMBps); break;
+        case 6: swprintf(out, cap, L"%.2f", r.ioWriteMBps); break;
+        default: if (cap > 0) out[0] = L'\0'; break;
+    }
+}
+
 // Minimal JSON helpers for simple key/value extraction within an object slice
 static bool FindKey(const std::string& json, size_t& pos, const char* key) {
     std::string needle = std::string("\"") + key + "\"";
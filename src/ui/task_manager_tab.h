@@ -39,12 +39,28 @@ private:
     void RequestAndUpdateProcessList();
     void RebuildDisplay();
 
+    // Delta snapshot protocol. Requests carry the last acknowledged
+    // generation; the render process answers with only the rows that
+    // changed since (plus removed PIDs), keyed by PID, instead of the
+    // full table. ParseRowObjects handles both the delta's "Rows" array
+    // and the legacy bare-array response from older render processes.
+    struct Row;
+    void ParseRowObjects(const std::string& json, size_t from, std::vector<Row>& rows);
+    void ApplySnapshotDelta(const std::string& json);
+    void RebuildRowsFromIndex();
+
     // UI enhancements
     void UpdateHeaderSortGlyphs();
     void ShowHeaderContextMenu(POINT ptScreen);
     void ToggleColumnVisibility(int columnIndex);
     void BuildColumns();
 
+    // Virtual list view (LVS_OWNERDATA). The control asks for cell text
+    // on demand via LVN_GETDISPINFO; RebuildDisplay only adjusts the
+    // item count and redraws rows whose values actually changed.
+    void OnGetDispInfo(NMLVDISPINFOW* info);
+    int VisibleToLogicalColumn(int visibleCol) const;
+
     // Details pane
      void CreateDetailsPane();
      void UpdateDetailsFromSelection();
@@ -83,7 +99,14 @@ private:
 
     struct Row { int pid; std::wstring name; float cpu; unsigned long long mem; int threads; std::wstring path; std::wstring cmd; float ioReadMBps; float ioWriteMBps; std::wstring publisher; std::wstring integrity; bool elevated; };
     std::vector<Row> lastRows_;
+
+    // Current table keyed by PID, maintained across delta responses;
+    // ackedSnapshotGeneration_ is echoed in the next request so the
+    // render process knows which generation to diff against
+    std::unordered_map<int, Row> rowsByPid_;
+    uint64_t ackedSnapshotGeneration_ = 0;
     std::vector<Row> displayRows_;
+    std::vector<Row> prevDisplayRows_;  // Snapshot of the last displayed rows for change detection
     int sortColumn_ = 2; // default CPU column
     bool sortAsc_ = false; // default descending CPU
     std::wstring filterText_;
@@ -1,6 +1,7 @@
 // ui_framework.cpp - UI Framework stub implementation
 // TODO: Implement when UI components are fully designed
 #include "ui_framework.h"
+#include "ui_paint_context.h"
 #include "../core/logger.h"
 
 // Stub implementations for UI components
@@ -24,8 +25,154 @@ LRESULT CALLBACK ModernButton::buttonProc(HWND hwnd, UINT msg, WPARAM wParam, LP
     return 0;
 }
 
+// Drawing goes through the shared paint context (ui_paint_context.h):
+// brushes/pens/fonts are cached per theme color and only recreated when
+// the theme changes, so repaints allocate no GDI objects. Control
+// creation and the owner-draw hookup remain stubbed until Phase 3.
 void ModernButton::drawButton(HDC hdc, RECT& rect, bool isHovered, bool isPressed) {
-    (void)hdc; (void)rect; (void)isHovered; (void)isPressed;
+    using namespace RainmeterManager::UI;
+
+    const COLORREF fill = isPressed ? currentTheme.selectedColor
+                        : isHovered ? currentTheme.hoverColor
+                                    : currentTheme.backgroundColor;
+
+    HGDIOBJ oldPen = SelectObject(hdc, CachedSolidPen(1, currentTheme.borderColor));
+    HGDIOBJ oldBrush = SelectObject(hdc, CachedSolidBrush(fill));
+    RoundRect(hdc, rect.left, rect.top, rect.right, rect.bottom, 4, 4);
+    SelectObject(hdc, oldBrush);
+    SelectObject(hdc, oldPen);
+
+    SetBkMode(hdc, TRANSPARENT);
+    SetTextColor(hdc, currentTheme.foregroundColor);
+    HFONT oldFont = (HFONT)SelectObject(hdc, CachedUIFont(currentTheme.fontSize));
+    DrawTextA(hdc, buttonText.c_str(), -1, &rect,
+              DT_CENTER | DT_VCENTER | DT_SINGLELINE | DT_END_ELLIPSIS);
+    SelectObject(hdc, oldFont);
+}
+
+// ModernListView: data model and virtualization are real (pure
+// bookkeeping); control creation and painting remain stubbed with the
+// rest of the UI until Phase 3.
+
+ModernListView::ModernListView() = default;
+
+bool ModernListView::create(HWND parent, int x, int y, int width, int height) {
+    (void)parent; (void)x; (void)y; (void)width; (void)height;
+    return false; // Stub
+}
+
+void ModernListView::setTheme(const UITheme& theme) { currentTheme = theme; }
+void ModernListView::show(bool visible) { (void)visible; }
+
+void ModernListView::addItem(const ListItem& item) {
+    items.push_back(item);
+    if (hwnd) {
+        InvalidateRect(hwnd, nullptr, FALSE);
+    }
+}
+
+void ModernListView::clearItems() {
+    items.clear();
+    if (hwnd) {
+        InvalidateRect(hwnd, nullptr, FALSE);
+    }
+}
+
+void ModernListView::setItems(std::vector<ListItem> newItems) {
+    items = std::move(newItems);
+    // One invalidation for the whole batch, not one per row
+    if (hwnd) {
+        InvalidateRect(hwnd, nullptr, FALSE);
+    }
+}
+
+ModernListView::ListItem* ModernListView::getSelectedItem() {
+    return nullptr; // Stub: selection tracking arrives with the control
+}
+
+void ModernListView::setOnSelectionChanged(std::function<void(ListItem*)> callback) {
+    selectionCallback = std::move(callback);
+}
+
+void ModernListView::setVirtualMode(DataProvider provider, size_t itemCount) {
+    virtualMode = true;
+    dataProvider = std::move(provider);
+    virtualItemCount = itemCount;
+    items.clear();  // Owned items and virtual mode are exclusive
+    firstVisibleIndex = 0;
+    realizeVisibleRows();
+}
+
+void ModernListView::setVirtualItemCount(size_t itemCount) {
+    virtualItemCount = itemCount;
+    if (firstVisibleIndex >= virtualItemCount) {
+        firstVisibleIndex = (virtualItemCount > 0) ? virtualItemCount - 1 : 0;
+    }
+    realizeVisibleRows();
+}
+
+size_t ModernListView::getItemCount() const {
+    return virtualMode ? virtualItemCount : items.size();
+}
+
+void ModernListView::realizeVisibleRows() {
+    if (!virtualMode || !dataProvider) {
+        return;
+    }
+
+    size_t last = firstVisibleIndex + visibleRowCount;
+    if (last > virtualItemCount) {
+        last = virtualItemCount;
+    }
+    releaseRowsOutsideRange(firstVisibleIndex, last);
+
+    for (size_t index = firstVisibleIndex; index < last; ++index) {
+        bool alreadyRealized = false;
+        for (const RealizedRow& row : rowPool) {
+            if (row.inUse && row.itemIndex == index) {
+                alreadyRealized = true;
+                break;
+            }
+        }
+        if (alreadyRealized) {
+            continue;
+        }
+
+        RealizedRow* row = acquireRow();
+        row->itemIndex = index;
+        if (!dataProvider(index, row->item)) {
+            row->inUse = false;
+        }
+    }
+
+    if (hwnd) {
+        InvalidateRect(hwnd, nullptr, FALSE);
+    }
+}
+
+ModernListView::RealizedRow* ModernListView::acquireRow() {
+    for (RealizedRow& row : rowPool) {
+        if (!row.inUse) {
+            row.inUse = true;
+            return &row;
+        }
+    }
+    rowPool.emplace_back();
+    rowPool.back().inUse = true;
+    return &rowPool.back();
+}
+
+void ModernListView::releaseRowsOutsideRange(size_t first, size_t last) {
+    for (RealizedRow& row : rowPool) {
+        if (row.inUse && (row.itemIndex < first || row.itemIndex >= last)) {
+            row.inUse = false;
+        }
+    }
+}
+
+LRESULT CALLBACK ModernListView::listViewProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam) {
+    (void)hwnd; (void)msg; (void)wParam; (void)lParam;
+    return 0;
 }
 
 // UIManager stubs
@@ -36,8 +183,17 @@ UIManager& UIManager::getInstance() {
     return inst;
 }
 
-void UIManager::setGlobalTheme(const UITheme& theme) { globalTheme = theme; }
-void UIManager::toggleDarkMode() { globalTheme.darkMode = !globalTheme.darkMode; }
+void UIManager::setGlobalTheme(const UITheme& theme) {
+    globalTheme = theme;
+    // Theme colors key the shared GDI caches; flush so the next paint
+    // recreates brushes/pens/fonts from the new palette.
+    RainmeterManager::UI::InvalidatePaintResources();
+}
+
+void UIManager::toggleDarkMode() {
+    globalTheme.darkMode = !globalTheme.darkMode;
+    RainmeterManager::UI::InvalidatePaintResources();
+}
 bool UIManager::createMainWindow(HINSTANCE hInstance, int cmdShow) { (void)hInstance; (void)cmdShow; return false; }
 void UIManager::setupLayout() {}
 void UIManager::updateLayout() {}
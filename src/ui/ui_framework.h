@@ -79,12 +79,48 @@ public:
     
     void addItem(const ListItem& item);
     void clearItems();
+    // Bulk replace with a single invalidation; use instead of
+    // clearItems + addItem loops, which repaint per item
+    void setItems(std::vector<ListItem> newItems);
     ListItem* getSelectedItem();
     void setOnSelectionChanged(std::function<void(ListItem*)> callback);
-    
+
+    // Virtualized mode: items are supplied on demand by a provider and
+    // only visible rows are realized, from a reusable row pool, so a
+    // list of hundreds of entries costs a handful of row objects.
+    // Fills item for the given index; returns false past the end
+    using DataProvider = std::function<bool(size_t index, ListItem& item)>;
+    void setVirtualMode(DataProvider provider, size_t itemCount);
+    // Update the count after the backing data changes (re-realizes
+    // visible rows; scroll position is preserved where possible)
+    void setVirtualItemCount(size_t itemCount);
+    bool isVirtualMode() const { return virtualMode; }
+    size_t getItemCount() const;
+
 private:
     std::vector<ListItem> items;
     std::function<void(ListItem*)> selectionCallback;
+
+    // Virtualization state. rowPool holds realized rows; rows scrolled
+    // out of view are returned to the pool and reused rather than
+    // destroyed and recreated.
+    struct RealizedRow {
+        size_t itemIndex = 0;
+        ListItem item;
+        bool inUse = false;
+    };
+    bool virtualMode = false;
+    DataProvider dataProvider;
+    size_t virtualItemCount = 0;
+    std::vector<RealizedRow> rowPool;
+    size_t firstVisibleIndex = 0;
+    size_t visibleRowCount = 0;
+
+    // Realizes rows [firstVisibleIndex, firstVisibleIndex +
+    // visibleRowCount) through the provider, reusing pooled rows
+    void realizeVisibleRows();
+    RealizedRow* acquireRow();
+    void releaseRowsOutsideRange(size_t first, size_t last);
     static LRESULT CALLBACK listViewProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam);
 };
 
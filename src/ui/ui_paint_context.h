@@ -0,0 +1,210 @@
+#ifndef UI_PAINT_CONTEXT_H
+#define UI_PAINT_CONTEXT_H
+
+#include <windows.h>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace RainmeterManager {
+namespace UI {
+
+// Shared paint context for the GDI-drawn windows (options, dashboard,
+// task manager tabs). Two pieces:
+//
+//   PaintResourceCache - solid brushes, pens and fonts cached by their
+//   creation parameters so WM_PAINT handlers stop churning GDI objects
+//   per paint. Entries live until InvalidatePaintResources() is called
+//   (theme change) or the process exits.
+//
+//   BufferedPaint - BeginPaint/EndPaint wrapper that redirects drawing
+//   to a pooled offscreen bitmap and blits it to the window DC in a
+//   single BitBlt, eliminating resize flicker. Buffers are retained
+//   across paints and only grow.
+//
+// All of this is UI-thread only, like the windows it serves; no locking.
+
+class PaintResourceCache {
+public:
+    static PaintResourceCache& Instance() {
+        // Leaked intentionally: GDI handles are reclaimed by the OS at
+        // process exit and destruction order vs. late paints is moot.
+        static PaintResourceCache* instance = new PaintResourceCache();
+        return *instance;
+    }
+
+    HBRUSH SolidBrush(COLORREF color) {
+        auto it = brushes.find(color);
+        if (it != brushes.end()) return it->second;
+        HBRUSH brush = CreateSolidBrush(color);
+        if (brush) brushes.emplace(color, brush);
+        return brush;
+    }
+
+    HPEN SolidPen(int width, COLORREF color) {
+        const uint64_t key = (static_cast<uint64_t>(static_cast<uint32_t>(width)) << 32) | color;
+        auto it = pens.find(key);
+        if (it != pens.end()) return it->second;
+        HPEN pen = CreatePen(PS_SOLID, width, color);
+        if (pen) pens.emplace(key, pen);
+        return pen;
+    }
+
+    HFONT Font(int pt, int weight = FW_SEMIBOLD, bool italic = false) {
+        const uint32_t key = (static_cast<uint32_t>(pt) << 16) |
+                             (static_cast<uint32_t>(weight) & 0x7FFF) |
+                             (italic ? 0x8000u : 0u);
+        auto it = fonts.find(key);
+        if (it != fonts.end()) return it->second;
+        // Same construction as CreateUIFont in ui_theme.h
+        HDC hdc = GetDC(nullptr);
+        int dpi = GetDeviceCaps(hdc, LOGPIXELSY);
+        ReleaseDC(nullptr, hdc);
+        HFONT font = CreateFontW(-MulDiv(pt, dpi, 72), 0, 0, 0, weight, italic, FALSE, FALSE,
+                                 DEFAULT_CHARSET, OUT_OUTLINE_PRECIS, CLIP_DEFAULT_PRECIS,
+                                 CLEARTYPE_NATURAL_QUALITY, VARIABLE_PITCH, L"Segoe UI");
+        if (font) fonts.emplace(key, font);
+        return font;
+    }
+
+    // Theme changes re-key every color; drop everything and let the
+    // next paint repopulate. Cached handles must not be selected into a
+    // DC when this runs, which holds because paints and theme switches
+    // both happen on the UI thread.
+    void Invalidate() {
+        for (auto& entry : brushes) DeleteObject(entry.second);
+        for (auto& entry : pens) DeleteObject(entry.second);
+        for (auto& entry : fonts) DeleteObject(entry.second);
+        brushes.clear();
+        pens.clear();
+        fonts.clear();
+    }
+
+private:
+    PaintResourceCache() = default;
+    PaintResourceCache(const PaintResourceCache&) = delete;
+    PaintResourceCache& operator=(const PaintResourceCache&) = delete;
+
+    std::unordered_map<uint32_t, HBRUSH> brushes;
+    std::unordered_map<uint64_t, HPEN> pens;
+    std::unordered_map<uint32_t, HFONT> fonts;
+};
+
+inline HBRUSH CachedSolidBrush(COLORREF color) {
+    return PaintResourceCache::Instance().SolidBrush(color);
+}
+
+inline HPEN CachedSolidPen(int width, COLORREF color) {
+    return PaintResourceCache::Instance().SolidPen(width, color);
+}
+
+inline HFONT CachedUIFont(int pt, int weight = FW_SEMIBOLD, bool italic = false) {
+    return PaintResourceCache::Instance().Font(pt, weight, italic);
+}
+
+inline void InvalidatePaintResources() {
+    PaintResourceCache::Instance().Invalidate();
+}
+
+class BufferedPaint {
+public:
+    explicit BufferedPaint(HWND hwnd) : window(hwnd) {
+        windowDc = BeginPaint(hwnd, &ps);
+        GetClientRect(hwnd, &clientRect);
+        width = clientRect.right - clientRect.left;
+        height = clientRect.bottom - clientRect.top;
+        if (width > 0 && height > 0) {
+            buffer = AcquireBuffer(windowDc, width, height);
+        }
+    }
+
+    ~BufferedPaint() {
+        if (buffer) {
+            BitBlt(windowDc, 0, 0, width, height, buffer->memDc, 0, 0, SRCCOPY);
+            buffer->inUse = false;
+        }
+        EndPaint(window, &ps);
+    }
+
+    // Draw here; falls back to the window DC when no offscreen bitmap
+    // could be allocated, so callers paint identically either way.
+    HDC Dc() const { return buffer ? buffer->memDc : windowDc; }
+    const RECT& Rect() const { return clientRect; }
+
+private:
+    struct Buffer {
+        HDC memDc = nullptr;
+        HBITMAP bitmap = nullptr;
+        HGDIOBJ originalBitmap = nullptr;
+        int width = 0;
+        int height = 0;
+        bool inUse = false;
+    };
+
+    // Process-wide buffer pool. Sizes are rounded up so a live resize
+    // reuses one growing bitmap instead of reallocating every pixel
+    // step; nested paints (parent + owner-drawn children) each get
+    // their own entry.
+    static Buffer* AcquireBuffer(HDC windowDc, int width, int height) {
+        // Reserved to the cap up front: callers keep Buffer* across the
+        // paint, so the vector must never reallocate under a nested
+        // AcquireBuffer while an outer paint still holds its entry
+        static std::vector<Buffer>* pool = [] {
+            auto* p = new std::vector<Buffer>();
+            p->reserve(4);
+            return p;
+        }();
+
+        const int roundedW = (width + 127) & ~127;
+        const int roundedH = (height + 127) & ~127;
+
+        Buffer* candidate = nullptr;
+        for (auto& entry : *pool) {
+            if (entry.inUse) continue;
+            if (entry.width >= width && entry.height >= height) {
+                entry.inUse = true;
+                return &entry;
+            }
+            candidate = &entry; // too small: regrow this slot below
+        }
+
+        if (!candidate) {
+            if (pool->size() >= 4) return nullptr; // cap: paint direct instead
+            pool->emplace_back();
+            candidate = &pool->back();
+        }
+
+        if (candidate->bitmap) {
+            SelectObject(candidate->memDc, candidate->originalBitmap);
+            DeleteObject(candidate->bitmap);
+            candidate->bitmap = nullptr;
+        }
+        if (!candidate->memDc) {
+            candidate->memDc = CreateCompatibleDC(windowDc);
+            if (!candidate->memDc) return nullptr;
+        }
+        candidate->bitmap = CreateCompatibleBitmap(windowDc, roundedW, roundedH);
+        if (!candidate->bitmap) return nullptr;
+        candidate->originalBitmap = SelectObject(candidate->memDc, candidate->bitmap);
+        candidate->width = roundedW;
+        candidate->height = roundedH;
+        candidate->inUse = true;
+        return candidate;
+    }
+
+    BufferedPaint(const BufferedPaint&) = delete;
+    BufferedPaint& operator=(const BufferedPaint&) = delete;
+
+    HWND window = nullptr;
+    PAINTSTRUCT ps{};
+    HDC windowDc = nullptr;
+    RECT clientRect{};
+    int width = 0;
+    int height = 0;
+    Buffer* buffer = nullptr;
+};
+
+} // namespace UI
+} // namespace RainmeterManager
+
+#endif // UI_PAINT_CONTEXT_H
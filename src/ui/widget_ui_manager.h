@@ -109,7 +109,19 @@ public:
     void renderWidget(const std::string& widgetId, ID2D1RenderTarget* renderTarget);
     void renderSelectionIndicators(ID2D1RenderTarget* renderTarget);
     void renderResizeHandles(const std::string& widgetId, ID2D1RenderTarget* renderTarget);
-    
+
+    // Present batching
+    // Layered-window presents are deferred: widgets mark themselves dirty,
+    // draw into pooled shared DIB sections, and presentBatch() commits all
+    // pending surfaces in one pass per frame tick, walked in
+    // RenderProperties::zOrder order. One UpdateLayeredWindow call per
+    // *dirty* widget keeps present overhead proportional to changed pixels
+    // rather than widget count.
+    void markWidgetDirty(const std::string& widgetId);
+    void presentBatch();
+    void setPresentBatchingEnabled(bool enable = true);
+    size_t getPendingPresentCount() const;
+
 private:
     WidgetUIManager() = default;
     static WidgetUIManager* instance;
@@ -198,6 +210,27 @@ private:
     // Context menu
     void showContextMenu(const std::string& widgetId, POINT pt);
     void handleContextMenuCommand(const std::string& widgetId, int commandId);
+
+    // Present batch state
+    // Pooled DIB sections back the per-present draws; surfaces are reused
+    // across frames and grow-only so a steady-state frame allocates nothing.
+    struct PooledDibSurface {
+        HBITMAP dib = nullptr;      // Shared DIB section (CreateDIBSection)
+        HDC memDc = nullptr;        // DC the widget surface is drawn into
+        void* pixels = nullptr;     // Mapped pixel bits of the section
+        int width = 0;              // Allocated extent (grow-only)
+        int height = 0;
+        bool inUse = false;
+    };
+    std::vector<PooledDibSurface> dibPool;
+    std::vector<std::string> dirtyWidgets;  // Deduped; drained by presentBatch
+    bool presentBatchingEnabled = true;
+
+    // Present batch helpers
+    PooledDibSurface* acquireDibSurface(int width, int height);
+    void releaseDibSurface(PooledDibSurface* surface);
+    void sortDirtyByZOrder();  // RenderProperties::zOrder, back to front
+    void commitDirtySurfaces();  // The single per-tick UpdateLayeredWindow pass
 };
 
 // Context menu commands
@@ -20,6 +20,9 @@
 #include <mutex>
 #include <thread>
 #include <queue>
+#include <atomic>
+#include <condition_variable>
+#include <fstream>
 
 #pragma comment(lib, "winhttp.lib")
 
@@ -161,12 +164,66 @@ struct SourceCuration {
     std::string maintenanceNotes;
 };
 
+// Durable offline-first submission queue. Submissions append to an
+// on-disk spool (one serialized record per line) and the call returns
+// immediately; a background worker batches uploads through the
+// installed uploader with exponential backoff on failure. Records
+// survive restarts - anything still spooled is retried on the next
+// start(), so feedback captured on a dead network is never lost and
+// never stalls the UI.
+class FeedbackSubmissionQueue {
+public:
+    // Uploads one batch of serialized submissions; returns true when the
+    // whole batch was accepted. Installed by the owner so the queue stays
+    // independent of the transport (WinHTTP today, test doubles in tests).
+    using BatchUploader = std::function<bool(const std::vector<std::string>& batch)>;
+
+    FeedbackSubmissionQueue(const std::string& spoolPath, BatchUploader uploader);
+    ~FeedbackSubmissionQueue();
+
+    // Loads surviving spool records and starts the upload worker
+    bool start();
+    void stop();
+
+    // Appends to the spool and returns immediately (never uploads inline)
+    bool enqueue(const std::string& serializedSubmission);
+
+    struct QueueStats {
+        size_t pendingSubmissions = 0;
+        size_t uploadedSubmissions = 0;
+        size_t failedAttempts = 0;
+    };
+    QueueStats getStats();
+
+private:
+    static constexpr size_t MAX_BATCH_SIZE = 16;
+    static constexpr int INITIAL_BACKOFF_SECONDS = 5;
+    static constexpr int MAX_BACKOFF_SECONDS = 900;
+
+    void uploadWorker();
+    bool loadSpool();
+    bool rewriteSpool();   // Compacts the spool after successful uploads
+
+    std::string spoolPath;
+    BatchUploader uploader;
+    std::vector<std::string> pending;   // In-memory mirror of the spool
+    std::mutex queueMutex;
+    std::condition_variable queueCondition;
+    std::thread workerThread;
+    std::atomic<bool> workerActive{false};
+    size_t uploadedCount = 0;
+    size_t failedAttempts = 0;
+    int backoffSeconds = INITIAL_BACKOFF_SECONDS;
+};
+
 // Feed list management
 class CommunityFeedManager {
 public:
     static CommunityFeedManager& getInstance();
     
-    // Source recommendation management
+    // Source recommendation management. Submission spools locally via
+    // the durable queue and returns immediately; the upload (and any
+    // retry) happens on the queue's worker, never on the caller.
     bool submitSourceRecommendation(const SourceRecommendation& recommendation);
     std::vector<SourceRecommendation> getRecommendations(SourceType type = SourceType::RSS_FEED);
     std::vector<SourceRecommendation> getRecommendationsByCategory(const std::string& category);
@@ -174,7 +231,8 @@ public:
     bool approveRecommendation(const std::string& recommendationId);
     bool rejectRecommendation(const std::string& recommendationId, const std::string& reason);
     
-    // Community feedback management
+    // Community feedback management. Same offline-first contract as
+    // recommendations: spool append, immediate return.
     bool submitFeedback(const CommunityFeedback& feedback);
     std::vector<CommunityFeedback> getFeedback(FeedbackType type = FeedbackType::SOURCE_RECOMMENDATION);
     bool markFeedbackResolved(const std::string& feedbackId, const std::string& resolution);
@@ -241,6 +299,12 @@ private:
     std::mutex feedbackMutex;
     std::mutex curationMutex;
     
+    // Durable submission spool: initialize() starts it and installs the
+    // WinHTTP batch uploader; stop happens in the destructor
+    std::unique_ptr<FeedbackSubmissionQueue> submissionQueue;
+    bool uploadSubmissionBatch(const std::vector<std::string>& batch);
+    std::string serializeSubmissionLine(const char* kind, const Json::Value& payload);
+
     // Background validation thread
     std::thread validationThread;
     std::queue<std::string> validationQueue;
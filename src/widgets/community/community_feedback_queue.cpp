@@ -0,0 +1,183 @@
+#include "../../core/feature_flags.h"
+
+#if RM_ENABLE_COMMUNITY_WIDGETS
+
+#include "community_feedback.h"
+#include <cstdio>
+#include <iostream>
+
+// FeedbackSubmissionQueue - durable offline-first submission spool.
+//
+// Durability model: enqueue appends the serialized record to the spool
+// file and flushes before returning, so a crash immediately after the
+// submit call loses nothing. The in-memory pending list mirrors the
+// spool; after a batch uploads, the spool is rewritten from what
+// remains (compaction) rather than edited in place, so the file is
+// always a simple one-record-per-line replay log.
+
+FeedbackSubmissionQueue::FeedbackSubmissionQueue(const std::string& spoolPath,
+                                                 BatchUploader uploader)
+    : spoolPath(spoolPath), uploader(std::move(uploader)) {
+}
+
+FeedbackSubmissionQueue::~FeedbackSubmissionQueue() {
+    stop();
+}
+
+bool FeedbackSubmissionQueue::start() {
+    if (workerActive.load()) {
+        return true;
+    }
+
+    if (!loadSpool()) {
+        std::cerr << "FeedbackSubmissionQueue: cannot read spool " << spoolPath << std::endl;
+        // Not fatal - the spool may simply not exist yet
+    }
+
+    workerActive = true;
+    workerThread = std::thread(&FeedbackSubmissionQueue::uploadWorker, this);
+    return true;
+}
+
+void FeedbackSubmissionQueue::stop() {
+    if (!workerActive.exchange(false)) {
+        return;
+    }
+    queueCondition.notify_all();
+    if (workerThread.joinable()) {
+        workerThread.join();
+    }
+    // Pending records stay in the spool and upload on the next start()
+}
+
+bool FeedbackSubmissionQueue::enqueue(const std::string& serializedSubmission) {
+    // Spool lines must stay one record each; embedded newlines would
+    // corrupt replay
+    if (serializedSubmission.find('\n') != std::string::npos) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(queueMutex);
+
+    std::ofstream spool(spoolPath, std::ios::app);
+    if (!spool.is_open()) {
+        std::cerr << "FeedbackSubmissionQueue: cannot append to spool " << spoolPath << std::endl;
+        return false;
+    }
+    spool << serializedSubmission << '\n';
+    spool.flush();
+    if (!spool.good()) {
+        return false;
+    }
+
+    pending.push_back(serializedSubmission);
+    queueCondition.notify_one();
+    return true;
+}
+
+FeedbackSubmissionQueue::QueueStats FeedbackSubmissionQueue::getStats() {
+    std::lock_guard<std::mutex> lock(queueMutex);
+    QueueStats stats;
+    stats.pendingSubmissions = pending.size();
+    stats.uploadedSubmissions = uploadedCount;
+    stats.failedAttempts = failedAttempts;
+    return stats;
+}
+
+bool FeedbackSubmissionQueue::loadSpool() {
+    std::ifstream spool(spoolPath);
+    if (!spool.is_open()) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(queueMutex);
+    std::string line;
+    while (std::getline(spool, line)) {
+        if (!line.empty()) {
+            pending.push_back(line);
+        }
+    }
+    if (!pending.empty()) {
+        std::cout << "FeedbackSubmissionQueue: " << pending.size()
+                  << " spooled submission(s) from a previous session" << std::endl;
+    }
+    return true;
+}
+
+bool FeedbackSubmissionQueue::rewriteSpool() {
+    // Called with queueMutex held. Write-then-rename keeps a crash
+    // mid-compaction from truncating unspooled records.
+    const std::string tempPath = spoolPath + ".tmp";
+    {
+        std::ofstream temp(tempPath, std::ios::trunc);
+        if (!temp.is_open()) {
+            return false;
+        }
+        for (const auto& record : pending) {
+            temp << record << '\n';
+        }
+        temp.flush();
+        if (!temp.good()) {
+            return false;
+        }
+    }
+    std::remove(spoolPath.c_str());
+    return std::rename(tempPath.c_str(), spoolPath.c_str()) == 0;
+}
+
+void FeedbackSubmissionQueue::uploadWorker() {
+    while (workerActive.load()) {
+        std::vector<std::string> batch;
+        {
+            std::unique_lock<std::mutex> lock(queueMutex);
+            queueCondition.wait(lock, [this]() {
+                return !pending.empty() || !workerActive.load();
+            });
+            if (!workerActive.load()) {
+                return;
+            }
+
+            size_t batchSize = pending.size() < MAX_BATCH_SIZE ? pending.size()
+                                                               : MAX_BATCH_SIZE;
+            batch.assign(pending.begin(), pending.begin() + batchSize);
+        }
+
+        // Upload outside the lock so enqueue never waits on the network
+        bool uploaded = false;
+        try {
+            uploaded = uploader && uploader(batch);
+        }
+        catch (const std::exception& e) {
+            std::cerr << "FeedbackSubmissionQueue: uploader threw: " << e.what() << std::endl;
+        }
+
+        if (uploaded) {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            pending.erase(pending.begin(), pending.begin() + batch.size());
+            uploadedCount += batch.size();
+            backoffSeconds = INITIAL_BACKOFF_SECONDS;
+            if (!rewriteSpool()) {
+                std::cerr << "FeedbackSubmissionQueue: spool compaction failed; "
+                             "uploaded records may replay next session" << std::endl;
+            }
+            continue;
+        }
+
+        // Failed batch stays at the front of the queue; back off before
+        // the retry, waking early only for shutdown
+        int waitSeconds;
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            failedAttempts++;
+            waitSeconds = backoffSeconds;
+            backoffSeconds = backoffSeconds * 2 < MAX_BACKOFF_SECONDS ? backoffSeconds * 2
+                                                                      : MAX_BACKOFF_SECONDS;
+        }
+        std::unique_lock<std::mutex> lock(queueMutex);
+        queueCondition.wait_for(lock, std::chrono::seconds(waitSeconds), [this]() {
+            return !workerActive.load();
+        });
+    }
+}
+
+#endif // RM_ENABLE_COMMUNITY_WIDGETS
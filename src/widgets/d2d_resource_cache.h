@@ -0,0 +1,169 @@
+#pragma once
+// d2d_resource_cache.h - Shared Direct2D resource cache for one render target
+// Copyright (c) 2025 RainmeterManager. All rights reserved.
+
+#include <d2d1.h>
+#include <dwrite.h>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+
+namespace RainmeterManager {
+namespace Widgets {
+
+/**
+ * @brief Per-render-target cache of Direct2D/DirectWrite resources
+ *
+ * Meters used to create their own solid brushes and text formats
+ * against the render target handed to Initialize, so 40 widgets held
+ * thousands of device objects and device-lost recovery re-created all
+ * of them meter by meter — long enough to flash every widget blank.
+ *
+ * The cache is owned by WidgetManager and bound to the current render
+ * target in SetRenderTarget. Brushes are keyed by exact color and
+ * created lazily, so widgets share dozens of objects instead. On
+ * device loss, rebinding releases every device resource in one pass
+ * and brushes repopulate on first use; text formats are
+ * device-independent and survive the rebind.
+ *
+ * Thread-safe; resources are owned by the cache — callers use them for
+ * the current frame and never Release them.
+ */
+class D2DResourceCache {
+public:
+    D2DResourceCache() = default;
+
+    ~D2DResourceCache() {
+        ReleaseDeviceResources();
+        ReleaseDeviceIndependentResources();
+    }
+
+    D2DResourceCache(const D2DResourceCache&) = delete;
+    D2DResourceCache& operator=(const D2DResourceCache&) = delete;
+
+    /**
+     * @brief Bind the cache to a render target
+     *
+     * Releases all device-dependent resources from the previous target.
+     * This is the whole device-lost recovery path: rebind, then brushes
+     * recreate on demand during the next render pass.
+     * @param renderTarget New target, or nullptr to just release
+     */
+    void SetRenderTarget(ID2D1RenderTarget* renderTarget) {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        if (renderTarget_ != renderTarget) {
+            ReleaseDeviceResourcesLocked();
+            renderTarget_ = renderTarget;
+        }
+    }
+
+    /**
+     * @brief Get a solid brush for the color, creating on first use
+     * @return Cached brush valid until the next rebind, or nullptr if
+     *         no render target is bound or creation failed
+     */
+    ID2D1SolidColorBrush* GetSolidBrush(const D2D1_COLOR_F& color) {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        if (!renderTarget_) {
+            return nullptr;
+        }
+
+        BrushKey key(color.r, color.g, color.b, color.a);
+        auto it = brushes_.find(key);
+        if (it != brushes_.end()) {
+            ++brushHits_;
+            return it->second;
+        }
+
+        ID2D1SolidColorBrush* brush = nullptr;
+        HRESULT hr = renderTarget_->CreateSolidColorBrush(color, &brush);
+        if (FAILED(hr) || !brush) {
+            return nullptr;
+        }
+        brushes_[key] = brush;
+        ++brushMisses_;
+        return brush;
+    }
+
+    /**
+     * @brief Get a text format for (face, size), creating on first use
+     *
+     * Device-independent: entries survive render-target rebinds.
+     * @param factory DirectWrite factory used on a cache miss
+     * @return Cached format, or nullptr on creation failure
+     */
+    IDWriteTextFormat* GetTextFormat(IDWriteFactory* factory,
+                                     const std::wstring& fontFace, float fontSize) {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        if (!factory) {
+            return nullptr;
+        }
+
+        std::wstring key = fontFace + L'\x1F' + std::to_wstring(fontSize);
+        auto it = textFormats_.find(key);
+        if (it != textFormats_.end()) {
+            return it->second;
+        }
+
+        IDWriteTextFormat* format = nullptr;
+        HRESULT hr = factory->CreateTextFormat(
+            fontFace.c_str(), nullptr,
+            DWRITE_FONT_WEIGHT_NORMAL, DWRITE_FONT_STYLE_NORMAL,
+            DWRITE_FONT_STRETCH_NORMAL, fontSize, L"", &format);
+        if (FAILED(hr) || !format) {
+            return nullptr;
+        }
+        textFormats_[key] = format;
+        return format;
+    }
+
+    /**
+     * @brief Release device-dependent resources (brushes)
+     */
+    void ReleaseDeviceResources() {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        ReleaseDeviceResourcesLocked();
+    }
+
+    /**
+     * @brief Release device-independent resources (text formats)
+     */
+    void ReleaseDeviceIndependentResources() {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        for (auto& entry : textFormats_) {
+            entry.second->Release();
+        }
+        textFormats_.clear();
+    }
+
+    size_t GetBrushCount() const {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        return brushes_.size();
+    }
+
+    uint64_t GetBrushHitCount() const { return brushHits_; }
+    uint64_t GetBrushMissCount() const { return brushMisses_; }
+
+private:
+    // Exact float channels; colors come from skin config so identical
+    // colors share one brush without quantization surprises
+    using BrushKey = std::tuple<float, float, float, float>;
+
+    void ReleaseDeviceResourcesLocked() {
+        for (auto& entry : brushes_) {
+            entry.second->Release();
+        }
+        brushes_.clear();
+    }
+
+    ID2D1RenderTarget* renderTarget_ = nullptr;  // Bound, not owned
+    std::map<BrushKey, ID2D1SolidColorBrush*> brushes_;
+    std::map<std::wstring, IDWriteTextFormat*> textFormats_;
+    mutable std::mutex cacheMutex_;
+    uint64_t brushHits_ = 0;
+    uint64_t brushMisses_ = 0;
+};
+
+} // namespace Widgets
+} // namespace RainmeterManager
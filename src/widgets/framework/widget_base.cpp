@@ -14,6 +14,7 @@ WidgetBase::WidgetBase(const std::wstring& name, const std::wstring& description
     , description_(description)
     , visible_(true)
     , initialized_(false)
+    , dirty_(true)
     , x_(0)
     , y_(0)
     , width_(200)
@@ -100,6 +101,7 @@ void WidgetBase::Render(ID2D1RenderTarget* renderTarget) {
 void WidgetBase::OnResize(UINT width, UINT height) {
     width_ = width;
     height_ = height;
+    dirty_ = true;
     LOG_DEBUG("Widget resized to: " + std::to_string(width) + "x" + std::to_string(height));
 }
 
@@ -116,8 +118,11 @@ void WidgetBase::OnMouseLeave() {
 }
 
 void WidgetBase::SetPosition(int x, int y) {
-    x_ = x;
-    y_ = y;
+    if (x_ != x || y_ != y) {
+        x_ = x;
+        y_ = y;
+        dirty_ = true;
+    }
 }
 
 void WidgetBase::GetPosition(int& x, int& y) const {
@@ -126,8 +131,11 @@ void WidgetBase::GetPosition(int& x, int& y) const {
 }
 
 void WidgetBase::SetSize(UINT width, UINT height) {
-    width_ = width;
-    height_ = height;
+    if (width_ != width || height_ != height) {
+        width_ = width;
+        height_ = height;
+        dirty_ = true;
+    }
 }
 
 void WidgetBase::GetSize(UINT& width, UINT& height) const {
@@ -5,6 +5,7 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include <chrono>
 #include <windows.h>
 #include <d2d1.h>
 #include "../../core/system_monitor.h"
@@ -19,6 +20,30 @@ using SystemMonitor = Core::ISystemMonitor;
 class WidgetRenderer;
 struct WidgetConfig;
 
+/**
+ * @brief How expensive a widget's Update() is expected to be
+ *
+ * The manager schedules Blocking widgets off the frame path so a slow
+ * network or disk refresh never stalls CPU/memory widgets.
+ */
+enum class WidgetUpdateClass {
+    Fast,      // Pure CPU/memory sampling; completes within the tick
+    Blocking   // Hits network or disk (weather, ISS, ticker feeds)
+};
+
+/**
+ * @brief Relative importance of a widget's update within a tick
+ *
+ * The manager runs due updates in priority order against the tick's
+ * time budget; widgets repeatedly pushed past the budget earn aged
+ * priority boosts so low priority means "later", never "never".
+ */
+enum class WidgetUpdatePriority {
+    Low = 0,       // Decorative; fine to lag a few ticks
+    Normal = 1,    // Regular data widgets
+    High = 2       // Under the cursor / actively interacted with
+};
+
 /**
  * @brief Base interface for all widgets
  * 
@@ -34,10 +59,40 @@ public:
     virtual void Update() = 0;
     virtual void Shutdown() = 0;
 
+    // Scheduling hint; widgets whose Update() can block on I/O override
+    // this so the manager keeps them off the frame path
+    virtual WidgetUpdateClass GetUpdateClass() const { return WidgetUpdateClass::Fast; }
+
+    // Scheduling priority within the tick budget (see WidgetManager)
+    virtual WidgetUpdatePriority GetUpdatePriority() const { return WidgetUpdatePriority::Normal; }
+
+    /**
+     * @brief Budget-aware update; return false to resume next tick
+     *
+     * Expensive widgets override this instead of Update() and check the
+     * deadline between work items (one ring segment, one data series),
+     * returning false to cooperatively yield the rest of the work to the
+     * next tick. The manager resumes yielded widgets with elevated
+     * priority. The default runs the whole Update() — correct for every
+     * widget whose refresh is cheap.
+     */
+    virtual bool UpdateIncremental(std::chrono::steady_clock::time_point deadline) {
+        (void)deadline;
+        Update();
+        return true;
+    }
+
     // Rendering
     virtual void Render(ID2D1RenderTarget* renderTarget) = 0;
     virtual void OnResize(UINT width, UINT height) = 0;
 
+    // Invalidation protocol. Widgets mark themselves dirty when Update()
+    // changes observable state; the manager skips clean widgets when
+    // rendering. The conservative default always redraws.
+    virtual bool IsDirty() const { return true; }
+    virtual void ClearDirty() {}
+    virtual void Invalidate() {}
+
     // Input handling
     virtual void OnMouseMove(int x, int y) = 0;
     virtual void OnMouseClick(int x, int y, bool leftButton) = 0;
@@ -69,6 +124,7 @@ protected:
     std::wstring description_;
     bool visible_;
     bool initialized_;
+    bool dirty_;
     
     // Position and size
     int x_;
@@ -97,7 +153,17 @@ public:
     std::wstring GetName() const override { return name_; }
     std::wstring GetDescription() const override { return description_; }
     bool IsVisible() const override { return visible_; }
-    void SetVisible(bool visible) override { visible_ = visible; }
+    void SetVisible(bool visible) override {
+        if (visible_ != visible) {
+            visible_ = visible;
+            dirty_ = true;
+        }
+    }
+
+    // Invalidation
+    bool IsDirty() const override { return dirty_; }
+    void ClearDirty() override { dirty_ = false; }
+    void Invalidate() override { dirty_ = true; }
 
     // Position
     void SetPosition(int x, int y);
@@ -115,6 +181,10 @@ protected:
     virtual void OnUpdate() {}
     virtual void OnShutdown() {}
     virtual void OnRender(ID2D1RenderTarget* renderTarget) = 0;
+
+    // Call from OnUpdate whenever observable state changed enough to
+    // need a redraw
+    void MarkDirty() { dirty_ = true; }
 };
 
 /**
@@ -87,6 +87,13 @@ public:
     virtual void SetUpdatePolicy(const MeasureUpdatePolicy& policy) = 0;
     virtual MeasureUpdatePolicy GetUpdatePolicy() const = 0;
     virtual bool ShouldUpdate() const = 0;
+
+    // Change detection
+    // Monotonic counter bumped only when an update actually changes the
+    // value or string value. Meters compare it against their last-seen
+    // generation to skip re-fetching and re-formatting unchanged data;
+    // most measures change far less often than meters render.
+    virtual uint64_t GetValueGeneration() const = 0;
 };
 
 /**
@@ -105,9 +112,22 @@ protected:
     
     MeasureUpdatePolicy updatePolicy_;
     DWORD lastUpdateTick_;
-    
+
     mutable std::mutex valueMutex_;
-    
+
+    // Bumped by SetValue/SetStringValue only on actual change (release
+    // store paired with the acquire load in GetValueGeneration), so
+    // observers on the render thread see the new value once they see
+    // the new generation
+    std::atomic<uint64_t> valueGeneration_{0};
+
+    // Push subscriptions; invoked from NotifyValueChanged after a
+    // generation bump. Kept alongside the generation counter so callers
+    // can pick push (event-driven meters) or pull (per-render-pass
+    // generation compare) per binding.
+    std::vector<std::function<void(const IMeasure&)>> valueSubscribers_;
+    mutable std::mutex subscriberMutex_;
+
 public:
     MeasureBase(const std::wstring& name, MeasureType type);
     virtual ~MeasureBase();
@@ -133,16 +153,33 @@ public:
     void SetUpdatePolicy(const MeasureUpdatePolicy& policy) override;
     MeasureUpdatePolicy GetUpdatePolicy() const override { return updatePolicy_; }
     bool ShouldUpdate() const override;
-    
+
+    uint64_t GetValueGeneration() const override {
+        return valueGeneration_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Subscribe to value changes
+     *
+     * The callback fires on the measure's update thread after each
+     * generation bump. Prefer generation polling for per-render checks;
+     * subscriptions are for meters that schedule work on change (e.g.
+     * marking a widget region dirty).
+     */
+    void SubscribeValueChanged(std::function<void(const IMeasure&)> callback);
+
 protected:
     // Override these in derived classes
     virtual bool OnInitialize() = 0;
     virtual void OnUpdate() = 0;
     virtual void OnShutdown() = 0;
     
-    // Helpers
+    // Helpers. SetValue/SetStringValue compare against the stored value
+    // and only bump valueGeneration_ (and notify subscribers) when it
+    // actually changed; redundant updates are generation-invisible.
     void SetValue(double value);
     void SetStringValue(const std::wstring& value);
+    void NotifyValueChanged();             // Generation bump + subscriber fan-out
     double Normalize(double value) const;  // Normalize to 0-1 range
 };
 
@@ -289,6 +326,11 @@ protected:
 /**
  * @brief WebParser measure for HTTP requests
  * Pattern from Evolucion\Clima and illustro\Network (external IP)
+ *
+ * Fetches go through Core::HttpFetchService (connection pooling,
+ * request coalescing, ETag/TTL cache) with cacheTtlMs set from the
+ * measure's effective update interval, so several measures polling the
+ * same endpoint share one connection and one request per cycle.
  */
 class WebParserMeasure : public MeasureBase {
 private:
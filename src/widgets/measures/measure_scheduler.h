@@ -0,0 +1,231 @@
+#pragma once
+// measure_scheduler.h - Hierarchical timer wheel for measure updates
+// Copyright (c) 2025 RainmeterManager. All rights reserved.
+
+#include "measure_base.h"
+#include "../../core/power_governor.h"
+#include <array>
+#include <list>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace RainmeterManager {
+namespace Widgets {
+namespace Measures {
+
+/**
+ * @brief Hierarchical timer wheel that drives measure updates
+ *
+ * Measures register once with their MeasureUpdatePolicy interval and the
+ * wheel hands back only the measures that are due on each tick, instead
+ * of the framework polling ShouldUpdate() on every registered measure.
+ * With hundreds of measures at mixed 250 ms - 60 s intervals this keeps
+ * the per-tick work proportional to the measures actually firing.
+ *
+ * Layout: two wheels of 256 slots each. The inner wheel advances one
+ * slot per TICK_GRANULARITY_MS (50 ms), covering ~12.8 s; longer
+ * intervals park in the outer wheel and cascade into the inner wheel as
+ * their slot comes around. Registration, cascade and expiry are all
+ * O(1) amortized per measure.
+ *
+ * Thread-safe; Advance() is expected to be called from the update tick
+ * (same cadence WidgetManager::Update runs at).
+ */
+class MeasureScheduler {
+public:
+    static constexpr DWORD TICK_GRANULARITY_MS = 50;
+    static constexpr size_t WHEEL_SLOTS = 256;
+
+    MeasureScheduler() = default;
+    ~MeasureScheduler() = default;
+
+    // Non-copyable - entries hold raw measure pointers
+    MeasureScheduler(const MeasureScheduler&) = delete;
+    MeasureScheduler& operator=(const MeasureScheduler&) = delete;
+
+    /**
+     * @brief Start driving a measure from the wheel
+     *
+     * The measure fires first after its full interval. Ownership stays
+     * with the caller; unregister before destroying the measure.
+     */
+    void RegisterMeasure(IMeasure* measure) {
+        if (!measure) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(wheelMutex_);
+        if (entries_.count(measure) != 0) {
+            return;  // Already scheduled
+        }
+
+        DWORD interval = measure->GetUpdatePolicy().GetEffectiveUpdateInterval();
+        if (interval < TICK_GRANULARITY_MS) {
+            interval = TICK_GRANULARITY_MS;
+        }
+
+        Entry entry;
+        entry.measure = measure;
+        entry.intervalTicks = interval / TICK_GRANULARITY_MS;
+        entries_[measure] = entry;
+        Schedule(measure, entries_[measure].intervalTicks);
+    }
+
+    /**
+     * @brief Stop driving a measure; safe to destroy it afterwards
+     */
+    void UnregisterMeasure(IMeasure* measure) {
+        std::lock_guard<std::mutex> lock(wheelMutex_);
+        auto it = entries_.find(measure);
+        if (it == entries_.end()) {
+            return;
+        }
+
+        // Unlink from whichever slot currently holds it
+        if (it->second.slotList) {
+            it->second.slotList->erase(it->second.slotIterator);
+        }
+        entries_.erase(it);
+    }
+
+    /**
+     * @brief Re-read a measure's update policy after it changed
+     */
+    void RescheduleMeasure(IMeasure* measure) {
+        UnregisterMeasure(measure);
+        RegisterMeasure(measure);
+    }
+
+    /**
+     * @brief Advance the wheel to the current tick and update due measures
+     *
+     * Catches up one inner slot at a time if more than one granule
+     * elapsed since the last call, so a stalled tick cannot skip slots.
+     * Returns the number of measures updated.
+     */
+    size_t Advance(DWORD nowTickMs) {
+        std::vector<IMeasure*> due;
+        {
+            std::lock_guard<std::mutex> lock(wheelMutex_);
+
+            if (lastAdvanceMs_ == 0) {
+                lastAdvanceMs_ = nowTickMs;
+            }
+
+            while (nowTickMs - lastAdvanceMs_ >= TICK_GRANULARITY_MS) {
+                lastAdvanceMs_ += TICK_GRANULARITY_MS;
+                innerCursor_ = (innerCursor_ + 1) % WHEEL_SLOTS;
+
+                if (innerCursor_ == 0) {
+                    outerCursor_ = (outerCursor_ + 1) % WHEEL_SLOTS;
+                    CascadeOuterSlot(outerCursor_);
+                }
+
+                ExpireInnerSlot(innerCursor_, due);
+            }
+
+            // Re-arm expired measures for their next interval. The
+            // power governor stretches the re-arm on battery/idle, so
+            // throttling takes effect from each measure's next fire
+            // and full cadence returns one interval after snap-back.
+            double stretch = Core::PowerGovernor::GetInstance().CurrentStretch();
+            for (IMeasure* measure : due) {
+                auto it = entries_.find(measure);
+                if (it != entries_.end()) {
+                    size_t ticks = it->second.intervalTicks;
+                    if (stretch > 1.0) {
+                        ticks = static_cast<size_t>(ticks * stretch);
+                    }
+                    Schedule(measure, ticks);
+                }
+            }
+        }
+
+        // Update outside the wheel lock so a slow measure cannot block
+        // registration from other threads
+        for (IMeasure* measure : due) {
+            measure->Update();
+        }
+        return due.size();
+    }
+
+    size_t GetRegisteredCount() const {
+        std::lock_guard<std::mutex> lock(wheelMutex_);
+        return entries_.size();
+    }
+
+private:
+    using SlotList = std::list<IMeasure*>;
+
+    struct Entry {
+        IMeasure* measure = nullptr;
+        size_t intervalTicks = 1;        // Interval in inner-wheel granules
+        size_t remainingTicks = 0;       // Granules left when parked in outer wheel
+        SlotList* slotList = nullptr;    // Slot currently holding this entry
+        SlotList::iterator slotIterator;
+    };
+
+    /**
+     * @brief Place a measure ticksFromNow granules in the future
+     *
+     * Fits in the inner wheel when within one revolution; otherwise
+     * parks in the outer wheel with the residue recorded for cascade.
+     */
+    void Schedule(IMeasure* measure, size_t ticksFromNow) {
+        Entry& entry = entries_[measure];
+
+        if (ticksFromNow < WHEEL_SLOTS) {
+            size_t slot = (innerCursor_ + ticksFromNow) % WHEEL_SLOTS;
+            innerWheel_[slot].push_back(measure);
+            entry.slotList = &innerWheel_[slot];
+            entry.slotIterator = std::prev(innerWheel_[slot].end());
+            entry.remainingTicks = 0;
+        } else {
+            // Count revolutions from the absolute inner position, not from
+            // the start of the current one: the inner wheel is partway
+            // through its revolution, so dividing the raw delta would
+            // cascade up to WHEEL_SLOTS - 1 granules early.
+            size_t adjusted = ticksFromNow + innerCursor_;
+            size_t revolutions = adjusted / WHEEL_SLOTS;
+            size_t slot = (outerCursor_ + revolutions) % WHEEL_SLOTS;
+            outerWheel_[slot].push_back(measure);
+            entry.slotList = &outerWheel_[slot];
+            entry.slotIterator = std::prev(outerWheel_[slot].end());
+            entry.remainingTicks = adjusted % WHEEL_SLOTS;
+        }
+    }
+
+    void ExpireInnerSlot(size_t slot, std::vector<IMeasure*>& due) {
+        SlotList& list = innerWheel_[slot];
+        for (IMeasure* measure : list) {
+            entries_[measure].slotList = nullptr;
+            due.push_back(measure);
+        }
+        list.clear();
+    }
+
+    void CascadeOuterSlot(size_t slot) {
+        SlotList expired;
+        expired.swap(outerWheel_[slot]);
+        for (IMeasure* measure : expired) {
+            Entry& entry = entries_[measure];
+            entry.slotList = nullptr;
+            // Residue of zero means due on this very granule
+            Schedule(measure, entry.remainingTicks);
+        }
+    }
+
+    std::array<SlotList, WHEEL_SLOTS> innerWheel_;
+    std::array<SlotList, WHEEL_SLOTS> outerWheel_;
+    size_t innerCursor_ = 0;
+    size_t outerCursor_ = 0;
+    DWORD lastAdvanceMs_ = 0;
+
+    std::map<IMeasure*, Entry> entries_;
+    mutable std::mutex wheelMutex_;
+};
+
+} // namespace Measures
+} // namespace Widgets
+} // namespace RainmeterManager
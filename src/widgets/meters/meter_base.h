@@ -4,6 +4,8 @@
 // Copyright (c) 2025 RainmeterManager. All rights reserved.
 
 #include "../measures/measure_base.h"
+#include "../d2d_resource_cache.h"
+#include "text_layout_cache.h"
 #include <d2d1.h>
 #include <dwrite.h>
 #include <string>
@@ -121,14 +123,36 @@ protected:
     // Bound measures (up to 8 as seen in Rainmeter)
     std::vector<Measures::IMeasure*> measures_;
     std::map<std::wstring, Measures::IMeasure*> namedMeasures_;
-    
+
+    // Change detection: last-seen generation per bound measure
+    // (parallel to measures_; BindMeasure appends a zero entry so the
+    // first Update always registers as a change). Update() compares
+    // generations and sets dirty_ only when a bound measure actually
+    // produced a new value, which is what dirty-region rendering keys
+    // off — unchanged meters skip re-fetch, re-format and redraw.
+    std::vector<uint64_t> measureGenerations_;
+    bool dirty_;
+
+    // Formatted-string cache for the primary measure: re-formatted only
+    // when its generation moves, so a 60fps render of a 1Hz measure
+    // formats once per second instead of once per frame
+    std::wstring cachedStringValue_;
+    uint64_t cachedStringGeneration_;
+
     // Mouse interaction state
     bool mouseOver_;
     std::function<void()> onLeftClick_;
     std::function<void()> onRightClick_;
     std::function<void(int)> onMouseScroll_;
     std::wstring tooltipText_;
-    
+
+    // Shared D2D resources (not owned; may be null). When attached,
+    // OnInitialize/OnRender take brushes and text formats from the
+    // cache instead of creating per-meter copies, and OnShutdown must
+    // not release them; without a cache meters fall back to owning
+    // their own resources as before.
+    D2DResourceCache* resourceCache_;
+
 public:
     MeterBase(const std::wstring& name, MeterType type);
     virtual ~MeterBase();
@@ -164,7 +188,24 @@ public:
     void SetRightClickAction(std::function<void()> action) { onRightClick_ = action; }
     void SetScrollAction(std::function<void(int)> action) { onMouseScroll_ = action; }
     void SetTooltip(const std::wstring& tooltip) { tooltipText_ = tooltip; }
-    
+
+    /**
+     * @brief Attach the per-render-target resource cache
+     *
+     * Call before Initialize (the owning widget gets the cache from
+     * WidgetManager::GetResourceCache). After a device loss the widget
+     * only needs to re-call Initialize on meters whose resources are
+     * not cache-backed; shared brushes recreate lazily.
+     */
+    void SetResourceCache(D2DResourceCache* cache) { resourceCache_ = cache; }
+
+    // Dirty tracking for the render pipeline: Update() raises dirty_
+    // when any bound measure's generation moved; the widget clears it
+    // after the meter has been drawn into the frame.
+    bool IsDirty() const { return dirty_; }
+    void MarkDirty() { dirty_ = true; }
+    void ClearDirty() { dirty_ = false; }
+
 protected:
     // Override in derived classes
     virtual bool OnInitialize(ID2D1RenderTarget* renderTarget) = 0;
@@ -175,6 +216,17 @@ protected:
     // Helpers
     double GetMeasureValue(size_t index = 0) const;
     std::wstring GetMeasureStringValue(size_t index = 0) const;
+
+    // Compares each bound measure's generation against the last-seen
+    // snapshot, updating the snapshot and returning true (and setting
+    // dirty_) if any moved. Called at the top of Update(); OnUpdate is
+    // skipped entirely when nothing changed.
+    bool PollMeasureGenerations();
+
+    // Generation-cached variant of GetMeasureStringValue for the
+    // primary measure: returns cachedStringValue_ unless the measure's
+    // generation moved since the last format.
+    const std::wstring& GetMeasureStringValueCached();
 };
 
 /**
@@ -201,22 +253,44 @@ private:
     IDWriteTextFormat* textFormat_;
     ID2D1SolidColorBrush* textBrush_;
     ID2D1SolidColorBrush* shadowBrush_;
-    
+
+    // Layout caching (see text_layout_cache.h). The processed text is
+    // memoized so FormatText/ApplyCase run only when text_ or the case
+    // setting changes, not every frame; the shared cache turns a
+    // stable label's render into a cached DrawTextLayout call.
+    TextLayoutCache* layoutCache_;         // Shared, not owned; may be null
+    std::wstring processedText_;           // FormatText + ApplyCase result
+    bool processedTextDirty_;
+
 public:
     explicit StringMeter(const std::wstring& name);
     ~StringMeter();
-    
+
     // Configuration
-    void SetText(const std::wstring& text) { text_ = text; }
+    void SetText(const std::wstring& text) {
+        if (text_ != text) { text_ = text; processedTextDirty_ = true; }
+    }
     void SetFont(const std::wstring& face, float size);
     void SetColor(D2D1_COLOR_F color) { fontColor_ = color; }
     void SetAlignment(StringAlign align) { stringAlign_ = align; }
     void SetEffect(StringEffect effect, D2D1_COLOR_F effectColor);
-    void SetCase(StringCase textCase) { stringCase_ = textCase; }
+    void SetCase(StringCase textCase) {
+        if (stringCase_ != textCase) { stringCase_ = textCase; processedTextDirty_ = true; }
+    }
     void SetPercentual(bool percentual) { percentual_ = percentual; }
     void SetAutoScale(bool autoScale) { autoScale_ = autoScale; }
     void SetNumOfDecimals(int decimals) { numOfDecimals_ = decimals; }
-    
+
+    /**
+     * @brief Attach the layout cache shared by this widget's meters
+     *
+     * Without a cache the meter falls back to per-frame layout
+     * creation. SetFont releases textFormat_, so cached entries keyed
+     * on the old format pointer simply stop matching — no explicit
+     * invalidation is needed here.
+     */
+    void SetLayoutCache(TextLayoutCache* cache) { layoutCache_ = cache; }
+
 protected:
     bool OnInitialize(ID2D1RenderTarget* renderTarget) override;
     void OnUpdate() override;
@@ -226,6 +300,10 @@ protected:
 private:
     std::wstring FormatText();
     std::wstring ApplyCase(const std::wstring& text);
+    // Returns processedText_, re-running FormatText/ApplyCase only
+    // when processedTextDirty_ is set (OnUpdate marks it when the
+    // measure value changed)
+    const std::wstring& GetProcessedText();
     D2D1_RECT_F GetTextRect() const;
     DWRITE_TEXT_ALIGNMENT GetDWriteAlignment() const;
 };
@@ -341,6 +419,12 @@ private:
 class ImageMeter : public MeterBase {
 private:
     std::wstring imagePath_;
+    // Bundle-relative asset path; when set and the shared packed bundle
+    // (Core::SharedResourceBundle) is open, LoadImage resolves the
+    // encoded bytes from the mapped archive and the decoded pixels from
+    // Core::DecodedImageCache — an icon shared by ten widgets is stored
+    // and decoded once — falling back to imagePath_ otherwise.
+    std::wstring bundleAssetPath_;
     bool preserveAspectRatio_;
     bool greyscale_;
     D2D1_COLOR_F imageTint_;
@@ -355,6 +439,7 @@ public:
     ~ImageMeter();
     
     void SetImagePath(const std::wstring& path);
+    void SetBundleAsset(const std::wstring& assetPath);
     void SetPreserveAspectRatio(bool preserve) { preserveAspectRatio_ = preserve; }
     void SetGreyscale(bool grey) { greyscale_ = grey; }
     void SetTint(D2D1_COLOR_F tint) { imageTint_ = tint; }
@@ -0,0 +1,148 @@
+#pragma once
+// text_layout_cache.h - Shared LRU cache for DirectWrite text layouts
+// Copyright (c) 2025 RainmeterManager. All rights reserved.
+
+#include <dwrite.h>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace RainmeterManager {
+namespace Widgets {
+namespace Meters {
+
+/**
+ * @brief LRU cache of IDWriteTextLayout objects shared across meters
+ *
+ * String meters previously re-created a text layout every frame even
+ * when the label was unchanged — the top Direct2D cost in text-heavy
+ * skins. The cache keys layouts by (text, format identity, wrap box)
+ * so an unchanged label costs a hash lookup and a DrawTextLayout call;
+ * a changing value (CPU percentage) only re-creates its own layout.
+ *
+ * Text layouts are device-independent, so device-lost recovery does
+ * NOT invalidate the cache — only Clear() (skin unload, font change)
+ * drops entries. Thread-safe; one instance is shared by all meters of
+ * a widget (wire through StringMeter::SetLayoutCache).
+ */
+class TextLayoutCache {
+public:
+    explicit TextLayoutCache(size_t capacity = 128)
+        : capacity_(capacity) {}
+
+    ~TextLayoutCache() { Clear(); }
+
+    TextLayoutCache(const TextLayoutCache&) = delete;
+    TextLayoutCache& operator=(const TextLayoutCache&) = delete;
+
+    /**
+     * @brief Get a layout for the text, creating and caching on miss
+     *
+     * The returned layout is owned by the cache and stays valid until
+     * it ages out of the LRU or Clear() is called; draw it this frame,
+     * do not hold it across frames and do not Release it.
+     * @param factory DirectWrite factory used on a cache miss
+     * @param text Already case/format-processed display text
+     * @param format Text format (its pointer identity keys the entry)
+     * @param maxWidth Layout box width
+     * @param maxHeight Layout box height
+     * @return Cached layout, or nullptr on creation failure
+     */
+    IDWriteTextLayout* GetLayout(IDWriteFactory* factory, const std::wstring& text,
+                                 IDWriteTextFormat* format, float maxWidth, float maxHeight) {
+        if (!factory || !format) {
+            return nullptr;
+        }
+
+        std::wstring key = MakeKey(text, format, maxWidth, maxHeight);
+
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+
+        auto it = index_.find(key);
+        if (it != index_.end()) {
+            // Hit: refresh LRU position
+            lru_.splice(lru_.begin(), lru_, it->second);
+            ++hits_;
+            return it->second->layout;
+        }
+
+        IDWriteTextLayout* layout = nullptr;
+        HRESULT hr = factory->CreateTextLayout(
+            text.c_str(), static_cast<UINT32>(text.length()),
+            format, maxWidth, maxHeight, &layout);
+        if (FAILED(hr) || !layout) {
+            return nullptr;
+        }
+
+        lru_.push_front(Entry{ std::move(key), layout });
+        index_[lru_.front().key] = lru_.begin();
+        ++misses_;
+
+        EvictIfNeeded();
+        return layout;
+    }
+
+    /**
+     * @brief Drop every cached layout (skin unload, font change)
+     */
+    void Clear() {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        for (Entry& entry : lru_) {
+            entry.layout->Release();
+        }
+        lru_.clear();
+        index_.clear();
+    }
+
+    size_t GetEntryCount() const {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        return lru_.size();
+    }
+
+    uint64_t GetHitCount() const { return hits_; }
+    uint64_t GetMissCount() const { return misses_; }
+
+private:
+    struct Entry {
+        std::wstring key;
+        IDWriteTextLayout* layout;
+    };
+
+    static std::wstring MakeKey(const std::wstring& text, IDWriteTextFormat* format,
+                                float maxWidth, float maxHeight) {
+        // Format pointer identity stands in for face/size/alignment:
+        // meters cache their IDWriteTextFormat per configuration, so a
+        // config change means a new format object and thus a new key
+        std::wstring key;
+        key.reserve(text.size() + 32);
+        key = text;
+        key += L'\x1F';
+        key += std::to_wstring(reinterpret_cast<uintptr_t>(format));
+        key += L'\x1F';
+        key += std::to_wstring(static_cast<int>(maxWidth));
+        key += L'\x1F';
+        key += std::to_wstring(static_cast<int>(maxHeight));
+        return key;
+    }
+
+    void EvictIfNeeded() {
+        while (lru_.size() > capacity_) {
+            Entry& victim = lru_.back();
+            index_.erase(victim.key);
+            victim.layout->Release();
+            lru_.pop_back();
+        }
+    }
+
+    size_t capacity_;
+    std::list<Entry> lru_;
+    std::unordered_map<std::wstring, std::list<Entry>::iterator> index_;
+    mutable std::mutex cacheMutex_;
+    uint64_t hits_ = 0;
+    uint64_t misses_ = 0;
+};
+
+} // namespace Meters
+} // namespace Widgets
+} // namespace RainmeterManager
@@ -2,7 +2,7 @@
 #define TICKER_WIDGET_H
 
 #include "../../widget_framework.h"
-#include <json/json.h>
+#include "../../core/json_document.h"
 #include <deque>
 
 /**
@@ -15,12 +15,18 @@
  * - Cryptocurrency prices (CoinGecko, CoinMarketCap)
  * 
  * Features:
- * - Scrolling ticker display
+ * - Scrolling ticker display (pre-rendered strip, blitted per frame)
  * - Real-time price/score updates
  * - Multiple data sources
  * - Customizable refresh intervals
  * - Alert thresholds
  * - Fallback to cached data
+ *
+ * Rendering: the formatted ticker line is laid out and rendered ONCE
+ * into an off-screen strip bitmap; each scroll tick is a source-rect
+ * offset blit from that strip (two blits at the wrap seam). The strip
+ * is rebuilt only when the feed content actually changes, so a 60 fps
+ * ticker costs a copy per frame rather than a full text-layout pass.
  */
 class TickerWidget : public StreamingWidget {
 public:
@@ -81,7 +87,7 @@ public:
     };
 
     TickerWidget(const std::string& id, const TickerConfig& config);
-    ~TickerWidget() = default;
+    ~TickerWidget();  // Releases the cached strip bitmap
 
     // Configuration
     void setTickerConfig(const TickerConfig& config);
@@ -134,6 +140,19 @@ private:
     std::atomic<bool> scrollingPaused{false};
     int scrollOffset = 0;
     std::mutex dataMutex;
+    // Reused across feed refreshes so the structural index keeps its
+    // capacity between polls
+    RainmeterManager::Core::JsonDocument tickerJsonDoc;
+
+    // Cached strip rendering state. stripBitmap holds the whole
+    // formatted ticker line rendered once; stripContentHash is the
+    // hash of the text it was rendered from, so feed refreshes that
+    // produce identical display text do not trigger a rebuild.
+    HBITMAP stripBitmap = nullptr;
+    int stripWidthPx = 0;
+    int stripHeightPx = 0;
+    uint64_t stripContentHash = 0;
+    std::atomic<bool> stripDirty{true};
 
     // Provider-specific implementations
     static std::map<DataProvider, std::function<std::string(const TickerConfig&)>> urlGenerators;
@@ -143,12 +162,27 @@ private:
     std::string generateApiUrl();
     void parseTickerData(const std::vector<uint8_t>& data);
     void updateTickerDisplay();
+    // Advances scrollOffset and invalidates the window; the paint path
+    // blits from the cached strip, so this loop does no text layout
     void scrollTickerLoop();
+
+    // Cached strip rendering helpers
+    // Re-lays-out and renders the full ticker line into stripBitmap.
+    // Called from the paint path when stripDirty is set; cheap no-op
+    // otherwise.
+    void rebuildStripIfDirty(HDC hdc);
+    // Copies the visible window from the strip at scrollOffset; emits
+    // two blits when the visible region spans the wrap seam
+    void blitScrolledStrip(HDC hdc);
+    // FNV-1a over the formatted items; parseTickerData compares this
+    // against stripContentHash and sets stripDirty only on change
+    uint64_t hashTickerContent() const;
+    void releaseStripBitmap();
     void monitorAlerts();
     void triggerAlert(const AlertThreshold& threshold, const TickerItem& item);
     std::string formatTickerItem(const TickerItem& item);
     std::string generateFallbackTickerContent();
-    bool validateTickerData(const Json::Value& data);
+    bool validateTickerData(const RainmeterManager::Core::JsonCursor& data);
 
     // Provider implementations
     std::string generateYahooFinanceUrl();
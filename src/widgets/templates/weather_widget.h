@@ -2,7 +2,7 @@
 #define WEATHER_WIDGET_H
 
 #include "../../widget_framework.h"
-#include <json/json.h>
+#include "../../core/json_document.h"
 #include <wininet.h>
 
 /**
@@ -102,6 +102,9 @@ protected:
 
 private:
     WeatherConfig weatherConfig;
+    // Reused across refreshes so the structural index keeps its
+    // capacity - polling parses allocate nothing in steady state
+    RainmeterManager::Core::JsonDocument weatherJsonDoc;
     std::vector<std::vector<uint8_t>> animationFrames;
     int currentFrame = 0;
     std::chrono::system_clock::time_point lastDataUpdate;
@@ -120,8 +123,10 @@ private:
     void animationLoop();
     void parseWeatherData(const std::vector<uint8_t>& data);
     std::string buildApiUrl();
-    Json::Value parseWeatherJson(const std::vector<uint8_t>& data);
-    bool validateWeatherData(const Json::Value& data);
+    // Parses into weatherJsonDoc (lazy - fields convert only when read);
+    // data must stay alive while cursors from the document are in use
+    bool parseWeatherJson(const std::vector<uint8_t>& data);
+    bool validateWeatherData(const RainmeterManager::Core::JsonCursor& root);
     std::string generateFallbackWeatherContent();
 
     // Provider implementations
@@ -3,18 +3,200 @@
 
 #include "widget_manager.h"
 #include "../core/logger.h"
+#include "../core/string_intern.h"
 #include <algorithm>
 #include <fstream>
-#include <codecvt>
-#include <locale>
+#include <iterator>
+#include <sstream>
 
 // Helper function to convert wide string to narrow string
 static std::string WStringToString(const std::wstring& wstr) {
-    if (wstr.empty()) return std::string();
-    int size_needed = WideCharToMultiByte(CP_UTF8, 0, &wstr[0], (int)wstr.size(), NULL, 0, NULL, NULL);
-    std::string strTo(size_needed, 0);
-    WideCharToMultiByte(CP_UTF8, 0, &wstr[0], (int)wstr.size(), &strTo[0], size_needed, NULL, NULL);
-    return strTo;
+    return RainmeterManager::Core::Utf16ToUtf8(wstr);
+}
+
+// Helper function to convert narrow (UTF-8) string to wide string
+static std::wstring StringToWString(const std::string& str) {
+    return RainmeterManager::Core::Utf8ToUtf16(str);
+}
+
+// Widget names are a small stable population that crosses the
+// UTF-16/UTF-8 boundary on every log line; interning converts each
+// name once and hands back the cached encoding afterwards
+static const std::string& WidgetNameUtf8(const std::wstring& name) {
+    return RainmeterManager::Core::StringInternTable::GetInstance().Intern(name).Utf8();
+}
+
+namespace {
+    // Budget scheduling tuning. The interaction budget is deliberately
+    // tight: while the user drags a window, updates get just enough time
+    // to keep high-priority widgets fresh and everything else waits.
+    constexpr DWORD DEFAULT_UPDATE_BUDGET_MS = 8;
+    constexpr DWORD INTERACTION_BUDGET_MS = 2;
+    constexpr uint32_t AGING_TICKS_PER_BOOST = 4;
+    constexpr uint32_t MAX_AGING_BOOST = 4;
+
+    // Config watcher tuning. The debounce absorbs the multiple writes
+    // editors make while saving; the wait timeout bounds how long a
+    // stop request can go unnoticed.
+    constexpr DWORD CONFIG_WATCH_WAIT_MS = 500;
+    constexpr DWORD CONFIG_WATCH_DEBOUNCE_MS = 200;
+
+    // Below this many widget sections the fan-out overhead exceeds the
+    // parse work; parse serially
+    constexpr size_t PARALLEL_PARSE_THRESHOLD = 8;
+
+    // Persistence tuning. Dirty widgets flush to the journal once edits
+    // have been quiet this long (a drag marks dirty continuously, so
+    // nothing writes until the drag ends); the journal compacts into
+    // the config file after this many appended patches.
+    constexpr DWORD PERSIST_QUIET_MS = 500;
+    constexpr size_t JOURNAL_COMPACT_THRESHOLD = 64;
+
+    // Spatial index cell edge. Widgets are typically 100-400px; 128
+    // keeps most widgets in 1-9 cells and a cursor query to one bucket
+    constexpr int SPATIAL_CELL_SIZE = 128;
+
+    // Floor division so negative coordinates (monitors left of primary)
+    // map to their own cells instead of folding onto cell 0
+    int SpatialCellOf(int coordinate) {
+        return (coordinate >= 0)
+            ? coordinate / SPATIAL_CELL_SIZE
+            : (coordinate - (SPATIAL_CELL_SIZE - 1)) / SPATIAL_CELL_SIZE;
+    }
+
+    // --- Minimal JSON helpers for the widget config file ---
+    // The file is a flat {"widgets":[{...},...]} document; these mirror
+    // the hand-rolled extraction ConfigManager uses rather than pulling
+    // in a JSON library for one file.
+
+    std::string ExtractJsonString(const std::string& object, const std::string& key) {
+        std::string pattern = "\"" + key + "\"";
+        size_t pos = object.find(pattern);
+        if (pos == std::string::npos) return std::string();
+        pos = object.find(':', pos + pattern.size());
+        if (pos == std::string::npos) return std::string();
+        pos = object.find('"', pos + 1);
+        if (pos == std::string::npos) return std::string();
+        size_t end = object.find('"', pos + 1);
+        if (end == std::string::npos) return std::string();
+        return object.substr(pos + 1, end - pos - 1);
+    }
+
+    std::string ExtractJsonScalar(const std::string& object, const std::string& key) {
+        std::string pattern = "\"" + key + "\"";
+        size_t pos = object.find(pattern);
+        if (pos == std::string::npos) return std::string();
+        pos = object.find(':', pos + pattern.size());
+        if (pos == std::string::npos) return std::string();
+        ++pos;
+        while (pos < object.size() && (object[pos] == ' ' || object[pos] == '\t')) ++pos;
+        size_t end = pos;
+        while (end < object.size() && object[end] != ',' && object[end] != '}' &&
+               object[end] != '\r' && object[end] != '\n') ++end;
+        return object.substr(pos, end - pos);
+    }
+
+    int ExtractJsonInt(const std::string& object, const std::string& key, int defaultValue) {
+        std::string value = ExtractJsonScalar(object, key);
+        if (value.empty()) return defaultValue;
+        try {
+            return std::stoi(value);
+        } catch (...) {
+            return defaultValue;
+        }
+    }
+
+    bool ExtractJsonBool(const std::string& object, const std::string& key, bool defaultValue) {
+        std::string value = ExtractJsonScalar(object, key);
+        if (value.find("true") != std::string::npos) return true;
+        if (value.find("false") != std::string::npos) return false;
+        return defaultValue;
+    }
+
+    // Splits the "widgets" array into the text of its top-level objects
+    std::vector<std::string> SplitWidgetObjects(const std::string& json) {
+        std::vector<std::string> objects;
+
+        size_t arrayPos = json.find("\"widgets\"");
+        if (arrayPos == std::string::npos) return objects;
+        arrayPos = json.find('[', arrayPos);
+        if (arrayPos == std::string::npos) return objects;
+
+        int depth = 0;
+        size_t objectStart = 0;
+        bool inString = false;
+        for (size_t i = arrayPos + 1; i < json.size(); ++i) {
+            char c = json[i];
+            if (inString) {
+                if (c == '\\') ++i;
+                else if (c == '"') inString = false;
+                continue;
+            }
+            if (c == '"') {
+                inString = true;
+            } else if (c == '{') {
+                if (depth++ == 0) objectStart = i;
+            } else if (c == '}') {
+                if (--depth == 0) {
+                    objects.push_back(json.substr(objectStart, i - objectStart + 1));
+                }
+            } else if (c == ']' && depth == 0) {
+                break;
+            }
+        }
+        return objects;
+    }
+
+    // Parses one object from the "widgets" array. Pure string work on an
+    // independent slice, so sections parse in parallel during a load.
+    bool ParseOneWidgetObject(const std::string& object,
+                              RainmeterManager::Widgets::WidgetConfig& config) {
+        config.name = StringToWString(ExtractJsonString(object, "name"));
+        config.type = StringToWString(ExtractJsonString(object, "type"));
+        if (config.name.empty() || config.type.empty()) {
+            return false;
+        }
+        config.x = ExtractJsonInt(object, "x", 0);
+        config.y = ExtractJsonInt(object, "y", 0);
+        config.width = static_cast<UINT>(ExtractJsonInt(object, "width", 200));
+        config.height = static_cast<UINT>(ExtractJsonInt(object, "height", 200));
+        config.visible = ExtractJsonBool(object, "visible", true);
+        config.configFile = StringToWString(ExtractJsonString(object, "configFile"));
+        config.updateIntervalMs = static_cast<UINT>(ExtractJsonInt(object, "updateIntervalMs", 1000));
+        return true;
+    }
+
+    // Changes a running widget can absorb without being re-created
+    bool ConfigsEqualInPlace(const RainmeterManager::Widgets::WidgetConfig& a,
+                             const RainmeterManager::Widgets::WidgetConfig& b) {
+        return a.x == b.x && a.y == b.y &&
+               a.width == b.width && a.height == b.height &&
+               a.visible == b.visible;
+    }
+
+    // Changes that require tearing the widget down and re-creating it
+    bool ConfigsRequireRecreate(const RainmeterManager::Widgets::WidgetConfig& a,
+                                const RainmeterManager::Widgets::WidgetConfig& b) {
+        return a.type != b.type ||
+               a.configFile != b.configFile ||
+               a.updateIntervalMs != b.updateIntervalMs;
+    }
+
+    // Serializes one widget entry in the same shape ParseOneWidgetObject
+    // reads, so journal lines and the compacted file round-trip
+    std::string SerializeWidgetObject(const RainmeterManager::Widgets::WidgetConfig& config) {
+        std::ostringstream out;
+        out << "{\"name\":\"" << WidgetNameUtf8(config.name)
+            << "\",\"type\":\"" << WStringToString(config.type)
+            << "\",\"x\":" << config.x
+            << ",\"y\":" << config.y
+            << ",\"width\":" << config.width
+            << ",\"height\":" << config.height
+            << ",\"visible\":" << (config.visible ? "true" : "false")
+            << ",\"configFile\":\"" << WStringToString(config.configFile)
+            << "\",\"updateIntervalMs\":" << config.updateIntervalMs << "}";
+        return out.str();
+    }
 }
 
 namespace RainmeterManager {
@@ -25,6 +207,7 @@ WidgetManager::WidgetManager()
     , initialized_(false)
     , lastUpdateTick_(0)
     , updateIntervalMs_(16)  // Default ~60fps
+    , updateBudgetMs_(DEFAULT_UPDATE_BUDGET_MS)
 {
     LOG_INFO("WidgetManager created");
 }
@@ -51,7 +234,7 @@ bool WidgetManager::Initialize(std::shared_ptr<Core::ISystemMonitor> monitor) {
     // Initialize all existing widgets
     for (auto& widget : widgets_) {
         if (!widget->Initialize()) {
-            LOG_ERROR("Failed to initialize widget: " + WStringToString(widget->GetName()));
+            LOG_ERROR("Failed to initialize widget: " + WidgetNameUtf8(widget->GetName()));
             continue;
         }
 
@@ -61,15 +244,24 @@ bool WidgetManager::Initialize(std::shared_ptr<Core::ISystemMonitor> monitor) {
         }
     }
 
+    StartUpdateWorkers();
+
     initialized_ = true;
     lastUpdateTick_ = GetTickCount();
 
-    LOG_INFO("WidgetManager initialized successfully with " + 
+    LOG_INFO("WidgetManager initialized successfully with " +
              std::to_string(widgets_.size()) + " widgets");
     return true;
 }
 
 void WidgetManager::Shutdown() {
+    // Join the watcher and the worker pool before taking widgetMutex_:
+    // a reload or deferred widget instantiation in flight takes that
+    // lock through AddWidget/RemoveWidget, so joining under it would
+    // deadlock
+    StopConfigWatcher();
+    StopUpdateWorkers();
+
     std::lock_guard<std::mutex> lock(widgetMutex_);
 
     if (!initialized_) {
@@ -85,14 +277,21 @@ void WidgetManager::Shutdown() {
 
     widgets_.clear();
     widgetsByName_.clear();
+    scheduleState_.clear();
+    spatialIndexDirty_ = true;
     systemMonitor_.reset();
     renderTarget_ = nullptr;
+    resourceCache_.SetRenderTarget(nullptr);
+    resourceCache_.ReleaseDeviceIndependentResources();
     initialized_ = false;
 
     LOG_INFO("WidgetManager shut down successfully");
 }
 
 void WidgetManager::Update() {
+    // Cheap (internally rate-limited); keeps the stretch factor fresh
+    Core::PowerGovernor::GetInstance().Poll();
+
     if (!initialized_ || !ShouldUpdate()) {
         return;
     }
@@ -102,35 +301,87 @@ void WidgetManager::Update() {
     // Update system monitor first
     UpdateSystemMonitor();
 
-    // Update all widgets
+    // Partition visible widgets by update cost
+    std::vector<IWidget*> fastWidgets;
+    std::vector<IWidget*> blockingWidgets;
+    fastWidgets.reserve(widgets_.size());
+
     for (auto& widget : widgets_) {
-        if (widget->IsVisible()) {
-            widget->Update();
+        if (!widget->IsVisible()) {
+            continue;
+        }
+        if (widget->GetUpdateClass() == WidgetUpdateClass::Blocking) {
+            blockingWidgets.push_back(widget.get());
+        } else {
+            fastWidgets.push_back(widget.get());
         }
     }
 
+    // Blocking widgets (network/disk measures) update detached; a widget
+    // whose previous refresh is still running is simply skipped this tick
+    for (IWidget* widget : blockingWidgets) {
+        if (TryMarkInFlight(widget)) {
+            SubmitUpdateTask([this, widget]() {
+                widget->Update();
+                ClearInFlight(widget);
+            });
+        }
+    }
+
+    // Fast widgets run in priority order against the tick's time budget
+    RunBudgetedUpdates(fastWidgets);
+
     lastUpdateTick_ = GetTickCount();
 }
 
 void WidgetManager::SetRenderTarget(ID2D1RenderTarget* renderTarget) {
     std::lock_guard<std::mutex> lock(widgetMutex_);
     renderTarget_ = renderTarget;
+    // Rebinding drops cached device resources in one pass; brushes
+    // repopulate lazily on the next render, which is the entire
+    // device-lost recovery path for shared resources
+    resourceCache_.SetRenderTarget(renderTarget);
     LOG_DEBUG("Render target set for WidgetManager");
 }
 
-void WidgetManager::RenderAll() {
+RECT WidgetManager::RenderAll() {
+    RECT combinedDirty = { 0, 0, 0, 0 };
+
     if (!initialized_ || !renderTarget_) {
-        return;
+        return combinedDirty;
     }
 
     std::lock_guard<std::mutex> lock(widgetMutex_);
 
-    // Render all visible widgets
+    // Render only widgets that invalidated since their last render;
+    // clean widgets keep their previous pixels
+    bool anyDirty = false;
     for (auto& widget : widgets_) {
-        if (widget->IsVisible()) {
-            widget->Render(renderTarget_);
+        if (!widget->IsVisible() || !widget->IsDirty()) {
+            continue;
+        }
+
+        widget->Render(renderTarget_);
+        widget->ClearDirty();
+
+        int x, y;
+        UINT width, height;
+        widget->GetPosition(x, y);
+        widget->GetSize(width, height);
+
+        RECT bounds = { x, y, x + static_cast<LONG>(width), y + static_cast<LONG>(height) };
+        if (!anyDirty) {
+            combinedDirty = bounds;
+            anyDirty = true;
+        } else {
+            combinedDirty.left = (std::min)(combinedDirty.left, bounds.left);
+            combinedDirty.top = (std::min)(combinedDirty.top, bounds.top);
+            combinedDirty.right = (std::max)(combinedDirty.right, bounds.right);
+            combinedDirty.bottom = (std::max)(combinedDirty.bottom, bounds.bottom);
         }
     }
+
+    return combinedDirty;
 }
 
 void WidgetManager::RenderWidget(const std::wstring& name) {
@@ -143,6 +394,7 @@ void WidgetManager::RenderWidget(const std::wstring& name) {
     auto it = widgetsByName_.find(name);
     if (it != widgetsByName_.end() && it->second->IsVisible()) {
         it->second->Render(renderTarget_);
+        it->second->ClearDirty();
     }
 }
 
@@ -158,16 +410,16 @@ bool WidgetManager::AddWidget(std::unique_ptr<IWidget> widget) {
 
     // Check for duplicate names
     if (widgetsByName_.find(name) != widgetsByName_.end()) {
-        LOG_ERROR("Widget with name already exists: " + WStringToString(name));
+        LOG_ERROR("Widget with name already exists: " + WidgetNameUtf8(name));
         return false;
     }
 
-    LOG_INFO("Adding widget: " + WStringToString(name));
+    LOG_INFO("Adding widget: " + WidgetNameUtf8(name));
 
     // Initialize if manager is already initialized
     if (initialized_) {
         if (!widget->Initialize()) {
-            LOG_ERROR("Failed to initialize new widget: " + WStringToString(name));
+            LOG_ERROR("Failed to initialize new widget: " + WidgetNameUtf8(name));
             return false;
         }
 
@@ -181,8 +433,9 @@ bool WidgetManager::AddWidget(std::unique_ptr<IWidget> widget) {
     IWidget* widgetPtr = widget.get();
     widgetsByName_[name] = widgetPtr;
     widgets_.push_back(std::move(widget));
+    spatialIndexDirty_ = true;
 
-    LOG_INFO("Widget added successfully: " + WStringToString(name));
+    LOG_INFO("Widget added successfully: " + WidgetNameUtf8(name));
     return true;
 }
 
@@ -191,11 +444,15 @@ bool WidgetManager::RemoveWidget(const std::wstring& name) {
 
     auto it = widgetsByName_.find(name);
     if (it == widgetsByName_.end()) {
-        LOG_WARNING("Widget not found: " + WStringToString(name));
+        LOG_WARNING("Widget not found: " + WidgetNameUtf8(name));
         return false;
     }
 
-    LOG_INFO("Removing widget: " + WStringToString(name));
+    LOG_INFO("Removing widget: " + WidgetNameUtf8(name));
+
+    // A detached blocking update may still be running; wait it out before
+    // the widget is destroyed
+    WaitForInFlight(it->second);
 
     // Find and remove from vector
     auto vecIt = std::find_if(widgets_.begin(), widgets_.end(),
@@ -208,9 +465,11 @@ bool WidgetManager::RemoveWidget(const std::wstring& name) {
         widgets_.erase(vecIt);
     }
 
+    scheduleState_.erase(it->second);
     widgetsByName_.erase(it);
+    spatialIndexDirty_ = true;
 
-    LOG_INFO("Widget removed successfully: " + WStringToString(name));
+    LOG_INFO("Widget removed successfully: " + WidgetNameUtf8(name));
     return true;
 }
 
@@ -245,11 +504,14 @@ void WidgetManager::ClearAllWidgets() {
     LOG_INFO("Clearing all widgets (" + std::to_string(widgets_.size()) + ")");
 
     for (auto& widget : widgets_) {
+        WaitForInFlight(widget.get());
         widget->Shutdown();
     }
 
     widgets_.clear();
     widgetsByName_.clear();
+    scheduleState_.clear();
+    spatialIndexDirty_ = true;
 
     LOG_INFO("All widgets cleared");
 }
@@ -257,19 +519,508 @@ void WidgetManager::ClearAllWidgets() {
 bool WidgetManager::LoadWidgetsFromConfig(const std::wstring& configFile) {
     LOG_INFO("Loading widgets from config: " + WStringToString(configFile));
 
-    // TODO: Implement JSON/INI config loading
-    // For now, return false to indicate not implemented
-    LOG_WARNING("LoadWidgetsFromConfig not yet implemented");
-    return false;
+    // Parse outside loadMutex_: the parse fans out across the worker
+    // pool, and workers running deferred instantiations briefly take
+    // loadMutex_ themselves — holding it here while waiting on them
+    // could wedge the pool
+    std::vector<WidgetConfig> configs;
+    if (!ParseWidgetConfigs(configFile, configs)) {
+        // Keep the running widgets; a half-saved or malformed file must
+        // not tear anything down
+        LOG_ERROR("Failed to parse widget config, keeping current widgets: " +
+                  WStringToString(configFile));
+        return false;
+    }
+
+    // The diff and apply are serialized against the watcher thread and
+    // deferred instantiation tasks
+    std::lock_guard<std::mutex> lock(loadMutex_);
+    return ApplyConfigDiff(configs);
 }
 
 bool WidgetManager::SaveWidgetsToConfig(const std::wstring& configFile) {
     LOG_INFO("Saving widgets to config: " + WStringToString(configFile));
 
-    // TODO: Implement JSON/INI config saving
-    // For now, return false to indicate not implemented
-    LOG_WARNING("SaveWidgetsToConfig not yet implemented");
-    return false;
+    // Refresh every persisted entry from its live widget, then write the
+    // whole file once. Incremental geometry changes go through
+    // MarkWidgetDirty and the journal instead of this path.
+    std::lock_guard<std::mutex> lock(loadMutex_);
+    for (auto& entry : loadedConfigs_) {
+        IWidget* widget = GetWidget(entry.first);
+        if (!widget) continue;
+        widget->GetPosition(entry.second.x, entry.second.y);
+        widget->GetSize(entry.second.width, entry.second.height);
+        entry.second.visible = widget->IsVisible();
+    }
+    if (!WriteFullConfig(configFile)) {
+        return false;
+    }
+
+    // A full write supersedes any journaled patches for the same file
+    if (configFile == watchedConfigFile_) {
+        DeleteFileW(JournalPathFor(configFile).c_str());
+        std::lock_guard<std::mutex> persistLock(persistMutex_);
+        journaledPatches_ = 0;
+    }
+    return true;
+}
+
+void WidgetManager::MarkWidgetDirty(const std::wstring& name) {
+    std::lock_guard<std::mutex> lock(persistMutex_);
+    dirtyWidgets_.insert(name);
+    lastDirtyTime_ = std::chrono::steady_clock::now();
+}
+
+void WidgetManager::FlushDirtyWidgets(bool force) {
+    std::vector<std::wstring> names;
+    {
+        std::lock_guard<std::mutex> lock(persistMutex_);
+        if (dirtyWidgets_.empty()) {
+            return;
+        }
+        // A drag in progress marks dirty continuously; wait for the
+        // edits to go quiet so one journal line covers the whole drag
+        if (!force && std::chrono::steady_clock::now() - lastDirtyTime_ <
+                          std::chrono::milliseconds(PERSIST_QUIET_MS)) {
+            return;
+        }
+        names.assign(dirtyWidgets_.begin(), dirtyWidgets_.end());
+        dirtyWidgets_.clear();
+    }
+
+    // Refresh the persisted entries from the live widgets; only these
+    // entries are written, the config file itself stays untouched
+    std::vector<WidgetConfig> patches;
+    {
+        std::lock_guard<std::mutex> lock(loadMutex_);
+        for (const auto& name : names) {
+            auto it = loadedConfigs_.find(name);
+            IWidget* widget = GetWidget(name);
+            if (it == loadedConfigs_.end() || !widget) {
+                continue;
+            }
+            widget->GetPosition(it->second.x, it->second.y);
+            widget->GetSize(it->second.width, it->second.height);
+            it->second.visible = widget->IsVisible();
+            patches.push_back(it->second);
+        }
+    }
+    if (patches.empty()) {
+        return;
+    }
+
+    std::ofstream journal(JournalPathFor(watchedConfigFile_).c_str(), std::ios::app);
+    if (!journal.is_open()) {
+        LOG_ERROR("Cannot append widget journal for: " +
+                  WStringToString(watchedConfigFile_));
+        return;
+    }
+    for (const auto& config : patches) {
+        journal << SerializeWidgetObject(config) << "\n";
+    }
+    journal.close();
+
+    size_t total;
+    {
+        std::lock_guard<std::mutex> lock(persistMutex_);
+        journaledPatches_ += patches.size();
+        total = journaledPatches_;
+    }
+    if (total >= JOURNAL_COMPACT_THRESHOLD) {
+        CompactJournal();
+    }
+}
+
+void WidgetManager::CompactJournal() {
+    {
+        std::lock_guard<std::mutex> lock(loadMutex_);
+        if (!WriteFullConfig(watchedConfigFile_)) {
+            // Keep the journal; its patches still apply on the next load
+            return;
+        }
+    }
+
+    DeleteFileW(JournalPathFor(watchedConfigFile_).c_str());
+    {
+        std::lock_guard<std::mutex> lock(persistMutex_);
+        journaledPatches_ = 0;
+    }
+    LOG_INFO("Widget config journal compacted into: " +
+             WStringToString(watchedConfigFile_));
+}
+
+bool WidgetManager::WriteFullConfig(const std::wstring& configFile) {
+    std::ostringstream json;
+    json << "{\n  \"widgets\": [\n";
+    bool first = true;
+    for (const auto& entry : loadedConfigs_) {
+        if (!first) json << ",\n";
+        first = false;
+        json << "    " << SerializeWidgetObject(entry.second);
+    }
+    json << "\n  ]\n}\n";
+
+    // Write-then-rename so a reader never sees a half-written file
+    std::wstring tempFile = configFile + L".tmp";
+    std::ofstream out(tempFile.c_str(), std::ios::trunc);
+    if (!out.is_open()) {
+        LOG_ERROR("Cannot write widget config: " + WStringToString(tempFile));
+        return false;
+    }
+    out << json.str();
+    out.close();
+    if (!MoveFileExW(tempFile.c_str(), configFile.c_str(), MOVEFILE_REPLACE_EXISTING)) {
+        LOG_ERROR("Could not replace widget config (" +
+                  std::to_string(GetLastError()) + "): " + WStringToString(configFile));
+        return false;
+    }
+
+    // Remember the resulting timestamp so the watcher treats this write
+    // as our own rather than an external edit
+    WIN32_FILE_ATTRIBUTE_DATA data;
+    if (GetFileAttributesExW(configFile.c_str(), GetFileExInfoStandard, &data)) {
+        ULARGE_INTEGER time;
+        time.LowPart = data.ftLastWriteTime.dwLowDateTime;
+        time.HighPart = data.ftLastWriteTime.dwHighDateTime;
+        lastSelfWriteStamp_ = time.QuadPart;
+    }
+    return true;
+}
+
+std::wstring WidgetManager::JournalPathFor(const std::wstring& configFile) {
+    return configFile + L".journal";
+}
+
+bool WidgetManager::StartConfigWatcher(const std::wstring& configFile) {
+    if (configWatcherThread_.joinable()) {
+        LOG_WARNING("Config watcher already running");
+        return false;
+    }
+
+    // Initial load; watcher reloads apply incrementally on top of this
+    LoadWidgetsFromConfig(configFile);
+
+    watchedConfigFile_ = configFile;
+    configWatcherStop_ = false;
+    configWatcherThread_ = std::thread(&WidgetManager::ConfigWatcherLoop, this);
+
+    LOG_INFO("Config watcher started for: " + WStringToString(configFile));
+    return true;
+}
+
+void WidgetManager::StopConfigWatcher() {
+    configWatcherStop_ = true;
+    if (configWatcherThread_.joinable()) {
+        configWatcherThread_.join();
+        LOG_INFO("Config watcher stopped");
+    }
+}
+
+bool WidgetManager::ParseWidgetConfigs(const std::wstring& configFile,
+                                       std::vector<WidgetConfig>& outConfigs) {
+    std::ifstream file(configFile.c_str());
+    if (!file.is_open()) {
+        LOG_ERROR("Cannot open widget config file: " + WStringToString(configFile));
+        return false;
+    }
+
+    std::string json((std::istreambuf_iterator<char>(file)),
+                     std::istreambuf_iterator<char>());
+
+    if (json.find("\"widgets\"") == std::string::npos) {
+        LOG_ERROR("Widget config has no \"widgets\" array: " + WStringToString(configFile));
+        return false;
+    }
+
+    const std::vector<std::string> objects = SplitWidgetObjects(json);
+    std::vector<WidgetConfig> parsed(objects.size());
+    std::vector<uint8_t> valid(objects.size(), 0);
+
+    // Each index is written by exactly one worker, so the fan-out join
+    // is the only synchronization needed (same pattern as
+    // RunBudgetedUpdates)
+    auto parseOne = [&](size_t i) {
+        valid[i] = ParseOneWidgetObject(objects[i], parsed[i]) ? 1 : 0;
+    };
+
+    if (updateWorkers_.empty() || objects.size() < PARALLEL_PARSE_THRESHOLD) {
+        for (size_t i = 0; i < objects.size(); ++i) {
+            parseOne(i);
+        }
+    } else {
+        struct FanOutState {
+            std::mutex mutex;
+            std::condition_variable done;
+            size_t remaining;
+        };
+        auto state = std::make_shared<FanOutState>();
+
+        const size_t chunkCount = (std::min)(updateWorkers_.size(), objects.size());
+        state->remaining = chunkCount;
+
+        for (size_t chunk = 0; chunk < chunkCount; ++chunk) {
+            SubmitUpdateTask([state, chunk, chunkCount, &objects, &parseOne]() {
+                for (size_t i = chunk; i < objects.size(); i += chunkCount) {
+                    parseOne(i);
+                }
+                std::lock_guard<std::mutex> doneLock(state->mutex);
+                if (--state->remaining == 0) {
+                    state->done.notify_one();
+                }
+            });
+        }
+
+        std::unique_lock<std::mutex> doneLock(state->mutex);
+        state->done.wait(doneLock, [&state] { return state->remaining == 0; });
+    }
+
+    // Compact in file order so diffing and creation see a stable order
+    for (size_t i = 0; i < parsed.size(); ++i) {
+        if (valid[i]) {
+            outConfigs.push_back(std::move(parsed[i]));
+        } else {
+            LOG_WARNING("Skipping widget config entry without name or type");
+        }
+    }
+
+    // Fold journaled patches (see MarkWidgetDirty) on top of the file so
+    // a load never resurrects pre-drag geometry; later lines win
+    std::ifstream journal(JournalPathFor(configFile).c_str());
+    if (journal.is_open()) {
+        std::string line;
+        size_t patched = 0;
+        while (std::getline(journal, line)) {
+            WidgetConfig patch;
+            if (!ParseOneWidgetObject(line, patch)) {
+                continue;
+            }
+            for (auto& config : outConfigs) {
+                if (config.name == patch.name) {
+                    config = patch;
+                    ++patched;
+                    break;
+                }
+            }
+        }
+        if (patched > 0) {
+            LOG_INFO("Applied " + std::to_string(patched) +
+                     " journaled widget patches on load");
+        }
+    }
+
+    return true;
+}
+
+bool WidgetManager::ApplyConfigDiff(const std::vector<WidgetConfig>& newConfigs) {
+    std::map<std::wstring, WidgetConfig> newByName;
+    for (const auto& config : newConfigs) {
+        if (!newByName.emplace(config.name, config).second) {
+            LOG_WARNING("Duplicate widget name in config, keeping first: " +
+                        WidgetNameUtf8(config.name));
+        }
+    }
+
+    size_t added = 0, removed = 0, recreated = 0, inPlace = 0, unchanged = 0;
+    size_t deferredCount = 0;
+    bool allApplied = true;
+
+    // Widgets whose entries disappeared from the file
+    for (const auto& entry : loadedConfigs_) {
+        if (newByName.find(entry.first) == newByName.end()) {
+            RemoveWidget(entry.first);
+            ++removed;
+        }
+    }
+
+    std::map<std::wstring, WidgetConfig> applied;
+    for (const auto& entry : newByName) {
+        const WidgetConfig& config = entry.second;
+        auto prev = loadedConfigs_.find(entry.first);
+
+        if (prev != loadedConfigs_.end() && !ConfigsRequireRecreate(prev->second, config)) {
+            if (ConfigsEqualInPlace(prev->second, config)) {
+                // Entry unchanged; the widget keeps running untouched
+                ++unchanged;
+            } else {
+                // Geometry/visibility changes apply to the live widget
+                IWidget* widget = GetWidget(entry.first);
+                if (widget) {
+                    widget->SetPosition(config.x, config.y);
+                    widget->SetSize(config.width, config.height);
+                    widget->SetVisible(config.visible);
+                    NotifyWidgetBoundsChanged();
+                    ++inPlace;
+                }
+            }
+            applied.emplace(entry.first, config);
+            continue;
+        }
+
+        // New entry, or a change (type, widget config file, update rate)
+        // that the running instance cannot absorb
+        if (prev != loadedConfigs_.end()) {
+            RemoveWidget(entry.first);
+            ++recreated;
+        }
+
+        // Hidden widgets materialize lazily in the background so the
+        // visible ones appear without waiting behind them; the deferred
+        // task re-checks the entry in case a newer reload supersedes it
+        if (!config.visible && !updateWorkers_.empty()) {
+            applied.emplace(entry.first, config);
+            ++deferredCount;
+            SubmitUpdateTask([this, config]() {
+                InstantiateDeferredWidget(config);
+            });
+            continue;
+        }
+
+        auto widget = WidgetFactory::CreateWidget(config);
+        if (!widget) {
+            // Not recorded as applied, so a later reload retries it
+            LOG_WARNING("Could not create widget from config: " +
+                        WidgetNameUtf8(entry.first));
+            allApplied = false;
+            continue;
+        }
+
+        IWidget* widgetPtr = widget.get();
+        if (!AddWidget(std::move(widget))) {
+            allApplied = false;
+            continue;
+        }
+        widgetPtr->SetPosition(config.x, config.y);
+        widgetPtr->SetSize(config.width, config.height);
+        widgetPtr->SetVisible(config.visible);
+
+        if (prev == loadedConfigs_.end()) {
+            ++added;
+        }
+        applied.emplace(entry.first, config);
+    }
+
+    loadedConfigs_ = std::move(applied);
+
+    LOG_INFO("Widget config applied: " + std::to_string(added) + " added, " +
+             std::to_string(removed) + " removed, " + std::to_string(recreated) +
+             " recreated, " + std::to_string(inPlace) + " updated in place, " +
+             std::to_string(unchanged) + " unchanged, " +
+             std::to_string(deferredCount) + " deferred (hidden)");
+    return allApplied;
+}
+
+void WidgetManager::InstantiateDeferredWidget(const WidgetConfig& config) {
+    // Never block a worker on loadMutex_: a reload holding it may be
+    // waiting on this very pool (RemoveWidget waits out in-flight
+    // updates), so contending here could wedge both sides. If a reload
+    // is applying, yield briefly and requeue behind it.
+    std::unique_lock<std::mutex> lock(loadMutex_, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        Sleep(5);
+        SubmitUpdateTask([this, config]() {
+            InstantiateDeferredWidget(config);
+        });
+        return;
+    }
+
+    // A reload that ran after this task was queued may have removed or
+    // replaced the entry; only materialize what is still wanted
+    auto it = loadedConfigs_.find(config.name);
+    if (it == loadedConfigs_.end() || ConfigsRequireRecreate(it->second, config)) {
+        return;
+    }
+
+    auto widget = WidgetFactory::CreateWidget(config);
+    if (!widget) {
+        LOG_WARNING("Could not create deferred widget from config: " +
+                    WidgetNameUtf8(config.name));
+        // Drop the entry so the next reload retries it
+        loadedConfigs_.erase(it);
+        return;
+    }
+
+    IWidget* widgetPtr = widget.get();
+    if (!AddWidget(std::move(widget))) {
+        loadedConfigs_.erase(it);
+        return;
+    }
+    widgetPtr->SetPosition(config.x, config.y);
+    widgetPtr->SetSize(config.width, config.height);
+    widgetPtr->SetVisible(config.visible);
+    NotifyWidgetBoundsChanged();
+}
+
+void WidgetManager::ConfigWatcherLoop() {
+    // Watch the containing directory; editors typically save by writing
+    // a temp file and renaming over the original, which a handle on the
+    // file itself would miss
+    std::wstring directory = watchedConfigFile_;
+    size_t slash = directory.find_last_of(L"\\/");
+    directory = (slash != std::wstring::npos) ? directory.substr(0, slash) : L".";
+
+    auto lastWriteTime = [this]() -> ULONGLONG {
+        WIN32_FILE_ATTRIBUTE_DATA data;
+        if (!GetFileAttributesExW(watchedConfigFile_.c_str(), GetFileExInfoStandard, &data)) {
+            return 0;
+        }
+        ULARGE_INTEGER time;
+        time.LowPart = data.ftLastWriteTime.dwLowDateTime;
+        time.HighPart = data.ftLastWriteTime.dwHighDateTime;
+        return time.QuadPart;
+    };
+    ULONGLONG lastSeen = lastWriteTime();
+
+    HANDLE changeHandle = FindFirstChangeNotificationW(
+        directory.c_str(), FALSE,
+        FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME);
+    if (changeHandle == INVALID_HANDLE_VALUE) {
+        LOG_WARNING("FindFirstChangeNotification failed (" +
+                    std::to_string(GetLastError()) + "), polling config timestamp instead");
+    }
+
+    while (!configWatcherStop_) {
+        if (changeHandle != INVALID_HANDLE_VALUE) {
+            DWORD wait = WaitForSingleObject(changeHandle, CONFIG_WATCH_WAIT_MS);
+            if (wait == WAIT_OBJECT_0) {
+                FindNextChangeNotification(changeHandle);
+            } else if (wait != WAIT_TIMEOUT) {
+                LOG_ERROR("Config watcher wait failed, stopping watcher");
+                break;
+            }
+        } else {
+            Sleep(CONFIG_WATCH_WAIT_MS);
+        }
+
+        // Persistence shares this thread's cadence: dirty widgets whose
+        // edits have gone quiet flush to the journal here
+        FlushDirtyWidgets(false);
+
+        ULONGLONG current = lastWriteTime();
+        if (current == 0 || current == lastSeen) {
+            continue;
+        }
+        if (current == lastSelfWriteStamp_) {
+            // Our own compaction or save; the applied state already
+            // matches the file, so no reload cycle
+            lastSeen = current;
+            continue;
+        }
+
+        // Debounce: editors write in bursts; let the timestamp settle
+        // before reloading so we parse a complete file
+        Sleep(CONFIG_WATCH_DEBOUNCE_MS);
+        lastSeen = lastWriteTime();
+
+        LOG_INFO("Widget config changed on disk, re-applying incrementally");
+        LoadWidgetsFromConfig(watchedConfigFile_);
+    }
+
+    // Final flush so edits made just before shutdown are not lost
+    FlushDirtyWidgets(true);
+
+    if (changeHandle != INVALID_HANDLE_VALUE) {
+        FindCloseChangeNotification(changeHandle);
+    }
 }
 
 void WidgetManager::SetSystemMonitor(std::shared_ptr<Core::ISystemMonitor> monitor) {
@@ -322,21 +1073,28 @@ void WidgetManager::OnResize(UINT width, UINT height) {
         return;
     }
 
+    // A resize often means a display topology change; re-map the
+    // monitor shards before touching widgetMutex_ (RefreshMonitorShards
+    // takes only taskMutex_)
+    RefreshMonitorShards();
+
     std::lock_guard<std::mutex> lock(widgetMutex_);
 
     LOG_DEBUG("WidgetManager OnResize: " + std::to_string(width) + "x" + std::to_string(height));
 
-    // Notify all widgets
+    // Notify all widgets; any of them may reflow, so the hit-test
+    // index is stale afterwards
     for (auto& widget : widgets_) {
         widget->OnResize(width, height);
     }
+    spatialIndexDirty_ = true;
 }
 
 void WidgetManager::ShowWidget(const std::wstring& name) {
     IWidget* widget = GetWidget(name);
     if (widget) {
         widget->SetVisible(true);
-        LOG_INFO("Widget shown: " + WStringToString(name));
+        LOG_INFO("Widget shown: " + WidgetNameUtf8(name));
     }
 }
 
@@ -344,7 +1102,7 @@ void WidgetManager::HideWidget(const std::wstring& name) {
     IWidget* widget = GetWidget(name);
     if (widget) {
         widget->SetVisible(false);
-        LOG_INFO("Widget hidden: " + WStringToString(name));
+        LOG_INFO("Widget hidden: " + WidgetNameUtf8(name));
     }
 }
 
@@ -370,15 +1128,30 @@ void WidgetManager::HideAllWidgets() {
 
 bool WidgetManager::ShouldUpdate() const {
     DWORD currentTick = GetTickCount();
-    return (currentTick - lastUpdateTick_) >= updateIntervalMs_;
+    // The governor stretches the tick on battery/idle; interaction
+    // snaps it back instantly via SetInteractionActive
+    DWORD interval = Core::PowerGovernor::GetInstance().StretchInterval(updateIntervalMs_);
+    return (currentTick - lastUpdateTick_) >= interval;
 }
 
 IWidget* WidgetManager::HitTest(int x, int y) const {
-    // Simple hit test - check if point is inside widget bounds
-    // Iterate in reverse order to check top widgets first
-    for (auto it = widgets_.rbegin(); it != widgets_.rend(); ++it) {
-        const auto& widget = *it;
-        
+    if (spatialIndexDirty_) {
+        RebuildSpatialIndex();
+    }
+
+    // One bucket lookup instead of a scan over every widget; the bucket
+    // holds widgets in z-order (registration order), so iterate in
+    // reverse to hit top widgets first. Bounds are re-checked against
+    // the widget itself — the grid is only a candidate filter.
+    auto cell = spatialGrid_.find(SpatialCellKey(SpatialCellOf(x), SpatialCellOf(y)));
+    if (cell == spatialGrid_.end()) {
+        return nullptr;
+    }
+
+    const std::vector<IWidget*>& candidates = cell->second;
+    for (auto it = candidates.rbegin(); it != candidates.rend(); ++it) {
+        IWidget* widget = *it;
+
         if (!widget->IsVisible()) {
             continue;
         }
@@ -390,18 +1163,383 @@ IWidget* WidgetManager::HitTest(int x, int y) const {
 
         if (x >= wx && x < (wx + static_cast<int>(wwidth)) &&
             y >= wy && y < (wy + static_cast<int>(wheight))) {
-            return widget.get();
+            return widget;
         }
     }
 
     return nullptr;
 }
 
+void WidgetManager::RebuildSpatialIndex() const {
+    spatialGrid_.clear();
+
+    for (const auto& widget : widgets_) {
+        int x, y;
+        UINT width, height;
+        widget->GetPosition(x, y);
+        widget->GetSize(width, height);
+
+        if (width == 0 || height == 0) {
+            continue;
+        }
+
+        const int firstCellX = SpatialCellOf(x);
+        const int lastCellX = SpatialCellOf(x + static_cast<int>(width) - 1);
+        const int firstCellY = SpatialCellOf(y);
+        const int lastCellY = SpatialCellOf(y + static_cast<int>(height) - 1);
+
+        for (int cellY = firstCellY; cellY <= lastCellY; ++cellY) {
+            for (int cellX = firstCellX; cellX <= lastCellX; ++cellX) {
+                spatialGrid_[SpatialCellKey(cellX, cellY)].push_back(widget.get());
+            }
+        }
+    }
+
+    spatialIndexDirty_ = false;
+}
+
+uint64_t WidgetManager::SpatialCellKey(int cellX, int cellY) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(cellX)) << 32) |
+           static_cast<uint64_t>(static_cast<uint32_t>(cellY));
+}
+
+void WidgetManager::NotifyWidgetBoundsChanged() {
+    std::lock_guard<std::mutex> lock(widgetMutex_);
+    spatialIndexDirty_ = true;
+}
+
 void WidgetManager::UpdateSystemMonitor() {
     if (systemMonitor_) {
         systemMonitor_->Update();
     }
 }
 
+uint32_t WidgetManager::EffectivePriority(IWidget* widget) const {
+    uint32_t priority = static_cast<uint32_t>(widget->GetUpdatePriority());
+
+    auto it = scheduleState_.find(widget);
+    if (it != scheduleState_.end()) {
+        // Aging: every few skipped ticks bump the widget one priority
+        // level (capped), so a Low widget behind persistent load still
+        // gets its turn
+        uint32_t boost = it->second.starvedTicks / AGING_TICKS_PER_BOOST;
+        priority += (std::min)(boost, MAX_AGING_BOOST);
+        if (it->second.resumePending) {
+            // A half-finished incremental update resumes ahead of its
+            // class so partial work is not held stale indefinitely
+            priority += 1;
+        }
+    }
+    return priority;
+}
+
+void WidgetManager::RunBudgetedUpdates(std::vector<IWidget*>& fastWidgets) {
+    using Clock = std::chrono::steady_clock;
+
+    if (fastWidgets.empty()) {
+        return;
+    }
+
+    // Highest effective priority first; stable so equal-priority widgets
+    // keep their registration order
+    std::stable_sort(fastWidgets.begin(), fastWidgets.end(),
+        [this](IWidget* a, IWidget* b) {
+            return EffectivePriority(a) > EffectivePriority(b);
+        });
+
+    const DWORD budgetMs = interactionActive_.load()
+        ? (std::min)(updateBudgetMs_, INTERACTION_BUDGET_MS)
+        : updateBudgetMs_;
+    const auto deadline = Clock::now() + std::chrono::milliseconds(budgetMs);
+
+    // Per-widget tick outcome; each index is written by exactly one
+    // worker so no synchronization is needed beyond the fan-out join
+    enum : uint8_t { RAN = 0, SKIPPED = 1, YIELDED = 2 };
+    std::vector<uint8_t> outcome(fastWidgets.size(), RAN);
+
+    auto updateOne = [&](size_t i) {
+        if (Clock::now() >= deadline) {
+            outcome[i] = SKIPPED;  // Budget spent; preempt to next tick
+            return;
+        }
+        outcome[i] = fastWidgets[i]->UpdateIncremental(deadline) ? RAN : YIELDED;
+    };
+
+    if (updateWorkers_.empty() || fastWidgets.size() <= 1) {
+        for (size_t i = 0; i < fastWidgets.size(); ++i) {
+            updateOne(i);
+        }
+    } else {
+        // Group by home monitor shard so each monitor's widgets queue on
+        // their own worker; idle workers steal across shards, which is
+        // what keeps one expensive monitor from capping the whole desk
+        const size_t shardCount = std::max<size_t>(1, shardMonitors_.size());
+        std::vector<std::vector<size_t>> byShard(shardCount);
+        for (size_t i = 0; i < fastWidgets.size(); ++i) {
+            byShard[ShardForWidget(fastWidgets[i]) % shardCount].push_back(i);
+        }
+
+        struct FanOutState {
+            std::mutex mutex;
+            std::condition_variable done;
+            size_t remaining;
+        };
+        auto state = std::make_shared<FanOutState>();
+
+        // Spare workers subdivide shards so a single-monitor setup still
+        // fans out as widely as before
+        size_t activeShards = 0;
+        for (const auto& indices : byShard) {
+            if (!indices.empty()) ++activeShards;
+        }
+        const size_t perShard =
+            std::max<size_t>(1, updateWorkers_.size() / activeShards);
+
+        std::vector<size_t> chunksForShard(shardCount, 0);
+        size_t totalChunks = 0;
+        for (size_t shard = 0; shard < shardCount; ++shard) {
+            if (byShard[shard].empty()) continue;
+            chunksForShard[shard] = (std::min)(perShard, byShard[shard].size());
+            totalChunks += chunksForShard[shard];
+        }
+        state->remaining = totalChunks;
+
+        for (size_t shard = 0; shard < shardCount; ++shard) {
+            const size_t chunkCount = chunksForShard[shard];
+            const std::vector<size_t>* indices = &byShard[shard];
+            for (size_t chunk = 0; chunk < chunkCount; ++chunk) {
+                SubmitUpdateTaskToShard(shard,
+                    [state, indices, chunk, chunkCount, &updateOne]() {
+                        // Stride over the shard's priority-sorted slice so
+                        // every chunk reaches its high-priority widgets
+                        // before the budget runs out
+                        for (size_t k = chunk; k < indices->size(); k += chunkCount) {
+                            updateOne((*indices)[k]);
+                        }
+                        std::lock_guard<std::mutex> doneLock(state->mutex);
+                        if (--state->remaining == 0) {
+                            state->done.notify_one();
+                        }
+                    });
+            }
+        }
+
+        std::unique_lock<std::mutex> doneLock(state->mutex);
+        state->done.wait(doneLock, [&state] { return state->remaining == 0; });
+    }
+
+    // Fold outcomes into the aging state (widgetMutex_ is held)
+    for (size_t i = 0; i < fastWidgets.size(); ++i) {
+        ScheduleState& schedule = scheduleState_[fastWidgets[i]];
+        if (outcome[i] == RAN) {
+            schedule.starvedTicks = 0;
+            schedule.resumePending = false;
+        } else {
+            ++schedule.starvedTicks;
+            schedule.resumePending = (outcome[i] == YIELDED);
+        }
+    }
+}
+
+void WidgetManager::StartUpdateWorkers() {
+    if (!updateWorkers_.empty()) {
+        return;
+    }
+
+    RefreshMonitorShards();
+
+    size_t shardCount;
+    {
+        std::lock_guard<std::mutex> lock(taskMutex_);
+        shardCount = std::max<size_t>(1, shardTasks_.size());
+    }
+
+    // At least one worker per monitor shard so shards progress
+    // independently, with the old floor for overlapping a few blocking
+    // refreshes on single-monitor machines — still capped by cores
+    unsigned int workerCount = std::thread::hardware_concurrency();
+    workerCount = (std::max)(2u, (std::min)(workerCount,
+        (std::max)(4u, static_cast<unsigned int>(shardCount))));
+
+    workersShouldStop_ = false;
+    for (unsigned int i = 0; i < workerCount; ++i) {
+        updateWorkers_.emplace_back(&WidgetManager::UpdateWorkerLoop, this,
+                                    static_cast<size_t>(i));
+    }
+
+    LOG_INFO("WidgetManager update pool started with " +
+             std::to_string(workerCount) + " workers across " +
+             std::to_string(shardCount) + " monitor shard(s)");
+}
+
+void WidgetManager::StopUpdateWorkers() {
+    {
+        std::lock_guard<std::mutex> lock(taskMutex_);
+        workersShouldStop_ = true;
+    }
+    taskCondition_.notify_all();
+
+    for (auto& worker : updateWorkers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    updateWorkers_.clear();
+
+    {
+        std::lock_guard<std::mutex> lock(taskMutex_);
+        for (auto& queue : shardTasks_) {
+            queue.clear();
+        }
+    }
+}
+
+void WidgetManager::SubmitUpdateTask(std::function<void()> task) {
+    // Tasks with no monitor affinity (parse chunks, deferred
+    // instantiations) round-robin across the shards
+    {
+        std::lock_guard<std::mutex> lock(taskMutex_);
+        if (shardTasks_.empty()) {
+            shardTasks_.resize(1);
+        }
+        shardTasks_[submitShardRR_++ % shardTasks_.size()].push_back(std::move(task));
+    }
+    taskCondition_.notify_one();
+}
+
+void WidgetManager::SubmitUpdateTaskToShard(size_t shard, std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(taskMutex_);
+        if (shardTasks_.empty()) {
+            shardTasks_.resize(1);
+        }
+        shardTasks_[shard % shardTasks_.size()].push_back(std::move(task));
+    }
+    taskCondition_.notify_one();
+}
+
+void WidgetManager::UpdateWorkerLoop(size_t workerIndex) {
+    for (;;) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(taskMutex_);
+            taskCondition_.wait(lock, [this] {
+                if (workersShouldStop_) {
+                    return true;
+                }
+                for (const auto& queue : shardTasks_) {
+                    if (!queue.empty()) {
+                        return true;
+                    }
+                }
+                return false;
+            });
+
+            if (!shardTasks_.empty()) {
+                // Home shard drains FIFO; stealing takes from the back
+                // of a victim queue so its own FIFO order is disturbed
+                // least
+                const size_t shardCount = shardTasks_.size();
+                const size_t home = workerIndex % shardCount;
+                if (!shardTasks_[home].empty()) {
+                    task = std::move(shardTasks_[home].front());
+                    shardTasks_[home].pop_front();
+                } else {
+                    for (size_t offset = 1; offset < shardCount; ++offset) {
+                        auto& victim = shardTasks_[(home + offset) % shardCount];
+                        if (!victim.empty()) {
+                            task = std::move(victim.back());
+                            victim.pop_back();
+                            break;
+                        }
+                    }
+                }
+            }
+
+            if (!task) {
+                if (workersShouldStop_) {
+                    return;
+                }
+                continue;
+            }
+        }
+
+        try {
+            task();
+        } catch (const std::exception& e) {
+            LOG_ERROR(std::string("Widget update task failed: ") + e.what());
+        }
+    }
+}
+
+void WidgetManager::RefreshMonitorShards() {
+    std::vector<HMONITOR> monitors;
+    EnumDisplayMonitors(nullptr, nullptr,
+        [](HMONITOR monitor, HDC, LPRECT, LPARAM param) -> BOOL {
+            reinterpret_cast<std::vector<HMONITOR>*>(param)->push_back(monitor);
+            return TRUE;
+        },
+        reinterpret_cast<LPARAM>(&monitors));
+    if (monitors.empty()) {
+        // Headless or locked session: everything in one shard
+        monitors.push_back(nullptr);
+    }
+
+    std::lock_guard<std::mutex> lock(taskMutex_);
+    shardMonitors_ = monitors;
+    if (shardTasks_.size() == shardMonitors_.size()) {
+        return;
+    }
+
+    // Fold the queues of disappearing shards into shard 0 before
+    // shrinking so no queued task is dropped
+    for (size_t i = shardMonitors_.size(); i < shardTasks_.size(); ++i) {
+        for (auto& task : shardTasks_[i]) {
+            shardTasks_[0].push_back(std::move(task));
+        }
+    }
+    shardTasks_.resize(shardMonitors_.size());
+
+    LOG_INFO("Widget update sharding across " +
+             std::to_string(shardTasks_.size()) + " monitor(s)");
+}
+
+size_t WidgetManager::ShardForWidget(IWidget* widget) const {
+    int x = 0, y = 0;
+    widget->GetPosition(x, y);
+    POINT origin{ x, y };
+    HMONITOR monitor = MonitorFromPoint(origin, MONITOR_DEFAULTTONEAREST);
+
+    // Unlocked read of the mapping: topology refreshes are rare, and a
+    // stale entry just routes the widget to a neighboring shard until
+    // the next refresh
+    for (size_t i = 0; i < shardMonitors_.size(); ++i) {
+        if (shardMonitors_[i] == monitor) {
+            return i;
+        }
+    }
+    return 0;
+}
+
+bool WidgetManager::TryMarkInFlight(IWidget* widget) {
+    std::lock_guard<std::mutex> lock(inflightMutex_);
+    return inflightWidgets_.insert(widget).second;
+}
+
+void WidgetManager::ClearInFlight(IWidget* widget) {
+    {
+        std::lock_guard<std::mutex> lock(inflightMutex_);
+        inflightWidgets_.erase(widget);
+    }
+    inflightCondition_.notify_all();
+}
+
+void WidgetManager::WaitForInFlight(IWidget* widget) {
+    std::unique_lock<std::mutex> lock(inflightMutex_);
+    inflightCondition_.wait(lock, [this, widget] {
+        return inflightWidgets_.count(widget) == 0;
+    });
+}
+
 } // namespace Widgets
 } // namespace RainmeterManager
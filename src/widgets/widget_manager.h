@@ -3,12 +3,23 @@
 // Copyright (c) 2025 RainmeterManager. All rights reserved.
 
 #include "framework/widget_base.h"
+#include "d2d_resource_cache.h"
 #include "../core/system_monitor.h"
+#include "../core/memory_pool.h"
+#include "../core/power_governor.h"
 #include <vector>
 #include <map>
+#include <set>
+#include <unordered_map>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
+#include <atomic>
+#include <functional>
+#include <chrono>
+#include <condition_variable>
 
 namespace RainmeterManager {
 namespace Widgets {
@@ -30,7 +41,12 @@ private:
     
     // Rendering
     ID2D1RenderTarget* renderTarget_;
-    
+
+    // Shared D2D resources for the current target; rebound (and device
+    // resources dropped) in SetRenderTarget so device-lost recovery is
+    // one release pass plus lazy recreation, not a per-meter rebuild
+    D2DResourceCache resourceCache_;
+
     // Thread safety
     mutable std::mutex widgetMutex_;
     
@@ -39,6 +55,85 @@ private:
     DWORD lastUpdateTick_;
     DWORD updateIntervalMs_;
 
+    // Budget scheduling. Each tick gets a time budget; fast widgets run
+    // in effective-priority order against it, and widgets pushed past
+    // the deadline (or yielding from UpdateIncremental) carry aging
+    // state that boosts them on later ticks so nothing starves.
+    struct ScheduleState {
+        uint32_t starvedTicks = 0;   // Consecutive ticks skipped or yielded
+        bool resumePending = false;  // UpdateIncremental returned false
+    };
+    DWORD updateBudgetMs_;
+    std::atomic<bool> interactionActive_{false};
+    std::map<IWidget*, ScheduleState> scheduleState_;
+
+    // Parallel update pipeline. Fast widgets fan out across the worker
+    // pool and complete within the tick; Blocking widgets run detached so
+    // a slow network refresh never stalls the rest.
+    //
+    // Task queues are sharded per monitor (shardMonitors_ maps shard
+    // index to HMONITOR): each worker drains its home shard's queue
+    // first and steals from the back of the others when idle, so a
+    // monitor dense with expensive widgets spills across the whole pool
+    // instead of serializing behind one queue while the rest sit idle.
+    // One mutex guards all queues — the guarded operations are pointer
+    // moves, so per-shard locks would matter only far beyond the widget
+    // counts the budget scheduler can sustain anyway.
+    // Shard queues allocate through the tagged Widgets pool so task-node
+    // churn recycles instead of fragmenting the heap, and shows up under
+    // the Widgets tag in MemoryRegistry statistics.
+    using TaskQueue = std::deque<std::function<void()>,
+                                 Core::TaggedAllocator<std::function<void()>,
+                                                       Core::MemoryTag::Widgets>>;
+    std::vector<std::thread> updateWorkers_;
+    std::vector<TaskQueue> shardTasks_;
+    std::vector<HMONITOR> shardMonitors_;
+    size_t submitShardRR_ = 0;   // Round-robin target for unaffiliated tasks (taskMutex_ held)
+    std::mutex taskMutex_;
+    std::condition_variable taskCondition_;
+    std::atomic<bool> workersShouldStop_{false};
+
+    // Blocking updates currently running; RemoveWidget waits on these
+    std::set<IWidget*> inflightWidgets_;
+    mutable std::mutex inflightMutex_;
+    std::condition_variable inflightCondition_;
+
+    // Config hot-reload. The last applied per-widget config, keyed by
+    // widget name; a reload diffs the new file against this map and
+    // touches only widgets whose entries changed. loadMutex_ serializes
+    // whole reloads (watcher thread, explicit calls, deferred
+    // instantiation tasks). Lock order is always loadMutex_ before
+    // widgetMutex_, never the reverse.
+    std::map<std::wstring, WidgetConfig> loadedConfigs_;
+    std::mutex loadMutex_;
+
+    std::wstring watchedConfigFile_;
+    std::thread configWatcherThread_;
+    std::atomic<bool> configWatcherStop_{false};
+
+    // Incremental persistence. Geometry edits mark their widget dirty;
+    // once the edits go quiet the watcher thread appends one journal
+    // line per dirty widget next to the config file instead of
+    // rewriting it, and compacts the journal into a full rewrite when
+    // it grows. persistMutex_ guards only the dirty set.
+    std::set<std::wstring> dirtyWidgets_;
+    std::chrono::steady_clock::time_point lastDirtyTime_;
+    std::mutex persistMutex_;
+    size_t journaledPatches_ = 0;
+
+    // Timestamp the watched file carried after our own last write, so
+    // the watcher can tell a compaction apart from an external edit and
+    // skip the reload cycle for it
+    std::atomic<ULONGLONG> lastSelfWriteStamp_{0};
+
+    // Spatial index for mouse dispatch. Widgets are bucketed into a
+    // uniform grid over their bounds so HitTest visits one cell instead
+    // of scanning the whole list — high-polling-rate mice hit this path
+    // thousands of times per second. Rebuilt lazily (next HitTest) when
+    // marked dirty; mutable because HitTest is logically const.
+    mutable std::unordered_map<uint64_t, std::vector<IWidget*>> spatialGrid_;
+    mutable bool spatialIndexDirty_ = true;
+
 public:
     WidgetManager();
     ~WidgetManager();
@@ -50,7 +145,20 @@ public:
 
     // Rendering
     void SetRenderTarget(ID2D1RenderTarget* renderTarget);
-    void RenderAll();
+
+    /**
+     * Cache of brushes and text formats shared by every widget drawing
+     * to the current render target. Hand this to meters instead of
+     * letting them create per-meter device objects.
+     */
+    D2DResourceCache* GetResourceCache() { return &resourceCache_; }
+
+    /**
+     * Render only widgets whose state changed since their last render.
+     * Returns the union of the redrawn widget bounds (all zeros when
+     * nothing was dirty), for presenting just the invalid region.
+     */
+    RECT RenderAll();
     void RenderWidget(const std::wstring& name);
 
     // Widget management
@@ -65,6 +173,26 @@ public:
     bool LoadWidgetsFromConfig(const std::wstring& configFile);
     bool SaveWidgetsToConfig(const std::wstring& configFile);
 
+    /**
+     * Watch configFile for changes and re-apply it incrementally: the
+     * reload diffs the file against the last applied configuration and
+     * re-creates only widgets whose entries changed, so editing one
+     * widget's config never restarts the others. Loads the file once
+     * immediately. Stopped by Shutdown (or StopConfigWatcher).
+     */
+    bool StartConfigWatcher(const std::wstring& configFile);
+    void StopConfigWatcher();
+
+    /**
+     * Mark a widget's persisted entry stale after moving or resizing it
+     * (drag handlers call this on every move). Dirty widgets persist as
+     * appended journal entries once the edits go quiet — never a
+     * full-file rewrite per drag step — off the UI thread; the journal
+     * compacts into the config file periodically, and those
+     * self-initiated writes do not trigger a watcher reload.
+     */
+    void MarkWidgetDirty(const std::wstring& name);
+
     // System monitor
     void SetSystemMonitor(std::shared_ptr<Core::ISystemMonitor> monitor);
     std::shared_ptr<Core::ISystemMonitor> GetSystemMonitor() const { return systemMonitor_; }
@@ -78,6 +206,35 @@ public:
     void SetUpdateInterval(DWORD intervalMs) { updateIntervalMs_ = intervalMs; }
     DWORD GetUpdateInterval() const { return updateIntervalMs_; }
 
+    /**
+     * Per-tick time budget for fast widget updates. Updates run in
+     * priority order until the budget is spent; the rest move to the
+     * next tick with an aged priority boost.
+     */
+    void SetUpdateBudget(DWORD budgetMs) { updateBudgetMs_ = budgetMs; }
+    DWORD GetUpdateBudget() const { return updateBudgetMs_; }
+
+    /**
+     * Signal that the user is interacting (window drag, resize). While
+     * active the tick budget shrinks so update work yields to input
+     * handling instead of causing visible hitches, and any power-saving
+     * stretch on the update cadence snaps back immediately.
+     */
+    void SetInteractionActive(bool active) {
+        interactionActive_ = active;
+        if (active) {
+            Core::PowerGovernor::GetInstance().NotifyInteraction();
+        }
+    }
+
+    /**
+     * Mark the spatial hit-test index stale after moving or resizing a
+     * widget directly (AddWidget/RemoveWidget/OnResize and config
+     * reloads handle this themselves). The index rebuilds on the next
+     * mouse event.
+     */
+    void NotifyWidgetBoundsChanged();
+
     // Widget visibility control
     void ShowWidget(const std::wstring& name);
     void HideWidget(const std::wstring& name);
@@ -89,6 +246,44 @@ private:
     bool ShouldUpdate() const;
     IWidget* HitTest(int x, int y) const;
     void UpdateSystemMonitor();
+
+    // Spatial index helpers (widgetMutex_ held)
+    void RebuildSpatialIndex() const;
+    static uint64_t SpatialCellKey(int cellX, int cellY);
+
+    // Budget scheduling helpers
+    uint32_t EffectivePriority(IWidget* widget) const;
+    void RunBudgetedUpdates(std::vector<IWidget*>& fastWidgets);
+
+    // Config hot-reload helpers. Parsing fans widget sections across the
+    // update worker pool; ApplyConfigDiff creates visible widgets inline
+    // and defers hidden ones to background tasks, so time-to-first-widget
+    // scales with the visible count rather than the file size.
+    bool ParseWidgetConfigs(const std::wstring& configFile,
+                            std::vector<WidgetConfig>& outConfigs);
+    bool ApplyConfigDiff(const std::vector<WidgetConfig>& newConfigs);
+    void InstantiateDeferredWidget(const WidgetConfig& config);
+    void ConfigWatcherLoop();
+
+    // Incremental persistence helpers (run on the watcher thread)
+    void FlushDirtyWidgets(bool force);
+    void CompactJournal();
+    bool WriteFullConfig(const std::wstring& configFile);
+    static std::wstring JournalPathFor(const std::wstring& configFile);
+
+    // Update pipeline helpers
+    void StartUpdateWorkers();
+    void StopUpdateWorkers();
+    void SubmitUpdateTask(std::function<void()> task);
+    void SubmitUpdateTaskToShard(size_t shard, std::function<void()> task);
+    void UpdateWorkerLoop(size_t workerIndex);
+
+    // Monitor sharding helpers
+    void RefreshMonitorShards();
+    size_t ShardForWidget(IWidget* widget) const;
+    bool TryMarkInFlight(IWidget* widget);
+    void ClearInFlight(IWidget* widget);
+    void WaitForInFlight(IWidget* widget);
 };
 
 } // namespace Widgets
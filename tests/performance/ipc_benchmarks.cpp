@@ -0,0 +1,367 @@
+#include <gtest/gtest.h>
+#include <windows.h>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+
+#include "../../src/render/ipc/shared_memory_manager.h"
+#include "../../src/render/ipc/named_pipe_channel.h"
+#include "../../src/render/interfaces/render_command.h"
+
+using namespace RainmeterManager::Render;
+
+// === Benchmark Infrastructure ===
+
+// One measured configuration; everything needed to diff a run against a
+// stored baseline lives in this record.
+struct BenchmarkBaseline {
+    std::string benchmark;
+    size_t payloadBytes;
+    size_t queueDepth;
+    double opsPerSec;
+    double p50Us;
+    double p99Us;
+    double p999Us;
+    size_t samples;
+};
+
+static std::vector<BenchmarkBaseline> g_baselines;
+
+// Percentile over a sample set (microseconds); sorts in place.
+static double Percentile(std::vector<double>& samplesUs, double fraction) {
+    if (samplesUs.empty()) {
+        return 0.0;
+    }
+    std::sort(samplesUs.begin(), samplesUs.end());
+    size_t index = static_cast<size_t>(fraction * (samplesUs.size() - 1));
+    return samplesUs[index];
+}
+
+static void RecordBaseline(const std::string& benchmark, size_t payloadBytes,
+                           size_t queueDepth, double elapsedSeconds,
+                           std::vector<double>& latenciesUs) {
+    BenchmarkBaseline entry;
+    entry.benchmark = benchmark;
+    entry.payloadBytes = payloadBytes;
+    entry.queueDepth = queueDepth;
+    entry.samples = latenciesUs.size();
+    entry.opsPerSec = elapsedSeconds > 0.0 ? latenciesUs.size() / elapsedSeconds : 0.0;
+    entry.p50Us = Percentile(latenciesUs, 0.50);
+    entry.p99Us = Percentile(latenciesUs, 0.99);
+    entry.p999Us = Percentile(latenciesUs, 0.999);
+    g_baselines.push_back(entry);
+
+    std::cout << benchmark << " payload=" << payloadBytes
+              << " depth=" << queueDepth
+              << " ops/s=" << static_cast<uint64_t>(entry.opsPerSec)
+              << " p50=" << entry.p50Us << "us"
+              << " p99=" << entry.p99Us << "us"
+              << " p999=" << entry.p999Us << "us\n";
+}
+
+// Emitted after the run; one JSON object per measured configuration so
+// CI can diff releases with a plain line-oriented comparison.
+static void WriteBaselineFile(const std::string& path) {
+    std::ofstream file(path);
+    file << "[\n";
+    for (size_t i = 0; i < g_baselines.size(); ++i) {
+        const BenchmarkBaseline& b = g_baselines[i];
+        file << "  {\"benchmark\":\"" << b.benchmark << "\""
+             << ",\"payload_bytes\":" << b.payloadBytes
+             << ",\"queue_depth\":" << b.queueDepth
+             << ",\"ops_per_sec\":" << b.opsPerSec
+             << ",\"p50_us\":" << b.p50Us
+             << ",\"p99_us\":" << b.p99Us
+             << ",\"p999_us\":" << b.p999Us
+             << ",\"samples\":" << b.samples << "}"
+             << (i + 1 < g_baselines.size() ? "," : "") << "\n";
+    }
+    file << "]\n";
+}
+
+// Build a command whose serialized size is dominated by a payload blob
+// of roughly the requested size (mimics widget config / web content).
+static RenderCommand MakePayloadCommand(size_t payloadBytes, uint64_t commandId) {
+    RenderCommand command;
+    command.commandId = commandId;
+    command.commandType = RenderCommandType::UpdateContent;
+    command.widgetId = 1;
+    command.content.sourceType = ContentSourceType::Static;
+    command.content.sourceUrl = std::string(payloadBytes, 'x');
+    return command;
+}
+
+// Payload sizes swept by every benchmark: small control messages up to
+// blobs that exceed the 64 KB pipe buffer.
+static const size_t kPayloadSizes[] = {256, 4 * 1024, 64 * 1024, 256 * 1024};
+
+// === Shared Memory Benchmarks ===
+
+class SharedMemoryBenchmark : public ::testing::Test {
+protected:
+    void SetUp() override {
+        producer_ = std::make_unique<SharedMemoryManager>(L"ipc_bench_shm");
+        if (!producer_->CreateSharedBuffer(8 * 1024 * 1024)) {
+            GTEST_SKIP() << "Shared memory unavailable";
+        }
+        consumer_ = std::make_unique<SharedMemoryManager>(L"ipc_bench_shm");
+        ASSERT_TRUE(consumer_->ConnectToSharedBuffer());
+    }
+
+    void TearDown() override {
+        if (consumer_) consumer_->Cleanup();
+        if (producer_) producer_->Cleanup();
+    }
+
+    std::unique_ptr<SharedMemoryManager> producer_;
+    std::unique_ptr<SharedMemoryManager> consumer_;
+};
+
+// Round-trip latency: one command in, drain on a consumer thread, one
+// result back. Measures the full serialize/ring/deserialize path.
+TEST_F(SharedMemoryBenchmark, RoundTripLatencySweep) {
+    const int iterations = 2000;
+
+    for (size_t payloadBytes : kPayloadSizes) {
+        std::atomic<bool> running(true);
+        std::thread echo([&]() {
+            RenderCommand command;
+            while (running.load()) {
+                if (!consumer_->WaitForCommand(50)) {
+                    continue;
+                }
+                while (consumer_->ReadCommand(command)) {
+                    RenderResult result;
+                    result.commandId = command.commandId;
+                    result.status = RenderResultStatus::Success;
+                    consumer_->WriteResult(result);
+                    consumer_->SignalResultReady();
+                }
+            }
+        });
+
+        std::vector<double> latenciesUs;
+        latenciesUs.reserve(iterations);
+        auto sweepStart = std::chrono::steady_clock::now();
+
+        for (int i = 0; i < iterations; ++i) {
+            RenderCommand command = MakePayloadCommand(payloadBytes, i + 1);
+            auto start = std::chrono::steady_clock::now();
+
+            ASSERT_TRUE(producer_->WriteCommand(command));
+            producer_->SignalCommandReady();
+            ASSERT_TRUE(producer_->WaitForResult(5000));
+            RenderResult result;
+            ASSERT_TRUE(producer_->ReadResult(result));
+
+            auto end = std::chrono::steady_clock::now();
+            latenciesUs.push_back(
+                std::chrono::duration<double, std::micro>(end - start).count());
+        }
+
+        double elapsed = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - sweepStart).count();
+        running.store(false);
+        echo.join();
+
+        RecordBaseline("shm_roundtrip", payloadBytes, 1, elapsed, latenciesUs);
+    }
+}
+
+// Throughput under queue depth: enqueue bursts of N commands, drain on
+// the consumer. Latency is measured per burst submission, so regressions
+// in ring contention or serialization show up as p99 growth with depth.
+TEST_F(SharedMemoryBenchmark, ThroughputQueueDepthSweep) {
+    const int burstsPerConfig = 500;
+    const size_t queueDepths[] = {1, 8, 32};
+    const size_t payloadBytes = 4 * 1024;
+
+    for (size_t depth : queueDepths) {
+        std::atomic<bool> running(true);
+        std::atomic<uint64_t> drained(0);
+        std::thread drainThread([&]() {
+            std::vector<RenderCommand> commands;
+            while (running.load()) {
+                if (!consumer_->WaitForCommand(50)) {
+                    continue;
+                }
+                drained += consumer_->DrainCommands(commands);
+                commands.clear();
+            }
+        });
+
+        std::vector<RenderCommand> burst;
+        for (size_t i = 0; i < depth; ++i) {
+            burst.push_back(MakePayloadCommand(payloadBytes, i + 1));
+        }
+
+        std::vector<double> latenciesUs;
+        latenciesUs.reserve(burstsPerConfig);
+        auto sweepStart = std::chrono::steady_clock::now();
+
+        for (int i = 0; i < burstsPerConfig; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            while (producer_->WriteCommands(burst) < burst.size()) {
+                // Ring full: give the drain thread a chance to catch up
+                std::this_thread::yield();
+            }
+            producer_->SignalCommandReady();
+            auto end = std::chrono::steady_clock::now();
+            latenciesUs.push_back(
+                std::chrono::duration<double, std::micro>(end - start).count());
+        }
+
+        double elapsed = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - sweepStart).count();
+        running.store(false);
+        drainThread.join();
+
+        EXPECT_GE(drained.load(), static_cast<uint64_t>(burstsPerConfig));
+        RecordBaseline("shm_burst_submit", payloadBytes, depth, elapsed, latenciesUs);
+    }
+}
+
+// === Named Pipe Benchmarks ===
+
+class NamedPipeBenchmark : public ::testing::Test {
+protected:
+    void SetUp() override {
+        server_ = std::make_unique<NamedPipeChannel>(L"ipc_bench_pipe");
+        if (!server_->CreateServer()) {
+            GTEST_SKIP() << "Named pipe transport unavailable: "
+                         << server_->GetLastError();
+        }
+        client_ = std::make_unique<NamedPipeChannel>(L"ipc_bench_pipe");
+
+        std::thread accept([this]() { serverConnected_ = server_->WaitForConnection(5000); });
+        bool clientConnected = client_->ConnectAsClient(5000);
+        accept.join();
+        ASSERT_TRUE(serverConnected_ && clientConnected);
+    }
+
+    void TearDown() override {
+        if (client_) client_->Cleanup();
+        if (server_) server_->Cleanup();
+    }
+
+    std::unique_ptr<NamedPipeChannel> server_;
+    std::unique_ptr<NamedPipeChannel> client_;
+    bool serverConnected_ = false;
+};
+
+// Round-trip latency through the pipe: server sends a command, client
+// echoes a result. Large payloads span multiple 64 KB pipe writes, so
+// this sweep is the one that shows the compression win.
+TEST_F(NamedPipeBenchmark, RoundTripLatencySweep) {
+    const int iterations = 500;
+
+    for (size_t payloadBytes : kPayloadSizes) {
+        std::atomic<bool> running(true);
+        std::thread echo([&]() {
+            RenderCommand command;
+            while (running.load()) {
+                if (!client_->ReceiveCommand(command, 50)) {
+                    continue;
+                }
+                RenderResult result;
+                result.commandId = command.commandId;
+                result.status = RenderResultStatus::Success;
+                client_->SendResult(result);
+            }
+        });
+
+        std::vector<double> latenciesUs;
+        latenciesUs.reserve(iterations);
+        auto sweepStart = std::chrono::steady_clock::now();
+
+        for (int i = 0; i < iterations; ++i) {
+            RenderCommand command = MakePayloadCommand(payloadBytes, i + 1);
+            auto start = std::chrono::steady_clock::now();
+
+            ASSERT_TRUE(server_->SendCommand(command));
+            RenderResult result;
+            ASSERT_TRUE(server_->ReceiveResult(result, 5000));
+
+            auto end = std::chrono::steady_clock::now();
+            latenciesUs.push_back(
+                std::chrono::duration<double, std::micro>(end - start).count());
+        }
+
+        double elapsed = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - sweepStart).count();
+        running.store(false);
+        echo.join();
+
+        RecordBaseline("pipe_roundtrip", payloadBytes, 1, elapsed, latenciesUs);
+    }
+}
+
+// Same sweep with compression negotiated on both ends; diffing this
+// against pipe_roundtrip in the baseline file isolates the codec's
+// effect per payload size.
+TEST_F(NamedPipeBenchmark, RoundTripLatencySweepCompressed) {
+    const int iterations = 500;
+
+    ASSERT_TRUE(server_->EnableCompression());
+    ASSERT_TRUE(client_->EnableCompression());
+
+    for (size_t payloadBytes : kPayloadSizes) {
+        std::atomic<bool> running(true);
+        std::thread echo([&]() {
+            RenderCommand command;
+            while (running.load()) {
+                if (!client_->ReceiveCommand(command, 50)) {
+                    continue;
+                }
+                RenderResult result;
+                result.commandId = command.commandId;
+                result.status = RenderResultStatus::Success;
+                client_->SendResult(result);
+            }
+        });
+
+        std::vector<double> latenciesUs;
+        latenciesUs.reserve(iterations);
+        auto sweepStart = std::chrono::steady_clock::now();
+
+        for (int i = 0; i < iterations; ++i) {
+            RenderCommand command = MakePayloadCommand(payloadBytes, i + 1);
+            auto start = std::chrono::steady_clock::now();
+
+            ASSERT_TRUE(server_->SendCommand(command));
+            RenderResult result;
+            ASSERT_TRUE(server_->ReceiveResult(result, 5000));
+
+            auto end = std::chrono::steady_clock::now();
+            latenciesUs.push_back(
+                std::chrono::duration<double, std::micro>(end - start).count());
+        }
+
+        double elapsed = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - sweepStart).count();
+        running.store(false);
+        echo.join();
+
+        RecordBaseline("pipe_roundtrip_lz4", payloadBytes, 1, elapsed, latenciesUs);
+    }
+}
+
+// Main function for IPC benchmarks
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+
+    // Set high priority for more accurate latency measurements
+    SetPriorityClass(GetCurrentProcess(), HIGH_PRIORITY_CLASS);
+
+    int result = RUN_ALL_TESTS();
+
+    WriteBaselineFile("ipc_benchmark_baseline.json");
+    std::cout << "Baselines written to ipc_benchmark_baseline.json ("
+              << g_baselines.size() << " configurations)\n";
+    return result;
+}
@@ -0,0 +1,478 @@
+// rmlog_query.cpp - Indexed reader/query tool for the RMBL binary log format
+// Copyright (c) 2025 RainmeterManager. All rights reserved.
+//
+// Standalone support tool: builds a sparse sidecar index over rotated
+// binary log segments and answers filtered queries ("errors from the
+// render subsystem between 14:02 and 14:05") by skipping every chunk
+// whose time range or level mask cannot match, so a query touches
+// kilobytes of a multi-GB log instead of scanning it.
+//
+// Build (no dependencies beyond the standard library):
+//   cl /EHsc /O2 /std:c++17 rmlog_query.cpp /Fe:rmlog_query.exe
+//   g++ -O2 -std=c++17 rmlog_query.cpp -o rmlog_query
+//
+// Usage:
+//   rmlog_query index <log> [<log>...]            build/refresh sidecar indexes
+//   rmlog_query query [options] <log> [<log>...]  filtered extraction
+//   rmlog_query dump <log> [<log>...]             render everything to text
+//
+// Query options:
+//   --from <time>    inclusive lower bound ("YYYY-MM-DD HH:MM:SS" UTC or ms since epoch)
+//   --to <time>      inclusive upper bound
+//   --level <name>   minimum level (TRACE..FATAL)
+//   --grep <substr>  substring match on the rendered template text; the
+//                    record's component is its call-site template, so this
+//                    is the component filter
+//   --limit <n>      stop after n matches
+//
+// The on-disk framing mirrors BinaryLogFileHeader / BinaryLogRecord in
+// src/core/logger.h. The structs are restated here so the tool stays a
+// single portable translation unit (logger.h drags in windows.h); any
+// format change must bump BINARY_LOG_VERSION and be reflected in both
+// places.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+// ---- RMBL framing (mirror of src/core/logger.h) ----
+
+constexpr uint32_t BINARY_LOG_MAGIC = 0x524D424C;   // 'RMBL'
+constexpr uint32_t BINARY_LOG_VERSION = 1;
+constexpr uint32_t TEMPLATE_DEF_ID = 0xFFFFFFFF;
+constexpr size_t NUM_LEVELS = 7;                    // TRACE..FATAL
+
+struct BinaryLogFileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t createdTimestamp;
+};
+
+struct BinaryLogRecord {
+    uint32_t templateId;
+    uint8_t level;
+    uint8_t argCount;
+    uint16_t argBytes;
+    uint32_t threadId;
+    uint32_t line;
+    uint64_t timestamp;     // ms since epoch
+};
+
+const char* LEVEL_NAMES[NUM_LEVELS] = {
+    "TRACE", "DEBUG", "INFO", "WARNING", "ERROR", "CRITICAL", "FATAL"
+};
+
+// ---- Sidecar index (<log>.rmlidx) ----
+//
+// One IndexChunk summarizes CHUNK_RECORDS consecutive records: byte
+// offset of the first, the covered time range, a level presence bitmask
+// and the record count. Queries binary-search nothing - they walk the
+// chunk table (a few KB even for GB-sized segments) and read only
+// chunks whose range and mask can match. sourceSize/sourceCreated
+// detect staleness; an appended-to segment reindexes transparently.
+
+constexpr uint32_t INDEX_MAGIC = 0x524D4C49;        // 'RMLI'
+constexpr uint32_t INDEX_VERSION = 1;
+constexpr uint32_t CHUNK_RECORDS = 4096;
+
+struct IndexHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t sourceSize;
+    uint64_t sourceCreated;   // createdTimestamp of the source header
+    uint32_t chunkCount;
+    uint32_t reserved;
+};
+
+struct IndexChunk {
+    uint64_t startOffset;
+    uint64_t minTimestamp;
+    uint64_t maxTimestamp;
+    uint32_t recordCount;
+    uint32_t levelMask;       // Bit per LogLevel present in the chunk
+};
+
+// ---- Query filter ----
+
+struct QueryFilter {
+    uint64_t fromMs = 0;
+    uint64_t toMs = UINT64_MAX;
+    int minLevel = 0;
+    std::string grep;
+    uint64_t limit = UINT64_MAX;
+};
+
+// Level mask covering minLevel and everything above it
+uint32_t MaskFromMinLevel(int minLevel) {
+    uint32_t mask = 0;
+    for (size_t level = static_cast<size_t>(minLevel); level < NUM_LEVELS; ++level) {
+        mask |= 1u << level;
+    }
+    return mask;
+}
+
+bool ParseLevel(const std::string& name, int& outLevel) {
+    for (size_t level = 0; level < NUM_LEVELS; ++level) {
+        if (name == LEVEL_NAMES[level]) {
+            outLevel = static_cast<int>(level);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Accepts raw milliseconds since epoch or "YYYY-MM-DD HH:MM:SS" (UTC)
+bool ParseTime(const std::string& text, uint64_t& outMs) {
+    if (!text.empty() && text.find_first_not_of("0123456789") == std::string::npos) {
+        outMs = std::strtoull(text.c_str(), nullptr, 10);
+        return true;
+    }
+
+    std::tm parsed = {};
+    if (sscanf(text.c_str(), "%d-%d-%d %d:%d:%d",
+               &parsed.tm_year, &parsed.tm_mon, &parsed.tm_mday,
+               &parsed.tm_hour, &parsed.tm_min, &parsed.tm_sec) != 6) {
+        return false;
+    }
+    parsed.tm_year -= 1900;
+    parsed.tm_mon -= 1;
+#ifdef _WIN32
+    time_t seconds = _mkgmtime(&parsed);
+#else
+    time_t seconds = timegm(&parsed);
+#endif
+    if (seconds < 0) return false;
+    outMs = static_cast<uint64_t>(seconds) * 1000ull;
+    return true;
+}
+
+std::string FormatTime(uint64_t timestampMs) {
+    time_t seconds = static_cast<time_t>(timestampMs / 1000);
+    std::tm utc = {};
+#ifdef _WIN32
+    gmtime_s(&utc, &seconds);
+#else
+    gmtime_r(&seconds, &utc);
+#endif
+    char buffer[40];
+    snprintf(buffer, sizeof(buffer), "%04d-%02d-%02d %02d:%02d:%02d.%03d",
+             utc.tm_year + 1900, utc.tm_mon + 1, utc.tm_mday,
+             utc.tm_hour, utc.tm_min, utc.tm_sec,
+             static_cast<int>(timestampMs % 1000));
+    return buffer;
+}
+
+// ---- Segment reading ----
+
+struct Segment {
+    std::string path;
+    BinaryLogFileHeader header = {};
+    uint64_t fileSize = 0;
+    std::vector<std::string> templates;   // Indexed by template ID
+    std::vector<IndexChunk> chunks;
+};
+
+bool ReadHeader(std::ifstream& file, Segment& segment) {
+    file.seekg(0, std::ios::end);
+    segment.fileSize = static_cast<uint64_t>(file.tellg());
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char*>(&segment.header), sizeof(segment.header))) {
+        return false;
+    }
+    if (segment.header.magic != BINARY_LOG_MAGIC) {
+        fprintf(stderr, "%s: not an RMBL binary log\n", segment.path.c_str());
+        return false;
+    }
+    if (segment.header.version != BINARY_LOG_VERSION) {
+        fprintf(stderr, "%s: unsupported format version %u\n",
+                segment.path.c_str(), segment.header.version);
+        return false;
+    }
+    return true;
+}
+
+// Registers a template definition record's payload into the table
+void CaptureTemplate(Segment& segment, const std::vector<char>& payload) {
+    if (payload.size() < sizeof(uint32_t)) return;
+    uint32_t definedId = 0;
+    memcpy(&definedId, payload.data(), sizeof(definedId));
+    if (segment.templates.size() <= definedId) {
+        segment.templates.resize(definedId + 1);
+    }
+    segment.templates[definedId].assign(payload.data() + sizeof(definedId),
+                                        payload.size() - sizeof(definedId));
+}
+
+// Full sequential pass: collects the template table and (optionally)
+// builds the chunk summaries. This is the only code path that reads a
+// whole segment; queries reuse its output through the sidecar.
+bool ScanSegment(Segment& segment, bool buildChunks) {
+    std::ifstream file(segment.path, std::ios::binary);
+    if (!file.is_open()) {
+        fprintf(stderr, "%s: cannot open\n", segment.path.c_str());
+        return false;
+    }
+    if (!ReadHeader(file, segment)) return false;
+
+    IndexChunk chunk = {};
+    chunk.startOffset = sizeof(BinaryLogFileHeader);
+    chunk.minTimestamp = UINT64_MAX;
+
+    BinaryLogRecord record;
+    std::vector<char> payload;
+    uint64_t offset = sizeof(BinaryLogFileHeader);
+
+    while (file.read(reinterpret_cast<char*>(&record), sizeof(record))) {
+        payload.resize(record.argBytes);
+        if (record.argBytes > 0 &&
+            !file.read(payload.data(), record.argBytes)) {
+            break;   // Truncated tail (crash mid-write): index what we have
+        }
+
+        if (record.templateId == TEMPLATE_DEF_ID) {
+            CaptureTemplate(segment, payload);
+        } else if (buildChunks) {
+            if (record.timestamp < chunk.minTimestamp) chunk.minTimestamp = record.timestamp;
+            if (record.timestamp > chunk.maxTimestamp) chunk.maxTimestamp = record.timestamp;
+            if (record.level < NUM_LEVELS) chunk.levelMask |= 1u << record.level;
+            chunk.recordCount++;
+
+            if (chunk.recordCount == CHUNK_RECORDS) {
+                segment.chunks.push_back(chunk);
+                chunk = {};
+                chunk.startOffset = offset + sizeof(record) + record.argBytes;
+                chunk.minTimestamp = UINT64_MAX;
+            }
+        }
+        offset += sizeof(record) + record.argBytes;
+    }
+
+    if (buildChunks && chunk.recordCount > 0) {
+        segment.chunks.push_back(chunk);
+    }
+    return true;
+}
+
+std::string IndexPathFor(const std::string& logPath) {
+    return logPath + ".rmlidx";
+}
+
+bool WriteIndex(const Segment& segment) {
+    std::ofstream file(IndexPathFor(segment.path), std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        fprintf(stderr, "%s: cannot write index\n", IndexPathFor(segment.path).c_str());
+        return false;
+    }
+
+    IndexHeader header = {};
+    header.magic = INDEX_MAGIC;
+    header.version = INDEX_VERSION;
+    header.sourceSize = segment.fileSize;
+    header.sourceCreated = segment.header.createdTimestamp;
+    header.chunkCount = static_cast<uint32_t>(segment.chunks.size());
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(segment.chunks.data()),
+               static_cast<std::streamsize>(segment.chunks.size() * sizeof(IndexChunk)));
+    return file.good();
+}
+
+// Loads the sidecar if it matches the segment's current size and header
+// timestamp; stale or missing sidecars report false and the caller
+// rebuilds
+bool LoadIndex(Segment& segment) {
+    std::ifstream file(IndexPathFor(segment.path), std::ios::binary);
+    if (!file.is_open()) return false;
+
+    IndexHeader header;
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header))) return false;
+    if (header.magic != INDEX_MAGIC || header.version != INDEX_VERSION) return false;
+    if (header.sourceSize != segment.fileSize ||
+        header.sourceCreated != segment.header.createdTimestamp) {
+        return false;   // Segment grew or was rotated since indexing
+    }
+
+    segment.chunks.resize(header.chunkCount);
+    return static_cast<bool>(file.read(
+        reinterpret_cast<char*>(segment.chunks.data()),
+        static_cast<std::streamsize>(header.chunkCount * sizeof(IndexChunk))));
+}
+
+// ---- Rendering ----
+
+// Argument bytes carry no type tags (the writer packs trivially
+// copyable values raw), so rendering shows the template text verbatim
+// with the payload as hex; placeholder substitution needs type info the
+// format deliberately omits from the hot path
+void RenderRecord(const Segment& segment, const BinaryLogRecord& record,
+                  const std::vector<char>& payload) {
+    const std::string& templateText =
+        record.templateId < segment.templates.size() && !segment.templates[record.templateId].empty()
+            ? segment.templates[record.templateId]
+            : "<template " + std::to_string(record.templateId) + ">";
+    const char* levelName =
+        record.level < NUM_LEVELS ? LEVEL_NAMES[record.level] : "?";
+
+    printf("[%s] [%s] [tid %u] %s", FormatTime(record.timestamp).c_str(),
+           levelName, record.threadId, templateText.c_str());
+    if (record.line != 0) {
+        printf(" (line %u)", record.line);
+    }
+    if (!payload.empty()) {
+        printf(" |");
+        for (char byte : payload) {
+            printf(" %02x", static_cast<unsigned char>(byte));
+        }
+    }
+    printf("\n");
+}
+
+// ---- Query execution ----
+
+uint64_t QuerySegment(Segment& segment, const QueryFilter& filter, uint64_t remaining) {
+    std::ifstream file(segment.path, std::ios::binary);
+    if (!file.is_open()) return 0;
+
+    const uint32_t levelMask = MaskFromMinLevel(filter.minLevel);
+    uint64_t matched = 0;
+    BinaryLogRecord record;
+    std::vector<char> payload;
+
+    for (const IndexChunk& chunk : segment.chunks) {
+        if (matched >= remaining) break;
+        if (chunk.maxTimestamp < filter.fromMs || chunk.minTimestamp > filter.toMs) continue;
+        if ((chunk.levelMask & levelMask) == 0) continue;
+
+        file.clear();
+        file.seekg(static_cast<std::streamoff>(chunk.startOffset));
+        for (uint32_t i = 0; i < chunk.recordCount && matched < remaining; ) {
+            if (!file.read(reinterpret_cast<char*>(&record), sizeof(record))) break;
+            payload.resize(record.argBytes);
+            if (record.argBytes > 0 && !file.read(payload.data(), record.argBytes)) break;
+
+            // Template definitions interleave with entries and are not
+            // counted by the chunk summaries
+            if (record.templateId == TEMPLATE_DEF_ID) continue;
+            ++i;
+
+            if (record.timestamp < filter.fromMs || record.timestamp > filter.toMs) continue;
+            if (record.level < filter.minLevel) continue;
+            if (!filter.grep.empty()) {
+                const std::string* templateText =
+                    record.templateId < segment.templates.size()
+                        ? &segment.templates[record.templateId] : nullptr;
+                if (!templateText || templateText->find(filter.grep) == std::string::npos) {
+                    continue;
+                }
+            }
+
+            RenderRecord(segment, record, payload);
+            ++matched;
+        }
+    }
+    return matched;
+}
+
+bool PrepareSegment(Segment& segment, bool forceReindex) {
+    // The template table always needs a pass over definition records;
+    // chunks come from the sidecar when it is fresh
+    std::ifstream probe(segment.path, std::ios::binary);
+    if (!probe.is_open()) {
+        fprintf(stderr, "%s: cannot open\n", segment.path.c_str());
+        return false;
+    }
+    if (!ReadHeader(probe, segment)) return false;
+    probe.close();
+
+    if (!forceReindex && LoadIndex(segment)) {
+        // Sidecar hit: only definition records still need reading, and
+        // they cluster at segment start right after the header
+        return ScanSegment(segment, false);
+    }
+
+    if (!ScanSegment(segment, true)) return false;
+    WriteIndex(segment);
+    return true;
+}
+
+int Usage() {
+    fprintf(stderr,
+            "usage: rmlog_query index <log> [<log>...]\n"
+            "       rmlog_query query [--from t] [--to t] [--level L] [--grep s] [--limit n] <log>...\n"
+            "       rmlog_query dump <log> [<log>...]\n");
+    return 2;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 3) return Usage();
+    const std::string command = argv[1];
+
+    QueryFilter filter;
+    std::vector<std::string> paths;
+
+    for (int arg = 2; arg < argc; ++arg) {
+        const std::string text = argv[arg];
+        if (command == "query" && text.rfind("--", 0) == 0 && arg + 1 < argc) {
+            const std::string value = argv[++arg];
+            if (text == "--from") {
+                if (!ParseTime(value, filter.fromMs)) {
+                    fprintf(stderr, "bad --from time: %s\n", value.c_str());
+                    return 2;
+                }
+            } else if (text == "--to") {
+                if (!ParseTime(value, filter.toMs)) {
+                    fprintf(stderr, "bad --to time: %s\n", value.c_str());
+                    return 2;
+                }
+            } else if (text == "--level") {
+                if (!ParseLevel(value, filter.minLevel)) {
+                    fprintf(stderr, "bad --level (TRACE..FATAL): %s\n", value.c_str());
+                    return 2;
+                }
+            } else if (text == "--grep") {
+                filter.grep = value;
+            } else if (text == "--limit") {
+                filter.limit = std::strtoull(value.c_str(), nullptr, 10);
+            } else {
+                return Usage();
+            }
+        } else {
+            paths.push_back(text);
+        }
+    }
+    if (paths.empty()) return Usage();
+
+    uint64_t totalMatched = 0;
+    for (const std::string& path : paths) {
+        Segment segment;
+        segment.path = path;
+
+        if (command == "index") {
+            if (!PrepareSegment(segment, true)) return 1;
+            uint64_t records = 0;
+            for (const IndexChunk& chunk : segment.chunks) records += chunk.recordCount;
+            printf("%s: %zu chunks, %llu records -> %s\n", path.c_str(),
+                   segment.chunks.size(), static_cast<unsigned long long>(records),
+                   IndexPathFor(path).c_str());
+        } else if (command == "query" || command == "dump") {
+            if (!PrepareSegment(segment, false)) return 1;
+            if (totalMatched >= filter.limit) break;
+            totalMatched += QuerySegment(segment, filter, filter.limit - totalMatched);
+        } else {
+            return Usage();
+        }
+    }
+
+    if (command == "query") {
+        fprintf(stderr, "%llu record(s) matched\n",
+                static_cast<unsigned long long>(totalMatched));
+    }
+    return 0;
+}